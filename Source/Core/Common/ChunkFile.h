@@ -241,6 +241,10 @@ public:
     return previous_pointer;
   }
 
+  // Returns the current position in the buffer. Once the data has been written, this is where the
+  // data that is done next can be found.
+  u8* GetPointer() const { return *m_ptr_current; }
+
   u32 GetOffsetFromPreviousPosition(u8* previous_pointer)
   {
     return static_cast<u32>((*m_ptr_current) - previous_pointer);
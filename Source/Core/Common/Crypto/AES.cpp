@@ -30,6 +30,16 @@
 
 namespace Common::AES
 {
+bool Context::CryptMultiple(std::span<const Buffer> buffers, size_t len) const
+{
+  for (const Buffer& buffer : buffers)
+  {
+    if (!Crypt(buffer.iv, buffer.in, buffer.out, len))
+      return false;
+  }
+  return true;
+}
+
 // For x64 and arm64, it's very unlikely a user's cpu does not support the accelerated version,
 // fallback is just in case.
 template <Mode AesMode>
@@ -204,6 +214,67 @@ public:
       _mm_storeu_si128(&((__m128i*)buf_out)[d], block[d]);
   }
 
+  // Encrypts one block of each buffer per step. Each buffer is its own dependency chain, so the
+  // rounds of the different buffers overlap in the pipeline like in DecryptPipelined.
+  template <size_t NumBuffers>
+  ATTRIBUTE_TARGET("aes")
+  inline void EncryptInterleaved(const Buffer* buffers, size_t len) const
+  {
+    __m128i iv[NumBuffers];
+    for (size_t d = 0; d < NumBuffers; d++)
+    {
+      iv[d] = buffers[d].iv ? _mm_loadu_si128((const __m128i*)buffers[d].iv) :
+                              _mm_setzero_si128();
+    }
+
+    for (size_t offset = 0; offset < len; offset += BLOCK_SIZE)
+    {
+      __m128i block[NumBuffers];
+      for (size_t d = 0; d < NumBuffers; d++)
+      {
+        block[d] = _mm_loadu_si128((const __m128i*)(buffers[d].in + offset));
+        block[d] = _mm_xor_si128(_mm_xor_si128(block[d], iv[d]), round_keys[0]);
+      }
+
+      for (size_t i = 1; i < Nr; ++i)
+        for (size_t d = 0; d < NumBuffers; d++)
+          block[d] = _mm_aesenc_si128(block[d], round_keys[i]);
+      for (size_t d = 0; d < NumBuffers; d++)
+        block[d] = _mm_aesenclast_si128(block[d], round_keys[Nr]);
+
+      for (size_t d = 0; d < NumBuffers; d++)
+      {
+        iv[d] = block[d];
+        _mm_storeu_si128((__m128i*)(buffers[d].out + offset), block[d]);
+      }
+    }
+  }
+
+  bool CryptMultiple(std::span<const Buffer> buffers, size_t len) const override
+  {
+    // Decryption is already pipelined within each buffer
+    if constexpr (AesMode == Mode::Decrypt)
+      return Context::CryptMultiple(buffers, len);
+
+    if (len % BLOCK_SIZE)
+      return false;
+
+    // Unlike for decryption, the round keys are shared between all the buffers, so the depth is
+    // kept a bit lower to leave registers for them.
+    constexpr size_t BUFFER_DEPTH = 8;
+    size_t i = 0;
+    for (; buffers.size() - i >= BUFFER_DEPTH; i += BUFFER_DEPTH)
+      EncryptInterleaved<BUFFER_DEPTH>(&buffers[i], len);
+    for (; buffers.size() - i >= 4; i += 4)
+      EncryptInterleaved<4>(&buffers[i], len);
+    for (; buffers.size() - i >= 2; i += 2)
+      EncryptInterleaved<2>(&buffers[i], len);
+    for (; i < buffers.size(); ++i)
+      EncryptInterleaved<1>(&buffers[i], len);
+
+    return true;
+  }
+
   bool Crypt(const u8* iv, u8* iv_out, const u8* buf_in, u8* buf_out, size_t len) const override
   {
     if (len % BLOCK_SIZE)
@@ -359,6 +430,77 @@ public:
     vst1q_u8(buf_out, block);
   }
 
+  // Processes one block of each buffer per step. CryptBlock has a long dependency chain within a
+  // buffer, which this hides by working on several independent buffers at once.
+  template <size_t NumBuffers>
+  inline void CryptInterleaved(const Buffer* buffers, size_t len) const
+  {
+    uint8x16_t iv[NumBuffers];
+    for (size_t d = 0; d < NumBuffers; d++)
+      iv[d] = buffers[d].iv ? vld1q_u8(buffers[d].iv) : vmovq_n_u8(0);
+
+    for (size_t offset = 0; offset < len; offset += BLOCK_SIZE)
+    {
+      uint8x16_t block[NumBuffers];
+      for (size_t d = 0; d < NumBuffers; d++)
+        block[d] = vld1q_u8(buffers[d].in + offset);
+
+      if constexpr (AesMode == Mode::Encrypt)
+      {
+        for (size_t d = 0; d < NumBuffers; d++)
+          block[d] = veorq_u8(block[d], iv[d]);
+
+        for (size_t i = 0; i < Nr - 1; ++i)
+          for (size_t d = 0; d < NumBuffers; d++)
+            block[d] = vaesmcq_u8(vaeseq_u8(block[d], round_keys[i]));
+        for (size_t d = 0; d < NumBuffers; d++)
+        {
+          block[d] = veorq_u8(vaeseq_u8(block[d], round_keys[Nr - 1]), round_keys[Nr]);
+          iv[d] = block[d];
+        }
+      }
+      else
+      {
+        uint8x16_t iv_next[NumBuffers];
+        for (size_t d = 0; d < NumBuffers; d++)
+          iv_next[d] = block[d];
+
+        for (size_t i = 0; i < Nr - 1; ++i)
+          for (size_t d = 0; d < NumBuffers; d++)
+            block[d] = vaesimcq_u8(vaesdq_u8(block[d], round_keys[i]));
+        for (size_t d = 0; d < NumBuffers; d++)
+        {
+          block[d] = veorq_u8(vaesdq_u8(block[d], round_keys[Nr - 1]), round_keys[Nr]);
+          block[d] = veorq_u8(block[d], iv[d]);
+          iv[d] = iv_next[d];
+        }
+      }
+
+      for (size_t d = 0; d < NumBuffers; d++)
+        vst1q_u8(buffers[d].out + offset, block[d]);
+    }
+  }
+
+  virtual bool CryptMultiple(std::span<const Buffer> buffers, size_t len) const override
+  {
+    if (len % BLOCK_SIZE)
+      return false;
+
+    // 11 round keys are live in addition to the blocks, out of 32 vector registers
+    constexpr size_t BUFFER_DEPTH = 8;
+    size_t i = 0;
+    for (; buffers.size() - i >= BUFFER_DEPTH; i += BUFFER_DEPTH)
+      CryptInterleaved<BUFFER_DEPTH>(&buffers[i], len);
+    for (; buffers.size() - i >= 4; i += 4)
+      CryptInterleaved<4>(&buffers[i], len);
+    for (; buffers.size() - i >= 2; i += 2)
+      CryptInterleaved<2>(&buffers[i], len);
+    for (; i < buffers.size(); ++i)
+      CryptInterleaved<1>(&buffers[i], len);
+
+    return true;
+  }
+
   virtual bool Crypt(const u8* iv, u8* iv_out, const u8* buf_in, u8* buf_out,
                      size_t len) const override
   {
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 
 #include "Common/CommonTypes.h"
 
@@ -30,6 +31,14 @@ public:
   static constexpr size_t KEY_SIZE = Nk * WORD_SIZE;
   static constexpr size_t BLOCK_SIZE = Nb * WORD_SIZE;
 
+  // One of the independent buffers processed by CryptMultiple.
+  struct Buffer
+  {
+    const u8* iv;  // nullptr means an IV of zero
+    const u8* in;
+    u8* out;
+  };
+
   Context() = default;
   virtual ~Context() = default;
   virtual bool Crypt(const u8* iv, u8* iv_out, const u8* buf_in, u8* buf_out, size_t len) const = 0;
@@ -41,6 +50,11 @@ public:
   {
     return Crypt(nullptr, nullptr, buf_in, buf_out, len);
   }
+
+  // Processes several buffers of the same length, each with its own IV. The blocks of a single
+  // buffer can't be encrypted in parallel with CBC, but the blocks of separate buffers can, so
+  // this is much faster than calling Crypt for each buffer when hardware AES is available.
+  virtual bool CryptMultiple(std::span<const Buffer> buffers, size_t len) const;
 };
 
 std::unique_ptr<Context> CreateContextEncrypt(const u8* key);
@@ -5,7 +5,10 @@
 
 #include <algorithm>
 #include <array>
+#include <climits>
+#include <cstring>
 #include <memory>
+#include <span>
 
 #include <fmt/ranges.h>
 #include <mbedtls/sha1.h>
@@ -59,12 +62,13 @@ private:
   mbedtls_sha1_context ctx{};
 };
 
+static constexpr size_t BLOCK_LEN = 64;
+static constexpr u32 K[4]{0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xca62c1d6};
+static constexpr u32 H[5]{0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+
 class BlockContext : public Context
 {
 protected:
-  static constexpr size_t BLOCK_LEN = 64;
-  static constexpr u32 K[4]{0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xca62c1d6};
-  static constexpr u32 H[5]{0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
 
   virtual void ProcessBlock(const u8* msg) = 0;
   virtual Digest GetDigest() = 0;
@@ -155,20 +159,11 @@ private:
 
 #ifdef _M_X86_64
 
-// Uses the dedicated SHA1 instructions. Normal SSE(AVX*) would be needed for parallel
-// multi-message processing. While Dolphin could gain from such implementation, it requires the
-// calling code to be modified and/or making the SHA1 implementation asynchronous so it can
-// optimistically batch.
+// Uses the dedicated SHA1 instructions. ProcessBlocks can also work on several messages at once
+// for CalculateDigests, which hides the latency of the SHA1 instructions.
 class ContextX64SHA1 final : public BlockContext
 {
 public:
-  ContextX64SHA1()
-  {
-    state[0] = _mm_set_epi32(H[0], H[1], H[2], H[3]);
-    state[1] = _mm_set_epi32(H[4], 0, 0, 0);
-  }
-
-private:
   struct XmmReg
   {
     // Allows aliasing attributes to be respected in the
@@ -182,6 +177,55 @@ private:
     }
     operator __m128i() const { return data; }
   };
+  // 0: abcd, 1: e
+  using State = std::array<XmmReg, 2>;
+
+  ContextX64SHA1() : state(InitialState()) {}
+
+  static State InitialState()
+  {
+    return {{{_mm_set_epi32(H[0], H[1], H[2], H[3])}, {_mm_set_epi32(H[4], 0, 0, 0)}}};
+  }
+
+  // Processes one block of each of NumMsgs messages. The rounds of the messages are interleaved,
+  // as each message is a long dependency chain of its own.
+  template <size_t NumMsgs>
+  ATTRIBUTE_TARGET("sha")
+  static void ProcessBlocks(State* states, const u8* const* msgs)
+  {
+    // There are 80 rounds with 4 bytes per round, giving 0x140 byte work space, but we can keep
+    // active state in just 0x40 bytes.
+    // see FIPS 180-4 6.1.3 Alternate Method for Computing a SHA-1 Message Digest
+    std::array<WorkBlock, NumMsgs> w;
+    std::array<State, NumMsgs> abcde;
+    for (size_t m = 0; m < NumMsgs; m++)
+    {
+      auto msg_block = (const __m128i*)msgs[m];
+      for (size_t i = 0; i < w[m].size(); i++)
+        w[m][i] = byterev_16B(_mm_loadu_si128(&msg_block[i]));
+      abcde[m] = states[m];
+    }
+
+    InterleavedRounds<0>(&w, &abcde);
+
+    // state += abcde
+    for (size_t m = 0; m < NumMsgs; m++)
+    {
+      states[m][1] = _mm_sha1nexte_epu32(abcde[m][1], states[m][1]);
+      states[m][0] = _mm_add_epi32(abcde[m][0], states[m][0]);
+    }
+  }
+
+  static Digest GetDigest(const State& state)
+  {
+    Digest digest;
+    _mm_storeu_si128((__m128i*)&digest[0], byterev_16B(state[0]));
+    u32 hi = _mm_cvtsi128_si32(byterev_16B(state[1]));
+    std::memcpy(&digest[sizeof(__m128i)], &hi, sizeof(hi));
+    return digest;
+  }
+
+private:
   using WorkBlock = CyclicArray<XmmReg, 4>;
 
   ATTRIBUTE_TARGET("ssse3")
@@ -204,63 +248,134 @@ private:
     return wx;
   }
 
+  // Does 4 rounds for every message, then recurses for the next 4. sha1rnds4 requires the round
+  // function as an imm8 arg, which is why this isn't a plain loop.
+  template <size_t Round, size_t NumMsgs>
   ATTRIBUTE_TARGET("sha")
-  void ProcessBlock(const u8* msg) override
+  static inline void InterleavedRounds(std::array<WorkBlock, NumMsgs>* w,
+                                       std::array<State, NumMsgs>* abcde)
   {
-    // There are 80 rounds with 4 bytes per round, giving 0x140 byte work space, but we can keep
-    // active state in just 0x40 bytes.
-    // see FIPS 180-4 6.1.3 Alternate Method for Computing a SHA-1 Message Digest
-    WorkBlock w;
-    auto msg_block = (const __m128i*)msg;
-    for (size_t i = 0; i < w.size(); i++)
-      w[i] = byterev_16B(_mm_loadu_si128(&msg_block[i]));
-
-    // 0: abcd, 1: e
-    auto abcde = state;
-
-    // Not sure of a (non-ugly) way to have constant-evaluated for-loop, so just rely on inlining.
-    // Problem is that sha1rnds4 requires imm8 arg, and first/last rounds have different behavior.
-
-    // clang-format off
-    // E0 += MSG0, special case of "nexte", can do normal add
-    abcde[1] = _mm_sha1rnds4_epu32(abcde[0], _mm_add_epi32(abcde[1], w[0]), 0);
-    abcde[0] = _mm_sha1rnds4_epu32(abcde[1], _mm_sha1nexte_epu32(abcde[0], w[1]), 0);
-    abcde[1] = _mm_sha1rnds4_epu32(abcde[0], _mm_sha1nexte_epu32(abcde[1], w[2]), 0);
-    abcde[0] = _mm_sha1rnds4_epu32(abcde[1], _mm_sha1nexte_epu32(abcde[0], w[3]), 0);
-    abcde[1] = _mm_sha1rnds4_epu32(abcde[0], _mm_sha1nexte_epu32(abcde[1], MsgSchedule<4>(&w)), 0);
-    abcde[0] = _mm_sha1rnds4_epu32(abcde[1], _mm_sha1nexte_epu32(abcde[0], MsgSchedule<5>(&w)), 1);
-    abcde[1] = _mm_sha1rnds4_epu32(abcde[0], _mm_sha1nexte_epu32(abcde[1], MsgSchedule<6>(&w)), 1);
-    abcde[0] = _mm_sha1rnds4_epu32(abcde[1], _mm_sha1nexte_epu32(abcde[0], MsgSchedule<7>(&w)), 1);
-    abcde[1] = _mm_sha1rnds4_epu32(abcde[0], _mm_sha1nexte_epu32(abcde[1], MsgSchedule<8>(&w)), 1);
-    abcde[0] = _mm_sha1rnds4_epu32(abcde[1], _mm_sha1nexte_epu32(abcde[0], MsgSchedule<9>(&w)), 1);
-    abcde[1] = _mm_sha1rnds4_epu32(abcde[0], _mm_sha1nexte_epu32(abcde[1], MsgSchedule<10>(&w)), 2);
-    abcde[0] = _mm_sha1rnds4_epu32(abcde[1], _mm_sha1nexte_epu32(abcde[0], MsgSchedule<11>(&w)), 2);
-    abcde[1] = _mm_sha1rnds4_epu32(abcde[0], _mm_sha1nexte_epu32(abcde[1], MsgSchedule<12>(&w)), 2);
-    abcde[0] = _mm_sha1rnds4_epu32(abcde[1], _mm_sha1nexte_epu32(abcde[0], MsgSchedule<13>(&w)), 2);
-    abcde[1] = _mm_sha1rnds4_epu32(abcde[0], _mm_sha1nexte_epu32(abcde[1], MsgSchedule<14>(&w)), 2);
-    abcde[0] = _mm_sha1rnds4_epu32(abcde[1], _mm_sha1nexte_epu32(abcde[0], MsgSchedule<15>(&w)), 3);
-    abcde[1] = _mm_sha1rnds4_epu32(abcde[0], _mm_sha1nexte_epu32(abcde[1], MsgSchedule<16>(&w)), 3);
-    abcde[0] = _mm_sha1rnds4_epu32(abcde[1], _mm_sha1nexte_epu32(abcde[0], MsgSchedule<17>(&w)), 3);
-    abcde[1] = _mm_sha1rnds4_epu32(abcde[0], _mm_sha1nexte_epu32(abcde[1], MsgSchedule<18>(&w)), 3);
-    abcde[0] = _mm_sha1rnds4_epu32(abcde[1], _mm_sha1nexte_epu32(abcde[0], MsgSchedule<19>(&w)), 3);
-    // state += abcde
-    state[1] = _mm_sha1nexte_epu32(abcde[1], state[1]);
-    state[0] = _mm_add_epi32(abcde[0], state[0]);
-    // clang-format on
+    // The rounds alternate between updating abcde[1] and abcde[0]
+    constexpr size_t dst = (Round + 1) % 2;
+    constexpr size_t src = Round % 2;
+
+    for (size_t m = 0; m < NumMsgs; m++)
+    {
+      __m128i msg;
+      if constexpr (Round < 4)
+        msg = (*w)[m][Round];
+      else
+        msg = MsgSchedule<Round>(&(*w)[m]);
+
+      auto& state = (*abcde)[m];
+      // E0 += MSG0, special case of "nexte", can do normal add
+      const __m128i e = Round == 0 ? _mm_add_epi32(state[dst], msg) :
+                                     _mm_sha1nexte_epu32(state[dst], msg);
+      state[dst] = _mm_sha1rnds4_epu32(state[src], e, Round / 5);
+    }
+
+    if constexpr (Round + 1 < 20)
+      InterleavedRounds<Round + 1>(w, abcde);
   }
 
-  Digest GetDigest() override
+  ATTRIBUTE_TARGET("sha")
+  void ProcessBlock(const u8* msg) override { ProcessBlocks<1>(&state, &msg); }
+
+  Digest GetDigest() override { return GetDigest(state); }
+
+  bool HwAccelerated() const override { return true; }
+
+  State state{};
+};
+
+// Hashes 8 messages at once, one in each 32-bit lane, for CPUs without the SHA1 instructions.
+class MultiBufferAVX2
+{
+public:
+  static constexpr size_t NUM_MSGS = 8;
+
+  MultiBufferAVX2()
+  {
+    for (size_t i = 0; i < state.size(); i++)
+      state[i].fill(H[i]);
+  }
+
+  ATTRIBUTE_TARGET("avx2")
+  void ProcessBlocks(const u8* const* msgs)
+  {
+    __m256i w[16];
+    for (size_t i = 0; i < 16; i++)
+    {
+      alignas(32) std::array<u32, NUM_MSGS> words;
+      for (size_t m = 0; m < NUM_MSGS; m++)
+        words[m] = Common::swap32(msgs[m] + i * sizeof(u32));
+      w[i] = _mm256_load_si256((const __m256i*)words.data());
+    }
+
+    __m256i a = _mm256_load_si256((const __m256i*)state[0].data());
+    __m256i b = _mm256_load_si256((const __m256i*)state[1].data());
+    __m256i c = _mm256_load_si256((const __m256i*)state[2].data());
+    __m256i d = _mm256_load_si256((const __m256i*)state[3].data());
+    __m256i e = _mm256_load_si256((const __m256i*)state[4].data());
+
+    for (size_t t = 0; t < 80; t++)
+    {
+      // w[t % 16] holds w[t - 16] until it's replaced here
+      __m256i& wt = w[t % 16];
+      if (t >= 16)
+      {
+        wt = Rotl<1>(_mm256_xor_si256(_mm256_xor_si256(w[(t - 3) % 16], w[(t - 8) % 16]),
+                                      _mm256_xor_si256(w[(t - 14) % 16], wt)));
+      }
+
+      __m256i f;
+      if (t < 20)
+        f = _mm256_or_si256(_mm256_and_si256(b, c), _mm256_andnot_si256(b, d));
+      else if (t < 40 || t >= 60)
+        f = _mm256_xor_si256(_mm256_xor_si256(b, c), d);
+      else
+        f = _mm256_or_si256(_mm256_and_si256(b, c), _mm256_and_si256(d, _mm256_or_si256(b, c)));
+
+      const __m256i temp = _mm256_add_epi32(
+          _mm256_add_epi32(Rotl<5>(a), f),
+          _mm256_add_epi32(_mm256_add_epi32(e, _mm256_set1_epi32(K[t / 20])), wt));
+      e = d;
+      d = c;
+      c = Rotl<30>(b);
+      b = a;
+      a = temp;
+    }
+
+    const __m256i result[5]{a, b, c, d, e};
+    for (size_t i = 0; i < state.size(); i++)
+    {
+      const __m256i sum =
+          _mm256_add_epi32(_mm256_load_si256((const __m256i*)state[i].data()), result[i]);
+      _mm256_store_si256((__m256i*)state[i].data(), sum);
+    }
+  }
+
+  Digest GetDigest(size_t msg) const
   {
     Digest digest;
-    _mm_storeu_si128((__m128i*)&digest[0], byterev_16B(state[0]));
-    u32 hi = _mm_cvtsi128_si32(byterev_16B(state[1]));
-    std::memcpy(&digest[sizeof(__m128i)], &hi, sizeof(hi));
+    for (size_t i = 0; i < state.size(); i++)
+    {
+      const u32 word = Common::swap32(state[i][msg]);
+      std::memcpy(&digest[i * sizeof(u32)], &word, sizeof(word));
+    }
     return digest;
   }
 
-  bool HwAccelerated() const override { return true; }
+private:
+  template <int Count>
+  ATTRIBUTE_TARGET("avx2")
+  static inline __m256i Rotl(__m256i x)
+  {
+    return _mm256_or_si256(_mm256_slli_epi32(x, Count), _mm256_srli_epi32(x, 32 - Count));
+  }
 
-  std::array<XmmReg, 2> state{};
+  // Each row holds one of the five state words for all the messages
+  alignas(32) std::array<std::array<u32, NUM_MSGS>, 5> state;
 };
 
 #endif
@@ -270,15 +385,6 @@ private:
 class ContextNeon final : public BlockContext
 {
 public:
-  ContextNeon()
-  {
-    state.abcd = vld1q_u32(&H[0]);
-    state.e = H[4];
-  }
-
-private:
-  using WorkBlock = CyclicArray<uint32x4_t, 4>;
-
   struct State
   {
     // ARM thought they were being clever by exposing e as u32, but it actually makes non-asm
@@ -287,6 +393,45 @@ private:
     u32 e{};
   };
 
+  ContextNeon() : state(InitialState()) {}
+
+  static State InitialState() { return {vld1q_u32(&H[0]), H[4]}; }
+
+  // Processes one block of each of NumMsgs messages. The rounds of the messages are interleaved,
+  // as each message is a long dependency chain of its own.
+  template <size_t NumMsgs>
+  static void ProcessBlocks(State* states_in, const u8* const* msgs)
+  {
+    std::array<WorkBlock, NumMsgs> w;
+    std::array<std::array<State, 2>, NumMsgs> states;
+    for (size_t m = 0; m < NumMsgs; m++)
+    {
+      for (size_t i = 0; i < w[m].size(); i++)
+        w[m][i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&msgs[m][sizeof(uint32x4_t) * i])));
+      states[m][0] = states_in[m];
+    }
+
+    InterleavedRounds<0>(&w, &states);
+
+    for (size_t m = 0; m < NumMsgs; m++)
+    {
+      states_in[m] = {vaddq_u32(states_in[m].abcd, states[m][0].abcd),
+                      states_in[m].e + states[m][0].e};
+    }
+  }
+
+  static Digest GetDigest(const State& state)
+  {
+    Digest digest;
+    vst1q_u8(&digest[0], vrev32q_u8(vreinterpretq_u8_u32(state.abcd)));
+    u32 e = Common::FromBigEndian(state.e);
+    std::memcpy(&digest[sizeof(state.abcd)], &e, sizeof(e));
+    return digest;
+  }
+
+private:
+  using WorkBlock = CyclicArray<uint32x4_t, 4>;
+
   static inline uint32x4_t MsgSchedule(WorkBlock* wblock, size_t i)
   {
     auto& w = *wblock;
@@ -315,49 +460,31 @@ private:
     return {f<Func>(state, w), vsha1h_u32(vgetq_lane_u32(state.abcd, 0))};
   }
 
-  virtual void ProcessBlock(const u8* msg) override
+  // Does 4 rounds for every message, then recurses for the next 4.
+  // Fashioned to look like x64 impl.
+  // In each case the goal is to have compiler inline + unroll everything.
+  template <size_t Round, size_t NumMsgs>
+  static inline void InterleavedRounds(std::array<WorkBlock, NumMsgs>* w,
+                                       std::array<std::array<State, 2>, NumMsgs>* states)
   {
-    WorkBlock w;
-    for (size_t i = 0; i < w.size(); i++)
-      w[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&msg[sizeof(uint32x4_t) * i])));
-
-    std::array<State, 2> states{state};
-
-    // Fashioned to look like x64 impl.
-    // In each case the goal is to have compiler inline + unroll everything.
-    states[1] = FourRounds<0>(states[0], w[0]);
-    states[0] = FourRounds<0>(states[1], w[1]);
-    states[1] = FourRounds<0>(states[0], w[2]);
-    states[0] = FourRounds<0>(states[1], w[3]);
-    states[1] = FourRounds<0>(states[0], MsgSchedule(&w, 4));
-    states[0] = FourRounds<1>(states[1], MsgSchedule(&w, 5));
-    states[1] = FourRounds<1>(states[0], MsgSchedule(&w, 6));
-    states[0] = FourRounds<1>(states[1], MsgSchedule(&w, 7));
-    states[1] = FourRounds<1>(states[0], MsgSchedule(&w, 8));
-    states[0] = FourRounds<1>(states[1], MsgSchedule(&w, 9));
-    states[1] = FourRounds<2>(states[0], MsgSchedule(&w, 10));
-    states[0] = FourRounds<2>(states[1], MsgSchedule(&w, 11));
-    states[1] = FourRounds<2>(states[0], MsgSchedule(&w, 12));
-    states[0] = FourRounds<2>(states[1], MsgSchedule(&w, 13));
-    states[1] = FourRounds<2>(states[0], MsgSchedule(&w, 14));
-    states[0] = FourRounds<3>(states[1], MsgSchedule(&w, 15));
-    states[1] = FourRounds<3>(states[0], MsgSchedule(&w, 16));
-    states[0] = FourRounds<3>(states[1], MsgSchedule(&w, 17));
-    states[1] = FourRounds<3>(states[0], MsgSchedule(&w, 18));
-    states[0] = FourRounds<3>(states[1], MsgSchedule(&w, 19));
-
-    state = {vaddq_u32(state.abcd, states[0].abcd), state.e + states[0].e};
-  }
+    // The rounds alternate between updating states[1] and states[0]
+    constexpr size_t dst = (Round + 1) % 2;
+    constexpr size_t src = Round % 2;
 
-  virtual Digest GetDigest() override
-  {
-    Digest digest;
-    vst1q_u8(&digest[0], vrev32q_u8(vreinterpretq_u8_u32(state.abcd)));
-    u32 e = Common::FromBigEndian(state.e);
-    std::memcpy(&digest[sizeof(state.abcd)], &e, sizeof(e));
-    return digest;
+    for (size_t m = 0; m < NumMsgs; m++)
+    {
+      const uint32x4_t msg = Round < 4 ? (*w)[m][Round] : MsgSchedule(&(*w)[m], Round);
+      (*states)[m][dst] = FourRounds<Round / 5>((*states)[m][src], msg);
+    }
+
+    if constexpr (Round + 1 < 20)
+      InterleavedRounds<Round + 1>(w, states);
   }
 
+  virtual void ProcessBlock(const u8* msg) override { ProcessBlocks<1>(&state, &msg); }
+
+  virtual Digest GetDigest() override { return GetDigest(state); }
+
   virtual bool HwAccelerated() const override { return true; }
 
   State state;
@@ -365,6 +492,82 @@ private:
 
 #endif
 
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+
+// Lets CalculateDigests use the static block functions of a hardware context on several messages.
+template <typename HwContext, size_t NumMsgs>
+class MultiBuffer
+{
+public:
+  static constexpr size_t NUM_MSGS = NumMsgs;
+
+  MultiBuffer() { states.fill(HwContext::InitialState()); }
+
+  void ProcessBlocks(const u8* const* msgs)
+  {
+    HwContext::template ProcessBlocks<NumMsgs>(states.data(), msgs);
+  }
+
+  Digest GetDigest(size_t msg) const { return HwContext::GetDigest(states[msg]); }
+
+private:
+  std::array<typename HwContext::State, NumMsgs> states;
+};
+
+// Hashes the messages in sets of Impl::NUM_MSGS. As all the messages have the same length, they
+// also all need the same number of blocks, including the padding at the end.
+template <typename Impl>
+static void CalculateDigestsInterleaved(std::span<const u8* const> msgs, size_t len,
+                                        Digest* digests)
+{
+  constexpr size_t NUM_MSGS = Impl::NUM_MSGS;
+
+  const size_t full_blocks = len / BLOCK_LEN;
+  const size_t tail_len = len % BLOCK_LEN;
+  const size_t tail_blocks = tail_len + 1 + sizeof(u64) > BLOCK_LEN ? 2 : 1;
+  const Common::BigEndianValue<u64> msg_bit_length{u64(len) * CHAR_BIT};
+
+  for (size_t first = 0; first < msgs.size(); first += NUM_MSGS)
+  {
+    const size_t count = std::min(NUM_MSGS, msgs.size() - first);
+
+    // Unused slots hash the last message again, and their digests are thrown away
+    std::array<const u8*, NUM_MSGS> msg_ptrs;
+    for (size_t m = 0; m < NUM_MSGS; m++)
+      msg_ptrs[m] = msgs[first + std::min(m, count - 1)];
+
+    Impl impl;
+    std::array<const u8*, NUM_MSGS> blocks;
+    for (size_t i = 0; i < full_blocks; i++)
+    {
+      for (size_t m = 0; m < NUM_MSGS; m++)
+        blocks[m] = msg_ptrs[m] + i * BLOCK_LEN;
+      impl.ProcessBlocks(blocks.data());
+    }
+
+    alignas(64) std::array<std::array<u8, BLOCK_LEN * 2>, NUM_MSGS> tails{};
+    for (size_t m = 0; m < NUM_MSGS; m++)
+    {
+      u8* tail = tails[m].data();
+      std::copy_n(msg_ptrs[m] + full_blocks * BLOCK_LEN, tail_len, tail);
+      tail[tail_len] = 0x80;
+      std::memcpy(tail + tail_blocks * BLOCK_LEN - sizeof(msg_bit_length), &msg_bit_length,
+                  sizeof(msg_bit_length));
+    }
+    for (size_t i = 0; i < tail_blocks; i++)
+    {
+      for (size_t m = 0; m < NUM_MSGS; m++)
+        blocks[m] = tails[m].data() + i * BLOCK_LEN;
+      impl.ProcessBlocks(blocks.data());
+    }
+
+    for (size_t m = 0; m < count; m++)
+      digests[first + m] = impl.GetDigest(m);
+  }
+}
+
+#endif
+
 std::unique_ptr<Context> CreateContext()
 {
   if (cpu_info.bSHA1)
@@ -389,6 +592,27 @@ Digest CalculateDigest(const u8* msg, size_t len)
   return ctx->Finish();
 }
 
+void CalculateDigests(std::span<const u8* const> msgs, size_t len, Digest* digests)
+{
+  if (cpu_info.bSHA1)
+  {
+#ifdef _M_X86_64
+    if (cpu_info.bSSSE3)
+      return CalculateDigestsInterleaved<MultiBuffer<ContextX64SHA1, 2>>(msgs, len, digests);
+#elif defined(_M_ARM_64)
+    return CalculateDigestsInterleaved<MultiBuffer<ContextNeon, 2>>(msgs, len, digests);
+#endif
+  }
+
+#ifdef _M_X86_64
+  if (cpu_info.bAVX2)
+    return CalculateDigestsInterleaved<MultiBufferAVX2>(msgs, len, digests);
+#endif
+
+  for (size_t i = 0; i < msgs.size(); i++)
+    digests[i] = CalculateDigest(msgs[i], len);
+}
+
 std::string DigestToString(const Digest& digest)
 {
   return fmt::format("{:02X}", fmt::join(digest, ""));
@@ -37,6 +37,10 @@ std::unique_ptr<Context> CreateContext();
 
 Digest CalculateDigest(const u8* msg, size_t len);
 
+// Calculates the digests of several messages of the same length. Independent messages can be
+// hashed side by side on one core, so this is faster than calling CalculateDigest for each one.
+void CalculateDigests(std::span<const u8* const> msgs, size_t len, Digest* digests);
+
 template <typename T>
 inline Digest CalculateDigest(const std::vector<T>& msg)
 {
@@ -0,0 +1,179 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// A multimap from u64 keys which are already hashes (e.g. texture hashes), stored in a single
+// array with open addressing and linear probing. Compared to std::multimap, lookups touch a few
+// adjacent slots instead of chasing pointers through a tree, and inserting or erasing doesn't
+// allocate unless the table has to grow.
+//
+// Erasing uses backward shifting rather than tombstones, so lookups never get slower over time.
+// Values with the same key are visited in no particular order.
+template <typename Value>
+class FlatHashMultiMap
+{
+public:
+  FlatHashMultiMap() = default;
+
+  // Returns the inserted value, which stays valid until the map is next modified.
+  Value& Insert(u64 key, Value value)
+  {
+    if ((m_size + 1) * 4 > m_slots.size() * 3)
+      Rehash(m_slots.empty() ? MIN_CAPACITY : m_slots.size() * 2);
+
+    size_t i = HomeSlot(key);
+    while (m_slots[i].occupied)
+      i = (i + 1) & m_mask;
+
+    m_slots[i] = {key, std::move(value), true};
+    ++m_size;
+    return m_slots[i].value;
+  }
+
+  // Grows the table so that count values fit without growing it again.
+  void Reserve(size_t count)
+  {
+    size_t capacity = std::max(m_slots.size(), MIN_CAPACITY);
+    while (count * 4 > capacity * 3)
+      capacity *= 2;
+    if (capacity != m_slots.size())
+      Rehash(capacity);
+  }
+
+  // Returns the first value stored under key for which pred returns true, or nullptr.
+  // pred must not modify the map.
+  template <typename Pred>
+  Value* FindIf(u64 key, Pred pred)
+  {
+    const size_t i = FindSlot(key, std::move(pred));
+    return i != m_slots.size() ? &m_slots[i].value : nullptr;
+  }
+
+  // Erases the first value stored under key for which pred returns true.
+  template <typename Pred>
+  bool EraseIf(u64 key, Pred pred)
+  {
+    const size_t i = FindSlot(key, std::move(pred));
+    if (i == m_slots.size())
+      return false;
+
+    EraseSlot(i);
+    return true;
+  }
+
+  // Calls func(key, value) for every entry. func must not insert or erase values.
+  template <typename Func>
+  void ForEach(Func func) const
+  {
+    for (const Slot& slot : m_slots)
+    {
+      if (slot.occupied)
+        func(slot.key, slot.value);
+    }
+  }
+
+  template <typename Func>
+  void ForEach(Func func)
+  {
+    for (Slot& slot : m_slots)
+    {
+      if (slot.occupied)
+        func(slot.key, slot.value);
+    }
+  }
+
+  void Clear()
+  {
+    m_slots.clear();
+    m_mask = 0;
+    m_shift = 64;
+    m_size = 0;
+  }
+
+  size_t Size() const { return m_size; }
+  bool Empty() const { return m_size == 0; }
+
+private:
+  struct Slot
+  {
+    u64 key = 0;
+    Value value{};
+    bool occupied = false;
+  };
+
+  static constexpr size_t MIN_CAPACITY = 64;
+
+  size_t HomeSlot(u64 key) const
+  {
+    // Fibonacci hashing, as keys which are hashes of similar data may still share their low bits.
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> m_shift);
+  }
+
+  // Returns m_slots.size() if there is no matching value.
+  template <typename Pred>
+  size_t FindSlot(u64 key, Pred pred)
+  {
+    if (m_size == 0)
+      return m_slots.size();
+
+    for (size_t i = HomeSlot(key); m_slots[i].occupied; i = (i + 1) & m_mask)
+    {
+      if (m_slots[i].key == key && pred(m_slots[i].value))
+        return i;
+    }
+    return m_slots.size();
+  }
+
+  // capacity must be a power of two
+  void Rehash(size_t capacity)
+  {
+    std::vector<Slot> old_slots = std::move(m_slots);
+
+    m_slots = std::vector<Slot>(capacity);
+    m_mask = capacity - 1;
+    m_shift = 64 - std::countr_zero(capacity);
+    m_size = 0;
+
+    for (Slot& slot : old_slots)
+    {
+      if (slot.occupied)
+        Insert(slot.key, std::move(slot.value));
+    }
+  }
+
+  void EraseSlot(size_t hole)
+  {
+    // Move later entries of the probe sequence back into the hole, unless that would move them
+    // before their home slot.
+    for (size_t i = (hole + 1) & m_mask; m_slots[i].occupied; i = (i + 1) & m_mask)
+    {
+      const size_t home = HomeSlot(m_slots[i].key);
+      const bool can_move = hole <= i ? (home <= hole || home > i) : (home <= hole && home > i);
+      if (can_move)
+      {
+        m_slots[hole] = std::move(m_slots[i]);
+        hole = i;
+      }
+    }
+
+    m_slots[hole] = Slot();
+    --m_size;
+  }
+
+  std::vector<Slot> m_slots;
+  size_t m_mask = 0;
+  int m_shift = 64;
+  size_t m_size = 0;
+};
+}  // namespace Common
@@ -0,0 +1,357 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/IOUring.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define HAVE_IO_URING 1
+#endif
+
+#ifdef HAVE_IO_URING
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#endif
+
+namespace Common
+{
+#ifdef HAVE_IO_URING
+
+// The kernel limits how much a single read can return, so larger reads are split up.
+constexpr u64 MAX_READ_SIZE = 1 << 30;
+
+static int SetUp(u32 entries, io_uring_params* params)
+{
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+static int Enter(int fd, u32 to_submit, u32 min_complete, u32 flags)
+{
+  int result;
+  do
+  {
+    result = static_cast<int>(
+        syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+  } while (result < 0 && errno == EINTR);
+  return result;
+}
+
+// The submission and completion rings, which are shared with the kernel. The application only
+// writes the tail of the submission ring and the head of the completion ring.
+struct IOUringReader::Ring
+{
+  ~Ring()
+  {
+    if (sqes != MAP_FAILED)
+      munmap(sqes, sqes_size);
+    if (cq_ring != MAP_FAILED && cq_ring != sq_ring)
+      munmap(cq_ring, cq_ring_size);
+    if (sq_ring != MAP_FAILED)
+      munmap(sq_ring, sq_ring_size);
+    if (fd >= 0)
+      close(fd);
+  }
+
+  int fd = -1;
+  u32 entries = 0;
+
+  void* sq_ring = MAP_FAILED;
+  size_t sq_ring_size = 0;
+  void* cq_ring = MAP_FAILED;
+  size_t cq_ring_size = 0;
+  io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+  size_t sqes_size = 0;
+
+  u32* sq_tail = nullptr;
+  u32 sq_mask = 0;
+  u32* sq_array = nullptr;
+
+  u32* cq_head = nullptr;
+  u32* cq_tail = nullptr;
+  u32 cq_mask = 0;
+  io_uring_cqe* cqes = nullptr;
+};
+
+struct IOUringReader::Request
+{
+  int fd;
+  u64 offset;
+  u8* out_ptr;
+  u64 size;
+  Callback callback;
+};
+
+std::unique_ptr<IOUringReader> IOUringReader::Create(u32 queue_depth)
+{
+  auto ring = std::make_unique<Ring>();
+
+  io_uring_params params{};
+  ring->fd = SetUp(queue_depth, &params);
+  if (ring->fd < 0)
+  {
+    INFO_LOG_FMT(COMMON, "io_uring is not available: {}", std::strerror(errno));
+    return nullptr;
+  }
+
+  // IORING_OP_READ was added in the same kernel version as this feature flag
+  if (!(params.features & IORING_FEAT_RW_CUR_POS))
+  {
+    INFO_LOG_FMT(COMMON, "io_uring doesn't support IORING_OP_READ");
+    return nullptr;
+  }
+
+  ring->entries = params.sq_entries;
+  ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(u32);
+  ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+  const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap)
+    ring->sq_ring_size = ring->cq_ring_size = std::max(ring->sq_ring_size, ring->cq_ring_size);
+
+  ring->sq_ring = mmap(nullptr, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+  if (ring->sq_ring == MAP_FAILED)
+    return nullptr;
+
+  if (single_mmap)
+  {
+    ring->cq_ring = ring->sq_ring;
+  }
+  else
+  {
+    ring->cq_ring = mmap(nullptr, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+    if (ring->cq_ring == MAP_FAILED)
+      return nullptr;
+  }
+
+  ring->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  ring->sqes = static_cast<io_uring_sqe*>(mmap(nullptr, ring->sqes_size, PROT_READ | PROT_WRITE,
+                                               MAP_SHARED | MAP_POPULATE, ring->fd,
+                                               IORING_OFF_SQES));
+  if (ring->sqes == MAP_FAILED)
+    return nullptr;
+
+  u8* sq_ring = static_cast<u8*>(ring->sq_ring);
+  ring->sq_tail = reinterpret_cast<u32*>(sq_ring + params.sq_off.tail);
+  ring->sq_mask = *reinterpret_cast<u32*>(sq_ring + params.sq_off.ring_mask);
+  ring->sq_array = reinterpret_cast<u32*>(sq_ring + params.sq_off.array);
+
+  u8* cq_ring = static_cast<u8*>(ring->cq_ring);
+  ring->cq_head = reinterpret_cast<u32*>(cq_ring + params.cq_off.head);
+  ring->cq_tail = reinterpret_cast<u32*>(cq_ring + params.cq_off.tail);
+  ring->cq_mask = *reinterpret_cast<u32*>(cq_ring + params.cq_off.ring_mask);
+  ring->cqes = reinterpret_cast<io_uring_cqe*>(cq_ring + params.cq_off.cqes);
+
+  return std::unique_ptr<IOUringReader>(new IOUringReader(std::move(ring)));
+}
+
+IOUringReader::IOUringReader(std::unique_ptr<Ring> ring) : m_ring(std::move(ring))
+{
+  m_completion_thread = std::thread(&IOUringReader::CompletionThread, this);
+}
+
+IOUringReader::~IOUringReader()
+{
+  WaitForReads();
+
+  // A request without user data tells the completion thread to exit
+  {
+    std::lock_guard lk(m_mutex);
+    if (!Submit(nullptr))
+      ERROR_LOG_FMT(COMMON, "Failed to stop the io_uring completion thread");
+  }
+  m_completion_thread.join();
+}
+
+void IOUringReader::Read(int fd, u64 offset, u8* out_ptr, u64 size, Callback callback)
+{
+  if (size == 0)
+  {
+    callback(true);
+    return;
+  }
+
+  auto request = std::make_unique<Request>(fd, offset, out_ptr, size, std::move(callback));
+
+  std::unique_lock lk(m_mutex);
+  m_read_finished.wait(lk, [this] { return m_reads_in_flight < m_ring->entries; });
+
+  if (!Submit(request.get()))
+  {
+    lk.unlock();
+    request->callback(false);
+    return;
+  }
+
+  ++m_reads_in_flight;
+  request.release();
+}
+
+void IOUringReader::WaitForReads()
+{
+  std::unique_lock lk(m_mutex);
+  m_read_finished.wait(lk, [this] { return m_reads_in_flight == 0; });
+}
+
+void IOUringReader::SimulateSubmitFailures(u32 count)
+{
+  std::lock_guard lk(m_mutex);
+  m_simulated_submit_failures = count;
+}
+
+bool IOUringReader::Submit(Request* request)
+{
+  // Every submission is handed to the kernel right away, so the submission ring is always empty
+  // at this point and the tail can't overtake the head.
+  const u32 tail = *m_ring->sq_tail;
+  const u32 index = tail & m_ring->sq_mask;
+
+  io_uring_sqe& sqe = m_ring->sqes[index];
+  std::memset(&sqe, 0, sizeof(sqe));
+  if (request)
+  {
+    sqe.opcode = IORING_OP_READ;
+    sqe.fd = request->fd;
+    sqe.off = request->offset;
+    sqe.addr = reinterpret_cast<u64>(request->out_ptr);
+    sqe.len = static_cast<u32>(std::min(request->size, MAX_READ_SIZE));
+  }
+  else
+  {
+    sqe.opcode = IORING_OP_NOP;
+  }
+  sqe.user_data = reinterpret_cast<u64>(request);
+
+  m_ring->sq_array[index] = index;
+  std::atomic_ref(*m_ring->sq_tail).store(tail + 1, std::memory_order_release);
+
+  int submitted;
+  if (m_simulated_submit_failures != 0)
+  {
+    --m_simulated_submit_failures;
+    submitted = -1;
+    errno = EAGAIN;
+  }
+  else
+  {
+    submitted = Enter(m_ring->fd, 1, 0, 0);
+  }
+  if (submitted == 1)
+    return true;
+
+  WARN_LOG_FMT(COMMON, "Failed to submit to io_uring: {}",
+               submitted < 0 ? std::strerror(errno) : "nothing submitted");
+
+  // The kernel didn't consume the entry, so take it back out of the submission ring. Otherwise the
+  // next submission would hand it to the kernel, with the user data of a request that the caller
+  // frees after this fails.
+  std::atomic_ref(*m_ring->sq_tail).store(tail, std::memory_order_release);
+  return false;
+}
+
+void IOUringReader::Finish(std::unique_ptr<Request> request, bool success)
+{
+  request->callback(success);
+
+  {
+    std::lock_guard lk(m_mutex);
+    --m_reads_in_flight;
+  }
+  m_read_finished.notify_all();
+}
+
+void IOUringReader::CompletionThread()
+{
+  Common::SetCurrentThreadName("io_uring Completion");
+
+  while (true)
+  {
+    if (Enter(m_ring->fd, 0, 1, IORING_ENTER_GETEVENTS) < 0)
+    {
+      ERROR_LOG_FMT(COMMON, "Failed to wait for io_uring completions: {}", std::strerror(errno));
+      return;
+    }
+
+    u32 head = *m_ring->cq_head;
+    const u32 tail = std::atomic_ref(*m_ring->cq_tail).load(std::memory_order_acquire);
+    for (; head != tail; ++head)
+    {
+      const io_uring_cqe& cqe = m_ring->cqes[head & m_ring->cq_mask];
+      std::unique_ptr<Request> request(reinterpret_cast<Request*>(cqe.user_data));
+      const s32 result = cqe.res;
+      std::atomic_ref(*m_ring->cq_head).store(head + 1, std::memory_order_release);
+
+      if (!request)
+        return;
+
+      const bool retry = result == -EINTR || result == -EAGAIN;
+      if (retry || (result > 0 && static_cast<u64>(result) < request->size))
+      {
+        // Read the rest (or try again) with the same request
+        if (!retry)
+        {
+          request->offset += result;
+          request->out_ptr += result;
+          request->size -= result;
+        }
+
+        bool submitted;
+        {
+          std::lock_guard lk(m_mutex);
+          submitted = Submit(request.get());
+        }
+        if (submitted)
+          request.release();
+        else
+          Finish(std::move(request), false);
+        continue;
+      }
+
+      const bool success = result >= 0 && static_cast<u64>(result) == request->size;
+      Finish(std::move(request), success);
+    }
+  }
+}
+
+#else
+
+struct IOUringReader::Ring
+{
+};
+
+struct IOUringReader::Request
+{
+};
+
+std::unique_ptr<IOUringReader> IOUringReader::Create(u32 queue_depth)
+{
+  return nullptr;
+}
+
+IOUringReader::~IOUringReader() = default;
+
+void IOUringReader::Read(int fd, u64 offset, u8* out_ptr, u64 size, Callback callback)
+{
+  callback(false);
+}
+
+void IOUringReader::WaitForReads()
+{
+}
+
+void IOUringReader::SimulateSubmitFailures(u32 count)
+{
+}
+
+#endif
+}  // namespace Common
@@ -0,0 +1,61 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Reads from files through an io_uring, so that several reads can be in flight at once without
+// a thread for each of them. io_uring only exists on Linux and may also be disabled by the kernel
+// or a sandbox, so Create can return nullptr and callers need another way of reading.
+class IOUringReader final
+{
+public:
+  using Callback = std::function<void(bool success)>;
+
+  static std::unique_ptr<IOUringReader> Create(u32 queue_depth);
+  ~IOUringReader();
+
+  IOUringReader(const IOUringReader&) = delete;
+  IOUringReader& operator=(const IOUringReader&) = delete;
+
+  // Reads size bytes at offset of the file descriptor into out_ptr, then calls callback on the
+  // completion thread. Blocks while queue_depth reads are already in flight.
+  void Read(int fd, u64 offset, u8* out_ptr, u64 size, Callback callback);
+
+  // Blocks until all reads have finished and their callbacks have returned.
+  void WaitForReads();
+
+  // Makes the next count submissions fail like io_uring_enter does when the kernel is out of
+  // resources, so that tests can check how failed submissions are handled.
+  void SimulateSubmitFailures(u32 count);
+
+private:
+  struct Ring;
+  struct Request;
+
+  explicit IOUringReader(std::unique_ptr<Ring> ring);
+
+  // m_mutex must be held when calling this.
+  bool Submit(Request* request);
+  void Finish(std::unique_ptr<Request> request, bool success);
+  void CompletionThread();
+
+  std::unique_ptr<Ring> m_ring;
+
+  std::mutex m_mutex;
+  std::condition_variable m_read_finished;
+  u32 m_reads_in_flight = 0;
+  u32 m_simulated_submit_failures = 0;
+
+  std::thread m_completion_thread;
+};
+}  // namespace Common
@@ -0,0 +1,120 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Common/CommonFuncs.h"
+#include "Common/Logging/Log.h"
+#ifdef _WIN32
+#include "Common/StringUtil.h"
+#endif
+
+namespace File
+{
+MappedFile::MappedFile(const std::string& filename)
+{
+  Open(filename);
+}
+
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+bool MappedFile::Open(const std::string& filename)
+{
+  Close();
+
+#ifdef _WIN32
+  const HANDLE file = CreateFileW(UTF8ToWString(filename).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to open {} for mapping: {}", filename,
+                  Common::GetLastErrorString());
+    return false;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  // The mapping keeps the file open, so the handle can be closed right away.
+  m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!m_mapping)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map {}: {}", filename, Common::GetLastErrorString());
+    return false;
+  }
+
+  m_data = static_cast<const u8*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+  if (!m_data)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map {}: {}", filename, Common::GetLastErrorString());
+    CloseHandle(m_mapping);
+    m_mapping = nullptr;
+    return false;
+  }
+  m_size = static_cast<size_t>(size.QuadPart);
+#else
+  const int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to open {} for mapping: {}", filename,
+                  Common::LastStrerrorString());
+    return false;
+  }
+
+  struct stat file_info;
+  if (fstat(fd, &file_info) != 0 || file_info.st_size == 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  // The mapping keeps the file open, so the descriptor can be closed right away.
+  void* const data = mmap(nullptr, file_info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map {}: {}", filename, Common::LastStrerrorString());
+    return false;
+  }
+
+  m_data = static_cast<const u8*>(data);
+  m_size = static_cast<size_t>(file_info.st_size);
+#endif
+
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (!m_data)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(m_data);
+  CloseHandle(m_mapping);
+  m_mapping = nullptr;
+#else
+  munmap(const_cast<u8*>(m_data), m_size);
+#endif
+
+  m_data = nullptr;
+  m_size = 0;
+}
+}  // namespace File
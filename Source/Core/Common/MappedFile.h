@@ -0,0 +1,39 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+// A file which is mapped into memory read-only, so that its contents can be accessed without
+// reading them into a buffer first. The data is paged in by the OS as it is accessed.
+class MappedFile
+{
+public:
+  MappedFile() = default;
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  bool Open(const std::string& filename);
+  void Close();
+
+  bool IsOpen() const { return m_data != nullptr; }
+  std::span<const u8> GetData() const { return {m_data, m_size}; }
+
+private:
+  const u8* m_data = nullptr;
+  size_t m_size = 0;
+
+#ifdef _WIN32
+  void* m_mapping = nullptr;
+#endif
+};
+}  // namespace File
@@ -0,0 +1,152 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "Common/CPUDetect.h"
+#include "Common/Thread.h"
+
+namespace Common
+{
+ThreadPool::ThreadPool(std::string name, u32 num_threads)
+{
+  Reset(std::move(name), num_threads);
+}
+
+ThreadPool::~ThreadPool()
+{
+  Shutdown();
+}
+
+void ThreadPool::Reset(std::string name, u32 num_threads)
+{
+  Shutdown();
+
+  m_shutting_down = false;
+  m_threads.reserve(num_threads);
+  for (u32 i = 0; i < num_threads; ++i)
+    m_threads.emplace_back(&ThreadPool::ThreadLoop, this, name);
+}
+
+void ThreadPool::Shutdown()
+{
+  if (m_threads.empty())
+    return;
+
+  {
+    std::lock_guard lk(m_mutex);
+    m_shutting_down = true;
+  }
+  m_work_available.notify_all();
+
+  for (std::thread& thread : m_threads)
+    thread.join();
+  m_threads.clear();
+}
+
+void ThreadPool::Push(FunctionType function)
+{
+  if (m_threads.empty())
+  {
+    function();
+    return;
+  }
+
+  {
+    std::lock_guard lk(m_mutex);
+    m_queue.push_back(std::move(function));
+  }
+  m_work_available.notify_one();
+}
+
+void ThreadPool::Cancel()
+{
+  std::lock_guard lk(m_mutex);
+  m_queue.clear();
+  if (m_busy_workers == 0)
+    m_work_done.notify_all();
+}
+
+void ThreadPool::WaitForCompletion()
+{
+  std::unique_lock lk(m_mutex);
+  m_work_done.wait(lk, [this] { return m_queue.empty() && m_busy_workers == 0; });
+}
+
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)>& function)
+{
+  if (count == 0)
+    return;
+
+  // Note: This must not be called from one of this pool's own workers, as the helpers pushed
+  // below could then be stuck in the queue behind the caller forever.
+  struct SharedState
+  {
+    std::atomic<size_t> next_index = 0;
+    std::mutex mutex;
+    std::condition_variable done;
+    size_t running_helpers = 0;
+  } state;
+
+  const auto run = [&] {
+    for (size_t i = state.next_index++; i < count; i = state.next_index++)
+      function(i);
+  };
+
+  const size_t helpers = std::min<size_t>(count - 1, m_threads.size());
+  state.running_helpers = helpers;
+  for (size_t i = 0; i < helpers; ++i)
+  {
+    Push([&] {
+      run();
+
+      std::lock_guard lk(state.mutex);
+      if (--state.running_helpers == 0)
+        state.done.notify_one();
+    });
+  }
+
+  run();
+
+  std::unique_lock lk(state.mutex);
+  state.done.wait(lk, [&] { return state.running_helpers == 0; });
+}
+
+u32 ThreadPool::GetAutomaticThreadCount()
+{
+  const int cores = cpu_info.num_cores > 0 ? cpu_info.num_cores :
+                                             static_cast<int>(std::thread::hardware_concurrency());
+  return static_cast<u32>(std::max(cores - 1, 1));
+}
+
+void ThreadPool::ThreadLoop(const std::string& name)
+{
+  Common::SetCurrentThreadName(name.c_str());
+
+  std::unique_lock lk(m_mutex);
+  while (true)
+  {
+    m_work_available.wait(lk, [this] { return m_shutting_down || !m_queue.empty(); });
+
+    // Remaining work is finished before shutting down.
+    if (m_queue.empty())
+      return;
+
+    FunctionType function = std::move(m_queue.front());
+    m_queue.pop_front();
+    ++m_busy_workers;
+
+    lk.unlock();
+    function();
+    lk.lock();
+
+    --m_busy_workers;
+    if (m_queue.empty() && m_busy_workers == 0)
+      m_work_done.notify_all();
+  }
+}
+}  // namespace Common
@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// A fixed number of worker threads which run pushed functions in no particular order.
+// Unlike WorkQueueThread, several items may be processed at the same time, so the pushed
+// functions are responsible for any synchronization between each other.
+class ThreadPool final
+{
+public:
+  using FunctionType = std::function<void()>;
+
+  ThreadPool() = default;
+  ThreadPool(std::string name, u32 num_threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // Shuts the current workers down (if any) and starts num_threads new ones.
+  // Starting zero threads is valid; pushed work is then run inline by the pushing thread.
+  void Reset(std::string name, u32 num_threads);
+
+  // Finishes all queued work and then stops the workers.
+  void Shutdown();
+
+  // Adds a function to the queue. Runs it immediately if the pool has no threads.
+  void Push(FunctionType function);
+
+  // Drops all work that hasn't been started yet.
+  void Cancel();
+
+  // Blocks until the queue is empty and no worker is busy.
+  void WaitForCompletion();
+
+  // Calls function(i) for every i in [0, count), spread across the workers and the calling
+  // thread, and returns once all calls have returned. Other work in the queue is not waited for.
+  void ParallelFor(size_t count, const std::function<void(size_t)>& function);
+
+  u32 GetThreadCount() const { return static_cast<u32>(m_threads.size()); }
+  bool IsRunning() const { return !m_threads.empty(); }
+
+  // Returns a thread count for an automatic (negative) setting, leaving one core for the thread
+  // that is submitting the work.
+  static u32 GetAutomaticThreadCount();
+
+private:
+  void ThreadLoop(const std::string& name);
+
+  std::vector<std::thread> m_threads;
+
+  std::mutex m_mutex;
+  std::condition_variable m_work_available;
+  std::condition_variable m_work_done;
+  std::deque<FunctionType> m_queue;
+  size_t m_busy_workers = 0;
+  bool m_shutting_down = false;
+};
+}  // namespace Common
@@ -141,6 +141,7 @@ void CPUInfo::Detect()
   // Detect family and other misc stuff.
   bool is_amd_family_17 = false;
   bool has_sse = false;
+  bool has_avx512_state = false;
   if (func_id_max >= 1)
   {
     info = cpuid(1);
@@ -189,11 +190,15 @@ void CPUInfo::Detect()
     if (((info.ecx >> 28) & 1) && ((info.ecx >> 27) & 1))
     {
       // Check that XSAVE can be used for SSE and AVX
-      if ((xgetbv(XCR_XFEATURE_ENABLED_MASK) & 0b110) == 0b110)
+      const u64 enabled_features = xgetbv(XCR_XFEATURE_ENABLED_MASK);
+      if ((enabled_features & 0b110) == 0b110)
       {
         bAVX = true;
         if ((info.ecx >> 12) & 1)
           bFMA = true;
+
+        // AVX-512 additionally needs the opmask and upper ZMM state to be enabled
+        has_avx512_state = (enabled_features & 0b11100110) == 0b11100110;
       }
     }
 
@@ -202,6 +207,10 @@ void CPUInfo::Detect()
       info = cpuid(7);
       if ((info.ebx >> 3) & 1)
         bBMI1 = true;
+      if (((info.ebx >> 5) & 1) && bAVX)
+        bAVX2 = true;
+      if (((info.ebx >> 16) & 1) && has_avx512_state)
+        bAVX512F = true;
       if ((info.ebx >> 8) & 1)
         bBMI2 = true;
       if ((info.ebx >> 29) & 1)
@@ -260,6 +269,10 @@ std::string CPUInfo::Summarize()
     sum.push_back("HTT");
   if (bAVX)
     sum.push_back("AVX");
+  if (bAVX2)
+    sum.push_back("AVX2");
+  if (bAVX512F)
+    sum.push_back("AVX512F");
   if (bBMI1)
     sum.push_back("BMI1");
   if (bBMI2)
@@ -43,6 +43,11 @@ const Info<bool> MAIN_SKIP_IPL{{System::Main, "Core", "SkipIPL"}, true};
 const Info<PowerPC::CPUCore> MAIN_CPU_CORE{{System::Main, "Core", "CPUCore"},
                                            PowerPC::DefaultCPUCore()};
 const Info<bool> MAIN_JIT_FOLLOW_BRANCH{{System::Main, "Core", "JITFollowBranch"}, true};
+const Info<bool> MAIN_JIT_ANALYSIS_CACHE{{System::Main, "Core", "JITAnalysisCache"}, false};
+const Info<bool> MAIN_JIT_TIERED_COMPILATION{{System::Main, "Core", "JITTieredCompilation"},
+                                             false};
+const Info<bool> MAIN_JIT_INTERPRET_COLD_BLOCKS{{System::Main, "Core", "JITInterpretColdBlocks"},
+                                                false};
 const Info<bool> MAIN_FASTMEM{{System::Main, "Core", "Fastmem"}, true};
 const Info<bool> MAIN_PAGE_TABLE_FASTMEM{{System::Main, "Core", "PageTableFastmem"}, true};
 const Info<bool> MAIN_FASTMEM_ARENA{{System::Main, "Core", "FastmemArena"}, true};
@@ -282,6 +287,11 @@ const Info<DiscIO::Region> MAIN_FALLBACK_REGION{{System::Main, "Core", "Fallback
 const Info<bool> MAIN_AUTO_DISC_CHANGE{{System::Main, "Core", "AutoDiscChange"}, false};
 const Info<bool> MAIN_ALLOW_SD_WRITES{{System::Main, "Core", "WiiSDCardAllowWrites"}, true};
 const Info<bool> MAIN_ENABLE_SAVESTATES{{System::Main, "Core", "EnableSaveStates"}, false};
+const Info<SaveStateCompression> MAIN_SAVESTATE_COMPRESSION{
+    {System::Main, "Core", "SaveStateCompression"}, SaveStateCompression::LZ4};
+const Info<bool> MAIN_REWIND_ENABLED{{System::Main, "Core", "EnableRewind"}, false};
+const Info<u32> MAIN_REWIND_INTERVAL{{System::Main, "Core", "RewindInterval"}, 30};
+const Info<u32> MAIN_REWIND_MEMORY_BUDGET_MB{{System::Main, "Core", "RewindMemoryBudgetMB"}, 512};
 const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS{
     {System::Main, "Core", "RealWiiRemoteRepeatReports"}, true};
 const Info<bool> MAIN_WII_WIILINK_ENABLE{{System::Main, "Core", "EnableWiiLink"}, false};
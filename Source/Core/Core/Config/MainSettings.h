@@ -56,6 +56,9 @@ namespace Config
 extern const Info<bool> MAIN_SKIP_IPL;
 extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
+extern const Info<bool> MAIN_JIT_ANALYSIS_CACHE;
+extern const Info<bool> MAIN_JIT_TIERED_COMPILATION;
+extern const Info<bool> MAIN_JIT_INTERPRET_COLD_BLOCKS;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_PAGE_TABLE_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
@@ -163,6 +166,18 @@ extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
+
+enum class SaveStateCompression
+{
+  LZ4,
+  ChunkedLZ4,
+  ChunkedZstd,
+};
+extern const Info<SaveStateCompression> MAIN_SAVESTATE_COMPRESSION;
+extern const Info<bool> MAIN_REWIND_ENABLED;
+extern const Info<u32> MAIN_REWIND_INTERVAL;
+extern const Info<u32> MAIN_REWIND_MEMORY_BUDGET_MB;
+
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
 extern const Info<s32> MAIN_OVERRIDE_BOOT_IOS;
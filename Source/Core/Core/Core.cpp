@@ -915,6 +915,7 @@ void Callback_NewField(Core::System& system)
   }
 
   AchievementManager::GetInstance().DoFrame();
+  State::UpdateRewind(system);
 }
 
 void UpdateTitle(Core::System& system)
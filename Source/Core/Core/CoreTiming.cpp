@@ -130,6 +130,7 @@ void CoreTimingManager::Shutdown()
   MoveEvents();
   ClearPendingEvents();
   UnregisterAllEvents();
+  m_after_advance_functions.clear();
   CPUThreadConfigCallback::RemoveConfigChangedCallback(m_registered_config_callback_id);
   m_frame_hook.reset();
 }
@@ -385,6 +386,20 @@ void CoreTimingManager::Advance()
   // until the next slice:
   //        Pokemon Box refuses to boot if the first exception from the audio DMA is received late
   power_pc.CheckExternalExceptions();
+
+  if (!m_after_advance_functions.empty())
+  {
+    // Functions which are added by these run at the end of the next Advance
+    std::vector<Common::MoveOnlyFunction<void()>> functions;
+    std::swap(functions, m_after_advance_functions);
+    for (auto& function : functions)
+      function();
+  }
+}
+
+void CoreTimingManager::RunAfterAdvance(Common::MoveOnlyFunction<void()> function)
+{
+  m_after_advance_functions.push_back(std::move(function));
 }
 
 TimePoint CoreTimingManager::CalculateTargetHostTimeInternal(s64 target_cycle)
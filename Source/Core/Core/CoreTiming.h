@@ -133,6 +133,11 @@ public:
   void Advance();
   void MoveEvents();
 
+  // Runs the function on the CPU thread at the end of the current Advance, or of the next one when
+  // called outside of Advance. Event callbacks run before the timing state of the next slice is set
+  // up, so the state of the system can only be saved consistently from a function passed here.
+  void RunAfterAdvance(Common::MoveOnlyFunction<void()> function);
+
   // Pretend that the main CPU has executed enough cycles to reach the next event.
   void Idle();
 
@@ -203,6 +208,9 @@ private:
   // Are we in a function that has been called from Advance()
   bool m_is_global_timer_sane = false;
 
+  // Only accessed from the CPU thread
+  std::vector<Common::MoveOnlyFunction<void()>> m_after_advance_functions;
+
   EventType* m_ev_lost = nullptr;
 
   CPUThreadConfigCallback::ConfigChangedCallbackID m_registered_config_callback_id;
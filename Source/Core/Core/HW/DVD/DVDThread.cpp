@@ -13,7 +13,6 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
-#include "Common/SPSCQueue.h"
 #include "Common/Timer.h"
 
 #include "Core/ConfigManager.h"
@@ -52,8 +51,8 @@ void DVDThread::Stop()
 {
   m_dvd_thread.Cancel();
   m_dvd_thread.Shutdown();
+  WaitForReadsInFlight();
 
-  m_result_queue.Clear();
   m_result_map.clear();
 
   m_disc.reset();
@@ -61,16 +60,9 @@ void DVDThread::Stop()
 
 void DVDThread::DoState(PointerWrap& p)
 {
-  // Ensure all requests are completed with results Push'd to m_result_queue.
+  // Ensure all requests are completed with results in m_result_map.
   WaitUntilIdle();
 
-  // Move all results from result_queue to result_map because
-  // PointerWrap::Do supports std::map but not Common::WaitableSPSCQueue.
-  // This won't affect the behavior of FinishRead.
-  ReadResult result;
-  while (m_result_queue.Pop(result))
-    m_result_map.emplace(result.first.id, std::move(result));
-
   p.Do(m_result_map);
   p.Do(m_next_id);
 
@@ -175,6 +167,13 @@ void DVDThread::WaitUntilIdle()
   ASSERT(Core::IsCPUThread());
 
   m_dvd_thread.WaitForCompletion();
+  WaitForReadsInFlight();
+}
+
+void DVDThread::WaitForReadsInFlight()
+{
+  std::unique_lock lk(m_result_mutex);
+  m_result_changed.wait(lk, [this] { return m_reads_in_flight == 0; });
 }
 
 void DVDThread::StartRead(u64 dvd_offset, u32 length, const DiscIO::Partition& partition,
@@ -225,35 +224,17 @@ void DVDThread::GlobalFinishRead(Core::System& system, u64 id, s64 cycles_late)
 
 void DVDThread::FinishRead(u64 id, s64 cycles_late)
 {
-  // We can't simply pop result_queue and always get the ReadResult
-  // we want, because the DVD thread may add ReadResults to the queue
-  // in a different order than we want to get them. What we do instead
-  // is to pop the queue until we find the ReadResult we want (the one
-  // whose ID matches userdata), which means we may end up popping
-  // ReadResults that we don't want. We can't add those unwanted results
-  // back to the queue, because the queue can only have one writer.
-  // Instead, we add them to a map that only is used by the CPU thread.
-  // When this function is called again later, it will check the map for
-  // the wanted ReadResult before it starts searching through the queue.
+  // Reads can finish in a different order than they were started in, so wait until the result
+  // with the ID we want shows up.
   ReadResult result;
-  auto it = m_result_map.find(id);
-  if (it != m_result_map.end())
   {
+    std::unique_lock lk(m_result_mutex);
+    m_result_changed.wait(lk, [this, id] { return m_result_map.contains(id); });
+
+    auto it = m_result_map.find(id);
     result = std::move(it->second);
     m_result_map.erase(it);
   }
-  else
-  {
-    while (true)
-    {
-      m_result_queue.WaitForData();
-      m_result_queue.Pop(result);
-      if (result.first.id == id)
-        break;
-
-      m_result_map.emplace(result.first.id, std::move(result));
-    }
-  }
   // We have now obtained the right ReadResult.
 
   const ReadRequest& request = result.first;
@@ -297,12 +278,31 @@ void DVDThread::ProcessReadRequest(ReadRequest&& request)
 {
   m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
-  std::vector<u8> buffer(request.length);
-  if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
-    buffer.resize(0);
+  {
+    std::unique_lock lk(m_result_mutex);
+    m_result_changed.wait(lk, [this] { return m_reads_in_flight < MAX_READS_IN_FLIGHT; });
+    ++m_reads_in_flight;
+  }
+
+  const u64 dvd_offset = request.dvd_offset;
+  const u32 length = request.length;
+  const DiscIO::Partition partition = request.partition;
 
-  request.realtime_done_us = Common::Timer::NowUs();
+  auto result = std::make_shared<ReadResult>(std::move(request), std::vector<u8>(length));
+  u8* buffer = result->second.data();
 
-  m_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
+  m_disc->ReadAsync(dvd_offset, length, buffer, partition, [this, result](bool success) {
+    if (!success)
+      result->second.resize(0);
+
+    result->first.realtime_done_us = Common::Timer::NowUs();
+
+    {
+      std::lock_guard lk(m_result_mutex);
+      m_result_map.emplace(result->first.id, std::move(*result));
+      --m_reads_in_flight;
+    }
+    m_result_changed.notify_all();
+  });
 }
 }  // namespace DVD
@@ -3,14 +3,15 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/SPSCQueue.h"
 
 #include "Common/WorkQueueThread.h"
 #include "Core/HW/DVD/DVDInterface.h"
@@ -119,17 +120,25 @@ private:
   };
 
   void ProcessReadRequest(ReadRequest&& read_request);
+  void WaitForReadsInFlight();
 
   using ReadResult = std::pair<ReadRequest, std::vector<u8>>;
 
+  // The DVD thread starts reads asynchronously, so that a slow read doesn't hold up the ones
+  // after it. Past this many reads, it waits for one to finish before starting another.
+  static constexpr u32 MAX_READS_IN_FLIGHT = 8;
+
   CoreTiming::EventType* m_finish_read = nullptr;
 
   u64 m_next_id = 0;
 
   Common::WorkQueueThreadSP<ReadRequest> m_dvd_thread;
 
-  Common::WaitableSPSCQueue<ReadResult> m_result_queue;
+  // Finished reads, by ID. Reads finish on whichever thread the disc's reader completes them on.
+  std::mutex m_result_mutex;
+  std::condition_variable m_result_changed;
   std::map<u64, ReadResult> m_result_map;
+  u32 m_reads_in_flight = 0;
 
   std::unique_ptr<DiscIO::Volume> m_disc;
 
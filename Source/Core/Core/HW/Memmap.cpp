@@ -501,6 +501,8 @@ void MemoryManager::DoState(PointerWrap& p)
   const bool current_have_exram = !!m_exram;
   const u32 current_exram_size = current_have_exram ? GetExRamSize() : 0;
 
+  m_saved_state_regions = {};
+
   u32 state_ram_size = current_ram_size;
   u32 state_l1_cache_size = current_l1_cache_size;
   bool state_have_fake_vmem = current_have_fake_vmem;
@@ -530,14 +532,21 @@ void MemoryManager::DoState(PointerWrap& p)
     return;
   }
 
-  p.DoArray(m_ram, current_ram_size);
-  p.DoArray(m_l1_cache, current_l1_cache_size);
+  const auto do_region = [this, &p](size_t index, u8* data, u32 size) {
+    const u8* const position = p.GetPointer();
+    p.DoArray(data, size);
+    if (p.IsWriteMode())
+      m_saved_state_regions[index] = {position, size};
+  };
+
+  do_region(0, m_ram, current_ram_size);
+  do_region(1, m_l1_cache, current_l1_cache_size);
   p.DoMarker("Memory RAM");
   if (current_have_fake_vmem)
-    p.DoArray(m_fake_vmem, current_fake_vmem_size);
+    do_region(2, m_fake_vmem, current_fake_vmem_size);
   p.DoMarker("Memory FakeVMEM");
   if (current_have_exram)
-    p.DoArray(m_exram, current_exram_size);
+    do_region(3, m_exram, current_exram_size);
   p.DoMarker("Memory EXRAM");
 }
 
@@ -103,6 +103,12 @@ public:
   bool InitFastmemArena();
   void ShutdownFastmemArena();
   void DoState(PointerWrap& p);
+  // Where the most recent DoState call in write mode stored RAM, the L1 cache, fake VMEM and EXRAM
+  // (in that order) in the state data. Regions which weren't stored are empty.
+  const std::array<std::span<const u8>, 4>& GetSavedStateRegions() const
+  {
+    return m_saved_state_regions;
+  }
 
   void UpdateDBATMappings(const PowerPC::BatTable& dbat_table);
   void AddPageTableMapping(u32 logical_address, u32 translated_address, bool writeable);
@@ -194,6 +200,8 @@ private:
   u8* m_l1_cache = nullptr;
   u8* m_fake_vmem = nullptr;
 
+  std::array<std::span<const u8>, 4> m_saved_state_regions{};
+
   // m_ram_size is the amount allocated by the emulator, whereas m_ram_size_real
   // is what will be reported in lowmem, and thus used by emulated software.
   // Note: Writing to lowmem is done by IPL. If using retail IPL, it will
@@ -193,6 +193,17 @@ int Interpreter::SingleStepInner()
   return opinfo->num_cycles;
 }
 
+int Interpreter::SingleStepBlock()
+{
+  m_end_block = false;
+
+  int cycles = 0;
+  while (!m_end_block)
+    cycles += SingleStepInner();
+
+  return cycles;
+}
+
 void Interpreter::SingleStep()
 {
   auto& core_timing = m_system.GetCoreTiming();
@@ -36,6 +36,9 @@ public:
   void Shutdown() override;
   void SingleStep() override;
   int SingleStepInner();
+  // Runs instructions until one of them ends the block (a branch or an exception), and returns the
+  // number of cycles they took. The downcount is not updated.
+  int SingleStepBlock();
 
   void Run() override;
   void ClearCache() override;
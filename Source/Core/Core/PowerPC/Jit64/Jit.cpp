@@ -344,6 +344,7 @@ void Jit64::Shutdown()
   memory.ShutdownFastmemArena();
 
   blocks.Shutdown();
+  m_analysis_cache.Close();
   m_far_code.Shutdown();
   m_const_pool.Shutdown();
 }
@@ -822,10 +823,17 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  js.firstTier = ShouldCompileFirstTier(em_address);
+  if (js.firstTier)
+    DisableFirstTierAnalysisOptions();
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
-  const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+  const u32 nextPC = AnalyzeBlock(em_address, block_size);
+
+  if (js.firstTier)
+    EnableOptimization();
 
   if (code_block.m_memory_exception)
   {
@@ -936,6 +944,25 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   if (IsProfilingEnabled())
     ABI_CallFunctionP(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
 
+  // Count the runs of first tier blocks, and have them recompiled once they turn out to be hot.
+  if (js.firstTier)
+  {
+    b->tier_up_countdown = TIER_UP_THRESHOLD;
+    MOV(64, R(RSCRATCH), ImmPtr(&b->tier_up_countdown));
+    SUB(32, MatR(RSCRATCH), Imm8(1));
+    FixupBranch hot = J_CC(CC_Z, Jump::Near);
+
+    SwitchToFarCode();
+    SetJumpTarget(hot);
+    MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionPC(JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
+                       static_cast<u32>(JitInterface::ExceptionType::HotBlock));
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    JMP(asm_routines.dispatcher_no_check);
+    SwitchToNearCode();
+  }
+
 #if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
   // should help logged stack-traces become more accurate
   MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
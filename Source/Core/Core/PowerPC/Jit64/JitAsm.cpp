@@ -217,7 +217,10 @@ void Jit64AsmRoutineManager::Generate()
   // If jitting triggered an ISI exception, MSR.DR may have changed
   MOV(64, R(RMEM), PPCSTATE(mem_ptr));
 
-  JMP(dispatcher_no_check);
+  // The block may have been run by the interpreter instead of being compiled (see
+  // JitBase::RunColdBlock), in which case the downcount has changed. Otherwise, fall through.
+  CMP(32, PPCSTATE(downcount), Imm8(0));
+  J_CC(CC_G, dispatcher_no_check);
 
   SetJumpTarget(bail);
   do_timing = GetCodePtr();
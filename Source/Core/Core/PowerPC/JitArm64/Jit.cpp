@@ -252,6 +252,7 @@ void JitArm64::Shutdown()
   memory.ShutdownFastmemArena();
   FreeCodeSpace();
   blocks.Shutdown();
+  m_analysis_cache.Close();
 }
 
 void JitArm64::FallBackToInterpreter(UGeckoInstruction inst)
@@ -1012,10 +1013,17 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  js.firstTier = ShouldCompileFirstTier(em_address);
+  if (js.firstTier)
+    DisableFirstTierAnalysisOptions();
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
-  const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+  const u32 nextPC = AnalyzeBlock(em_address, block_size);
+
+  if (js.firstTier)
+    SetOptimizationEnabled(true);
 
   if (code_block.m_memory_exception)
   {
@@ -1178,6 +1186,28 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   if (IsProfilingEnabled())
     ABI_CallFunction(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
 
+  // Count the runs of first tier blocks, and have them recompiled once they turn out to be hot.
+  if (js.firstTier)
+  {
+    b->tier_up_countdown = TIER_UP_THRESHOLD;
+    MOVP2R(ARM64Reg::X0, &b->tier_up_countdown);
+    LDR(IndexType::Unsigned, ARM64Reg::W1, ARM64Reg::X0, 0);
+    SUBS(ARM64Reg::W1, ARM64Reg::W1, 1);
+    STR(IndexType::Unsigned, ARM64Reg::W1, ARM64Reg::X0, 0);
+    FixupBranch not_hot = B(CC_NEQ);
+    FixupBranch hot = B();
+
+    SwitchToFarCode();
+    SetJumpTarget(hot);
+    MOVI2R(DISPATCHER_PC, js.blockStart);
+    STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
+    ABI_CallFunction(&JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
+                     static_cast<u32>(JitInterface::ExceptionType::HotBlock));
+    B(dispatcher_no_check);
+    SwitchToNearCode();
+    SetJumpTarget(not_hot);
+  }
+
   if (code_block.m_gqr_used.Count() == 1 && !js.pairedQuantizeAddresses.contains(js.blockStart))
   {
     int gqr = *code_block.m_gqr_used.begin();
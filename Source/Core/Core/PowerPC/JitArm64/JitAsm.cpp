@@ -186,7 +186,11 @@ void JitArm64::GenerateAsm()
   // If jitting triggered an ISI exception, MSR.DR may have changed
   EmitUpdateMembase();
 
-  B(dispatcher_no_check);
+  // The block may have been run by the interpreter instead of being compiled (see
+  // JitBase::RunColdBlock), in which case the downcount has changed. Otherwise, fall through.
+  LDR(IndexType::Unsigned, ARM64Reg::W0, PPC_REG, PPCSTATE_OFF(downcount));
+  CMP(ARM64Reg::W0, 0);
+  B(CC_GT, dispatcher_no_check);
 
   SetJumpTarget(bail);
   do_timing = GetCodePtr();
@@ -0,0 +1,272 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitAnalysisCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/Logging/Log.h"
+#include "Core/HLE/HLE.h"
+#include "Core/PowerPC/BreakPoints.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PPCTables.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace
+{
+// Precedes the instructions of each entry in the disk cache.
+struct SerializedEntryHeader
+{
+  u32 code_op_size;
+  u32 num_instructions;
+  u32 next_pc;
+  u32 num_cycles;
+  u32 gpr_inputs;
+  u8 gqr_used;
+  u8 gqr_modified;
+  u8 broken;
+  u8 gpa_fpa_any;
+};
+
+// CodeOps are stored as they are in memory, except for the opinfo pointer, which is looked up
+// again when loading.
+static_assert(std::is_trivially_copyable_v<PPCAnalyst::CodeOp>);
+}  // namespace
+
+class JitAnalysisCache::Reader : public Common::LinearDiskCacheReader<DiskKey, u8>
+{
+public:
+  explicit Reader(JitAnalysisCache& cache) : m_cache(cache) {}
+
+  void Read(const DiskKey& key, const u8* value, u32 value_size) override
+  {
+    SerializedEntryHeader header;
+    if (value_size < sizeof(header))
+      return;
+    std::memcpy(&header, value, sizeof(header));
+
+    if (header.code_op_size != sizeof(PPCAnalyst::CodeOp) || header.num_instructions == 0 ||
+        value_size != sizeof(header) + header.num_instructions * sizeof(PPCAnalyst::CodeOp))
+    {
+      return;
+    }
+
+    Entry entry{
+        .instructions_hash = key.instructions_hash,
+        .next_pc = header.next_pc,
+        .num_cycles = header.num_cycles,
+        .gpr_inputs = header.gpr_inputs,
+        .gqr_used = header.gqr_used,
+        .gqr_modified = header.gqr_modified,
+        .broken = header.broken != 0,
+        .gpa_any = (header.gpa_fpa_any & 1) != 0,
+        .fpa_any = (header.gpa_fpa_any & 2) != 0,
+        .code = std::vector<PPCAnalyst::CodeOp>(header.num_instructions),
+    };
+    std::memcpy(entry.code.data(), value + sizeof(header),
+                header.num_instructions * sizeof(PPCAnalyst::CodeOp));
+    for (PPCAnalyst::CodeOp& op : entry.code)
+      op.opinfo = PPCTables::GetOpInfo(op.inst, op.address);
+
+    m_cache.AddEntry(key.key, std::move(entry));
+  }
+
+private:
+  JitAnalysisCache& m_cache;
+};
+
+JitAnalysisCache::JitAnalysisCache(Core::System& system) : m_system(system)
+{
+}
+
+void JitAnalysisCache::Open(const std::string& game_id)
+{
+  if (game_id == m_game_id)
+    return;
+
+  Close();
+  if (game_id.empty())
+    return;
+
+  const std::string& cache_dir = File::GetUserPath(D_CACHE_IDX);
+  if (!File::Exists(cache_dir))
+    File::CreateDir(cache_dir);
+
+  const std::string filename = cache_dir + "JitAnalysis-" + game_id + ".cache";
+  Reader reader(*this);
+  const u32 count = m_disk_cache.OpenAndRead(filename, reader);
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} cached block analyses from {}", count, filename);
+
+  m_game_id = game_id;
+}
+
+void JitAnalysisCache::Close()
+{
+  if (!IsOpen())
+    return;
+
+  m_disk_cache.Sync();
+  m_disk_cache.Close();
+  m_entries.clear();
+  m_game_id.clear();
+}
+
+std::optional<u32> JitAnalysisCache::Lookup(u32 em_address, u32 feature_flags, u32 analysis_flags,
+                                            PPCAnalyst::CodeBlock* block,
+                                            PPCAnalyst::CodeBuffer* buffer)
+{
+  const auto first_instruction = m_system.GetMMU().TryReadInstruction(em_address);
+  if (!first_instruction.valid)
+    return std::nullopt;
+
+  const auto it = m_entries.find(
+      {em_address, first_instruction.physical_address, feature_flags, analysis_flags});
+  if (it == m_entries.end())
+    return std::nullopt;
+
+  for (const Entry& entry : it->second)
+  {
+    if (entry.code.size() > buffer->size() || !Validate(entry, block))
+      continue;
+
+    *block->m_stats = {};
+    block->m_stats->numCycles = entry.num_cycles;
+    block->m_gpa->any = entry.gpa_any;
+    block->m_fpa->any = entry.fpa_any;
+    block->m_address = em_address;
+    block->m_num_instructions = static_cast<u32>(entry.code.size());
+    block->m_broken = entry.broken;
+    block->m_memory_exception = false;
+    block->m_gqr_used = BitSet8(entry.gqr_used);
+    block->m_gqr_modified = BitSet8(entry.gqr_modified);
+    block->m_gpr_inputs = BitSet32(entry.gpr_inputs);
+    std::ranges::copy(entry.code, buffer->begin());
+
+    return entry.next_pc;
+  }
+
+  return std::nullopt;
+}
+
+void JitAnalysisCache::Store(u32 em_address, u32 feature_flags, u32 analysis_flags, u32 next_pc,
+                             const PPCAnalyst::CodeBlock& block,
+                             const PPCAnalyst::CodeBuffer& buffer)
+{
+  const u32 num_instructions = block.m_num_instructions;
+  if (!IsOpen() || num_instructions == 0 || block.m_memory_exception)
+    return;
+
+  // The analysis of instructions which are HLE hooks or breakpoints differs from the analysis of
+  // the same instructions without them, so leave such blocks out rather than tracking this too.
+  for (u32 i = 0; i < num_instructions; ++i)
+  {
+    if (IsHooked(buffer[i].address))
+      return;
+  }
+
+  const auto first_instruction = m_system.GetMMU().TryReadInstruction(em_address);
+  if (!first_instruction.valid)
+    return;
+
+  const Key key{em_address, first_instruction.physical_address, feature_flags, analysis_flags};
+  const u32 instructions_hash = HashInstructions(buffer, num_instructions);
+
+  const auto it = m_entries.find(key);
+  if (it != m_entries.end() && std::ranges::any_of(it->second, [&](const Entry& entry) {
+        return entry.instructions_hash == instructions_hash &&
+               entry.code.size() == num_instructions;
+      }))
+  {
+    return;
+  }
+
+  Entry entry{
+      .instructions_hash = instructions_hash,
+      .next_pc = next_pc,
+      .num_cycles = block.m_stats->numCycles,
+      .gpr_inputs = block.m_gpr_inputs.m_val,
+      .gqr_used = block.m_gqr_used.m_val,
+      .gqr_modified = block.m_gqr_modified.m_val,
+      .broken = block.m_broken,
+      .gpa_any = block.m_gpa->any,
+      .fpa_any = block.m_fpa->any,
+      .code = std::vector<PPCAnalyst::CodeOp>(buffer.begin(), buffer.begin() + num_instructions),
+  };
+
+  const SerializedEntryHeader header{
+      .code_op_size = sizeof(PPCAnalyst::CodeOp),
+      .num_instructions = num_instructions,
+      .next_pc = entry.next_pc,
+      .num_cycles = entry.num_cycles,
+      .gpr_inputs = entry.gpr_inputs,
+      .gqr_used = entry.gqr_used,
+      .gqr_modified = entry.gqr_modified,
+      .broken = entry.broken,
+      .gpa_fpa_any = static_cast<u8>((entry.gpa_any ? 1 : 0) | (entry.fpa_any ? 2 : 0)),
+  };
+
+  std::vector<u8> value(sizeof(header) + num_instructions * sizeof(PPCAnalyst::CodeOp));
+  std::memcpy(value.data(), &header, sizeof(header));
+  u8* code_out = value.data() + sizeof(header);
+  for (PPCAnalyst::CodeOp op : entry.code)
+  {
+    op.opinfo = nullptr;
+    std::memcpy(code_out, &op, sizeof(op));
+    code_out += sizeof(op);
+  }
+
+  m_disk_cache.Append({key, instructions_hash}, value.data(), static_cast<u32>(value.size()));
+
+  AddEntry(key, std::move(entry));
+}
+
+void JitAnalysisCache::AddEntry(const Key& key, Entry entry)
+{
+  std::vector<Entry>& entries = m_entries[key];
+  if (entries.size() >= MAX_ENTRIES_PER_KEY)
+    entries.erase(entries.begin(), entries.end() - (MAX_ENTRIES_PER_KEY - 1));
+
+  entries.push_back(std::move(entry));
+}
+
+u32 JitAnalysisCache::HashInstructions(const PPCAnalyst::CodeBuffer& buffer, u32 num_instructions)
+{
+  u32 crc = Common::StartCRC32();
+  for (u32 i = 0; i < num_instructions; ++i)
+  {
+    const u32 words[2] = {buffer[i].address, buffer[i].inst.hex};
+    crc = Common::UpdateCRC32(crc, reinterpret_cast<const u8*>(words), sizeof(words));
+  }
+  return crc;
+}
+
+bool JitAnalysisCache::IsHooked(u32 address) const
+{
+  auto& power_pc = m_system.GetPowerPC();
+  return HLE::TryReplaceFunction(power_pc.GetSymbolDB(), address, power_pc.GetMode()) ||
+         power_pc.GetBreakPoints().IsAddressBreakPoint(address);
+}
+
+bool JitAnalysisCache::Validate(const Entry& entry, PPCAnalyst::CodeBlock* block) const
+{
+  auto& mmu = m_system.GetMMU();
+
+  block->m_physical_addresses.clear();
+  for (const PPCAnalyst::CodeOp& op : entry.code)
+  {
+    const auto result = mmu.TryReadInstruction(op.address);
+    if (!result.valid || result.hex != op.inst.hex || IsHooked(op.address))
+      return false;
+
+    block->m_physical_addresses.insert(result.physical_address,
+                                       result.physical_address + sizeof(UGeckoInstruction));
+  }
+
+  return true;
+}
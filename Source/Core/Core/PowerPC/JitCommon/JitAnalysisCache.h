@@ -0,0 +1,100 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <compare>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+
+namespace Core
+{
+class System;
+}
+
+// Keeps the results of PPCAnalyzer::Analyze across sessions, so blocks which are recompiled on
+// every boot of a game don't need to be analyzed again.
+//
+// Entries are keyed by effective address, physical address, CPU feature flags and the analyzer
+// settings, and store the instruction words they were created from. Before an entry is used, the
+// instructions are read back from guest memory and compared, so stale entries (e.g. from code
+// which was overwritten or loaded to a different place) are never used.
+//
+// Only the analysis is cached. The emitted host code references absolute addresses of the JIT's
+// code space, the PPC state and various routines, so it is always generated anew.
+class JitAnalysisCache
+{
+public:
+  explicit JitAnalysisCache(Core::System& system);
+
+  // Opens the cache file belonging to the given game, unless it's already open.
+  void Open(const std::string& game_id);
+  void Close();
+
+  bool IsOpen() const { return !m_game_id.empty(); }
+  const std::string& GetGameID() const { return m_game_id; }
+
+  // Fills in block and buffer from a stored entry which matches the instructions currently in
+  // memory and returns the address following the block, like PPCAnalyzer::Analyze would.
+  std::optional<u32> Lookup(u32 em_address, u32 feature_flags, u32 analysis_flags,
+                            PPCAnalyst::CodeBlock* block, PPCAnalyst::CodeBuffer* buffer);
+
+  // Adds the result of a PPCAnalyzer::Analyze call to the cache.
+  void Store(u32 em_address, u32 feature_flags, u32 analysis_flags, u32 next_pc,
+             const PPCAnalyst::CodeBlock& block, const PPCAnalyst::CodeBuffer& buffer);
+
+  // Code which is loaded to the same place again and again with different contents (overlays,
+  // for instance) gets an entry for each version. Only the most recently added ones are kept.
+  static constexpr size_t MAX_ENTRIES_PER_KEY = 4;
+
+private:
+  struct Key
+  {
+    u32 em_address;
+    u32 physical_address;
+    u32 feature_flags;
+    u32 analysis_flags;
+
+    auto operator<=>(const Key&) const = default;
+  };
+
+  struct DiskKey
+  {
+    Key key;
+    u32 instructions_hash;
+  };
+
+  struct Entry
+  {
+    u32 instructions_hash;
+    u32 next_pc;
+    u32 num_cycles;
+    u32 gpr_inputs;
+    u8 gqr_used;
+    u8 gqr_modified;
+    bool broken;
+    bool gpa_any;
+    bool fpa_any;
+    std::vector<PPCAnalyst::CodeOp> code;
+  };
+
+  class Reader;
+
+  void AddEntry(const Key& key, Entry entry);
+
+  static u32 HashInstructions(const PPCAnalyst::CodeBuffer& buffer, u32 num_instructions);
+  bool IsHooked(u32 address) const;
+  bool Validate(const Entry& entry, PPCAnalyst::CodeBlock* block) const;
+
+  Core::System& m_system;
+
+  std::string m_game_id;
+  std::map<Key, std::vector<Entry>> m_entries;
+  Common::LinearDiskCache<DiskKey, u8> m_disk_cache;
+};
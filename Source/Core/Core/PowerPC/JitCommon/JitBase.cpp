@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <optional>
 #include <utility>
 
 #include "Common/Align.h"
@@ -19,6 +20,7 @@
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
 #include "Core/MemTools.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -58,7 +60,7 @@
 // After resetting the stack to the top, we call _resetstkoflw() to restore
 // the guard page at the 256kb mark.
 
-const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JitBase::JIT_SETTINGS{{
+const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 28> JitBase::JIT_SETTINGS{{
     {&JitBase::bJITOff, &Config::MAIN_DEBUG_JIT_OFF},
     {&JitBase::bJITLoadStoreOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_OFF},
     {&JitBase::bJITLoadStorelXzOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_LXZ_OFF},
@@ -75,6 +77,9 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JitB
     {&JitBase::m_enable_profiling, &Config::MAIN_DEBUG_JIT_ENABLE_PROFILING},
     {&JitBase::m_enable_debugging, &Config::MAIN_ENABLE_DEBUGGING},
     {&JitBase::m_enable_branch_following, &Config::MAIN_JIT_FOLLOW_BRANCH},
+    {&JitBase::m_enable_analysis_cache, &Config::MAIN_JIT_ANALYSIS_CACHE},
+    {&JitBase::m_enable_tiered_compilation, &Config::MAIN_JIT_TIERED_COMPILATION},
+    {&JitBase::m_interpret_cold_blocks, &Config::MAIN_JIT_INTERPRET_COLD_BLOCKS},
     {&JitBase::m_enable_float_exceptions, &Config::MAIN_FLOAT_EXCEPTIONS},
     {&JitBase::m_enable_div_by_zero_exceptions, &Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS},
     {&JitBase::m_low_dcbz_hack, &Config::MAIN_LOW_DCBZ_HACK},
@@ -93,13 +98,16 @@ const u8* JitBase::Dispatch(JitBase& jit)
 
 void JitTrampoline(JitBase& jit, u32 em_address)
 {
+  if (jit.RunColdBlock(em_address))
+    return;
+
   jit.Jit(em_address);
 }
 
 JitBase::JitBase(Core::System& system)
-    : m_code_buffer(code_buffer_size), m_system(system), m_ppc_state(system.GetPPCState()),
-      m_mmu(system.GetMMU()), m_branch_watch(system.GetPowerPC().GetBranchWatch()),
-      m_ppc_symbol_db(system.GetPPCSymbolDB())
+    : m_code_buffer(code_buffer_size), m_analysis_cache(system), m_system(system),
+      m_ppc_state(system.GetPPCState()), m_mmu(system.GetMMU()),
+      m_branch_watch(system.GetPowerPC().GetBranchWatch()), m_ppc_symbol_db(system.GetPPCSymbolDB())
 {
   m_registered_config_callback_id = CPUThreadConfigCallback::AddConfigChangedCallback([this] {
     if (DoesConfigNeedRefresh())
@@ -139,6 +147,9 @@ void JitBase::RefreshConfig()
   analyzer.SetFloatExceptionsEnabled(m_enable_float_exceptions);
   analyzer.SetDivByZeroExceptionsEnabled(m_enable_div_by_zero_exceptions);
 
+  if (!m_enable_analysis_cache)
+    m_analysis_cache.Close();
+
   bool any_watchpoints = m_system.GetPowerPC().GetMemChecks().HasAny();
   jo.fastmem = m_fastmem_enabled && jo.fastmem_arena && (m_ppc_state.msr.DR || !any_watchpoints) &&
                EMM::IsExceptionHandlerSupported();
@@ -165,6 +176,65 @@ void JitBase::InitFastmemArena()
   jo.fastmem_arena = Config::Get(Config::MAIN_FASTMEM_ARENA) && memory.InitFastmemArena();
 }
 
+u32 JitBase::AnalyzeBlock(u32 em_address, std::size_t block_size)
+{
+  // Single stepping analyzes one instruction at a time, which isn't worth caching.
+  const bool use_cache = m_enable_analysis_cache && block_size == m_code_buffer.size();
+  if (use_cache)
+  {
+    // The game can change without the JIT being restarted, e.g. when the Wii Menu boots a title.
+    m_analysis_cache.Open(SConfig::GetInstance().GetGameID());
+
+    const std::optional<u32> next_pc =
+        m_analysis_cache.Lookup(em_address, m_ppc_state.feature_flags, analyzer.GetAnalysisFlags(),
+                                &code_block, &m_code_buffer);
+    if (next_pc)
+      return *next_pc;
+  }
+
+  const u32 next_pc = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+
+  if (use_cache)
+  {
+    m_analysis_cache.Store(em_address, m_ppc_state.feature_flags, analyzer.GetAnalysisFlags(),
+                           next_pc, code_block, m_code_buffer);
+  }
+
+  return next_pc;
+}
+
+bool JitBase::RunColdBlock(u32 em_address)
+{
+  if (!m_interpret_cold_blocks || IsDebuggingEnabled())
+    return false;
+
+  const auto it = js.coldBlockRuns.try_emplace(em_address, 0).first;
+  if (++it->second > COLD_BLOCK_THRESHOLD)
+  {
+    js.coldBlockRuns.erase(it);
+    return false;
+  }
+
+  // The dispatcher checks the downcount after returning from JitTrampoline, and exceptions raised
+  // by the block are handled by the interpreter just like they are in its own loop.
+  m_ppc_state.downcount -= m_system.GetInterpreter().SingleStepBlock();
+  return true;
+}
+
+bool JitBase::ShouldCompileFirstTier(u32 em_address) const
+{
+  return m_enable_tiered_compilation && !IsDebuggingEnabled() &&
+         !js.hotBlockAddresses.contains(em_address);
+}
+
+void JitBase::DisableFirstTierAnalysisOptions()
+{
+  analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_MERGE);
+  analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
+  analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
+  analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+}
+
 void JitBase::InitBLROptimization()
 {
   m_enable_blr_optimization =
@@ -8,6 +8,7 @@
 #include <iosfwd>
 #include <map>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -20,6 +21,7 @@
 #include "Core/ConfigManager.h"
 #include "Core/MachineContext.h"
 #include "Core/PowerPC/CPUCoreBase.h"
+#include "Core/PowerPC/JitCommon/JitAnalysisCache.h"
 #include "Core/PowerPC/JitCommon/JitAsmCommon.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
@@ -80,6 +82,15 @@ protected:
   static constexpr size_t GUARD_SIZE = 64 * 1024;
   static constexpr size_t GUARD_OFFSET = SAFE_STACK_SIZE - GUARD_SIZE;
 
+  // How often a first tier block runs before it gets recompiled with all optimizations. The
+  // recompile happens on the CPU thread, just like the first compile of the block. It costs about
+  // as much as that one, or a few times as much when branch following pulls in more code, and
+  // only happens once per block, so it isn't worth handing blocks to another thread for it.
+  static constexpr u32 TIER_UP_THRESHOLD = 1000;
+
+  // How often a block is run by the interpreter before it gets compiled.
+  static constexpr u32 COLD_BLOCK_THRESHOLD = 8;
+
   struct JitOptions
   {
     bool enableBlocklink;
@@ -114,6 +125,9 @@ protected:
     int skipInstructions;
     CarryFlag carryFlag;
 
+    // Whether the block is compiled as a quick first tier block (see ShouldCompileFirstTier).
+    bool firstTier;
+
     bool generatingTrampoline = false;
     u8* trampolineExceptionHandler;
 
@@ -131,11 +145,15 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+    std::unordered_set<u32> hotBlockAddresses;
+    // Number of times each uncompiled block has been run by RunColdBlock, by start address
+    std::unordered_map<u32, u32> coldBlockRuns;
   };
 
   PPCAnalyst::CodeBlock code_block;
   PPCAnalyst::CodeBuffer m_code_buffer;
   PPCAnalyst::PPCAnalyzer analyzer;
+  JitAnalysisCache m_analysis_cache;
 
   CPUThreadConfigCallback::ConfigChangedCallbackID m_registered_config_callback_id;
   bool bJITOff = false;
@@ -154,6 +172,9 @@ protected:
   bool m_enable_profiling = false;
   bool m_enable_debugging = false;
   bool m_enable_branch_following = false;
+  bool m_enable_analysis_cache = false;
+  bool m_enable_tiered_compilation = false;
+  bool m_interpret_cold_blocks = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
   bool m_low_dcbz_hack = false;
@@ -168,13 +189,24 @@ protected:
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JIT_SETTINGS;
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 28> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh() const;
   void RefreshConfig();
 
   void InitFastmemArena();
 
+  // Analyzes the block at em_address into code_block and m_code_buffer, using the analysis
+  // cache when possible. Returns the address following the block.
+  u32 AnalyzeBlock(u32 em_address, std::size_t block_size);
+
+  // With tiered compilation, blocks are first compiled without branch following or instruction
+  // reordering, which makes both analysis and code generation cheaper. These blocks count how
+  // often they run, and once they reach TIER_UP_THRESHOLD they are invalidated through
+  // JitInterface::CompileExceptionCheck so that the next run compiles them fully.
+  bool ShouldCompileFirstTier(u32 em_address) const;
+  void DisableFirstTierAnalysisOptions();
+
   void InitBLROptimization();
   void ProtectStack();
   void UnprotectStack();
@@ -213,6 +245,14 @@ public:
 
   virtual void Jit(u32 em_address) = 0;
 
+  // With cold block interpretation, the first few runs of a block go through the interpreter
+  // instead of compiling it right away. Code which only runs a few times, like initialization code
+  // of freshly loaded modules, then never needs to be compiled, which spreads out the compilation
+  // stutter of loading a lot of new code. Blocks which keep running are still compiled on the CPU
+  // thread, once they have been interpreted COLD_BLOCK_THRESHOLD times. Returns whether the block
+  // was run.
+  bool RunColdBlock(u32 em_address);
+
   virtual void EraseSingleBlock(const JitBlock& block) = 0;
 
   // Memory region name, free size, and fragmentation ratio
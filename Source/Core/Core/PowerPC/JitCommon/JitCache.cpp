@@ -82,6 +82,8 @@ void JitBaseBlockCache::Clear()
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
+  m_jit.js.hotBlockAddresses.clear();
+  m_jit.js.coldBlockRuns.clear();
   for (auto& e : block_map)
   {
     DestroyBlock(e.second);
@@ -343,6 +345,8 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
         m_jit.js.fifoWriteAddresses.erase(i);
         m_jit.js.pairedQuantizeAddresses.erase(i);
         m_jit.js.noSpeculativeConstantsAddresses.erase(i);
+        m_jit.js.hotBlockAddresses.erase(i);
+        m_jit.js.coldBlockRuns.erase(i);
       }
     }
   }
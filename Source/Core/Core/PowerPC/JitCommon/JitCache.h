@@ -108,6 +108,9 @@ struct JitBlock : public JitBlockData
   std::vector<std::pair<u32, UGeckoInstruction>> original_buffer;
 
   std::unique_ptr<ProfileData> profile_data;
+
+  // Decremented each time a first tier block runs. See JitBase::ShouldCompileFirstTier.
+  u32 tier_up_countdown = 0;
 };
 
 typedef void (*CompiledCode)();
@@ -324,6 +324,9 @@ void JitInterface::CompileExceptionCheck(ExceptionType type)
   case ExceptionType::SpeculativeConstants:
     exception_addresses = &m_jit->js.noSpeculativeConstantsAddresses;
     break;
+  case ExceptionType::HotBlock:
+    exception_addresses = &m_jit->js.hotBlockAddresses;
+    break;
   }
 
   auto& ppc_state = m_system.GetPPCState();
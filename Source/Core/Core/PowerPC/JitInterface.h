@@ -94,7 +94,8 @@ public:
   {
     FIFOWrite,
     PairedQuantize,
-    SpeculativeConstants
+    SpeculativeConstants,
+    HotBlock
   };
   void CompileExceptionCheck(ExceptionType type);
   static void CompileExceptionCheckFromJIT(JitInterface& jit_interface, ExceptionType type);
@@ -0,0 +1,215 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/RewindBuffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <lz4.h>
+#include <xxhash.h>
+
+#include "Common/Logging/Log.h"
+#include "Common/ThreadPool.h"
+
+namespace State
+{
+RewindBuffer::RewindBuffer(Common::ThreadPool& pool, size_t memory_budget)
+    : m_pool(pool), m_memory_budget(memory_budget)
+{
+}
+
+void RewindBuffer::SetMemoryBudget(size_t memory_budget)
+{
+  std::lock_guard lk(m_mutex);
+  m_memory_budget = memory_budget;
+  TrimToBudget();
+}
+
+// Splits state into chunks of at most CHUNK_SIZE bytes. Each memory region and each part of the
+// state between them starts a new chunk.
+static std::vector<std::span<const u8>> SplitIntoChunks(std::span<const u8> state,
+                                                        const MemoryLayout& memory_layout)
+{
+  std::vector<std::span<const u8>> chunks;
+  const auto add_range = [&](u64 offset, u64 size) {
+    for (u64 i = 0; i < size; i += RewindBuffer::CHUNK_SIZE)
+    {
+      chunks.push_back(state.subspan(offset + i,
+                                     std::min<u64>(RewindBuffer::CHUNK_SIZE, size - i)));
+    }
+  };
+
+  u64 position = 0;
+  if (IsValidMemoryLayout(memory_layout, state.size()))
+  {
+    for (const MemoryRegion& region : memory_layout)
+    {
+      if (region.size == 0)
+        continue;
+
+      add_range(position, region.offset - position);
+      add_range(region.offset, region.size);
+      position = region.offset + region.size;
+    }
+  }
+  add_range(position, state.size() - position);
+
+  return chunks;
+}
+
+void RewindBuffer::Push(std::span<const u8> state, const MemoryLayout& memory_layout)
+{
+  const std::vector<std::span<const u8>> chunks = SplitIntoChunks(state, memory_layout);
+
+  Snapshot snapshot{.size = state.size(), .chunks = std::vector<ChunkHash>(chunks.size())};
+  m_pool.ParallelFor(chunks.size(), [&](size_t i) {
+    const XXH128_hash_t hash = XXH3_128bits(chunks[i].data(), chunks[i].size());
+    snapshot.chunks[i] = {hash.low64, hash.high64};
+  });
+
+  std::lock_guard lk(m_mutex);
+
+  // Only chunks which aren't stored yet need to be compressed, and only once each, even if they
+  // occur several times within this snapshot.
+  std::vector<std::pair<size_t, Chunk*>> new_chunks;
+  for (size_t i = 0; i < chunks.size(); ++i)
+  {
+    const auto [it, inserted] = m_chunks.try_emplace(snapshot.chunks[i]);
+    Chunk& chunk = it->second;
+    if (inserted)
+    {
+      chunk.size = static_cast<u32>(chunks[i].size());
+      chunk.ref_count = 0;
+      new_chunks.emplace_back(i, &chunk);
+    }
+    ++chunk.ref_count;
+  }
+
+  m_pool.ParallelFor(new_chunks.size(), [&](size_t i) {
+    const std::span<const u8> in = chunks[new_chunks[i].first];
+    Chunk& chunk = *new_chunks[i].second;
+
+    std::vector<char> out(LZ4_compressBound(static_cast<int>(in.size())));
+    const int compressed_len =
+        LZ4_compress_default(reinterpret_cast<const char*>(in.data()), out.data(),
+                             static_cast<int>(in.size()), static_cast<int>(out.size()));
+    chunk.compressed = compressed_len > 0 && static_cast<size_t>(compressed_len) < in.size();
+    if (!chunk.compressed)
+    {
+      if (compressed_len <= 0)
+        ERROR_LOG_FMT(CORE, "Failed to compress rewind chunk, storing it uncompressed");
+
+      chunk.stored_data.reset(in.size());
+      std::memcpy(chunk.stored_data.data(), in.data(), in.size());
+      return;
+    }
+
+    chunk.stored_data.reset(compressed_len);
+    std::memcpy(chunk.stored_data.data(), out.data(), compressed_len);
+  });
+
+  for (const auto& [index, chunk] : new_chunks)
+    m_memory_usage += chunk->stored_data.size();
+  m_memory_usage += snapshot.chunks.size() * sizeof(ChunkHash);
+
+  m_snapshots.push_back(std::move(snapshot));
+  TrimToBudget();
+}
+
+bool RewindBuffer::Pop(Common::UniqueBuffer<u8>& state)
+{
+  std::lock_guard lk(m_mutex);
+  if (m_snapshots.empty())
+    return false;
+
+  Snapshot snapshot = std::move(m_snapshots.back());
+  m_snapshots.pop_back();
+
+  // Chunks don't all have the same size, as memory regions start new ones.
+  std::vector<const Chunk*> chunks(snapshot.chunks.size());
+  std::vector<size_t> offsets(snapshot.chunks.size());
+  size_t offset = 0;
+  for (size_t i = 0; i < chunks.size(); ++i)
+  {
+    chunks[i] = &m_chunks.at(snapshot.chunks[i]);
+    offsets[i] = offset;
+    offset += chunks[i]->size;
+  }
+
+  std::atomic<bool> failed = offset != snapshot.size;
+  state.reset(snapshot.size);
+  m_pool.ParallelFor(failed ? 0 : chunks.size(), [&](size_t i) {
+    const Chunk& chunk = *chunks[i];
+    u8* const out = state.data() + offsets[i];
+    if (!chunk.compressed)
+    {
+      std::memcpy(out, chunk.stored_data.data(), chunk.size);
+      return;
+    }
+
+    const int decompressed_len = LZ4_decompress_safe(
+        reinterpret_cast<const char*>(chunk.stored_data.data()), reinterpret_cast<char*>(out),
+        static_cast<int>(chunk.stored_data.size()), static_cast<int>(chunk.size));
+    if (decompressed_len != static_cast<int>(chunk.size))
+      failed = true;
+  });
+
+  ReleaseSnapshot(snapshot);
+
+  if (failed)
+  {
+    ERROR_LOG_FMT(CORE, "Failed to decompress rewind snapshot");
+    return false;
+  }
+
+  return true;
+}
+
+void RewindBuffer::Clear()
+{
+  std::lock_guard lk(m_mutex);
+  m_snapshots.clear();
+  m_chunks.clear();
+  m_memory_usage = 0;
+}
+
+size_t RewindBuffer::GetSnapshotCount() const
+{
+  std::lock_guard lk(m_mutex);
+  return m_snapshots.size();
+}
+
+size_t RewindBuffer::GetMemoryUsage() const
+{
+  std::lock_guard lk(m_mutex);
+  return m_memory_usage;
+}
+
+void RewindBuffer::ReleaseSnapshot(const Snapshot& snapshot)
+{
+  for (const ChunkHash& hash : snapshot.chunks)
+  {
+    const auto it = m_chunks.find(hash);
+    if (--it->second.ref_count == 0)
+    {
+      m_memory_usage -= it->second.stored_data.size();
+      m_chunks.erase(it);
+    }
+  }
+  m_memory_usage -= snapshot.chunks.size() * sizeof(ChunkHash);
+}
+
+void RewindBuffer::TrimToBudget()
+{
+  // The newest snapshot is always kept, even if it alone exceeds the budget.
+  while (m_memory_usage > m_memory_budget && m_snapshots.size() > 1)
+  {
+    ReleaseSnapshot(m_snapshots.front());
+    m_snapshots.pop_front();
+  }
+}
+}  // namespace State
@@ -0,0 +1,104 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Core/StateDelta.h"
+
+namespace Common
+{
+class ThreadPool;
+}
+
+namespace State
+{
+// A ring of compressed savestates, used for rewinding.
+//
+// Snapshots are split into chunks of CHUNK_SIZE bytes, and chunks with the same contents are only
+// stored once, no matter how many snapshots contain them. As most of a savestate (in particular
+// most of emulated memory) doesn't change between two snapshots taken a fraction of a second
+// apart, this makes each additional snapshot a lot cheaper than a full compressed state.
+//
+// Each memory region of a snapshot starts a new chunk, so the chunks of memory cover the same
+// addresses in every snapshot, even when a section before them changes its size.
+//
+// When the memory used by the stored chunks exceeds the budget, the oldest snapshots are dropped.
+class RewindBuffer
+{
+public:
+  static constexpr u32 CHUNK_SIZE = 64 * 1024;
+
+  // Compression and decompression of chunks is spread across the given pool. Push and Pop must not
+  // be called from one of its workers.
+  RewindBuffer(Common::ThreadPool& pool, size_t memory_budget);
+
+  RewindBuffer(const RewindBuffer&) = delete;
+  RewindBuffer& operator=(const RewindBuffer&) = delete;
+
+  void SetMemoryBudget(size_t memory_budget);
+
+  // Adds a snapshot of the given state as the newest one. memory_layout is where the memory
+  // regions are in state. It is ignored if it doesn't fit the state.
+  void Push(std::span<const u8> state, const MemoryLayout& memory_layout = {});
+
+  // Reconstructs the newest snapshot into state and removes it from the buffer.
+  // Returns false if the buffer is empty.
+  bool Pop(Common::UniqueBuffer<u8>& state);
+
+  void Clear();
+
+  size_t GetSnapshotCount() const;
+  size_t GetMemoryUsage() const;
+
+private:
+  struct ChunkHash
+  {
+    u64 low;
+    u64 high;
+
+    bool operator==(const ChunkHash&) const = default;
+  };
+
+  struct ChunkHashHasher
+  {
+    size_t operator()(const ChunkHash& hash) const { return static_cast<size_t>(hash.low); }
+  };
+
+  struct Chunk
+  {
+    // LZ4 compressed, unless the chunk couldn't be compressed (or didn't get smaller), in which
+    // case it's stored as is.
+    Common::UniqueBuffer<u8> stored_data;
+    u32 size;
+    u32 ref_count;
+    bool compressed;
+  };
+
+  struct Snapshot
+  {
+    size_t size;
+    std::vector<ChunkHash> chunks;
+  };
+
+  // Removes the references of the given snapshot to its chunks.
+  void ReleaseSnapshot(const Snapshot& snapshot);
+  void TrimToBudget();
+
+  Common::ThreadPool& m_pool;
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<ChunkHash, Chunk, ChunkHashHasher> m_chunks;
+  std::deque<Snapshot> m_snapshots;
+  size_t m_memory_budget;
+  size_t m_memory_usage = 0;
+};
+}  // namespace State
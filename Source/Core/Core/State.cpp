@@ -4,11 +4,14 @@
 #include "Core/State.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <filesystem>
 #include <locale>
 #include <map>
 #include <mutex>
 #include <shared_mutex>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -18,22 +21,26 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/Buffer.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Contains.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
+#include "Common/ThreadPool.h"
 #include "Common/TimeUtil.h"
 #include "Common/TransferableSharedMutex.h"
 #include "Common/Version.h"
 #include "Common/WorkQueueThread.h"
 
 #include "Core/AchievementManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -44,6 +51,8 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RewindBuffer.h"
+#include "Core/StateDelta.h"
 #include "Core/System.h"
 
 #include "UICommon/UICommon.h"
@@ -86,7 +95,10 @@ static Common::TransferableSharedMutex s_state_saves_in_progress;
 struct CompressAndDumpStateArgs
 {
   Common::UniqueBuffer<u8> buffer;
+  MemoryLayout memory_layout;
   std::string filename;
+  // If not empty, a delta state against this state file is written.
+  std::string base_filename;
   std::shared_lock<decltype(s_state_saves_in_progress)> task_lock;
 };
 
@@ -94,14 +106,89 @@ struct CompressAndDumpStateArgs
 // Only the CPU thread manipulates this worker.
 static Common::WorkQueueThreadSP<CompressAndDumpStateArgs> s_compress_and_dump_thread;
 
+// Compresses and decompresses the chunks of ChunkedLZ4 and ChunkedZstd states and of the rewind
+// buffer.
+static Common::ThreadPool s_compression_pool;
+
+struct RewindCaptureArgs
+{
+  Common::UniqueBuffer<u8> buffer;
+  size_t size;
+  MemoryLayout memory_layout;
+};
+
+static RewindBuffer s_rewind_buffer{s_compression_pool, 0};
+
+// Adds the raw states captured on the CPU thread to s_rewind_buffer, so that the CPU thread only
+// has to spend the time needed to serialize the state.
+static Common::WorkQueueThreadSP<RewindCaptureArgs> s_rewind_thread;
+static std::atomic<u32> s_pending_rewind_captures = 0;
+
+// Captures are skipped while this many are still waiting for the worker, rather than letting the
+// queue (and its memory usage) grow without bounds on hosts which can't keep up.
+constexpr u32 MAX_PENDING_REWIND_CAPTURES = 2;
+
+// Buffers which have been added to the rewind buffer, kept for the next captures so they don't have
+// to allocate (and fault in) a new buffer on the CPU thread.
+static std::mutex s_spare_rewind_buffers_mutex;
+static std::vector<Common::UniqueBuffer<u8>> s_spare_rewind_buffers;
+
+static u32 s_fields_since_rewind_capture = 0;
+
+// Uncompressed size of each chunk of ChunkedLZ4 and ChunkedZstd states.
+constexpr u32 COMPRESSION_CHUNK_SIZE = 1024 * 1024;
+
+// Higher levels make saving significantly slower while barely reducing the size of states.
+constexpr int ZSTD_COMPRESSION_LEVEL = 3;
+
+// Granularity at which the memory of delta states is compared against their base.
+constexpr u32 DELTA_PAGE_SIZE = 4096;
+
+// Limits how many delta states may be stacked on top of each other (and guards against cycles).
+constexpr int MAX_DELTA_CHAIN_LENGTH = 16;
+
+namespace
+{
+// Follows the extended header of Delta states, and is followed by the base filename and then
+// the delta data (see CreateDelta()), compressed with delta_compression_type.
+struct DeltaStateHeader
+{
+  u16 delta_compression_type;
+  u16 reserved;
+  u32 page_size;
+  u32 base_crc32;
+  u32 base_filename_length;
+  u64 base_size;
+  u64 delta_size;
+};
+static_assert(std::is_trivially_copyable_v<DeltaStateHeader>);
+
+// The uncompressed contents of the most recently used base state. Saving several deltas against
+// the same base then doesn't need to read the base again every time.
+struct DeltaBase
+{
+  std::string filename;
+  double time = 0;
+  u32 crc32 = 0;
+  Common::UniqueBuffer<u8> data;
+  MemoryLayout memory_layout;
+};
+}  // namespace
+
+static DeltaBase s_delta_base;
+// Recursive, as the base of a delta state may itself be a delta state.
+static std::recursive_mutex s_delta_base_mutex;
+
 // Don't forget to increase this after doing changes on the savestate system
 constexpr u32 STATE_VERSION = 189;  // Last changed in PR 14560
 
 // Increase this if the StateExtendedHeader definition changes
-constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
+constexpr u32 EXTENDED_HEADER_VERSION = 2;  // Last changed to add memory_layout
+// States with this version have no memory layout but can still be loaded.
+constexpr u32 EXTENDED_HEADER_VERSION_WITHOUT_MEMORY_LAYOUT = 1;
 
 // Change this if we ever need to store more data in the extended header
-constexpr u32 COMPRESSED_DATA_OFFSET = 0;
+constexpr u32 COMPRESSED_DATA_OFFSET = sizeof(MemoryLayout);
 
 constexpr u32 COOKIE_BASE = 0xBAADBABE;
 
@@ -132,6 +219,8 @@ static constexpr bool s_use_compression = true;
 }
 
 static bool ReadHeader(const std::string& filename, StateHeader& header);
+static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<u8>& ret_data,
+                              int delta_depth = 0, MemoryLayout* memory_layout = nullptr);
 
 static void DoState(Core::System& system, PointerWrap& p)
 {
@@ -227,6 +316,20 @@ static bool LoadFromBuffer(Core::System& system, std::span<u8> buffer)
   return p.IsReadMode();
 }
 
+// Returns where the memory regions are in the state data that the last SaveToBuffer call wrote to
+// buffer.
+static MemoryLayout GetSavedMemoryLayout(Core::System& system, const u8* buffer)
+{
+  MemoryLayout memory_layout;
+  const auto& regions = system.GetMemory().GetSavedStateRegions();
+  for (size_t i = 0; i < memory_layout.size(); ++i)
+  {
+    if (!regions[i].empty())
+      memory_layout[i] = {.offset = u64(regions[i].data() - buffer), .size = regions[i].size()};
+  }
+  return memory_layout;
+}
+
 // Returns the required size, or 0 on failure.
 static std::size_t SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
 {
@@ -353,19 +456,96 @@ static void CompressBufferToFile(std::span<const u8> raw_buffer, File::IOFile& f
   }
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+// Chunked payload layout:
+// u32 chunk_size;  // uncompressed size of every chunk but the last
+// u32 chunk_count;
+// u32 compressed_chunk_sizes[chunk_count];
+// compressed chunks, back to back
+static void CompressBufferToFileChunked(std::span<const u8> raw_buffer, CompressionType type,
+                                        File::IOFile& f, Common::ThreadPool& pool)
+{
+  const u32 chunk_count =
+      static_cast<u32>((raw_buffer.size() + COMPRESSION_CHUNK_SIZE - 1) / COMPRESSION_CHUNK_SIZE);
+  std::vector<Common::UniqueBuffer<u8>> chunks(chunk_count);
+  std::vector<u32> compressed_sizes(chunk_count);
+  std::atomic<bool> failed = false;
+
+  pool.ParallelFor(chunk_count, [&](size_t i) {
+    const std::span<const u8> in = raw_buffer.subspan(
+        i * COMPRESSION_CHUNK_SIZE,
+        std::min<size_t>(COMPRESSION_CHUNK_SIZE, raw_buffer.size() - i * COMPRESSION_CHUNK_SIZE));
+    Common::UniqueBuffer<u8>& out = chunks[i];
+
+    if (type == CompressionType::ChunkedZstd)
+    {
+      out.reset(ZSTD_compressBound(in.size()));
+      const size_t compressed_len =
+          ZSTD_compress(out.data(), out.size(), in.data(), in.size(), ZSTD_COMPRESSION_LEVEL);
+      if (ZSTD_isError(compressed_len))
+        failed = true;
+      else
+        compressed_sizes[i] = static_cast<u32>(compressed_len);
+    }
+    else
+    {
+      const int in_size = static_cast<int>(in.size());
+      out.reset(LZ4_compressBound(in_size));
+      const int compressed_len =
+          LZ4_compress_default(reinterpret_cast<const char*>(in.data()),
+                               reinterpret_cast<char*>(out.data()), in_size, int(out.size()));
+      if (compressed_len == 0)
+        failed = true;
+      else
+        compressed_sizes[i] = static_cast<u32>(compressed_len);
+    }
+  });
+
+  if (failed)
+  {
+    PanicAlertFmtT("Internal compression error - failed to compress state");
+    return;
+  }
+
+  f.WriteArray(&COMPRESSION_CHUNK_SIZE, 1);
+  f.WriteArray(&chunk_count, 1);
+  f.WriteArray(compressed_sizes.data(), chunk_count);
+  for (u32 i = 0; i < chunk_count; ++i)
+    f.WriteBytes(chunks[i].data(), compressed_sizes[i]);
+}
+
+static CompressionType GetConfiguredCompressionType()
+{
+  if (!s_use_compression)
+    return CompressionType::Uncompressed;
+
+  switch (Config::Get(Config::MAIN_SAVESTATE_COMPRESSION))
+  {
+  case Config::SaveStateCompression::ChunkedLZ4:
+    return CompressionType::ChunkedLZ4;
+  case Config::SaveStateCompression::ChunkedZstd:
+    return CompressionType::ChunkedZstd;
+  case Config::SaveStateCompression::LZ4:
+  default:
+    return CompressionType::LZ4;
+  }
+}
+
+static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size,
+                                 CompressionType compression_type,
+                                 const MemoryLayout& memory_layout)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+  base_header.compression_type = compression_type;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
   // If more fields are added to StateExtendedHeader, set them here.
+  extended_header.memory_layout = memory_layout;
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static void WriteHeadersToFile(size_t uncompressed_size, CompressionType compression_type,
+                               const MemoryLayout& memory_layout, File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -377,7 +557,7 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
   StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
+  CreateExtendedHeader(extended_header, uncompressed_size, compression_type, memory_layout);
 
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
@@ -385,6 +565,83 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
 
   f.WriteArray(&extended_header.base_header, 1);
   // If StateExtendedHeader is amended to include more than the base, add WriteBytes() calls here.
+  f.WriteArray(&extended_header.memory_layout, 1);
+}
+
+void WritePayloadToFile(std::span<const u8> buffer, CompressionType compression_type,
+                        File::IOFile& f, Common::ThreadPool& pool)
+{
+  switch (compression_type)
+  {
+  case CompressionType::LZ4:
+    CompressBufferToFile(buffer, f);
+    break;
+  case CompressionType::ChunkedLZ4:
+  case CompressionType::ChunkedZstd:
+    CompressBufferToFileChunked(buffer, compression_type, f, pool);
+    break;
+  default:
+    f.WriteBytes(buffer.data(), buffer.size());
+    break;
+  }
+}
+
+// Makes s_delta_base hold the given state file. Must be called with s_delta_base_mutex held.
+static bool UpdateDeltaBase(const std::string& base_filename, int delta_depth)
+{
+  StateHeader header;
+  if (!File::Exists(base_filename) || !ReadHeader(base_filename, header))
+    return false;
+
+  if (s_delta_base.filename == base_filename && s_delta_base.time == header.legacy_header.time)
+    return true;
+
+  Common::UniqueBuffer<u8> data;
+  MemoryLayout memory_layout;
+  LoadFileStateData(base_filename, data, delta_depth, &memory_layout);
+  if (data.empty())
+    return false;
+
+  s_delta_base.filename = base_filename;
+  s_delta_base.time = header.legacy_header.time;
+  s_delta_base.crc32 = Common::ComputeCRC32(data.data(), data.size());
+  s_delta_base.data = std::move(data);
+  s_delta_base.memory_layout = memory_layout;
+  return true;
+}
+
+// Writes a Delta state, or returns false without writing anything if the base can't be used.
+static bool WriteDeltaStateToFile(std::span<const u8> buffer, const MemoryLayout& memory_layout,
+                                  const std::string& filename, const std::string& base_filename,
+                                  CompressionType compression_type, File::IOFile& f)
+{
+  std::lock_guard lk(s_delta_base_mutex);
+
+  // The previous state at filename is moved away once the new one has been written.
+  // Bases without a memory layout were saved by an older version and can't be compared against.
+  std::error_code error;
+  if (std::filesystem::equivalent(base_filename, filename, error) ||
+      !UpdateDeltaBase(base_filename, 0) || s_delta_base.memory_layout[0].size == 0)
+  {
+    Core::DisplayMessage("Base state unavailable, saving a full state instead", 2000);
+    return false;
+  }
+
+  DeltaStateHeader delta_header{};
+  const Common::UniqueBuffer<u8> delta = CreateDelta(
+      s_delta_base.data, s_delta_base.memory_layout, buffer, memory_layout, DELTA_PAGE_SIZE);
+  delta_header.delta_compression_type = compression_type;
+  delta_header.page_size = DELTA_PAGE_SIZE;
+  delta_header.base_crc32 = s_delta_base.crc32;
+  delta_header.base_size = s_delta_base.data.size();
+  delta_header.delta_size = delta.size();
+  delta_header.base_filename_length = static_cast<u32>(base_filename.size());
+
+  WriteHeadersToFile(buffer.size(), CompressionType::Delta, memory_layout, f);
+  f.WriteArray(&delta_header, 1);
+  f.WriteString(base_filename);
+  WritePayloadToFile(delta, compression_type, f, s_compression_pool);
+  return true;
 }
 
 static void CompressAndDumpState(Core::System& system, const CompressAndDumpStateArgs& save_args)
@@ -411,12 +668,14 @@ static void CompressAndDumpState(Core::System& system, const CompressAndDumpStat
     return;
   }
 
-  WriteHeadersToFile(buffer.size(), f);
-
-  if (s_use_compression)
-    CompressBufferToFile(buffer, f);
-  else
-    f.WriteBytes(buffer.data(), buffer.size());
+  const CompressionType compression_type = GetConfiguredCompressionType();
+  if (save_args.base_filename.empty() ||
+      !WriteDeltaStateToFile(buffer, save_args.memory_layout, filename, save_args.base_filename,
+                             compression_type, f))
+  {
+    WriteHeadersToFile(buffer.size(), compression_type, save_args.memory_layout, f);
+    WritePayloadToFile(buffer, compression_type, f, s_compression_pool);
+  }
 
   if (!f.IsGood())
     Core::DisplayMessage("Failed to write state file", 2000);
@@ -467,7 +726,8 @@ static void CompressAndDumpState(Core::System& system, const CompressAndDumpStat
   }
 }
 
-static void SaveAsFromCore(Core::System& system, std::string filename)
+static void SaveAsFromCore(Core::System& system, std::string filename,
+                           std::string base_filename = {})
 {
   // Try with a buffer a bit larger than the previous state.
   // This will often avoid the "Measure" step.
@@ -476,12 +736,16 @@ static void SaveAsFromCore(Core::System& system, std::string filename)
 
   if (const auto actual_size = SaveToBuffer(system, buffer))
   {
+    const MemoryLayout memory_layout = GetSavedMemoryLayout(system, buffer.data());
+
     // Adjust the oversized buffer down to the actual size.
     buffer.assign(buffer.extract().first, actual_size);
 
     CompressAndDumpStateArgs dump_args{
         .buffer = std::move(buffer),
+        .memory_layout = memory_layout,
         .filename = std::move(filename),
+        .base_filename = std::move(base_filename),
         .task_lock = GetStateSaveTaskLock(),
     };
     Core::DisplayMessage("Saving State...", 1000);
@@ -501,6 +765,15 @@ void SaveAs(Core::System& system, std::string filename)
       });
 }
 
+void SaveDeltaAs(Core::System& system, std::string filename, std::string base_filename)
+{
+  Core::RunOnCPUThread(system, [&system, filename = std::move(filename),
+                                base_filename = std::move(base_filename),
+                                lock = GetStateSaveTaskLock()]() mutable {
+    SaveAsFromCore(system, std::move(filename), std::move(base_filename));
+  });
+}
+
 static bool GetVersionFromLZO(StateHeader& header, File::IOFile& f)
 {
   // Just read the first block, since it will contain the full revision string
@@ -690,6 +963,179 @@ static bool DecompressLZ4(Common::UniqueBuffer<u8>& raw_buffer, u64 size, File::
   }
 }
 
+static bool DecompressChunked(Common::UniqueBuffer<u8>& raw_buffer, u64 size,
+                              CompressionType type, File::IOFile& f, Common::ThreadPool& pool)
+{
+  u32 chunk_size = 0;
+  u32 chunk_count = 0;
+  if (!f.ReadArray(&chunk_size, 1) || !f.ReadArray(&chunk_count, 1))
+  {
+    PanicAlertFmt("Could not read state data length");
+    return false;
+  }
+
+  if (chunk_size == 0 || (size + chunk_size - 1) / chunk_size != chunk_count)
+  {
+    PanicAlertFmtT("Internal compression error - state has {0} chunks of {1} bytes for {2} bytes",
+                   chunk_count, chunk_size, size);
+    return false;
+  }
+
+  std::vector<u32> compressed_sizes(chunk_count);
+  std::vector<u64> compressed_offsets(chunk_count);
+  if (!f.ReadArray(compressed_sizes.data(), chunk_count))
+  {
+    PanicAlertFmt("Could not read state data length");
+    return false;
+  }
+
+  u64 compressed_size = 0;
+  for (u32 i = 0; i < chunk_count; ++i)
+  {
+    compressed_offsets[i] = compressed_size;
+    compressed_size += compressed_sizes[i];
+  }
+
+  if (compressed_size > f.GetSize() - f.Tell())
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  Common::UniqueBuffer<u8> compressed_data(compressed_size);
+  if (!f.ReadBytes(compressed_data.data(), compressed_size))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  raw_buffer.reset(size);
+  std::atomic<bool> failed = false;
+
+  pool.ParallelFor(chunk_count, [&](size_t i) {
+    const u8* in = compressed_data.data() + compressed_offsets[i];
+    u8* out = raw_buffer.data() + i * chunk_size;
+    const size_t out_size = std::min<u64>(chunk_size, size - i * chunk_size);
+
+    bool chunk_ok;
+    if (type == CompressionType::ChunkedZstd)
+    {
+      const size_t decompressed_len = ZSTD_decompress(out, out_size, in, compressed_sizes[i]);
+      chunk_ok = !ZSTD_isError(decompressed_len) && decompressed_len == out_size;
+    }
+    else
+    {
+      const int decompressed_len = LZ4_decompress_safe(
+          reinterpret_cast<const char*>(in), reinterpret_cast<char*>(out),
+          static_cast<int>(compressed_sizes[i]), static_cast<int>(out_size));
+      chunk_ok = decompressed_len == static_cast<int>(out_size);
+    }
+
+    if (!chunk_ok)
+      failed = true;
+  });
+
+  if (failed)
+  {
+    PanicAlertFmtT("Internal compression error - failed to decompress state");
+    return false;
+  }
+
+  return true;
+}
+
+bool ReadPayloadFromFile(Common::UniqueBuffer<u8>& buffer, u64 size,
+                         CompressionType compression_type, File::IOFile& f,
+                         Common::ThreadPool& pool)
+{
+  switch (compression_type)
+  {
+  case CompressionType::LZ4:
+    return DecompressLZ4(buffer, size, f);
+  case CompressionType::ChunkedLZ4:
+  case CompressionType::ChunkedZstd:
+    return DecompressChunked(buffer, size, compression_type, f, pool);
+  case CompressionType::Uncompressed:
+    buffer.reset(size);
+    if (!f.ReadBytes(buffer.data(), size))
+    {
+      PanicAlertFmt("Error reading bytes: {0}", size);
+      return false;
+    }
+    return true;
+  default:
+    PanicAlertFmt("Unknown compression type {0}", static_cast<u16>(compression_type));
+    return false;
+  }
+}
+
+static bool LoadDeltaStateData(const std::string& filename, u64 size,
+                               const MemoryLayout& memory_layout, int delta_depth,
+                               File::IOFile& f, Common::UniqueBuffer<u8>& buffer)
+{
+  if (delta_depth >= MAX_DELTA_CHAIN_LENGTH)
+  {
+    PanicAlertFmt("Too many nested delta states");
+    return false;
+  }
+
+  DeltaStateHeader delta_header;
+  std::string base_filename;
+  if (!f.ReadArray(&delta_header, 1) || delta_header.page_size == 0 ||
+      delta_header.base_filename_length > f.GetSize() - f.Tell())
+  {
+    PanicAlertFmt("Unable to read delta state header");
+    return false;
+  }
+  base_filename.resize(delta_header.base_filename_length);
+  if (!f.ReadBytes(base_filename.data(), base_filename.size()))
+  {
+    PanicAlertFmt("Unable to read delta state header");
+    return false;
+  }
+
+  Common::UniqueBuffer<u8> delta;
+  if (delta_header.delta_compression_type == CompressionType::Delta ||
+      !ReadPayloadFromFile(delta, delta_header.delta_size,
+                           static_cast<CompressionType>(delta_header.delta_compression_type), f,
+                           s_compression_pool))
+  {
+    return false;
+  }
+
+  std::lock_guard lk(s_delta_base_mutex);
+
+  // Look next to the delta if the base has been moved along with it.
+  if (!File::Exists(base_filename))
+  {
+    base_filename = (std::filesystem::path(filename).parent_path() /
+                     std::filesystem::path(base_filename).filename())
+                        .string();
+  }
+
+  if (!UpdateDeltaBase(base_filename, delta_depth + 1))
+  {
+    Core::DisplayMessage(fmt::format("Base state {} not found", base_filename), 2000);
+    return false;
+  }
+
+  const std::span<const u8> base = s_delta_base.data;
+  if (base.size() != delta_header.base_size || s_delta_base.crc32 != delta_header.base_crc32)
+  {
+    Core::DisplayMessage(fmt::format("Base state {} has changed", base_filename), 2000);
+    return false;
+  }
+
+  if (!ApplyDelta(base, s_delta_base.memory_layout, delta, memory_layout, size,
+                  delta_header.page_size, buffer))
+  {
+    PanicAlertFmt("Delta state corrupted");
+    return false;
+  }
+
+  return true;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -737,7 +1183,8 @@ static bool ValidateHeaders(const StateHeader& header)
   return success;
 }
 
-static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<u8>& ret_data)
+static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<u8>& ret_data,
+                              int delta_depth, MemoryLayout* memory_layout)
 {
   File::IOFile f;
   f.Open(filename, "rb");
@@ -754,54 +1201,78 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
   }
   // If StateExtendedHeader is amended to include more than the base, add ReadBytes() calls here.
 
-  if (extended_header.base_header.header_version != EXTENDED_HEADER_VERSION)
+  const StateExtendedBaseHeader& base_header = extended_header.base_header;
+  if (base_header.header_version == EXTENDED_HEADER_VERSION_WITHOUT_MEMORY_LAYOUT)
+  {
+    extended_header.memory_layout = {};
+  }
+  else if (base_header.header_version != EXTENDED_HEADER_VERSION ||
+           base_header.payload_offset < sizeof(extended_header.memory_layout) ||
+           !f.ReadArray(&extended_header.memory_layout, 1) ||
+           !f.Seek(base_header.payload_offset - sizeof(extended_header.memory_layout),
+                   File::SeekOrigin::Current))
   {
     PanicAlertFmt("State header corrupted");
     return;
   }
 
+  if (!IsValidMemoryLayout(extended_header.memory_layout, base_header.uncompressed_size))
+    extended_header.memory_layout = {};
+
   Common::UniqueBuffer<u8> buffer;
 
-  switch (extended_header.base_header.compression_type)
-  {
-  case CompressionType::LZ4:
+  const auto compression_type =
+      static_cast<CompressionType>(extended_header.base_header.compression_type);
+  if (compression_type == CompressionType::Delta)
   {
-    Core::DisplayMessage("Decompressing State...", OSD::Duration::SHORT);
-    if (!DecompressLZ4(buffer, extended_header.base_header.uncompressed_size, f))
+    if (!LoadDeltaStateData(filename, extended_header.base_header.uncompressed_size,
+                            extended_header.memory_layout, delta_depth, f, buffer))
+    {
       return;
-
-    break;
+    }
   }
-  case CompressionType::Uncompressed:
+  else
   {
-    u64 header_len = sizeof(StateHeaderLegacy) + sizeof(StateHeaderVersion) +
-                     header.version_header.version_string_length + sizeof(StateExtendedBaseHeader) +
-                     extended_header.base_header.payload_offset;
+    u64 size = extended_header.base_header.uncompressed_size;
+    if (compression_type == CompressionType::Uncompressed)
+    {
+      // The payload of uncompressed states is the rest of the file.
+      u64 header_len = sizeof(StateHeaderLegacy) + sizeof(StateHeaderVersion) +
+                       header.version_header.version_string_length +
+                       sizeof(StateExtendedBaseHeader) + extended_header.base_header.payload_offset;
 
-    u64 file_size = f.GetSize();
-    if (file_size < header_len)
+      u64 file_size = f.GetSize();
+      if (file_size < header_len)
+      {
+        PanicAlertFmt("State header length corrupted");
+        return;
+      }
+      size = file_size - header_len;
+    }
+    else if (compression_type == CompressionType::LZ4)
     {
-      PanicAlertFmt("State header length corrupted");
-      return;
+      Core::DisplayMessage("Decompressing State...", OSD::Duration::SHORT);
     }
 
-    const auto size = static_cast<size_t>(file_size - header_len);
-    buffer.reset(size);
-
-    if (!f.ReadBytes(buffer.data(), size))
-    {
-      PanicAlertFmt("Error reading bytes: {0}", size);
+    if (!ReadPayloadFromFile(buffer, size, compression_type, f, s_compression_pool))
       return;
-    }
-    break;
-  }
-  default:
-    PanicAlertFmt("Unknown compression type {0}", extended_header.base_header.compression_type);
-    return;
   }
 
   // all good
   ret_data.swap(buffer);
+  if (memory_layout)
+    *memory_layout = extended_header.memory_layout;
+}
+
+bool ReadStateFileData(const std::string& filename, Common::UniqueBuffer<u8>& data)
+{
+  Common::UniqueBuffer<u8> buffer;
+  LoadFileStateData(filename, buffer);
+  if (buffer.empty())
+    return false;
+
+  data.swap(buffer);
+  return true;
 }
 
 static void LoadAsFromCore(Core::System& system, std::string filename)
@@ -881,10 +1352,59 @@ void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback)
   s_on_after_load_callback = std::move(callback);
 }
 
+static void AddRewindCapture(RewindCaptureArgs args)
+{
+  s_rewind_buffer.SetMemoryBudget(size_t(Config::Get(Config::MAIN_REWIND_MEMORY_BUDGET_MB)) *
+                                  1024 * 1024);
+  s_rewind_buffer.Push(std::span(args.buffer.data(), args.size), args.memory_layout);
+
+  {
+    std::lock_guard lk(s_spare_rewind_buffers_mutex);
+    if (s_spare_rewind_buffers.size() < MAX_PENDING_REWIND_CAPTURES)
+      s_spare_rewind_buffers.push_back(std::move(args.buffer));
+  }
+
+  --s_pending_rewind_captures;
+}
+
+// Runs at the end of CoreTiming's Advance rather than directly from UpdateRewind, as UpdateRewind
+// is called in the middle of the VideoInterface event, where neither the state of the
+// VideoInterface nor the timing state of the slice is consistent.
+static void CaptureRewindSnapshot(Core::System& system)
+{
+  if (s_pending_rewind_captures >= MAX_PENDING_REWIND_CAPTURES)
+    return;
+
+  Common::UniqueBuffer<u8> buffer;
+  {
+    std::lock_guard lk(s_spare_rewind_buffers_mutex);
+    if (!s_spare_rewind_buffers.empty())
+    {
+      buffer = std::move(s_spare_rewind_buffers.back());
+      s_spare_rewind_buffers.pop_back();
+    }
+  }
+  if (buffer.empty())
+    buffer.reset(std::size_t(s_last_state_size) * 110 / 100);
+
+  const size_t size = SaveToBuffer(system, buffer);
+  if (size == 0)
+    return;
+
+  const MemoryLayout memory_layout = GetSavedMemoryLayout(system, buffer.data());
+  ++s_pending_rewind_captures;
+  s_rewind_thread.EmplaceItem(RewindCaptureArgs{
+      .buffer = std::move(buffer), .size = size, .memory_layout = memory_layout});
+}
+
 void Init(Core::System& system)
 {
   s_compress_and_dump_thread.Reset("Savestate Worker",
                                    std::bind_front(&CompressAndDumpState, std::ref(system)));
+  s_compression_pool.Reset("Savestate Compression", Common::ThreadPool::GetAutomaticThreadCount());
+
+  s_rewind_thread.Reset("Rewind Worker", &AddRewindCapture);
+  s_fields_since_rewind_capture = 0;
 
   s_flush_unsaved_data_hook = UICommon::AddFlushUnsavedDataCallback([] {
     // Holding the lock for any amount of time means there are no pending state save tasks.
@@ -895,7 +1415,13 @@ void Init(Core::System& system)
 void Shutdown()
 {
   s_compress_and_dump_thread.Shutdown();
+  s_rewind_thread.Shutdown();
+  s_compression_pool.Shutdown();
+  s_rewind_buffer.Clear();
+  s_spare_rewind_buffers.clear();
+  s_pending_rewind_captures = 0;
   s_undo_load_buffer.reset();
+  s_delta_base = {};
   s_flush_unsaved_data_hook.reset();
 }
 
@@ -990,4 +1516,53 @@ void UndoSaveState(Core::System& system)
   LoadAs(system, File::GetUserPath(D_STATESAVES_IDX) + "lastState.sav");
 }
 
+void UpdateRewind(Core::System& system)
+{
+  if (!Config::Get(Config::MAIN_REWIND_ENABLED) || NetPlay::IsNetPlayRunning() ||
+      AchievementManager::GetInstance().IsHardcoreModeActive())
+  {
+    return;
+  }
+
+  if (++s_fields_since_rewind_capture < Config::Get(Config::MAIN_REWIND_INTERVAL))
+    return;
+
+  s_fields_since_rewind_capture = 0;
+  system.GetCoreTiming().RunAfterAdvance([&system] { CaptureRewindSnapshot(system); });
+}
+
+void Rewind(Core::System& system)
+{
+  if (!CheckIfStateLoadIsAllowed(system))
+    return;
+
+  Core::RunOnCPUThread(system, [&system] {
+    if (system.GetMovie().IsMovieActive())
+    {
+      Core::DisplayMessage("Rewinding is not available while a movie is active", 2000);
+      return;
+    }
+
+    // Captures which haven't been added to the buffer yet are the newest ones.
+    s_rewind_thread.WaitForCompletion();
+
+    Common::UniqueBuffer<u8> buffer;
+    if (!s_rewind_buffer.Pop(buffer))
+    {
+      Core::DisplayMessage("Nothing to rewind", 2000);
+      return;
+    }
+
+    if (!LoadFromBuffer(system, buffer))
+    {
+      Core::DisplayMessage("Failed to rewind", OSD::Duration::NORMAL);
+      return;
+    }
+
+    s_fields_since_rewind_capture = 0;
+    Core::DisplayMessage(
+        fmt::format("Rewound ({} snapshots left)", s_rewind_buffer.GetSnapshotCount()), 1000);
+  });
+}
+
 }  // namespace State
@@ -7,16 +7,29 @@
 
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <string>
 #include <type_traits>
 
+#include "Common/Buffer.h"
 #include "Common/CommonTypes.h"
+#include "Core/StateDelta.h"
+
+namespace Common
+{
+class ThreadPool;
+}
 
 namespace Core
 {
 class System;
 }
 
+namespace File
+{
+class IOFile;
+}
+
 namespace State
 {
 // number of states
@@ -54,6 +67,13 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // The payload is split into chunks of equal size which are compressed independently, so that
+  // they can be compressed and decompressed in parallel. See CompressBufferToFileChunked().
+  ChunkedLZ4 = 2,
+  ChunkedZstd = 3,
+  // Only the pages of memory which differ from another state file (the base) and the rest of the
+  // state are stored. See CreateDelta().
+  Delta = 4,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
@@ -74,6 +94,9 @@ static_assert(std::is_trivially_copyable_v<StateExtendedBaseHeader>);
 struct StateExtendedHeader
 {
   StateExtendedBaseHeader base_header;
+  // Where the memory regions are in the uncompressed data, for comparing it against other states.
+  // Empty for states with an extended header version of 1.
+  MemoryLayout memory_layout;
   // Feel free to add new fields here, adjusting COMPRESSED_DATA_OFFSET accordingly, as well as
   // CreateExtendedHeader(). Add the appropriate IOFile read/write calls within LoadFileStateData()
   // and WriteHeadersToFile()
@@ -96,6 +119,10 @@ void Save(Core::System& system, int slot);
 void Load(Core::System& system, int slot);
 
 void SaveAs(Core::System& system, std::string filename);
+// Like SaveAs, but only stores the parts of the state which differ from the state in base_filename.
+// Loading the resulting file requires the base state to be unchanged. If the base can't be used,
+// a full state is saved instead.
+void SaveDeltaAs(Core::System& system, std::string filename, std::string base_filename);
 void LoadAs(Core::System& system, std::string filename);
 
 void LoadLastSaved(Core::System& system, int i = 1);
@@ -103,6 +130,25 @@ void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
 void UndoLoadState(Core::System& system);
 
+// Takes a snapshot for rewinding if rewinding is enabled and enough fields have passed since the
+// last one. Called from the CPU thread at the start of every field.
+void UpdateRewind(Core::System& system);
+// Restores the newest rewind snapshot and drops it, so that repeated calls go further back.
+void Rewind(Core::System& system);
+
+// Writes a state payload to f the way a state file with the given compression type stores it, and
+// reads it back. The chunked compression types are spread across pool. These are used by the
+// savestate code and by DolphinTool's statebench command.
+void WritePayloadToFile(std::span<const u8> buffer, CompressionType compression_type,
+                        File::IOFile& f, Common::ThreadPool& pool);
+bool ReadPayloadFromFile(Common::UniqueBuffer<u8>& buffer, u64 size,
+                         CompressionType compression_type, File::IOFile& f,
+                         Common::ThreadPool& pool);
+
+// Reads the uncompressed payload of a state file, following delta states to their bases.
+// Returns false if the file couldn't be read.
+bool ReadStateFileData(const std::string& filename, Common::UniqueBuffer<u8>& data);
+
 // for calling back into UI code without introducing a dependency on it in core
 using AfterLoadCallbackFunc = std::function<void()>;
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback);
@@ -0,0 +1,196 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/StateDelta.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace State
+{
+// Calls function(offset, size) for each part of a state of the given size which lies outside of
+// the memory regions, in order.
+template <typename Function>
+static void ForEachUnmappedRange(const MemoryLayout& layout, u64 state_size,
+                                 const Function& function)
+{
+  u64 position = 0;
+  for (const MemoryRegion& region : layout)
+  {
+    if (region.size == 0)
+      continue;
+
+    function(position, region.offset - position);
+    position = region.offset + region.size;
+  }
+  function(position, state_size - position);
+}
+
+bool IsValidMemoryLayout(const MemoryLayout& layout, u64 state_size)
+{
+  u64 position = 0;
+  for (const MemoryRegion& region : layout)
+  {
+    if (region.size == 0)
+      continue;
+
+    if (region.offset < position || region.offset > state_size ||
+        region.size > state_size - region.offset)
+    {
+      return false;
+    }
+    position = region.offset + region.size;
+  }
+  return true;
+}
+
+Common::UniqueBuffer<u8> CreateDelta(std::span<const u8> base, const MemoryLayout& base_layout,
+                                     std::span<const u8> target, const MemoryLayout& target_layout,
+                                     u32 page_size)
+{
+  std::array<std::vector<u32>, std::tuple_size_v<MemoryLayout>> changed_pages;
+  size_t page_index_count = 0;
+  size_t page_data_size = 0;
+  size_t memory_size = 0;
+  for (size_t i = 0; i < target_layout.size(); ++i)
+  {
+    const MemoryRegion& region = target_layout[i];
+    const MemoryRegion& base_region = base_layout[i];
+    const u8* const target_data = target.data() + region.offset;
+    const u8* const base_data = base.data() + base_region.offset;
+
+    for (u64 offset = 0; offset < region.size; offset += page_size)
+    {
+      const size_t size = static_cast<size_t>(std::min<u64>(page_size, region.size - offset));
+      if (offset + size > base_region.size ||
+          std::memcmp(base_data + offset, target_data + offset, size) != 0)
+      {
+        changed_pages[i].push_back(static_cast<u32>(offset / page_size));
+        page_data_size += size;
+      }
+    }
+
+    page_index_count += changed_pages[i].size();
+    memory_size += region.size;
+  }
+
+  const size_t header_size = (changed_pages.size() + page_index_count) * sizeof(u32);
+  Common::UniqueBuffer<u8> delta(header_size + (target.size() - memory_size) + page_data_size);
+
+  u8* out = delta.data();
+  const auto write_u32 = [&out](u32 value) {
+    std::memcpy(out, &value, sizeof(u32));
+    out += sizeof(u32);
+  };
+  for (const std::vector<u32>& pages : changed_pages)
+    write_u32(static_cast<u32>(pages.size()));
+  for (const std::vector<u32>& pages : changed_pages)
+  {
+    for (const u32 page : pages)
+      write_u32(page);
+  }
+
+  ForEachUnmappedRange(target_layout, target.size(), [&](u64 offset, u64 size) {
+    std::memcpy(out, target.data() + offset, size);
+    out += size;
+  });
+
+  for (size_t i = 0; i < target_layout.size(); ++i)
+  {
+    const MemoryRegion& region = target_layout[i];
+    for (const u32 page : changed_pages[i])
+    {
+      const u64 offset = u64(page) * page_size;
+      const size_t size = static_cast<size_t>(std::min<u64>(page_size, region.size - offset));
+      std::memcpy(out, target.data() + region.offset + offset, size);
+      out += size;
+    }
+  }
+
+  return delta;
+}
+
+bool ApplyDelta(std::span<const u8> base, const MemoryLayout& base_layout,
+                std::span<const u8> delta, const MemoryLayout& target_layout, u64 target_size,
+                u32 page_size, Common::UniqueBuffer<u8>& target)
+{
+  if (page_size == 0 || !IsValidMemoryLayout(base_layout, base.size()) ||
+      !IsValidMemoryLayout(target_layout, target_size))
+  {
+    return false;
+  }
+
+  const u8* in = delta.data();
+  const u8* const in_end = delta.data() + delta.size();
+  const auto read_u32 = [&in, in_end](u32* value) {
+    if (in_end - in < static_cast<ptrdiff_t>(sizeof(u32)))
+      return false;
+    std::memcpy(value, in, sizeof(u32));
+    in += sizeof(u32);
+    return true;
+  };
+
+  std::array<u32, std::tuple_size_v<MemoryLayout>> changed_page_counts;
+  for (u32& count : changed_page_counts)
+  {
+    if (!read_u32(&count))
+      return false;
+  }
+
+  std::array<std::vector<u32>, std::tuple_size_v<MemoryLayout>> changed_pages;
+  for (size_t i = 0; i < changed_pages.size(); ++i)
+  {
+    if (changed_page_counts[i] > static_cast<u64>(in_end - in) / sizeof(u32))
+      return false;
+
+    changed_pages[i].resize(changed_page_counts[i]);
+    for (u32& page : changed_pages[i])
+      read_u32(&page);
+  }
+
+  target.reset(target_size);
+
+  bool success = true;
+  ForEachUnmappedRange(target_layout, target_size, [&](u64 offset, u64 size) {
+    if (!success || size > static_cast<u64>(in_end - in))
+    {
+      success = false;
+      return;
+    }
+    std::memcpy(target.data() + offset, in, size);
+    in += size;
+  });
+  if (!success)
+    return false;
+
+  for (size_t i = 0; i < target_layout.size(); ++i)
+  {
+    const MemoryRegion& region = target_layout[i];
+    const MemoryRegion& base_region = base_layout[i];
+    u8* const target_data = target.data() + region.offset;
+
+    // Pages past the end of the base region are always part of the delta.
+    const u64 base_size = std::min(region.size, base_region.size);
+    std::memcpy(target_data, base.data() + base_region.offset, base_size);
+    std::memset(target_data + base_size, 0, region.size - base_size);
+
+    for (const u32 page : changed_pages[i])
+    {
+      const u64 offset = u64(page) * page_size;
+      if (offset >= region.size)
+        return false;
+
+      const u64 size = std::min<u64>(page_size, region.size - offset);
+      if (size > static_cast<u64>(in_end - in))
+        return false;
+
+      std::memcpy(target_data + offset, in, size);
+      in += size;
+    }
+  }
+
+  return in == in_end;
+}
+}  // namespace State
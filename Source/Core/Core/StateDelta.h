@@ -0,0 +1,53 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <span>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+
+namespace State
+{
+// A part of the uncompressed data of a state which holds emulated memory.
+struct MemoryRegion
+{
+  u64 offset = 0;
+  u64 size = 0;
+
+  bool operator==(const MemoryRegion&) const = default;
+};
+
+// Where RAM, the L1 cache, fake VMEM and EXRAM (in the order MemoryManager::DoState stores them)
+// are in the data of a state. Regions which don't exist are empty.
+//
+// Unlike the rest of a state, these regions have the same size in every state of a game. Comparing
+// two states region by region means that a section before them which changes its size doesn't make
+// all of memory look different.
+using MemoryLayout = std::array<MemoryRegion, 4>;
+
+// Returns whether the non-empty regions are in ascending order, don't overlap, and lie within a
+// state of the given size.
+bool IsValidMemoryLayout(const MemoryLayout& layout, u64 state_size);
+
+// Returns a delta from which ApplyDelta can reconstruct target using base. The memory regions are
+// compared page by page against the corresponding regions of base, and only the pages which
+// differ are stored. Everything outside of the memory regions is stored whole.
+//
+// The delta is laid out as:
+// u32 changed_page_counts[layout size];
+// u32 page_indices[sum of changed_page_counts];  // relative to the region, ascending per region
+// the bytes of target outside of its memory regions, back to back
+// the changed pages, back to back (the last page of a region may be shorter than page_size)
+Common::UniqueBuffer<u8> CreateDelta(std::span<const u8> base, const MemoryLayout& base_layout,
+                                     std::span<const u8> target, const MemoryLayout& target_layout,
+                                     u32 page_size);
+
+// Reconstructs the target that a delta was created for. Returns false if the delta is corrupted or
+// doesn't match the given layouts and size.
+bool ApplyDelta(std::span<const u8> base, const MemoryLayout& base_layout,
+                std::span<const u8> delta, const MemoryLayout& target_layout, u64 target_size,
+                u32 page_size, Common::UniqueBuffer<u8>& target);
+}  // namespace State
@@ -4,16 +4,21 @@
 #include "DiscIO/Blob.h"
 
 #include <algorithm>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
 #include "Common/DirectIOFile.h"
 #include "Common/MsgHandler.h"
+#include "Common/ThreadPool.h"
 
 #include "DiscIO/CISOBlob.h"
+#include "DiscIO/ChunkStoreBlob.h"
 #include "DiscIO/CompressedBlob.h"
 #include "DiscIO/DirectoryBlob.h"
 #include "DiscIO/FileBlob.h"
@@ -55,11 +60,117 @@ std::string GetName(BlobType blob_type, bool translate)
     return "NFS";
   case BlobType::SPLIT_PLAIN:
     return translate_str("Multi-part ISO");
+  case BlobType::CHUNK_STORE:
+    return "DCS";
   default:
     return "";
   }
 }
 
+// Runs the reads of BlobReader::ReadAsync on worker threads, with one copy of the reader for each
+// worker, since readers can't be used by several threads at once.
+class AsyncReadWorkers
+{
+public:
+  explicit AsyncReadWorkers(std::vector<std::unique_ptr<BlobReader>> readers)
+      : m_idle_readers(std::move(readers)),
+        m_workers("Blob Reader", static_cast<u32>(m_idle_readers.size()))
+  {
+  }
+
+  void Push(std::function<bool(BlobReader&)> read, AsyncReadCallback callback)
+  {
+    m_workers.Push([this, read = std::move(read), callback = std::move(callback)] {
+      std::unique_ptr<BlobReader> reader;
+      {
+        std::lock_guard lk(m_mutex);
+        reader = std::move(m_idle_readers.back());
+        m_idle_readers.pop_back();
+      }
+
+      const bool success = read(*reader);
+
+      {
+        std::lock_guard lk(m_mutex);
+        m_idle_readers.push_back(std::move(reader));
+      }
+
+      callback(success);
+    });
+  }
+
+  void WaitForCompletion() { m_workers.WaitForCompletion(); }
+
+private:
+  // There are as many readers as workers, so a worker always finds an idle one.
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<BlobReader>> m_idle_readers;
+
+  Common::ThreadPool m_workers;
+};
+
+BlobReader::BlobReader() = default;
+
+BlobReader::~BlobReader() = default;
+
+void BlobReader::ReadAsync(u64 offset, u64 size, u8* out_ptr, AsyncReadCallback callback)
+{
+  AsyncReadWorkers* workers = GetAsyncReadWorkers();
+  if (!workers)
+  {
+    callback(Read(offset, size, out_ptr));
+    return;
+  }
+
+  workers->Push(
+      [offset, size, out_ptr](BlobReader& reader) { return reader.Read(offset, size, out_ptr); },
+      std::move(callback));
+}
+
+void BlobReader::ReadWiiDecryptedAsync(u64 offset, u64 size, u8* out_ptr,
+                                       u64 partition_data_offset, AsyncReadCallback callback)
+{
+  AsyncReadWorkers* workers = GetAsyncReadWorkers();
+  if (!workers)
+  {
+    callback(ReadWiiDecrypted(offset, size, out_ptr, partition_data_offset));
+    return;
+  }
+
+  workers->Push(
+      [offset, size, out_ptr, partition_data_offset](BlobReader& reader) {
+        return reader.ReadWiiDecrypted(offset, size, out_ptr, partition_data_offset);
+      },
+      std::move(callback));
+}
+
+void BlobReader::WaitForAsyncReads()
+{
+  if (m_async_read_workers)
+    m_async_read_workers->WaitForCompletion();
+}
+
+AsyncReadWorkers* BlobReader::GetAsyncReadWorkers()
+{
+  if (m_async_read_workers || m_async_read_copy_failed)
+    return m_async_read_workers.get();
+
+  std::vector<std::unique_ptr<BlobReader>> readers(std::max(GetAsyncReadThreadCount(), 1u));
+  for (std::unique_ptr<BlobReader>& reader : readers)
+  {
+    reader = CopyReader();
+    if (!reader)
+    {
+      // Fall back to reading synchronously
+      m_async_read_copy_failed = true;
+      return nullptr;
+    }
+  }
+
+  m_async_read_workers = std::make_unique<AsyncReadWorkers>(std::move(readers));
+  return m_async_read_workers.get();
+}
+
 void SectorReader::SetSectorSize(int blocksize)
 {
   m_block_size = std::max(blocksize, 0);
@@ -241,6 +352,8 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename)
     return RVZFileReader::Create(std::move(file), filename);
   case NFS_MAGIC:
     return NFSFileReader::Create(std::move(file), filename);
+  case CHUNK_STORE_MAGIC:
+    return ChunkStoreFileReader::Create(std::move(file), filename);
   default:
     if (auto directory_blob = DirectoryBlobReader::Create(filename))
       return std::move(directory_blob);
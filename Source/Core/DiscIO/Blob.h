@@ -42,6 +42,7 @@ enum class BlobType
   MOD_DESCRIPTOR,
   NFS,
   SPLIT_PLAIN,
+  CHUNK_STORE,
 };
 
 // If you convert an ISO file to another format and then call GetDataSize on it, what is the result?
@@ -58,10 +59,14 @@ enum class DataSizeType
 
 std::string GetName(BlobType blob_type, bool translate);
 
+using AsyncReadCallback = std::function<void(bool success)>;
+
+class AsyncReadWorkers;
+
 class BlobReader
 {
 public:
-  virtual ~BlobReader() = default;
+  virtual ~BlobReader();
 
   virtual BlobType GetBlobType() const = 0;
   virtual std::unique_ptr<BlobReader> CopyReader() const = 0;
@@ -97,11 +102,34 @@ public:
     return false;
   }
 
+  // Start a read in the background and call the callback with the result once it has finished.
+  // The callback may be called on any thread, even before these functions return, and out_ptr
+  // must stay valid until it has been called. Several reads can be in flight at the same time,
+  // and they may finish in any order. Like Read, these must not be called from multiple threads.
+  // By default, the reads are done with copies of this reader on worker threads.
+  virtual void ReadAsync(u64 offset, u64 size, u8* out_ptr, AsyncReadCallback callback);
+  virtual void ReadWiiDecryptedAsync(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset,
+                                     AsyncReadCallback callback);
+
+  // Blocks until all reads started with ReadAsync have finished and their callbacks returned.
+  virtual void WaitForAsyncReads();
+
   // Returns true only for CachedBlobReader.
   virtual bool IsCached() const { return false; }
 
 protected:
-  BlobReader() {}
+  BlobReader();
+
+  // How many copies of the reader the default ReadAsync uses at the same time. Readers which
+  // cache decompressed data should keep this at 1, so that the copies don't decompress the same
+  // data more than once.
+  virtual u32 GetAsyncReadThreadCount() const { return 1; }
+
+private:
+  AsyncReadWorkers* GetAsyncReadWorkers();
+
+  std::unique_ptr<AsyncReadWorkers> m_async_read_workers;
+  bool m_async_read_copy_failed = false;
 };
 
 // Provides caching and byte-operation-to-block-operations facilities.
@@ -206,5 +234,8 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
                        int chunk_size, const CompressCB& callback);
+bool ConvertToChunkStore(BlobReader* infile, const std::string& infile_path,
+                         const std::string& outfile_path, const std::string& store_path,
+                         int compression_level, int chunk_size, const CompressCB& callback);
 
 }  // namespace DiscIO
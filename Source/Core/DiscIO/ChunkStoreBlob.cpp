@@ -0,0 +1,877 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DiscIO/ChunkStoreBlob.h"
+
+#include <algorithm>
+#include <cstring>
+#include <expected>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/Align.h"
+#include "Common/Assert.h"
+#include "Common/BitUtils.h"
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/AES.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+#include "Common/Random.h"
+#include "Common/StringUtil.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/Filesystem.h"
+#include "DiscIO/MultithreadedCompressor.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeDisc.h"
+#include "DiscIO/VolumeWii.h"
+#include "DiscIO/WIABlob.h"
+#include "DiscIO/WIACompression.h"
+
+namespace DiscIO
+{
+// The decompressed chunks are kept in a cache shared by all chunk store readers, so that discs
+// which share chunks also share the memory for them.
+class ChunkCache
+{
+public:
+  using Chunk = std::shared_ptr<const std::vector<u8>>;
+
+  Chunk Get(const Common::SHA1::Digest& hash)
+  {
+    std::lock_guard lk(m_mutex);
+
+    const auto it = m_entries.find(hash);
+    if (it == m_entries.end())
+      return nullptr;
+
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    return it->second->chunk;
+  }
+
+  void Insert(const Common::SHA1::Digest& hash, Chunk chunk)
+  {
+    std::lock_guard lk(m_mutex);
+
+    if (m_entries.contains(hash))
+      return;
+
+    m_size += chunk->size();
+    m_lru.emplace_front(Entry{hash, std::move(chunk)});
+    m_entries.emplace(hash, m_lru.begin());
+
+    // Readers which are still using an evicted chunk keep it alive until they're done with it
+    while (m_size > MAX_SIZE && m_lru.size() > 1)
+    {
+      m_size -= m_lru.back().chunk->size();
+      m_entries.erase(m_lru.back().hash);
+      m_lru.pop_back();
+    }
+  }
+
+private:
+  struct Entry
+  {
+    Common::SHA1::Digest hash;
+    Chunk chunk;
+  };
+
+  static constexpr size_t MAX_SIZE = 64 * 1024 * 1024;
+
+  std::list<Entry> m_lru;
+  std::map<Common::SHA1::Digest, std::list<Entry>::iterator> m_entries;
+  size_t m_size = 0;
+  std::mutex m_mutex;
+};
+
+static ChunkCache& GetChunkCache()
+{
+  static ChunkCache cache;
+  return cache;
+}
+
+static std::string GetChunkPath(const std::string& store_path, const Common::SHA1::Digest& hash)
+{
+  return fmt::format("{}/{}.zst", store_path, Common::SHA1::DigestToString(hash));
+}
+
+static std::shared_ptr<const std::vector<u8>> LoadChunk(const std::string& path,
+                                                         const Common::SHA1::Digest& hash, u64 size)
+{
+  File::DirectIOFile file(path, File::AccessMode::Read);
+  if (!file.IsOpen())
+    return nullptr;
+
+  ChunkStoreChunkHeader header;
+  if (!file.Read(Common::AsWritableU8Span(header)) || header.data_size != size)
+    return nullptr;
+
+  const u64 file_size = file.GetSize();
+  if (file_size < sizeof(header))
+    return nullptr;
+
+  DecompressionBuffer in;
+  in.data.resize(file_size - sizeof(header));
+  if (!file.Read(in.data))
+    return nullptr;
+  in.bytes_written = in.data.size();
+
+  std::unique_ptr<Decompressor> decompressor = std::make_unique<ZstdDecompressor>();
+  if (header.rvz_packed_size != 0)
+  {
+    // The chunk was packed as starting at an offset which is a multiple of the block size
+    decompressor = std::make_unique<RVZPackDecompressor>(std::move(decompressor),
+                                                         DecompressionBuffer{}, 0,
+                                                         header.rvz_packed_size);
+  }
+
+  DecompressionBuffer out_buffer{std::vector<u8>(size), 0};
+  size_t in_bytes_read = 0;
+  while (out_buffer.bytes_written < out_buffer.data.size())
+  {
+    const size_t prev_bytes_written = out_buffer.bytes_written;
+    if (!decompressor->Decompress(in, &out_buffer, &in_bytes_read))
+      return nullptr;
+
+    // The compressed data ended before all of the data was decompressed
+    if (out_buffer.bytes_written == prev_bytes_written)
+      return nullptr;
+  }
+
+  // The chunk may have been damaged or replaced since it was stored, and as it can be shared by
+  // many discs, using it without checking would silently corrupt all of them
+  if (Common::SHA1::CalculateDigest(out_buffer.data) != hash)
+  {
+    ERROR_LOG_FMT(DISCIO, "Chunk {} doesn't match its hash", path);
+    return nullptr;
+  }
+
+  return std::make_shared<const std::vector<u8>>(std::move(out_buffer.data));
+}
+
+ChunkStoreFileReader::ChunkStoreFileReader(File::DirectIOFile file, std::string path)
+    : m_file(std::move(file)), m_path(std::move(path)), m_encryption_cache(this)
+{
+}
+
+std::unique_ptr<ChunkStoreFileReader> ChunkStoreFileReader::Create(File::DirectIOFile file,
+                                                                   const std::string& path)
+{
+  std::unique_ptr<ChunkStoreFileReader> reader(new ChunkStoreFileReader(std::move(file), path));
+  return reader->Initialize() ? std::move(reader) : nullptr;
+}
+
+bool ChunkStoreFileReader::Initialize()
+{
+  if (!m_file.Seek(0, File::SeekOrigin::Begin) ||
+      !m_file.Read(Common::AsWritableU8Span(m_header)) || m_header.magic != CHUNK_STORE_MAGIC)
+  {
+    return false;
+  }
+
+  if (m_header.version > VERSION)
+  {
+    ERROR_LOG_FMT(DISCIO, "Unsupported version {} in {}", m_header.version, m_path);
+    return false;
+  }
+
+  if (m_header.chunk_size == 0 || m_header.chunk_size % VolumeWii::BLOCK_TOTAL_SIZE != 0)
+    return false;
+
+  std::string store_path(m_header.store_path_size, '\0');
+  m_regions.resize(m_header.number_of_regions);
+  m_chunks.resize(m_header.number_of_chunks);
+  std::vector<ChunkStoreHashBlocks> hash_blocks(m_header.number_of_hash_blocks);
+  if (!m_file.Read(reinterpret_cast<u8*>(store_path.data()), store_path.size()) ||
+      !m_file.Read(Common::AsWritableU8Span(m_regions)) ||
+      !m_file.Read(Common::AsWritableU8Span(m_chunks)) ||
+      !m_file.Read(Common::AsWritableU8Span(hash_blocks)))
+  {
+    return false;
+  }
+
+  const std::filesystem::path store = StringToPath(store_path);
+  if (store.is_relative())
+    m_store_path = PathToString(StringToPath(m_path).parent_path() / store);
+  else
+    m_store_path = std::move(store_path);
+
+  // The regions must cover the whole disc without overlapping, and their chunks must exist
+  u64 offset = 0;
+  for (size_t i = 0; i < m_regions.size(); ++i)
+  {
+    const ChunkStoreRegion& region = m_regions[i];
+    if (region.offset != offset || region.size == 0)
+      return false;
+    if (region.is_partition && region.size % VolumeWii::BLOCK_TOTAL_SIZE != 0)
+      return false;
+
+    const u64 chunk_size = region.is_partition ? VolumeWii::GROUP_TOTAL_SIZE : m_header.chunk_size;
+    const u64 chunks = Common::AlignUp(region.size, chunk_size) / chunk_size;
+    if (region.first_chunk + chunks > m_chunks.size())
+      return false;
+
+    offset += region.size;
+    m_region_ends.emplace(offset, i);
+  }
+  if (offset != m_header.data_size)
+    return false;
+
+  for (const ChunkStoreHashBlocks& entry : hash_blocks)
+  {
+    if (entry.chunk_index >= m_chunks.size())
+      return false;
+    m_hash_blocks.emplace(entry.chunk_index, entry.hash);
+  }
+
+  return true;
+}
+
+std::unique_ptr<BlobReader> ChunkStoreFileReader::CopyReader() const
+{
+  return Create(m_file, m_path);
+}
+
+u64 ChunkStoreFileReader::GetDecryptedSize(const ChunkStoreRegion& region)
+{
+  return region.size / VolumeWii::BLOCK_TOTAL_SIZE * VolumeWii::BLOCK_DATA_SIZE;
+}
+
+const ChunkStoreRegion* ChunkStoreFileReader::GetPartition(u64 partition_data_offset) const
+{
+  const auto it = m_region_ends.upper_bound(partition_data_offset);
+  if (it == m_region_ends.end())
+    return nullptr;
+
+  const ChunkStoreRegion& region = m_regions[it->second];
+  if (!region.is_partition || region.offset != partition_data_offset)
+    return nullptr;
+
+  return &region;
+}
+
+bool ChunkStoreFileReader::Read(u64 offset, u64 size, u8* out_ptr)
+{
+  if (offset + size > m_header.data_size)
+    return false;
+
+  while (size > 0)
+  {
+    const auto it = m_region_ends.upper_bound(offset);
+    if (it == m_region_ends.end())
+      return false;
+
+    const ChunkStoreRegion& region = m_regions[it->second];
+    const u64 bytes_to_read = std::min(region.offset + region.size - offset, size);
+
+    if (region.is_partition)
+    {
+      bool hash_blocks_error = false;
+      if (!m_encryption_cache.EncryptGroups(
+              offset - region.offset, bytes_to_read, out_ptr, region.offset,
+              GetDecryptedSize(region), region.partition_key,
+              [this, &region, &hash_blocks_error](
+                  VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP], u64 offset_) {
+                const auto hash_it =
+                    m_hash_blocks.find(region.first_chunk + offset_ / VolumeWii::GROUP_TOTAL_SIZE);
+                if (hash_it == m_hash_blocks.end())
+                  return;
+
+                const Chunk chunk = GetChunk(
+                    hash_it->second, sizeof(VolumeWii::HashBlock) * VolumeWii::BLOCKS_PER_GROUP);
+                if (chunk)
+                  std::memcpy(hash_blocks, chunk->data(), chunk->size());
+                else
+                  hash_blocks_error = true;
+              }))
+      {
+        return false;
+      }
+      if (hash_blocks_error)
+        return false;
+    }
+    else
+    {
+      if (!ReadFromChunks(region, m_header.chunk_size, offset - region.offset, bytes_to_read,
+                          out_ptr))
+      {
+        return false;
+      }
+    }
+
+    offset += bytes_to_read;
+    size -= bytes_to_read;
+    out_ptr += bytes_to_read;
+  }
+
+  return true;
+}
+
+bool ChunkStoreFileReader::SupportsReadWiiDecrypted(u64 offset, u64 size,
+                                                    u64 partition_data_offset) const
+{
+  const ChunkStoreRegion* partition = GetPartition(partition_data_offset);
+  return partition && offset + size <= GetDecryptedSize(*partition);
+}
+
+bool ChunkStoreFileReader::ReadWiiDecrypted(u64 offset, u64 size, u8* out_ptr,
+                                            u64 partition_data_offset)
+{
+  const ChunkStoreRegion* partition = GetPartition(partition_data_offset);
+  if (!partition || offset + size > GetDecryptedSize(*partition))
+    return false;
+
+  return ReadFromChunks(*partition, VolumeWii::GROUP_DATA_SIZE, offset, size, out_ptr);
+}
+
+bool ChunkStoreFileReader::ReadFromChunks(const ChunkStoreRegion& region, u64 chunk_size,
+                                          u64 offset, u64 size, u8* out_ptr)
+{
+  const u64 data_size = region.is_partition ? GetDecryptedSize(region) : region.size;
+
+  while (size > 0)
+  {
+    const u64 chunk_index = offset / chunk_size;
+    const u64 offset_in_chunk = offset % chunk_size;
+    const u64 this_chunk_size = std::min(chunk_size, data_size - chunk_index * chunk_size);
+    const u64 bytes_to_read = std::min(this_chunk_size - offset_in_chunk, size);
+
+    const Chunk chunk = GetChunk(m_chunks[region.first_chunk + chunk_index], this_chunk_size);
+    if (!chunk)
+      return false;
+
+    std::memcpy(out_ptr, chunk->data() + offset_in_chunk, bytes_to_read);
+
+    offset += bytes_to_read;
+    size -= bytes_to_read;
+    out_ptr += bytes_to_read;
+  }
+
+  return true;
+}
+
+ChunkStoreFileReader::Chunk ChunkStoreFileReader::GetChunk(const Common::SHA1::Digest& hash,
+                                                           u64 size)
+{
+  if (m_cached_chunk && m_cached_chunk_hash == hash)
+    return m_cached_chunk;
+
+  ChunkCache& cache = GetChunkCache();
+  Chunk chunk = cache.Get(hash);
+  if (!chunk)
+  {
+    const std::string path = GetChunkPath(m_store_path, hash);
+    chunk = LoadChunk(path, hash, size);
+    if (!chunk)
+    {
+      ERROR_LOG_FMT(DISCIO, "Failed to load chunk {} of {}", path, m_path);
+      return nullptr;
+    }
+
+    cache.Insert(hash, chunk);
+  }
+
+  // Chunks with the same hash have the same size, unless the hash was written incorrectly
+  if (chunk->size() != size)
+    return nullptr;
+
+  m_cached_chunk_hash = hash;
+  m_cached_chunk = chunk;
+  return chunk;
+}
+
+struct ChunkStoreCompressThreadState
+{
+  using WiiBlockData = std::array<u8, VolumeWii::BLOCK_DATA_SIZE>;
+
+  std::unique_ptr<Compressor> compressor;
+
+  std::vector<WiiBlockData> decryption_buffer =
+      std::vector<WiiBlockData>(VolumeWii::BLOCKS_PER_GROUP);
+
+  std::vector<VolumeWii::HashBlock> hash_buffer =
+      std::vector<VolumeWii::HashBlock>(VolumeWii::BLOCKS_PER_GROUP);
+};
+
+struct ChunkStoreCompressParameters
+{
+  std::vector<u8> data{};
+  const ChunkStoreRegion* region = nullptr;
+  const FileSystem* file_system = nullptr;
+  u64 data_offset = 0;
+  size_t chunk_index = 0;
+  u64 bytes_read = 0;
+};
+
+struct ChunkStoreOutputChunk
+{
+  Common::SHA1::Digest hash{};
+
+  // Empty if the chunk already is in the store
+  std::vector<u8> file;
+};
+
+struct ChunkStoreOutputParameters
+{
+  ChunkStoreOutputChunk data;
+  std::optional<ChunkStoreOutputChunk> hash_blocks;
+  size_t chunk_index = 0;
+  u64 bytes_read = 0;
+};
+
+static ConversionResult<ChunkStoreOutputChunk>
+CompressChunk(Compressor* compressor, const std::string& store_path, const u8* data, size_t size,
+              std::optional<u64> data_offset, const FileSystem* file_system)
+{
+  ChunkStoreOutputChunk chunk;
+  chunk.hash = Common::SHA1::CalculateDigest(data, size);
+
+  // Chunks are shared between discs, so there is no need to compress data that's already stored
+  if (File::Exists(GetChunkPath(store_path, chunk.hash)))
+    return chunk;
+
+  ChunkStoreChunkHeader header{static_cast<u32>(size), 0};
+
+  // Junk data is only packed if the chunk starts at the beginning of a block, so that the chunk
+  // can be unpacked the same way wherever it's used
+  std::optional<std::vector<u8>> packed;
+  if (data_offset && *data_offset % VolumeWii::BLOCK_TOTAL_SIZE == 0)
+    packed = RVZPackData(data, size, *data_offset, true, file_system);
+  if (packed)
+  {
+    header.rvz_packed_size = static_cast<u32>(packed->size());
+    data = packed->data();
+    size = packed->size();
+  }
+
+  if (!compressor->Start(size) || !compressor->Compress(data, size) || !compressor->End())
+    return std::unexpected{ConversionResultCode::InternalError};
+
+  chunk.file.resize(sizeof(header) + compressor->GetSize());
+  std::memcpy(chunk.file.data(), &header, sizeof(header));
+  std::memcpy(chunk.file.data() + sizeof(header), compressor->GetData(), compressor->GetSize());
+
+  return chunk;
+}
+
+static ConversionResult<ChunkStoreOutputParameters>
+ProcessAndCompress(ChunkStoreCompressThreadState* state, ChunkStoreCompressParameters parameters,
+                   const std::string& store_path)
+{
+  ChunkStoreOutputParameters output{
+      {}, std::nullopt, parameters.chunk_index, parameters.bytes_read};
+
+  if (!parameters.region->is_partition)
+  {
+    ConversionResult<ChunkStoreOutputChunk> data =
+        CompressChunk(state->compressor.get(), store_path, parameters.data.data(),
+                      parameters.data.size(), parameters.data_offset, parameters.file_system);
+    if (!data)
+      return std::unexpected{data.error()};
+
+    output.data = std::move(*data);
+    return output;
+  }
+
+  ASSERT(parameters.data.size() % VolumeWii::BLOCK_TOTAL_SIZE == 0);
+  const size_t blocks = parameters.data.size() / VolumeWii::BLOCK_TOTAL_SIZE;
+
+  const auto aes_context =
+      Common::AES::CreateContextDecrypt(parameters.region->partition_key.data());
+
+  for (size_t i = 0; i < VolumeWii::BLOCKS_PER_GROUP; ++i)
+  {
+    if (i < blocks)
+    {
+      VolumeWii::DecryptBlockData(parameters.data.data() + i * VolumeWii::BLOCK_TOTAL_SIZE,
+                                  state->decryption_buffer[i].data(), aes_context.get());
+    }
+    else
+    {
+      state->decryption_buffer[i].fill(0);
+    }
+  }
+
+  VolumeWii::HashGroup(state->decryption_buffer.data(), state->hash_buffer.data());
+
+  // If recalculating the hashes doesn't give the original hash blocks, store the original ones
+  bool hashes_match = true;
+  for (size_t i = 0; i < blocks; ++i)
+  {
+    VolumeWii::HashBlock hashes;
+    VolumeWii::DecryptBlockHashes(parameters.data.data() + i * VolumeWii::BLOCK_TOTAL_SIZE,
+                                  &hashes, aes_context.get());
+
+    if (std::memcmp(&hashes, &state->hash_buffer[i], sizeof(hashes)) != 0)
+    {
+      hashes_match = false;
+      state->hash_buffer[i] = hashes;
+    }
+  }
+
+  static_assert(std::is_trivially_copyable_v<ChunkStoreCompressThreadState::WiiBlockData>);
+  ConversionResult<ChunkStoreOutputChunk> data = CompressChunk(
+      state->compressor.get(), store_path,
+      reinterpret_cast<const u8*>(state->decryption_buffer.data()),
+      blocks * VolumeWii::BLOCK_DATA_SIZE, parameters.data_offset, parameters.file_system);
+  if (!data)
+    return std::unexpected{data.error()};
+  output.data = std::move(*data);
+
+  if (!hashes_match)
+  {
+    ConversionResult<ChunkStoreOutputChunk> hash_blocks =
+        CompressChunk(state->compressor.get(), store_path,
+                      reinterpret_cast<const u8*>(state->hash_buffer.data()),
+                      state->hash_buffer.size() * sizeof(VolumeWii::HashBlock), std::nullopt,
+                      nullptr);
+    if (!hash_blocks)
+      return std::unexpected{hash_blocks.error()};
+    output.hash_blocks = std::move(*hash_blocks);
+  }
+
+  return output;
+}
+
+static ConversionResultCode WriteChunk(const ChunkStoreOutputChunk& chunk,
+                                       const std::string& store_path, u64* bytes_written)
+{
+  if (chunk.file.empty())
+    return ConversionResultCode::Success;
+
+  // Another thread or another conversion may have stored the same chunk in the meantime
+  const std::string path = GetChunkPath(store_path, chunk.hash);
+  if (File::Exists(path))
+    return ConversionResultCode::Success;
+
+  // Write to a temporary file first, so that a conversion which gets interrupted or runs at the
+  // same time as another one can't leave an incomplete chunk behind
+  const std::string temp_path =
+      fmt::format("{}.{:016x}.tmp", path, Common::Random::GenerateValue<u64>());
+  {
+    File::DirectIOFile file(temp_path, File::AccessMode::Write);
+    if (!file.IsOpen() || !file.Write(chunk.file))
+    {
+      file.Close();
+      File::Delete(temp_path);
+      return ConversionResultCode::WriteFailed;
+    }
+  }
+
+  if (!File::Rename(temp_path, path))
+  {
+    File::Delete(temp_path);
+    return ConversionResultCode::WriteFailed;
+  }
+
+  *bytes_written += chunk.file.size();
+  return ConversionResultCode::Success;
+}
+
+static ConversionResultCode SetUpRegions(const VolumeDisc* volume, u64 iso_size, u32 chunk_size,
+                                         std::vector<ChunkStoreRegion>* regions,
+                                         std::vector<const FileSystem*>* file_systems)
+{
+  std::vector<Partition> partitions;
+  if (volume && volume->HasWiiHashes() && volume->HasWiiEncryption())
+    partitions = volume->GetPartitions();
+
+  std::ranges::sort(partitions, {}, &Partition::offset);
+
+  const FileSystem* non_partition_file_system =
+      volume ? volume->GetFileSystem(PARTITION_NONE) : nullptr;
+
+  u32 total_chunks = 0;
+  const auto add_region = [&](u64 offset, u64 size, const FileSystem* file_system,
+                              const std::array<u8, VolumeWii::AES_KEY_SIZE>* partition_key) {
+    if (size == 0)
+      return;
+
+    ChunkStoreRegion& region = regions->emplace_back();
+    region.offset = offset;
+    region.size = size;
+    region.first_chunk = total_chunks;
+    region.is_partition = partition_key != nullptr;
+    region.partition_key = partition_key ? *partition_key : decltype(region.partition_key){};
+    file_systems->emplace_back(file_system);
+
+    const u64 region_chunk_size = partition_key ? VolumeWii::GROUP_TOTAL_SIZE : chunk_size;
+    total_chunks += static_cast<u32>(Common::AlignUp(size, region_chunk_size) / region_chunk_size);
+  };
+
+  u64 last_partition_end_offset = 0;
+  for (const Partition& partition : partitions)
+  {
+    // Partitions which are odd in some way are stored as raw data instead, like in RVZ
+
+    if (partition.offset < last_partition_end_offset)
+    {
+      WARN_LOG_FMT(DISCIO, "Overlapping partitions at {:x}", partition.offset);
+      continue;
+    }
+
+    if (volume->ReadSwapped<u32>(partition.offset, PARTITION_NONE) != 0x10001U)
+    {
+      WARN_LOG_FMT(DISCIO, "Invalid partition at {:x}", partition.offset);
+      continue;
+    }
+
+    const std::optional<u64> data_offset =
+        volume->ReadSwappedAndShifted(partition.offset + 0x2b8, PARTITION_NONE);
+    const std::optional<u64> data_size =
+        volume->ReadSwappedAndShifted(partition.offset + 0x2bc, PARTITION_NONE);
+
+    if (!data_offset || !data_size)
+      return ConversionResultCode::ReadFailed;
+
+    const u64 data_start = partition.offset + *data_offset;
+    if (data_start % VolumeWii::BLOCK_TOTAL_SIZE != 0 || data_start >= iso_size)
+    {
+      WARN_LOG_FMT(DISCIO, "Misaligned partition at {:x}", partition.offset);
+      continue;
+    }
+
+    const u64 size =
+        Common::AlignDown(std::min(*data_size, iso_size - data_start), VolumeWii::BLOCK_TOTAL_SIZE);
+    if (size == 0)
+    {
+      WARN_LOG_FMT(DISCIO, "Very small partition at {:x}", partition.offset);
+      continue;
+    }
+
+    const IOS::ES::TicketReader& ticket = volume->GetTicket(partition);
+    if (!ticket.IsValid())
+      return ConversionResultCode::ReadFailed;
+
+    const std::array<u8, VolumeWii::AES_KEY_SIZE> key = ticket.GetTitleKey();
+
+    add_region(last_partition_end_offset, data_start - last_partition_end_offset,
+               non_partition_file_system, nullptr);
+    add_region(data_start, size, volume->GetFileSystem(partition), &key);
+
+    last_partition_end_offset = data_start + size;
+  }
+
+  add_region(last_partition_end_offset, iso_size - last_partition_end_offset,
+             non_partition_file_system, nullptr);
+
+  return ConversionResultCode::Success;
+}
+
+static std::string GetStorePathForManifest(const std::string& store_path,
+                                           const std::string& manifest_path)
+{
+  // Storing the path relative to the manifest lets a library be moved as a whole
+  std::error_code error;
+  const std::filesystem::path store = std::filesystem::absolute(StringToPath(store_path), error);
+  const std::filesystem::path manifest_directory =
+      std::filesystem::absolute(StringToPath(manifest_path), error).parent_path();
+  if (error)
+    return store_path;
+
+  const std::filesystem::path relative = store.lexically_relative(manifest_directory);
+  if (relative.empty())
+    return PathToString(store);
+
+  std::string result = PathToString(relative);
+#ifdef _WIN32
+  std::ranges::replace(result, '\\', '/');
+#endif
+  return result;
+}
+
+static ConversionResultCode
+ConvertToChunkStore(BlobReader* infile, const VolumeDisc* infile_volume,
+                    File::DirectIOFile* outfile, const std::string& outfile_path,
+                    const std::string& store_path, int compression_level, u32 chunk_size,
+                    const CompressCB& callback)
+{
+  ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
+
+  if (!File::IsDirectory(store_path) && !File::CreateDirs(store_path))
+    return ConversionResultCode::WriteFailed;
+
+  const u64 iso_size = infile->GetDataSize();
+
+  std::vector<ChunkStoreRegion> regions;
+  std::vector<const FileSystem*> file_systems;
+  const ConversionResultCode set_up_regions_result =
+      SetUpRegions(infile_volume, iso_size, chunk_size, &regions, &file_systems);
+  if (set_up_regions_result != ConversionResultCode::Success)
+    return set_up_regions_result;
+
+  std::vector<Common::SHA1::Digest> chunks;
+  for (const ChunkStoreRegion& region : regions)
+  {
+    const u64 region_chunk_size = region.is_partition ? VolumeWii::GROUP_TOTAL_SIZE : chunk_size;
+    chunks.resize(region.first_chunk + Common::AlignUp(region.size, region_chunk_size) /
+                                           region_chunk_size);
+  }
+
+  std::vector<ChunkStoreHashBlocks> hash_blocks;
+  u64 bytes_written = 0;
+  const size_t progress_monitor = std::max<size_t>(1, chunks.size() / 1000);
+
+  const auto set_up_compress_thread_state = [&](ChunkStoreCompressThreadState* state) {
+    state->compressor = std::make_unique<ZstdCompressor>(compression_level);
+    return ConversionResultCode::Success;
+  };
+
+  const auto process_and_compress = [&](ChunkStoreCompressThreadState* state,
+                                        ChunkStoreCompressParameters parameters) {
+    return ProcessAndCompress(state, std::move(parameters), store_path);
+  };
+
+  const auto output = [&](ChunkStoreOutputParameters parameters) {
+    ConversionResultCode result = WriteChunk(parameters.data, store_path, &bytes_written);
+    if (result != ConversionResultCode::Success)
+      return result;
+    chunks[parameters.chunk_index] = parameters.data.hash;
+
+    if (parameters.hash_blocks)
+    {
+      result = WriteChunk(*parameters.hash_blocks, store_path, &bytes_written);
+      if (result != ConversionResultCode::Success)
+        return result;
+      hash_blocks.emplace_back(ChunkStoreHashBlocks{static_cast<u32>(parameters.chunk_index),
+                                                    parameters.hash_blocks->hash});
+    }
+
+    if (parameters.chunk_index % progress_monitor == 0)
+    {
+      const int ratio = parameters.bytes_read == 0 ?
+                            0 :
+                            static_cast<int>(100 * bytes_written / parameters.bytes_read);
+
+      const std::string text = Common::FmtFormatT("{0} of {1} blocks. Compression ratio {2}%",
+                                                  parameters.chunk_index, chunks.size(), ratio);
+
+      if (!callback(text, static_cast<float>(parameters.bytes_read) / iso_size))
+        return ConversionResultCode::Canceled;
+    }
+
+    return ConversionResultCode::Success;
+  };
+
+  MultithreadedCompressor<ChunkStoreCompressThreadState, ChunkStoreCompressParameters,
+                          ChunkStoreOutputParameters>
+      mt_compressor(set_up_compress_thread_state, process_and_compress, output);
+
+  std::vector<u8> buffer;
+  u64 bytes_read = 0;
+  for (size_t i = 0; i < regions.size(); ++i)
+  {
+    const ChunkStoreRegion& region = regions[i];
+    const u64 region_chunk_size = region.is_partition ? VolumeWii::GROUP_TOTAL_SIZE : chunk_size;
+
+    for (u64 offset = 0; offset < region.size; offset += region_chunk_size)
+    {
+      const ConversionResultCode status = mt_compressor.GetStatus();
+      if (status != ConversionResultCode::Success)
+        return status;
+
+      const u64 bytes_to_read = std::min(region_chunk_size, region.size - offset);
+      buffer.resize(bytes_to_read);
+      if (!infile->Read(region.offset + offset, bytes_to_read, buffer.data()))
+        return ConversionResultCode::ReadFailed;
+      bytes_read += bytes_to_read;
+
+      // The packing of junk data needs the offset of the data as the disc would be read
+      const u64 data_offset = region.is_partition ? offset / VolumeWii::BLOCK_TOTAL_SIZE *
+                                                        VolumeWii::BLOCK_DATA_SIZE :
+                                                    region.offset + offset;
+
+      mt_compressor.CompressAndWrite(
+          ChunkStoreCompressParameters{buffer, &region, file_systems[i], data_offset,
+                                       region.first_chunk + offset / region_chunk_size,
+                                       bytes_read});
+    }
+  }
+
+  ASSERT(bytes_read == iso_size);
+
+  mt_compressor.Shutdown();
+
+  const ConversionResultCode status = mt_compressor.GetStatus();
+  if (status != ConversionResultCode::Success)
+    return status;
+
+  // The hash blocks were output in the order of their chunks, since the output thread handles the
+  // chunks in the order they were submitted
+  const std::string manifest_store_path = GetStorePathForManifest(store_path, outfile_path);
+
+  ChunkStoreHeader header{};
+  header.magic = CHUNK_STORE_MAGIC;
+  header.version = ChunkStoreFileReader::VERSION;
+  header.data_size = iso_size;
+  header.chunk_size = chunk_size;
+  header.store_path_size = static_cast<u32>(manifest_store_path.size());
+  header.number_of_regions = static_cast<u32>(regions.size());
+  header.number_of_chunks = static_cast<u32>(chunks.size());
+  header.number_of_hash_blocks = static_cast<u32>(hash_blocks.size());
+
+  if (!outfile->Write(Common::AsU8Span(header)) ||
+      !outfile->Write(reinterpret_cast<const u8*>(manifest_store_path.data()),
+                      manifest_store_path.size()) ||
+      !outfile->Write(Common::AsU8Span(regions)) || !outfile->Write(Common::AsU8Span(chunks)) ||
+      !outfile->Write(Common::AsU8Span(hash_blocks)))
+  {
+    return ConversionResultCode::WriteFailed;
+  }
+
+  return ConversionResultCode::Success;
+}
+
+bool ConvertToChunkStore(BlobReader* infile, const std::string& infile_path,
+                         const std::string& outfile_path, const std::string& store_path,
+                         int compression_level, int chunk_size, const CompressCB& callback)
+{
+  File::DirectIOFile outfile(outfile_path, File::AccessMode::Write);
+  if (!outfile.IsOpen())
+  {
+    PanicAlertFmtT(
+        "Failed to open the output file \"{0}\".\n"
+        "Check that you have permissions to write the target folder and that the media can "
+        "be written.",
+        outfile_path);
+    return false;
+  }
+
+  std::unique_ptr<VolumeDisc> infile_volume = CreateDisc(infile_path);
+
+  const ConversionResultCode result =
+      ConvertToChunkStore(infile, infile_volume.get(), &outfile, outfile_path, store_path,
+                          compression_level, static_cast<u32>(chunk_size), callback);
+
+  if (result == ConversionResultCode::ReadFailed)
+    PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
+
+  if (result == ConversionResultCode::WriteFailed)
+  {
+    PanicAlertFmtT("Failed to write the output file \"{0}\".\n"
+                   "Check that you have enough space available on the target drive.",
+                   outfile_path);
+  }
+
+  if (result != ConversionResultCode::Success)
+  {
+    // Remove the incomplete manifest. The chunks that were stored are complete and can be kept,
+    // since they may be used by other discs or by the next attempt to convert this one.
+    outfile.Close();
+    File::Delete(outfile_path);
+  }
+
+  return result == ConversionResultCode::Success;
+}
+
+}  // namespace DiscIO
@@ -0,0 +1,137 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/DirectIOFile.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/VolumeWii.h"
+#include "DiscIO/WiiEncryptionCache.h"
+
+namespace DiscIO
+{
+static constexpr u32 CHUNK_STORE_MAGIC = 0x01534344;  // "DCS\x1" (byteswapped to little endian)
+
+// DCS stores the data of a disc in a directory of chunks that is shared with other discs, so that
+// the regional and revision variants of a game only take up space for the data they don't share.
+//
+// Manifest file structure (one for each disc):
+// ChunkStoreHeader
+// char store_path[store_path_size], the chunk directory, relative to the manifest if not absolute
+// ChunkStoreRegion regions[number_of_regions], in order of their offset
+// SHA1::Digest chunks[number_of_chunks]
+// ChunkStoreHashBlocks hash_blocks[number_of_hash_blocks], in order of their chunk index
+//
+// Each chunk is stored in the chunk directory as <SHA-1 of its data>.zst, containing a
+// ChunkStoreChunkHeader followed by the Zstandard compressed data. If rvz_packed_size is not 0,
+// the compressed data uses the junk data packing of RVZ (see docs/WiaAndRvz.md).
+//
+// Like in RVZ, the data of Wii partitions is stored decrypted with one chunk per group and the
+// hashes are recalculated when reading. For the groups where that gives the wrong hashes, the
+// original hash blocks of the group are stored in a chunk of their own.
+
+#pragma pack(push, 1)
+struct ChunkStoreHeader
+{
+  u32 magic;
+  u32 version;
+  u64 data_size;
+  u32 chunk_size;  // For regions which aren't Wii partition data
+  u32 store_path_size;
+  u32 number_of_regions;
+  u32 number_of_chunks;
+  u32 number_of_hash_blocks;
+};
+static_assert(sizeof(ChunkStoreHeader) == 0x24, "Wrong size for chunk store header");
+
+struct ChunkStoreRegion
+{
+  u64 offset;
+  u64 size;
+  u32 first_chunk;
+  u8 is_partition;
+  std::array<u8, VolumeWii::AES_KEY_SIZE> partition_key;
+};
+static_assert(sizeof(ChunkStoreRegion) == 0x25, "Wrong size for chunk store region");
+
+struct ChunkStoreHashBlocks
+{
+  u32 chunk_index;
+  Common::SHA1::Digest hash;
+};
+static_assert(sizeof(ChunkStoreHashBlocks) == 0x18, "Wrong size for chunk store hash blocks");
+
+struct ChunkStoreChunkHeader
+{
+  u32 data_size;
+  u32 rvz_packed_size;
+};
+static_assert(sizeof(ChunkStoreChunkHeader) == 0x08, "Wrong size for chunk store chunk header");
+#pragma pack(pop)
+
+class ChunkStoreFileReader final : public BlobReader
+{
+public:
+  static std::unique_ptr<ChunkStoreFileReader> Create(File::DirectIOFile file,
+                                                      const std::string& path);
+
+  BlobType GetBlobType() const override { return BlobType::CHUNK_STORE; }
+  std::unique_ptr<BlobReader> CopyReader() const override;
+
+  u64 GetRawSize() const override { return m_file.GetSize(); }
+  u64 GetDataSize() const override { return m_header.data_size; }
+  DataSizeType GetDataSizeType() const override { return DataSizeType::Accurate; }
+
+  u64 GetBlockSize() const override { return m_header.chunk_size; }
+  bool HasFastRandomAccessInBlock() const override { return false; }
+  std::string GetCompressionMethod() const override { return "Zstandard"; }
+  std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
+
+  bool Read(u64 offset, u64 size, u8* out_ptr) override;
+  bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const override;
+  bool ReadWiiDecrypted(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset) override;
+
+  static constexpr u32 VERSION = 1;
+
+private:
+  using Chunk = std::shared_ptr<const std::vector<u8>>;
+
+  ChunkStoreFileReader(File::DirectIOFile file, std::string path);
+  bool Initialize();
+
+  const ChunkStoreRegion* GetPartition(u64 partition_data_offset) const;
+  static u64 GetDecryptedSize(const ChunkStoreRegion& region);
+
+  bool ReadFromChunks(const ChunkStoreRegion& region, u64 chunk_size, u64 offset, u64 size,
+                      u8* out_ptr);
+  Chunk GetChunk(const Common::SHA1::Digest& hash, u64 size);
+
+  File::DirectIOFile m_file;
+  std::string m_path;
+  std::string m_store_path;
+
+  ChunkStoreHeader m_header;
+  std::vector<ChunkStoreRegion> m_regions;
+  std::vector<Common::SHA1::Digest> m_chunks;
+  std::map<u32, Common::SHA1::Digest> m_hash_blocks;
+
+  // The regions, by the offset of their end
+  std::map<u64, size_t> m_region_ends;
+
+  // The last chunk that was read, so that small reads don't have to go through the shared cache
+  Common::SHA1::Digest m_cached_chunk_hash{};
+  Chunk m_cached_chunk;
+
+  WiiEncryptionCache m_encryption_cache;
+};
+
+}  // namespace DiscIO
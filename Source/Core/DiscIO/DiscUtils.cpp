@@ -17,6 +17,7 @@
 #include "DiscIO/Blob.h"
 #include "DiscIO/Filesystem.h"
 #include "DiscIO/Volume.h"
+#include "DiscIO/VolumeWii.h"
 
 namespace DiscIO
 {
@@ -234,6 +235,13 @@ bool IsDiscImageBlockSizeValid(int block_size, BlobType format)
       return false;
     }
 
+    break;
+  case BlobType::CHUNK_STORE:
+    // Block size must be a multiple of the Wii block size, so that every chunk starts at the
+    // beginning of a block and can have its junk data packed
+    if (block_size <= 0 || block_size % VolumeWii::BLOCK_TOTAL_SIZE != 0)
+      return false;
+
     break;
   default:
     ASSERT(false);
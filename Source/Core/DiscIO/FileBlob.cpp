@@ -38,6 +38,33 @@ bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
   return m_file.OffsetRead(offset, out_ptr, nbytes);
 }
 
+void PlainFileReader::ReadAsync(u64 offset, u64 nbytes, u8* out_ptr, AsyncReadCallback callback)
+{
+#ifndef _WIN32
+  if (!m_io_uring_created)
+  {
+    m_io_uring = Common::IOUringReader::Create(IO_URING_QUEUE_DEPTH);
+    m_io_uring_created = true;
+  }
+
+  if (m_io_uring)
+  {
+    m_io_uring->Read(m_file.GetHandle(), offset, out_ptr, nbytes, std::move(callback));
+    return;
+  }
+#endif
+
+  BlobReader::ReadAsync(offset, nbytes, out_ptr, std::move(callback));
+}
+
+void PlainFileReader::WaitForAsyncReads()
+{
+  if (m_io_uring)
+    m_io_uring->WaitForReads();
+
+  BlobReader::WaitForAsyncReads();
+}
+
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, const CompressCB& callback)
 {
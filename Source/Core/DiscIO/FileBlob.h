@@ -8,6 +8,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/DirectIOFile.h"
+#include "Common/IOUring.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -30,12 +31,25 @@ public:
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
 
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
+  void ReadAsync(u64 offset, u64 nbytes, u8* out_ptr, AsyncReadCallback callback) override;
+  void WaitForAsyncReads() override;
+
+protected:
+  u32 GetAsyncReadThreadCount() const override { return ASYNC_READ_THREADS; }
 
 private:
   PlainFileReader(File::DirectIOFile file);
 
+  // Reading doesn't depend on any state, so reads can be done in parallel.
+  static constexpr u32 ASYNC_READ_THREADS = 4;
+  static constexpr u32 IO_URING_QUEUE_DEPTH = 16;
+
   File::DirectIOFile m_file;
   u64 m_size;
+
+  // Created when the first asynchronous read is started, if the system supports it.
+  std::unique_ptr<Common::IOUringReader> m_io_uring;
+  bool m_io_uring_created = false;
 };
 
 }  // namespace DiscIO
@@ -34,6 +34,10 @@ public:
 
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
 
+protected:
+  // Reading doesn't depend on any state, so reads can be done in parallel.
+  u32 GetAsyncReadThreadCount() const override { return 4; }
+
 private:
   struct SingleFile
   {
@@ -15,6 +15,7 @@
 #include "Common/Crypto/SHA1.h"
 #include "Common/Swap.h"
 #include "Core/IOS/ES/Formats.h"
+#include "DiscIO/Blob.h"
 #include "DiscIO/Enums.h"
 
 namespace DiscIO
@@ -43,6 +44,13 @@ public:
   Volume() {}
   virtual ~Volume() {}
   virtual bool Read(u64 offset, u64 length, u8* buffer, const Partition& partition) const = 0;
+  // Starts a read in the background, the same way as BlobReader::ReadAsync. The default
+  // implementation reads right away and calls the callback before returning.
+  virtual void ReadAsync(u64 offset, u64 length, u8* buffer, const Partition& partition,
+                         AsyncReadCallback callback) const
+  {
+    callback(Read(offset, length, buffer, partition));
+  }
   template <typename T>
   std::optional<T> ReadSwapped(u64 offset, const Partition& partition) const
   {
@@ -64,6 +64,18 @@ bool VolumeGC::Read(u64 offset, u64 length, u8* buffer, const Partition& partiti
   return m_reader->Read(offset, length, buffer);
 }
 
+void VolumeGC::ReadAsync(u64 offset, u64 length, u8* buffer, const Partition& partition,
+                         AsyncReadCallback callback) const
+{
+  if (partition != PARTITION_NONE)
+  {
+    callback(false);
+    return;
+  }
+
+  m_reader->ReadAsync(offset, length, buffer, std::move(callback));
+}
+
 const FileSystem* VolumeGC::GetFileSystem(const Partition& partition) const
 {
   return m_file_system->get();
@@ -361,6 +361,10 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
 
 constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
 
+// How many chunks may have been planned without having passed through every stage yet. Group
+// chunks are up to 2 MiB each, so this also bounds the memory used by the pipeline.
+constexpr u32 MAX_CHUNKS_IN_FLIGHT = 16;
+
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
                                Hashes<bool> hashes_to_calculate)
     : m_volume(volume), m_redump_verification(redump_verification),
@@ -373,9 +377,14 @@ VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
     m_redump_verification = false;
 }
 
+void VolumeVerifier::SetReadCallback(std::function<void(u64 bytes)> callback)
+{
+  m_read_callback = std::move(callback);
+}
+
 VolumeVerifier::~VolumeVerifier()
 {
-  WaitForAsyncOperations();
+  StopWorkers();
 }
 
 Hashes<bool> VolumeVerifier::GetDefaultHashesToCalculate()
@@ -418,6 +427,7 @@ void VolumeVerifier::Start()
   CheckMisc();
 
   SetUpHashing();
+  StartWorkers();
 }
 
 std::vector<Partition> VolumeVerifier::CheckPartitions()
@@ -1075,41 +1085,216 @@ void VolumeVerifier::SetUpHashing()
   }
 }
 
-void VolumeVerifier::WaitForAsyncOperations() const
+void VolumeVerifier::StartWorkers()
+{
+  m_read_worker.Reset("Verifier Read",
+                      [this](ChunkToRead chunk_to_read) { ReadChunk(std::move(chunk_to_read)); });
+
+  if (m_hashes_to_calculate.crc32)
+    m_crc32_worker.Reset("Verifier CRC32");
+  if (m_hashes_to_calculate.md5)
+    m_md5_worker.Reset("Verifier MD5");
+  if (m_hashes_to_calculate.sha1)
+    m_sha1_worker.Reset("Verifier SHA1");
+  if (!m_content_offsets.empty())
+    m_content_worker.Reset("Verifier Content");
+
+  if (!m_groups.empty())
+  {
+    m_group_worker.Reset("Verifier Blocks");
+
+    // Decrypting a block and checking its H0-H3 hashes doesn't depend on any other block, so
+    // the blocks of a group are checked in parallel
+    m_block_check_workers.Reset("Verifier Block Check",
+                                Common::ThreadPool::GetAutomaticThreadCount());
+  }
+}
+
+void VolumeVerifier::StopWorkers()
+{
+  // The read worker pushes work to the other workers, so it has to be stopped first
+  m_read_worker.Cancel();
+  m_read_worker.Shutdown();
+
+  for (Common::AsyncWorkThreadSP* worker :
+       {&m_crc32_worker, &m_md5_worker, &m_sha1_worker, &m_content_worker, &m_group_worker})
+  {
+    worker->Cancel();
+    worker->Shutdown();
+  }
+  m_block_check_workers.Shutdown();
+
+  m_data.reset();
+}
+
+void VolumeVerifier::WaitForAsyncOperations()
 {
-  if (m_crc32_future.valid())
-    m_crc32_future.wait();
-  if (m_md5_future.valid())
-    m_md5_future.wait();
-  if (m_sha1_future.valid())
-    m_sha1_future.wait();
-  if (m_content_future.valid())
-    m_content_future.wait();
-  if (m_group_future.valid())
-    m_group_future.wait();
+  m_read_worker.WaitForCompletion();
+
+  m_crc32_worker.WaitForCompletion();
+  m_md5_worker.WaitForCompletion();
+  m_sha1_worker.WaitForCompletion();
+  m_content_worker.WaitForCompletion();
+  m_group_worker.WaitForCompletion();
 }
 
-bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
+void VolumeVerifier::WaitForChunkSlot()
 {
-  std::vector<u8> data(bytes_to_read);
+  std::unique_lock lk(m_chunks_mutex);
+  m_chunk_released.wait(lk, [this] { return m_chunks_in_flight < MAX_CHUNKS_IN_FLIGHT; });
+  ++m_chunks_in_flight;
+}
 
-  const u64 bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
+void VolumeVerifier::ReleaseChunk()
+{
+  {
+    std::lock_guard lk(m_chunks_mutex);
+    --m_chunks_in_flight;
+  }
+  m_chunk_released.notify_one();
+}
+
+void VolumeVerifier::AddBytesProcessed(u64 bytes)
+{
+  {
+    std::lock_guard lk(m_chunks_mutex);
+    m_bytes_processed += bytes;
+  }
+  m_chunk_released.notify_all();
+}
+
+void VolumeVerifier::ReadChunk(ChunkToRead chunk_to_read)
+{
+  // The chunk gives its slot back once the last stage that uses it has dropped it
+  std::shared_ptr<std::vector<u8>> data(new std::vector<u8>(chunk_to_read.size),
+                                        [this](std::vector<u8>* ptr) {
+                                          delete ptr;
+                                          ReleaseChunk();
+                                        });
+
+  const u64 bytes_to_copy = m_data ? chunk_to_read.bytes_from_previous_chunk : 0;
   if (bytes_to_copy > 0)
-    std::memcpy(data.data(), m_data.data() + m_data.size() - m_excess_bytes, bytes_to_copy);
-  bytes_to_read -= bytes_to_copy;
+    std::memcpy(data->data(), m_data->data() + m_data->size() - bytes_to_copy, bytes_to_copy);
 
-  if (bytes_to_read > 0)
+  const u64 bytes_to_read = chunk_to_read.size - bytes_to_copy;
+  const bool read_failed =
+      bytes_to_read > 0 && !m_volume.Read(chunk_to_read.offset + bytes_to_copy, bytes_to_read,
+                                          data->data() + bytes_to_copy, PARTITION_NONE);
+  if (bytes_to_read > 0 && m_read_callback)
+    m_read_callback(bytes_to_read);
+
+  if (read_failed)
   {
-    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data.data() + bytes_to_copy,
-                       PARTITION_NONE))
+    ERROR_LOG_FMT(DISCIO, "Read failed at {:#x} to {:#x}", chunk_to_read.offset,
+                  chunk_to_read.offset + chunk_to_read.size);
+
+    // The full-disc hashes can't be calculated anymore, so stop feeding them
+    m_read_errors_occurred = true;
+    m_data.reset();
+  }
+  else
+  {
+    m_data = data;
+  }
+
+  const Chunk chunk = std::move(data);
+  const u64 byte_increment = chunk_to_read.byte_increment;
+
+  // The chunk's bytes count as processed once every stage has finished with it. This can't be
+  // tied to the lifetime of the chunk itself, as the read worker keeps the last chunk around.
+  const std::shared_ptr<void> completion(
+      nullptr, [this, byte_increment](void*) { AddBytesProcessed(byte_increment); });
+
+  if (chunk_to_read.hash && !m_read_errors_occurred)
+  {
+    if (m_hashes_to_calculate.crc32)
     {
-      return false;
+      m_crc32_worker.Push([this, chunk, completion, byte_increment] {
+        m_crc32_context = Common::UpdateCRC32(m_crc32_context, chunk->data(),
+                                              static_cast<size_t>(byte_increment));
+      });
+    }
+
+    if (m_hashes_to_calculate.md5)
+    {
+      m_md5_worker.Push([this, chunk, completion, byte_increment] {
+        mbedtls_md5_update_ret(&m_md5_context, chunk->data(), byte_increment);
+      });
+    }
+
+    if (m_hashes_to_calculate.sha1)
+    {
+      m_sha1_worker.Push([this, chunk, completion, byte_increment] {
+        m_sha1_context->Update(chunk->data(), byte_increment);
+      });
     }
   }
 
-  WaitForAsyncOperations();
-  m_data = std::move(data);
-  return true;
+  if (chunk_to_read.content)
+  {
+    m_content_worker.Push(
+        [this, chunk, completion, read_failed, content = *chunk_to_read.content] {
+      if (read_failed || !m_volume.CheckContentIntegrity(content, *chunk, m_ticket))
+      {
+        AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
+      }
+    });
+  }
+
+  if (chunk_to_read.group_index)
+  {
+    m_group_worker.Push(
+        [this, chunk, completion, read_failed, group_index = *chunk_to_read.group_index] {
+          CheckGroup(group_index, chunk, read_failed);
+        });
+  }
+}
+
+void VolumeVerifier::CheckGroup(size_t group_index, const Chunk& data, bool read_failed)
+{
+  const GroupToVerify& group = m_groups[group_index];
+  const size_t blocks = group.block_index_end - group.block_index_start;
+
+  const auto check_block = [&](size_t i) {
+    return m_volume.CheckBlockIntegrity(group.block_index_start + i,
+                                        data->data() + i * VolumeWii::BLOCK_TOTAL_SIZE,
+                                        group.partition);
+  };
+
+  std::vector<u8> block_ok(blocks);
+  if (!read_failed && blocks > 0)
+  {
+    // The title key and H3 table of a partition are Common::Lazy values, which aren't safe to
+    // compute from several threads at once. Checking the first block on this thread computes
+    // them, so the workers only ever read them.
+    block_ok[0] = check_block(0);
+    m_block_check_workers.ParallelFor(blocks - 1,
+                                      [&](size_t i) { block_ok[i + 1] = check_block(i + 1); });
+  }
+
+  for (size_t i = 0; i < blocks; ++i)
+  {
+    const u64 block_offset = group.offset + i * VolumeWii::BLOCK_TOTAL_SIZE;
+
+    if (block_ok[i])
+    {
+      m_biggest_verified_offset =
+          std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
+    }
+    else
+    {
+      if (m_scrubber.CanBlockBeScrubbed(block_offset))
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
+        m_unused_block_errors[group.partition]++;
+      }
+      else
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
+        m_block_errors[group.partition]++;
+      }
+    }
+  }
 }
 
 void VolumeVerifier::Process()
@@ -1118,7 +1303,16 @@ void VolumeVerifier::Process()
   ASSERT(!m_done);
 
   if (m_progress >= m_max_progress)
+  {
+    // Everything has been handed to the workers. Wait for them to finish a chunk instead of
+    // returning right away, so that the caller doesn't spin until GetBytesProcessed catches up.
+    std::unique_lock lk(m_chunks_mutex);
+    const u64 bytes_processed = m_bytes_processed;
+    m_chunk_released.wait(lk, [&] {
+      return m_bytes_processed != bytes_processed || m_bytes_processed == m_max_progress;
+    });
     return;
+  }
 
   IOS::ES::Content content{};
   bool content_read = false;
@@ -1182,99 +1376,43 @@ void VolumeVerifier::Process()
     }
   }
 
-  const bool is_data_needed = m_calculating_any_hash || content_read || group_read;
-  const bool read_failed = is_data_needed && !ReadChunkAndWaitForAsyncOperations(bytes_to_read);
+  // Once a read has failed, the full-disc hashes are abandoned, so only the data that is checked
+  // on its own still needs to be read
+  const bool hash = m_calculating_any_hash && !m_read_errors_occurred;
+  const bool is_data_needed = hash || content_read || group_read;
 
-  if (read_failed)
+  if (is_data_needed)
   {
-    ERROR_LOG_FMT(DISCIO, "Read failed at {:#x} to {:#x}", m_progress, m_progress + bytes_to_read);
-
-    m_read_errors_occurred = true;
-    m_calculating_any_hash = false;
+    WaitForChunkSlot();
+    m_read_worker.Push(ChunkToRead{
+        .offset = m_progress,
+        .size = bytes_to_read,
+        .bytes_from_previous_chunk = std::min(m_excess_bytes, bytes_to_read),
+        .byte_increment = bytes_to_read - excess_bytes,
+        .hash = hash,
+        .content = content_read ? std::make_optional(content) : std::nullopt,
+        .group_index = group_read ? std::make_optional(m_group_index) : std::nullopt,
+    });
   }
-
-  m_excess_bytes = excess_bytes;
-  const u64 byte_increment = bytes_to_read - excess_bytes;
-
-  if (m_calculating_any_hash)
+  else
   {
-    if (m_hashes_to_calculate.crc32)
-    {
-      m_crc32_future = std::async(std::launch::async, [this, byte_increment] {
-        m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(),
-                                              static_cast<size_t>(byte_increment));
-      });
-    }
-
-    if (m_hashes_to_calculate.md5)
-    {
-      m_md5_future = std::async(std::launch::async, [this, byte_increment] {
-        mbedtls_md5_update_ret(&m_md5_context, m_data.data(), byte_increment);
-      });
-    }
-
-    if (m_hashes_to_calculate.sha1)
-    {
-      m_sha1_future = std::async(std::launch::async, [this, byte_increment] {
-        m_sha1_context->Update(m_data.data(), byte_increment);
-      });
-    }
+    AddBytesProcessed(bytes_to_read - excess_bytes);
   }
 
-  if (content_read)
-  {
-    m_content_future = std::async(std::launch::async, [this, read_failed, content] {
-      if (read_failed || !m_volume.CheckContentIntegrity(content, m_data, m_ticket))
-      {
-        AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
-      }
-    });
+  m_excess_bytes = excess_bytes;
 
+  if (content_read)
     m_content_index++;
-  }
 
   if (group_read)
-  {
-    m_group_future = std::async(std::launch::async, [this, read_failed,
-                                                     group_index = m_group_index] {
-      const GroupToVerify& group = m_groups[group_index];
-      u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
-      {
-        const u64 block_offset = group.offset + offset_in_group;
-
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
-        {
-          m_biggest_verified_offset =
-              std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
-        }
-        else
-        {
-          if (m_scrubber.CanBlockBeScrubbed(block_offset))
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
-            m_unused_block_errors[group.partition]++;
-          }
-          else
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
-            m_block_errors[group.partition]++;
-          }
-        }
-      }
-    });
-
     m_group_index++;
-  }
 
-  m_progress += byte_increment;
+  m_progress += bytes_to_read - excess_bytes;
 }
 
 u64 VolumeVerifier::GetBytesProcessed() const
 {
-  return m_progress;
+  return m_bytes_processed;
 }
 
 u64 VolumeVerifier::GetTotalBytes() const
@@ -1289,6 +1427,10 @@ void VolumeVerifier::Finish()
   m_done = true;
 
   WaitForAsyncOperations();
+  StopWorkers();
+
+  if (m_read_errors_occurred)
+    m_calculating_any_hash = false;
 
   if (m_calculating_any_hash)
   {
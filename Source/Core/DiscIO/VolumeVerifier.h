@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -14,6 +18,8 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/ThreadPool.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/Volume.h"
@@ -29,6 +35,12 @@
 //
 // Start, Process and Finish may take some time to run.
 //
+// Process only plans the next chunk and hands it to a pipeline of worker threads: one reads the
+// chunks in order, and the CRC32, MD5, SHA1, content and Wii block checks each run on their own
+// thread, so a slow stage only holds back the reads once several chunks are waiting for it.
+// GetBytesProcessed only counts the chunks that every stage has finished with, and once every
+// chunk has been planned, Process waits for the workers to finish one.
+//
 // GetResult() can be called before the processing is finished, but the result will be incomplete.
 
 namespace DiscIO
@@ -128,6 +140,9 @@ public:
   ~VolumeVerifier();
 
   static Hashes<bool> GetDefaultHashesToCalculate();
+  // Called on the read thread with the amount of bytes read from the volume for each chunk.
+  // Must be set before Start is called.
+  void SetReadCallback(std::function<void(u64 bytes)> callback);
   void Start();
   void Process();
   u64 GetBytesProcessed() const;
@@ -144,6 +159,19 @@ private:
     size_t block_index_end;
   };
 
+  struct ChunkToRead
+  {
+    u64 offset;
+    u64 size;
+    u64 bytes_from_previous_chunk;
+    u64 byte_increment;
+    bool hash;
+    std::optional<IOS::ES::Content> content;
+    std::optional<size_t> group_index;
+  };
+
+  using Chunk = std::shared_ptr<const std::vector<u8>>;
+
   std::vector<Partition> CheckPartitions();
   bool CheckPartition(const Partition& partition);  // Returns false if partition should be ignored
   std::string GetPartitionName(std::optional<u32> type) const;
@@ -156,12 +184,19 @@ private:
   void CheckMisc();
   void CheckSuperPaperMario();
   void SetUpHashing();
-  void WaitForAsyncOperations() const;
-  bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
+  void StartWorkers();
+  void StopWorkers();
+  void WaitForAsyncOperations();
+  void WaitForChunkSlot();
+  void ReleaseChunk();
+  void AddBytesProcessed(u64 bytes);
+  void ReadChunk(ChunkToRead chunk_to_read);
+  void CheckGroup(size_t group_index, const Chunk& data, bool read_failed);
 
   void AddProblem(Severity severity, std::string text);
 
   const Volume& m_volume;
+  std::function<void(u64 bytes)> m_read_callback;
   Result m_result;
   bool m_is_tgc = false;
   bool m_is_datel = false;
@@ -171,7 +206,8 @@ private:
   bool m_redump_verification;
   RedumpVerifier m_redump_verifier;
 
-  bool m_read_errors_occurred = false;
+  // Set by the read worker, but also read by Process to skip reads that are only for hashing
+  std::atomic<bool> m_read_errors_occurred = false;
 
   Hashes<bool> m_hashes_to_calculate{};
   bool m_calculating_any_hash = false;
@@ -179,13 +215,24 @@ private:
   mbedtls_md5_context m_md5_context{};
   std::unique_ptr<Common::SHA1::Context> m_sha1_context;
 
+  // Bounds the memory used by chunks that have been planned but not yet processed by every stage
+  std::mutex m_chunks_mutex;
+  std::condition_variable m_chunk_released;
+  u32 m_chunks_in_flight = 0;
+  // The bytes of the chunks that every stage has finished with. Only changed with m_chunks_mutex
+  // held, and m_chunk_released is notified when it changes.
+  std::atomic<u64> m_bytes_processed = 0;
+
   u64 m_excess_bytes = 0;
-  std::vector<u8> m_data;
-  std::future<void> m_crc32_future;
-  std::future<void> m_md5_future;
-  std::future<void> m_sha1_future;
-  std::future<void> m_content_future;
-  std::future<void> m_group_future;
+  Chunk m_data;  // The last chunk read. Only accessed by the read worker.
+
+  Common::WorkQueueThreadSP<ChunkToRead> m_read_worker;
+  Common::AsyncWorkThreadSP m_crc32_worker;
+  Common::AsyncWorkThreadSP m_md5_worker;
+  Common::AsyncWorkThreadSP m_sha1_worker;
+  Common::AsyncWorkThreadSP m_content_worker;
+  Common::AsyncWorkThreadSP m_group_worker;
+  Common::ThreadPool m_block_check_workers;
 
   DiscScrubber m_scrubber;
   IOS::ES::TicketReader m_ticket;
@@ -201,7 +248,7 @@ private:
 
   bool m_started = false;
   bool m_done = false;
-  u64 m_progress = 0;
+  u64 m_progress = 0;  // The bytes that have been planned by Process
   u64 m_max_progress = 0;
   DataSizeType m_data_size_type;
 };
@@ -6,13 +6,13 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <condition_variable>
 #include <cstring>
-#include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -22,6 +22,7 @@
 #include "Common/Crypto/AES.h"
 #include "Common/Crypto/SHA1.h"
 #include "Common/Logging/Log.h"
+#include "Common/ThreadPool.h"
 
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscExtractor.h"
@@ -237,6 +238,84 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
   return true;
 }
 
+void VolumeWii::ReadAsync(u64 offset, u64 length, u8* buffer, const Partition& partition,
+                          AsyncReadCallback callback) const
+{
+  if (partition == PARTITION_NONE)
+  {
+    m_reader->ReadAsync(offset, length, buffer, std::move(callback));
+    return;
+  }
+
+  auto it = m_partitions.find(partition);
+  if (it == m_partitions.end())
+  {
+    callback(false);
+    return;
+  }
+  const PartitionDetails& partition_details = it->second;
+
+  const u64 partition_data_offset = partition.offset + *partition_details.data_offset;
+  if (m_has_hashes && m_has_encryption &&
+      m_reader->SupportsReadWiiDecrypted(offset, length, partition_data_offset))
+  {
+    m_reader->ReadWiiDecryptedAsync(offset, length, buffer, partition_data_offset,
+                                    std::move(callback));
+    return;
+  }
+
+  if (!m_has_hashes)
+  {
+    m_reader->ReadAsync(partition_data_offset + offset, length, buffer, std::move(callback));
+    return;
+  }
+
+  Common::AES::Context* aes_context = m_has_encryption ? partition_details.key->get() : nullptr;
+  if (!aes_context)
+  {
+    // Discs with hashes but without encryption only exist in development builds of games
+    callback(m_has_encryption ? false : Read(offset, length, buffer, partition));
+    return;
+  }
+
+  // Read all blocks in one go, and decrypt them once they have arrived. m_last_decrypted_block is
+  // left alone, since the callback may run on another thread.
+  const u64 first_block = offset / BLOCK_DATA_SIZE;
+  const u64 end_block = Common::AlignUp(offset + length, BLOCK_DATA_SIZE) / BLOCK_DATA_SIZE;
+  auto encrypted_data = std::make_shared<std::vector<u8>>((end_block - first_block) *
+                                                          BLOCK_TOTAL_SIZE);
+
+  m_reader->ReadAsync(
+      partition_data_offset + first_block * BLOCK_TOTAL_SIZE, encrypted_data->size(),
+      encrypted_data->data(),
+      [encrypted_data, aes_context, offset, length, buffer,
+       callback = std::move(callback)](bool success) {
+        if (!success)
+        {
+          callback(false);
+          return;
+        }
+
+        std::vector<u8> block_data(BLOCK_DATA_SIZE);
+        u64 data_offset_in_block = offset % BLOCK_DATA_SIZE;
+        u64 bytes_left = length;
+        u8* out_ptr = buffer;
+        for (const u8* block = encrypted_data->data(); bytes_left > 0; block += BLOCK_TOTAL_SIZE)
+        {
+          DecryptBlockData(block, block_data.data(), aes_context);
+
+          const u64 copy_size = std::min(bytes_left, BLOCK_DATA_SIZE - data_offset_in_block);
+          std::memcpy(out_ptr, &block_data[data_offset_in_block], static_cast<size_t>(copy_size));
+
+          bytes_left -= copy_size;
+          out_ptr += copy_size;
+          data_offset_in_block = 0;
+        }
+
+        callback(true);
+      });
+}
+
 bool VolumeWii::HasWiiHashes() const
 {
   return m_has_hashes;
@@ -505,88 +584,116 @@ bool VolumeWii::CheckBlockIntegrity(u64 block_index, const Partition& partition)
   return CheckBlockIntegrity(block_index, cluster.data(), partition);
 }
 
-bool VolumeWii::HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GROUP],
-                          HashBlock out[BLOCKS_PER_GROUP],
-                          const std::function<bool(size_t block)>& read_function)
+// Calculates the H0 and H1 hashes of one subgroup of 8 blocks, and its H2 hash.
+static void HashSubgroup(const std::array<u8, VolumeWii::BLOCK_DATA_SIZE> in[],
+                         VolumeWii::HashBlock out[], size_t subgroup)
 {
-  std::array<std::future<void>, BLOCKS_PER_GROUP> hash_futures;
-  bool success = true;
+  constexpr size_t BLOCKS_PER_SUBGROUP = 8;
+  const size_t h1_base = subgroup * BLOCKS_PER_SUBGROUP;
 
-  for (size_t i = 0; i < BLOCKS_PER_GROUP; ++i)
+  for (size_t i = h1_base; i < h1_base + BLOCKS_PER_SUBGROUP; ++i)
   {
-    if (read_function && success)
-      success = read_function(i);
+    // H0 hashes
+    std::array<const u8*, 31> h0_data;
+    for (size_t j = 0; j < h0_data.size(); ++j)
+      h0_data[j] = in[i].data() + j * 0x400;
+    Common::SHA1::CalculateDigests(h0_data, 0x400, out[i].h0.data());
+
+    // H0 padding
+    out[i].padding_0 = {};
+  }
 
-    hash_futures[i] = std::async(std::launch::async, [&in, &out, &hash_futures, success, i] {
-      const size_t h1_base = Common::AlignDown(i, 8);
+  // H1 hashes
+  std::array<const u8*, BLOCKS_PER_SUBGROUP> h1_data;
+  for (size_t j = 0; j < h1_data.size(); ++j)
+    h1_data[j] = reinterpret_cast<const u8*>(out[h1_base + j].h0.data());
+  Common::SHA1::CalculateDigests(h1_data, sizeof(VolumeWii::HashBlock::h0),
+                                 out[h1_base].h1.data());
 
-      if (success)
-      {
-        // H0 hashes
-        for (size_t j = 0; j < 31; ++j)
-          out[i].h0[j] = Common::SHA1::CalculateDigest(in[i].data() + j * 0x400, 0x400);
+  // H1 padding
+  out[h1_base].padding_1 = {};
 
-        // H0 padding
-        out[i].padding_0 = {};
-
-        // H1 hash
-        out[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(out[i].h0);
-      }
+  // H1 copies
+  for (size_t j = 1; j < BLOCKS_PER_SUBGROUP; ++j)
+    out[h1_base + j].h1 = out[h1_base].h1;
 
-      if (i % 8 == 7)
-      {
-        for (size_t j = 0; j < 7; ++j)
-          hash_futures[h1_base + j].get();
+  // H2 hash
+  out[0].h2[subgroup] = Common::SHA1::CalculateDigest(out[h1_base].h1);
+}
 
-        if (success)
-        {
-          // H1 padding
-          out[h1_base].padding_1 = {};
+bool VolumeWii::HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GROUP],
+                          HashBlock out[BLOCKS_PER_GROUP],
+                          const std::function<bool(size_t block)>& read_function,
+                          Common::ThreadPool* workers)
+{
+  constexpr size_t SUBGROUPS = BLOCKS_PER_GROUP / 8;
 
-          // H1 copies
-          for (size_t j = 1; j < 8; ++j)
-            out[h1_base + j].h1 = out[h1_base].h1;
+  std::mutex mutex;
+  std::condition_variable subgroup_hashed;
+  size_t subgroups_queued = 0;
+  size_t subgroups_hashed = 0;
 
-          // H2 hash
-          out[0].h2[h1_base / 8] = Common::SHA1::CalculateDigest(out[i].h1);
-        }
+  bool success = true;
+  for (size_t subgroup = 0; subgroup < SUBGROUPS && success; ++subgroup)
+  {
+    if (read_function)
+    {
+      for (size_t i = subgroup * 8; i < (subgroup + 1) * 8 && success; ++i)
+        success = read_function(i);
+      if (!success)
+        break;
+    }
 
-        if (i == BLOCKS_PER_GROUP - 1)
-        {
-          for (size_t j = 0; j < 7; ++j)
-            hash_futures[j * 8 + 7].get();
+    // Each subgroup is hashed while the next one is being read
+    if (workers && workers->IsRunning())
+    {
+      ++subgroups_queued;
+      workers->Push([&, subgroup] {
+        HashSubgroup(in, out, subgroup);
 
-          if (success)
-          {
-            // H2 padding
-            out[0].padding_2 = {};
+        std::lock_guard lk(mutex);
+        ++subgroups_hashed;
+        subgroup_hashed.notify_one();
+      });
+    }
+    else
+    {
+      HashSubgroup(in, out, subgroup);
+    }
+  }
 
-            // H2 copies
-            for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
-              out[j].h2 = out[0].h2;
-          }
-        }
-      }
-    });
+  // Wait for all the queued subgroups to finish, as they reference this stack frame
+  {
+    std::unique_lock lk(mutex);
+    subgroup_hashed.wait(lk, [&] { return subgroups_hashed == subgroups_queued; });
   }
 
-  // Wait for all the async tasks to finish
-  hash_futures.back().get();
+  if (!success)
+    return false;
+
+  // H2 padding
+  out[0].padding_2 = {};
+
+  // H2 copies
+  for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
+    out[j].h2 = out[0].h2;
 
-  return success;
+  return true;
 }
 
 bool VolumeWii::EncryptGroup(
     u64 offset, u64 partition_data_offset, u64 partition_data_decrypted_size,
     const std::array<u8, AES_KEY_SIZE>& key, BlobReader* blob,
     std::array<u8, GROUP_TOTAL_SIZE>* out,
-    const std::function<void(HashBlock hash_blocks[BLOCKS_PER_GROUP])>& hash_exception_callback)
+    const std::function<void(HashBlock hash_blocks[BLOCKS_PER_GROUP])>& hash_exception_callback,
+    Common::ThreadPool* workers)
 {
   std::vector<std::array<u8, BLOCK_DATA_SIZE>> unencrypted_data(BLOCKS_PER_GROUP);
   std::vector<HashBlock> unencrypted_hashes(BLOCKS_PER_GROUP);
 
-  const bool success =
-      HashGroup(unencrypted_data.data(), unencrypted_hashes.data(), [&](size_t block) {
+  const bool success = HashGroup(
+      unencrypted_data.data(), unencrypted_hashes.data(),
+      [&](size_t block) {
         if (offset + (block + 1) * BLOCK_DATA_SIZE <= partition_data_decrypted_size)
         {
           if (!blob->ReadWiiDecrypted(offset + block * BLOCK_DATA_SIZE, BLOCK_DATA_SIZE,
@@ -600,7 +707,8 @@ bool VolumeWii::EncryptGroup(
           unencrypted_data[block].fill(0);
         }
         return true;
-      });
+      },
+      workers);
 
   if (!success)
     return false;
@@ -608,34 +716,39 @@ bool VolumeWii::EncryptGroup(
   if (hash_exception_callback)
     hash_exception_callback(unencrypted_hashes.data());
 
-  const unsigned int threads =
-      std::min(BLOCKS_PER_GROUP, std::max<unsigned int>(1, std::thread::hardware_concurrency()));
-
-  std::vector<std::future<void>> encryption_futures(threads);
-
   auto aes_context = Common::AES::CreateContextEncrypt(key.data());
 
-  for (size_t i = 0; i < threads; ++i)
-  {
-    encryption_futures[i] = std::async(
-        std::launch::async,
-        [&unencrypted_data, &unencrypted_hashes, &aes_context, &out](size_t start, size_t end) {
-          for (size_t j = start; j < end; ++j)
-          {
-            u8* out_ptr = out->data() + j * BLOCK_TOTAL_SIZE;
+  // CBC encryption is serial within a buffer, so several blocks are encrypted at a time to let
+  // CryptMultiple interleave them. The hashes go first, since the IV of a block's data is taken
+  // from its encrypted hashes.
+  constexpr size_t BLOCKS_PER_BATCH = 8;
+  const auto encrypt_batch = [&](size_t batch) {
+    std::array<Common::AES::Context::Buffer, BLOCKS_PER_BATCH> hash_buffers;
+    std::array<Common::AES::Context::Buffer, BLOCKS_PER_BATCH> data_buffers;
+    for (size_t i = 0; i < BLOCKS_PER_BATCH; ++i)
+    {
+      const size_t j = batch * BLOCKS_PER_BATCH + i;
+      u8* out_ptr = out->data() + j * BLOCK_TOTAL_SIZE;
 
-            aes_context->CryptIvZero(reinterpret_cast<u8*>(&unencrypted_hashes[j]), out_ptr,
-                                     BLOCK_HEADER_SIZE);
+      hash_buffers[i] = {nullptr, reinterpret_cast<const u8*>(&unencrypted_hashes[j]), out_ptr};
+      data_buffers[i] = {out_ptr + 0x3D0, unencrypted_data[j].data(),
+                         out_ptr + BLOCK_HEADER_SIZE};
+    }
 
-            aes_context->Crypt(out_ptr + 0x3D0, unencrypted_data[j].data(),
-                               out_ptr + BLOCK_HEADER_SIZE, BLOCK_DATA_SIZE);
-          }
-        },
-        i * BLOCKS_PER_GROUP / threads, (i + 1) * BLOCKS_PER_GROUP / threads);
-  }
+    aes_context->CryptMultiple(hash_buffers, BLOCK_HEADER_SIZE);
+    aes_context->CryptMultiple(data_buffers, BLOCK_DATA_SIZE);
+  };
 
-  for (std::future<void>& future : encryption_futures)
-    future.get();
+  constexpr size_t BATCHES = BLOCKS_PER_GROUP / BLOCKS_PER_BATCH;
+  if (workers)
+  {
+    workers->ParallelFor(BATCHES, encrypt_batch);
+  }
+  else
+  {
+    for (size_t i = 0; i < BATCHES; ++i)
+      encrypt_batch(i);
+  }
 
   return true;
 }
@@ -21,6 +21,11 @@
 
 #include "Common/Crypto/AES.h"
 
+namespace Common
+{
+class ThreadPool;
+}
+
 namespace DiscIO
 {
 class BlobReader;
@@ -60,6 +65,8 @@ public:
   VolumeWii(std::unique_ptr<BlobReader> reader);
   ~VolumeWii() override;
   bool Read(u64 offset, u64 length, u8* buffer, const Partition& partition) const override;
+  void ReadAsync(u64 offset, u64 length, u8* buffer, const Partition& partition,
+                 AsyncReadCallback callback) const override;
   bool HasWiiHashes() const override;
   bool HasWiiEncryption() const override;
   std::vector<Partition> GetPartitions() const override;
@@ -95,16 +102,21 @@ public:
   // The in parameter can either contain all the data to begin with,
   // or read_function can write data into the in parameter when called.
   // The latter lets reading run in parallel with hashing.
+  // If workers is not nullptr, the hashing is spread across its threads.
   // This function returns false iff read_function returns false.
   static bool HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GROUP],
                         HashBlock out[BLOCKS_PER_GROUP],
-                        const std::function<bool(size_t block)>& read_function = {});
+                        const std::function<bool(size_t block)>& read_function = {},
+                        Common::ThreadPool* workers = nullptr);
 
+  // Reads, hashes and encrypts a whole group. If workers is not nullptr, the hashing and the
+  // encryption are spread across its threads.
   static bool EncryptGroup(u64 offset, u64 partition_data_offset, u64 partition_data_decrypted_size,
                            const std::array<u8, AES_KEY_SIZE>& key, BlobReader* blob,
                            std::array<u8, GROUP_TOTAL_SIZE>* out,
                            const std::function<void(HashBlock hash_blocks[BLOCKS_PER_GROUP])>&
-                               hash_exception_callback = {});
+                               hash_exception_callback = {},
+                           Common::ThreadPool* workers = nullptr);
 
   static void DecryptBlockHashes(const u8* in, HashBlock* out, Common::AES::Context* aes_context);
   static void DecryptBlockData(const u8* in, u8* out, Common::AES::Context* aes_context);
@@ -86,7 +86,12 @@ WIARVZFileReader<RVZ>::WIARVZFileReader(File::DirectIOFile file, const std::stri
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  // The workers access m_file and m_header_2, so they must be stopped before anything is destroyed
+  m_read_ahead_workers.Cancel();
+  m_read_ahead_workers.Shutdown();
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -515,34 +520,25 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     const u64 group_offset_in_data = i * chunk_size;
     const u64 offset_in_group = *offset - group_offset_in_data - data_offset;
 
+    UpdateReadAhead(total_group_index, chunk_size, data_size, group_index, number_of_groups,
+                    exception_lists);
+
     chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
     const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
+    const GroupChunk group_chunk =
+        GetGroupChunk(group, chunk_size, exception_lists, group_offset_in_data);
 
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
-    {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
-
-      group_data_size &= 0x7FFFFFFF;
-
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
-    }
-
-    if (group_data_size == 0)
+    if (group_chunk.compressed_size == 0)
     {
       std::memset(*out_ptr, 0, bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
-
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
+      Chunk& chunk = ReadCompressedData(
+          group_chunk.offset_in_file, group_chunk.compressed_size, group_chunk.decompressed_size,
+          group_chunk.compression_type, group_chunk.exception_lists, group_chunk.rvz_packed_size,
+          group_chunk.data_offset);
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
@@ -569,6 +565,32 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   return true;
 }
 
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::GroupChunk
+WIARVZFileReader<RVZ>::GetGroupChunk(const GroupEntry& group, u64 chunk_size,
+                                     u32 exception_lists, u64 group_offset_in_data) const
+{
+  GroupChunk group_chunk;
+  group_chunk.offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+  group_chunk.compressed_size = Common::swap32(group.data_size);
+  group_chunk.decompressed_size = chunk_size;
+  group_chunk.compression_type = m_compression_type;
+  group_chunk.exception_lists = exception_lists;
+  group_chunk.data_offset = group_offset_in_data;
+
+  if constexpr (RVZ)
+  {
+    if ((group_chunk.compressed_size & 0x80000000) == 0)
+      group_chunk.compression_type = WIARVZCompressionType::None;
+
+    group_chunk.compressed_size &= 0x7FFFFFFF;
+
+    group_chunk.rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  return group_chunk;
+}
+
 template <bool RVZ>
 typename WIARVZFileReader<RVZ>::Chunk&
 WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
@@ -579,6 +601,21 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
   if (offset_in_file == m_cached_chunk_offset)
     return m_cached_chunk;
 
+  if (!TakeReadAheadGroup(offset_in_file, &m_cached_chunk))
+  {
+    m_cached_chunk = CreateChunk(offset_in_file, compressed_size, decompressed_size,
+                                 compression_type, exception_lists, rvz_packed_size, data_offset);
+  }
+  m_cached_chunk_offset = offset_in_file;
+  return m_cached_chunk;
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk
+WIARVZFileReader<RVZ>::CreateChunk(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
+                                   WIARVZCompressionType compression_type, u32 exception_lists,
+                                   u32 rvz_packed_size, u64 data_offset)
+{
   std::unique_ptr<Decompressor> decompressor;
   switch (compression_type)
   {
@@ -607,11 +644,117 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
 
   const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
+               compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::UpdateReadAhead(u64 total_group_index, u64 chunk_size, u64 data_size,
+                                            u32 group_index, u32 number_of_groups,
+                                            u32 exception_lists)
+{
+  if (total_group_index == m_last_group_index)
+    return;
+
+  if (total_group_index == m_last_group_index + 1)
+  {
+    ++m_sequential_groups;
+  }
+  else
+  {
+    m_sequential_groups = 0;
+    ClearReadAhead();
+  }
+  m_last_group_index = total_group_index;
+
+  if (m_sequential_groups < READ_AHEAD_TRIGGER_GROUPS)
+    return;
+
+  // Groups that were read ahead but skipped over won't be needed anymore
+  std::erase_if(m_read_ahead_groups, [total_group_index](const auto& entry) {
+    return entry.second->total_group_index < total_group_index;
+  });
+
+  const u64 max_groups =
+      std::clamp<u64>(MAX_READ_AHEAD_BYTES / chunk_size, 1, MAX_READ_AHEAD_GROUPS);
+  const u64 first_group = total_group_index - group_index + 1;
+  const u64 end_group = std::min<u64>(first_group + max_groups, number_of_groups);
+  for (u64 i = first_group; i < end_group && m_read_ahead_groups.size() < max_groups; ++i)
+  {
+    if (group_index + i >= m_group_entries.size())
+      break;
+
+    const u64 group_offset_in_data = i * chunk_size;
+    const GroupChunk group_chunk =
+        GetGroupChunk(m_group_entries[group_index + i],
+                      std::min(chunk_size, data_size - group_offset_in_data), exception_lists,
+                      group_offset_in_data);
+
+    if (group_chunk.compressed_size == 0 || group_chunk.offset_in_file == m_cached_chunk_offset ||
+        m_read_ahead_groups.contains(group_chunk.offset_in_file))
+    {
+      continue;
+    }
+
+    if (!m_read_ahead_workers.IsRunning())
+    {
+      m_read_ahead_workers.Reset(
+          "WIA/RVZ Read-Ahead",
+          std::min<u32>(Common::ThreadPool::GetAutomaticThreadCount(), MAX_READ_AHEAD_GROUPS));
+    }
+
+    auto group = std::make_shared<ReadAheadGroup>();
+    group->group_chunk = group_chunk;
+    group->total_group_index = group_index + i;
+    m_read_ahead_groups.emplace(group_chunk.offset_in_file, group);
+
+    m_read_ahead_workers.Push([this, group] {
+      const GroupChunk& c = group->group_chunk;
+      group->chunk = CreateChunk(c.offset_in_file, c.compressed_size, c.decompressed_size,
+                                 c.compression_type, c.exception_lists, c.rvz_packed_size,
+                                 c.data_offset);
+      const bool success = group->chunk.DecompressAll();
+
+      {
+        std::lock_guard lk(m_read_ahead_mutex);
+        group->done = true;
+        group->success = success;
+      }
+      m_read_ahead_done.notify_all();
+    });
+  }
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::TakeReadAheadGroup(u64 offset_in_file, Chunk* chunk)
+{
+  const auto it = m_read_ahead_groups.find(offset_in_file);
+  if (it == m_read_ahead_groups.end())
+    return false;
+
+  const std::shared_ptr<ReadAheadGroup> group = std::move(it->second);
+  m_read_ahead_groups.erase(it);
+
+  std::unique_lock lk(m_read_ahead_mutex);
+  m_read_ahead_done.wait(lk, [&group] { return group->done; });
+
+  // If decompressing failed, let the caller try again so that the error is handled as usual
+  if (!group->success)
+    return false;
+
+  *chunk = std::move(group->chunk);
+  return true;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::ClearReadAhead()
+{
+  if (m_read_ahead_groups.empty())
+    return;
+
+  // Groups which a worker has already started on are kept alive by the worker's reference
+  m_read_ahead_workers.Cancel();
+  m_read_ahead_groups.clear();
 }
 
 template <bool RVZ>
@@ -654,17 +797,33 @@ WIARVZFileReader<RVZ>::Chunk::Chunk(File::DirectIOFile* file, u64 offset_in_file
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
+{
+  if (!DecompressUntil(offset + size))
+    return false;
+
+  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
+  return true;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressAll()
+{
+  return DecompressUntil(m_out.data.size() - m_out_bytes_allocated_for_exceptions);
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressUntil(u64 end_offset)
 {
   if (!m_decompressor || !m_file ||
-      offset + size > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
+      end_offset > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
   {
     return false;
   }
 
-  while (offset + size > GetOutBytesWrittenExcludingExceptions())
+  while (end_offset > GetOutBytesWrittenExcludingExceptions())
   {
     u64 bytes_to_read;
-    if (offset + size == m_out.data.size())
+    if (end_offset == m_out.data.size())
     {
       // Read all the remaining data.
       bytes_to_read = m_in.data.size() - m_in.bytes_written;
@@ -677,7 +836,7 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 
       // The compressed data is probably not much bigger than the decompressed data.
       // Add a few bytes for possible compression overhead and for any hash exceptions.
-      bytes_to_read = offset + size - GetOutBytesWrittenExcludingExceptions() + 0x100;
+      bytes_to_read = end_offset - GetOutBytesWrittenExcludingExceptions() + 0x100;
 
       // Align the access in an attempt to gain speed. But we don't actually know the
       // block size of the underlying storage device, so we just use the Wii block size.
@@ -755,7 +914,6 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     }
   }
 
-  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
   return true;
 }
 
@@ -1297,6 +1455,26 @@ static void RVZPack(const u8* in, OutputParametersEntry* out, u64 size, u64 data
   RVZPack(in, out, size, 1, size, data_offset, false, allow_junk_reuse, compression, file_system);
 }
 
+std::optional<std::vector<u8>> RVZPackData(const u8* data, size_t size, u64 data_offset,
+                                           bool compression, const FileSystem* file_system)
+{
+  struct PackedData
+  {
+    std::vector<u8> main_data;
+    std::optional<size_t> reuse_id;
+    std::optional<size_t> reused_group;
+    size_t rvz_packed_size = 0;
+  };
+
+  PackedData packed;
+  RVZPack(data, &packed, size, data_offset, true, compression, file_system);
+
+  if (packed.rvz_packed_size == 0)
+    return std::nullopt;
+
+  return std::move(packed.main_data);
+}
+
 template <bool RVZ>
 ConversionResult<typename WIARVZFileReader<RVZ>::OutputParameters>
 WIARVZFileReader<RVZ>::ProcessAndCompress(CompressThreadState* state, CompressParameters parameters,
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
@@ -15,6 +16,7 @@
 #include "Common/Crypto/SHA1.h"
 #include "Common/DirectIOFile.h"
 #include "Common/Swap.h"
+#include "Common/ThreadPool.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/WIACompression.h"
@@ -37,6 +39,12 @@ enum class WIARVZCompressionType : u32
 
 std::pair<int, int> GetAllowedCompressionLevels(WIARVZCompressionType compression_type, bool gui);
 
+// Replaces junk data with the seeds needed to regenerate it, the same way RVZ packs groups.
+// data_offset is the offset of the data on the disc, or in the decrypted data of a Wii partition.
+// Returns std::nullopt if no junk was found. Otherwise, RVZPackDecompressor can unpack the result.
+std::optional<std::vector<u8>> RVZPackData(const u8* data, size_t size, u64 data_offset,
+                                           bool compression, const FileSystem* file_system);
+
 constexpr u32 WIA_MAGIC = 0x01414957;  // "WIA\x1" (byteswapped to little endian)
 constexpr u32 RVZ_MAGIC = 0x015A5652;  // "RVZ\x1" (byteswapped to little endian)
 
@@ -195,6 +203,9 @@ private:
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
 
+    // Decompresses all of the data, so that later reads don't need to access the file
+    bool DecompressAll();
+
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
                            u64 exception_list_index, u16 additional_offset) const;
@@ -206,6 +217,7 @@ private:
     }
 
   private:
+    bool DecompressUntil(u64 end_offset);
     bool Decompress();
     bool HandleExceptions(const u8* data, size_t bytes_allocated, size_t bytes_written,
                           size_t* bytes_used, bool align);
@@ -235,12 +247,46 @@ private:
 
   const PartitionEntry* GetPartition(u64 partition_data_offset, u32* partition_first_sector) const;
 
+  // Where the compressed data of a group is stored and how to decompress it
+  struct GroupChunk
+  {
+    u64 offset_in_file = 0;
+    u32 compressed_size = 0;
+    u64 decompressed_size = 0;
+    WIARVZCompressionType compression_type = WIARVZCompressionType::None;
+    u32 exception_lists = 0;
+    u32 rvz_packed_size = 0;
+    u64 data_offset = 0;
+  };
+
+  // A group which is being decompressed by a read-ahead worker
+  struct ReadAheadGroup
+  {
+    GroupChunk group_chunk;
+    u64 total_group_index = 0;
+    Chunk chunk;
+    bool done = false;
+    bool success = false;
+  };
+
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
+  GroupChunk GetGroupChunk(const GroupEntry& group, u64 chunk_size, u32 exception_lists,
+                           u64 group_offset_in_data) const;
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
+  Chunk CreateChunk(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
+                    WIARVZCompressionType compression_type, u32 exception_lists,
+                    u32 rvz_packed_size, u64 data_offset);
+
+  // Called for every group that is read. Once the groups are being read in order, the groups
+  // after it are queued for decompression on the read-ahead workers.
+  void UpdateReadAhead(u64 total_group_index, u64 chunk_size, u64 data_size, u32 group_index,
+                       u32 number_of_groups, u32 exception_lists);
+  bool TakeReadAheadGroup(u64 offset_in_file, Chunk* chunk);
+  void ClearReadAhead();
 
   static bool ApplyHashExceptions(std::span<const HashExceptionEntry> exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -372,6 +418,17 @@ private:
   u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
   WiiEncryptionCache m_encryption_cache;
 
+  // How many groups in a row have been read in order, and the index of the last one
+  u32 m_sequential_groups = 0;
+  u64 m_last_group_index = std::numeric_limits<u64>::max();
+
+  // The read-ahead groups, by the offset of their data in the file. Only the reading thread
+  // accesses the map itself; the mutex guards the done and success members of the groups.
+  std::map<u64, std::shared_ptr<ReadAheadGroup>> m_read_ahead_groups;
+  std::mutex m_read_ahead_mutex;
+  std::condition_variable m_read_ahead_done;
+  Common::ThreadPool m_read_ahead_workers;
+
   std::vector<HashExceptionEntry> m_exception_list;
   bool m_write_to_exception_list = false;
   u64 m_exception_list_last_group_index;
@@ -395,6 +452,13 @@ private:
   static constexpr u32 RVZ_VERSION = 0x01000000;
   static constexpr u32 RVZ_VERSION_WRITE_COMPATIBLE = 0x00030000;
   static constexpr u32 RVZ_VERSION_READ_COMPATIBLE = 0x00030000;
+
+  // Read-ahead starts once this many groups have been read in order
+  static constexpr u32 READ_AHEAD_TRIGGER_GROUPS = 2;
+
+  // Read-ahead is limited to whichever of these is reached first
+  static constexpr u64 MAX_READ_AHEAD_GROUPS = 16;
+  static constexpr u64 MAX_READ_AHEAD_BYTES = 8 * 1024 * 1024;
 };
 
 using WIAFileReader = WIARVZFileReader<false>;
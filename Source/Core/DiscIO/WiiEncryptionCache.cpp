@@ -7,14 +7,35 @@
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <mutex>
 
 #include "Common/Align.h"
 #include "Common/CommonTypes.h"
+#include "Common/ThreadPool.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/VolumeWii.h"
 
 namespace DiscIO
 {
+// Every open Wii volume which is read encrypted has a cache, and there can be many of them, for
+// instance while the game list is being scanned. A pool per cache would start a set of threads
+// for each, so they all share one, which is kept alive for as long as any cache uses it.
+static std::shared_ptr<Common::ThreadPool> GetSharedWorkers()
+{
+  static std::mutex mutex;
+  static std::weak_ptr<Common::ThreadPool> shared_workers;
+
+  std::lock_guard lk(mutex);
+  std::shared_ptr<Common::ThreadPool> workers = shared_workers.lock();
+  if (!workers)
+  {
+    workers = std::make_shared<Common::ThreadPool>("Wii Encryption",
+                                                   Common::ThreadPool::GetAutomaticThreadCount());
+    shared_workers = workers;
+  }
+  return workers;
+}
+
 WiiEncryptionCache::WiiEncryptionCache(BlobReader* blob) : m_blob(blob)
 {
 }
@@ -31,6 +52,7 @@ WiiEncryptionCache::EncryptGroup(u64 offset, u64 partition_data_offset,
   {
     m_cache = std::make_unique<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>>();
     m_cached_offset = std::numeric_limits<u64>::max();
+    m_workers = GetSharedWorkers();
   }
 
   ASSERT(offset % VolumeWii::GROUP_TOTAL_SIZE == 0);
@@ -53,7 +75,7 @@ WiiEncryptionCache::EncryptGroup(u64 offset, u64 partition_data_offset,
 
     if (!VolumeWii::EncryptGroup(group_offset_in_partition, partition_data_offset,
                                  partition_data_decrypted_size, key, m_blob, m_cache.get(),
-                                 hash_exception_callback_2))
+                                 hash_exception_callback_2, m_workers.get()))
     {
       m_cached_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
       return nullptr;
@@ -9,6 +9,11 @@
 #include "Common/CommonTypes.h"
 #include "DiscIO/VolumeWii.h"
 
+namespace Common
+{
+class ThreadPool;
+}
+
 namespace DiscIO
 {
 class BlobReader;
@@ -49,6 +54,8 @@ public:
 private:
   BlobReader* m_blob;
   std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> m_cache;
+  // Hashes and encrypts the blocks of a group in parallel. Shared by all caches.
+  std::shared_ptr<Common::ThreadPool> m_workers;
   u64 m_cached_offset = 0;
 };
 
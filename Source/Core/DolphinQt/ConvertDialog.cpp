@@ -49,10 +49,11 @@ ConvertDialog::ConvertDialog(QList<std::shared_ptr<const UICommon::GameFile>> fi
   m_format->addItem(QStringLiteral("GCZ"), static_cast<int>(DiscIO::BlobType::GCZ));
   m_format->addItem(QStringLiteral("WIA"), static_cast<int>(DiscIO::BlobType::WIA));
   m_format->addItem(QStringLiteral("RVZ"), static_cast<int>(DiscIO::BlobType::RVZ));
+  m_format->addItem(QStringLiteral("DCS"), static_cast<int>(DiscIO::BlobType::CHUNK_STORE));
   if (std::ranges::all_of(
           m_files, [](const auto& file) { return file->GetBlobType() == DiscIO::BlobType::PLAIN; }))
   {
-    m_format->setCurrentIndex(m_format->count() - 1);
+    m_format->setCurrentIndex(m_format->findData(static_cast<int>(DiscIO::BlobType::RVZ)));
   }
   form_layout->addRow(tr("Format:"), m_format);
 
@@ -80,7 +81,10 @@ ConvertDialog::ConvertDialog(QList<std::shared_ptr<const UICommon::GameFile>> fi
          "and a few other programs. It can efficiently compress encrypted Wii data, but not junk "
          "data (unless removed).\n\n"
          "RVZ: An advanced compressed format which is compatible with Dolphin 5.0-12188 and later. "
-         "It can efficiently compress both junk data and encrypted Wii data."));
+         "It can efficiently compress both junk data and encrypted Wii data.\n\n"
+         "DCS: Compresses like RVZ, but stores the data in a \"chunks\" folder next to the "
+         "converted file. Disc images which are converted to the same folder share the data they "
+         "have in common, such as different regions or revisions of a game."));
   info_text->setWordWrap(true);
   info_text->setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Minimum);
 
@@ -177,6 +181,7 @@ void ConvertDialog::OnFormatChanged()
 
     break;
   case DiscIO::BlobType::RVZ:
+  case DiscIO::BlobType::CHUNK_STORE:
     m_block_size->setEnabled(true);
 
     for (int block_size = DiscIO::PREFERRED_MIN_BLOCK_SIZE;
@@ -228,6 +233,9 @@ void ConvertDialog::OnFormatChanged()
 
     break;
   }
+  case DiscIO::BlobType::CHUNK_STORE:
+    AddToCompressionComboBox(QStringLiteral("Zstandard"), DiscIO::WIARVZCompressionType::Zstd);
+    break;
   default:
     m_compression->setEnabled(false);
     break;
@@ -236,8 +244,9 @@ void ConvertDialog::OnFormatChanged()
   m_block_size->setEnabled(m_block_size->count() > 1);
   m_compression->setEnabled(m_compression->count() > 1);
 
-  // Block scrubbing of RVZ containers and Datel discs
+  // Block scrubbing of RVZ and DCS containers and Datel discs
   const bool scrubbing_allowed = format != DiscIO::BlobType::RVZ &&
+                                 format != DiscIO::BlobType::CHUNK_STORE &&
                                  std::ranges::none_of(m_files, &UICommon::GameFile::IsDatelDisc);
 
   m_scrub->setEnabled(scrubbing_allowed);
@@ -343,6 +352,10 @@ void ConvertDialog::Convert()
     extension = QStringLiteral(".rvz");
     filter = tr("RVZ GC/Wii images (*.rvz)");
     break;
+  case DiscIO::BlobType::CHUNK_STORE:
+    extension = QStringLiteral(".dcs");
+    filter = tr("DCS GC/Wii images (*.dcs)");
+    break;
   default:
     ASSERT(false);
     return;
@@ -502,6 +515,20 @@ void ConvertDialog::Convert()
         });
         break;
 
+      case DiscIO::BlobType::CHUNK_STORE:
+        success = std::async(std::launch::async, [&] {
+          // Like in dolphin-tool, the chunks go next to the converted image, so that images
+          // converted to the same folder share them
+          const std::string store_path =
+              PathToString(StringToPath(dst_path.toStdString()).parent_path() / "chunks");
+          const bool good = DiscIO::ConvertToChunkStore(blob_reader.get(), original_path,
+                                                        dst_path.toStdString(), store_path,
+                                                        compression_level, block_size, callback);
+          progress_dialog.Reset();
+          return good;
+        });
+        break;
+
       default:
         ASSERT(false);
         break;
@@ -538,6 +538,7 @@ void MainWindow::ConnectMenuBar()
   connect(m_menu_bar, &MenuBar::Screenshot, this, &MainWindow::ScreenShot);
   connect(m_menu_bar, &MenuBar::StateLoad, this, &MainWindow::StateLoad);
   connect(m_menu_bar, &MenuBar::StateSave, this, &MainWindow::StateSave);
+  connect(m_menu_bar, &MenuBar::StateSaveDelta, this, &MainWindow::StateSaveDelta);
   connect(m_menu_bar, &MenuBar::StateLoadSlot, this, &MainWindow::StateLoadSlot);
   connect(m_menu_bar, &MenuBar::StateSaveSlot, this, &MainWindow::StateSaveSlot);
   connect(m_menu_bar, &MenuBar::StateLoadSlotAt, this, &MainWindow::StateLoadSlotAt);
@@ -630,6 +631,7 @@ void MainWindow::ConnectHotkeys()
           &MainWindow::StateLoadLastSavedAt);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateLoadUndo, this, &MainWindow::StateLoadUndo);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveUndo, this, &MainWindow::StateSaveUndo);
+  connect(m_hotkey_scheduler, &HotkeyScheduler::StateRewind, this, &MainWindow::StateRewind);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveOldest, this,
           &MainWindow::StateSaveOldest);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveFile, this, &MainWindow::StateSave);
@@ -809,7 +811,7 @@ QStringList MainWindow::PromptFileNames()
       this, tr("Select a File"),
       settings.value(QStringLiteral("mainwindow/lastdir"), QString{}).toString(),
       QStringLiteral("%1 (*.elf *.dol *.gcm *.bin *.iso *.tgc *.wbfs *.ciso *.gcz *.wia *.rvz "
-                     "hif_000000.nfs *.wad *.dff *.m3u *.json);;%2 (*)")
+                     "hif_000000.nfs *.dcs *.wad *.dff *.m3u *.json);;%2 (*)")
           .arg(tr("All GC/Wii files"))
           .arg(tr("All Files")));
 
@@ -1529,6 +1531,25 @@ void MainWindow::StateSave()
     State::SaveAs(m_system, path.toStdString());
 }
 
+void MainWindow::StateSaveDelta()
+{
+  QString dialog_path = (Config::Get(Config::MAIN_CURRENT_STATE_PATH).empty()) ?
+                            QDir::currentPath() :
+                            QString::fromStdString(Config::Get(Config::MAIN_CURRENT_STATE_PATH));
+  const QString base_path = DolphinFileDialog::getOpenFileName(
+      this, tr("Select the Base State"), dialog_path,
+      tr("All Save States (*.sav *.s??);; All Files (*)"));
+  if (base_path.isEmpty())
+    return;
+
+  dialog_path = QFileInfo(base_path).dir().path();
+  const QString path = DolphinFileDialog::getSaveFileName(
+      this, tr("Select a File"), dialog_path, tr("All Save States (*.sav *.s??);; All Files (*)"));
+  Config::SetBase(Config::MAIN_CURRENT_STATE_PATH, QFileInfo(path).dir().path().toStdString());
+  if (!path.isEmpty())
+    State::SaveDeltaAs(m_system, path.toStdString(), base_path.toStdString());
+}
+
 void MainWindow::StateLoadSlot()
 {
   State::Load(m_system, m_state_slot);
@@ -1559,6 +1580,11 @@ void MainWindow::StateLoadUndo()
   State::UndoLoadState(m_system);
 }
 
+void MainWindow::StateRewind()
+{
+  State::Rewind(m_system);
+}
+
 void MainWindow::StateSaveUndo()
 {
   State::UndoSaveState(m_system);
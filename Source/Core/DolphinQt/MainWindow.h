@@ -113,12 +113,14 @@ private:
   void FrameAdvance();
   void StateLoad();
   void StateSave();
+  void StateSaveDelta();
   void StateLoadSlot();
   void StateSaveSlot();
   void StateLoadSlotAt(int slot);
   void StateSaveSlotAt(int slot);
   void StateLoadLastSavedAt(int slot);
   void StateLoadUndo();
+  void StateRewind();
   void StateSaveUndo();
   void StateSaveOldest();
   void SetStateSlot(int slot);
@@ -77,6 +77,7 @@ signals:
   void BrowseNetPlay();
   void StateLoad();
   void StateSave();
+  void StateSaveDelta();
   void StateLoadSlot();
   void StateSaveSlot();
   void StateLoadSlotAt(int slot);
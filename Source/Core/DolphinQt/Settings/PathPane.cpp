@@ -48,7 +48,7 @@ void PathPane::BrowseDefaultGame()
   QString file = QDir::toNativeSeparators(DolphinFileDialog::getOpenFileName(
       this, tr("Select a Game"), Settings::Instance().GetDefaultGame(),
       QStringLiteral("%1 (*.elf *.dol *.gcm *.bin *.iso *.tgc *.wbfs *.ciso *.gcz *.wia *.rvz "
-                     "hif_000000.nfs *.wad *.m3u *.json);;%2 (*)")
+                     "hif_000000.nfs *.dcs *.wad *.m3u *.json);;%2 (*)")
           .arg(tr("All GC/Wii files"))
           .arg(tr("All Files"))));
 
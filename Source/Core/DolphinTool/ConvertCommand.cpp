@@ -14,6 +14,7 @@
 #include <fmt/ostream.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
@@ -51,6 +52,8 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
     return DiscIO::BlobType::WIA;
   else if (format_str == "rvz")
     return DiscIO::BlobType::RVZ;
+  else if (format_str == "dcs")
+    return DiscIO::BlobType::CHUNK_STORE;
   return std::nullopt;
 }
 
@@ -83,7 +86,7 @@ int ConvertCommand(const std::vector<std::string>& args)
       .type("string")
       .action("store")
       .help("Container format to use. Default is RVZ. [%choices]")
-      .choices({"iso", "gcz", "wia", "rvz"});
+      .choices({"iso", "gcz", "wia", "rvz", "dcs"});
 
   parser.add_option("-s", "--scrub")
       .action("store_true")
@@ -92,8 +95,8 @@ int ConvertCommand(const std::vector<std::string>& args)
   parser.add_option("-b", "--block_size")
       .type("int")
       .action("store")
-      .help("Block size for GCZ/WIA/RVZ formats, as an integer. Suggested value for RVZ: 131072 "
-            "(128 KiB)");
+      .help("Block size for GCZ/WIA/RVZ/DCS formats, as an integer. Suggested value for RVZ: "
+            "131072 (128 KiB)");
 
   parser.add_option("-c", "--compression")
       .type("string")
@@ -108,6 +111,13 @@ int ConvertCommand(const std::vector<std::string>& args)
       .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
             "zstd: 5");
 
+  parser.add_option("--store")
+      .type("string")
+      .action("store")
+      .help("Chunk directory for the DCS format, which can be shared by several disc images. "
+            "Default is a directory named 'chunks' next to the output FILE.")
+      .metavar("DIR");
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -184,10 +194,10 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
-  if (scrub && format == DiscIO::BlobType::RVZ)
+  if (scrub && (format == DiscIO::BlobType::RVZ || format == DiscIO::BlobType::CHUNK_STORE))
   {
-    fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
-                          "advantages. Continuing anyway.\n");
+    fmt::print(std::cerr, "Warning: Scrubbing an RVZ or DCS container does not offer significant "
+                          "space advantages. Continuing anyway.\n");
   }
 
   if (scrub && format == DiscIO::BlobType::PLAIN)
@@ -215,11 +225,11 @@ int ConvertCommand(const std::vector<std::string>& args)
     block_size_o = static_cast<int>(options.get("block_size"));
 
   if (format == DiscIO::BlobType::GCZ || format == DiscIO::BlobType::WIA ||
-      format == DiscIO::BlobType::RVZ)
+      format == DiscIO::BlobType::RVZ || format == DiscIO::BlobType::CHUNK_STORE)
   {
     if (!block_size_o.has_value())
     {
-      fmt::print(std::cerr, "Error: Block size must be set for GCZ/RVZ/WIA\n");
+      fmt::print(std::cerr, "Error: Block size must be set for GCZ/RVZ/WIA/DCS\n");
       return EXIT_FAILURE;
     }
 
@@ -294,6 +304,35 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
+  if (format == DiscIO::BlobType::CHUNK_STORE)
+  {
+    // DCS always uses Zstandard
+    if (compression_o.has_value() && compression_o.value() != DiscIO::WIARVZCompressionType::Zstd)
+    {
+      fmt::print(std::cerr, "Error: Compression type is not supported for the container format\n");
+      return EXIT_FAILURE;
+    }
+
+    if (!compression_level_o.has_value())
+    {
+      fmt::print(std::cerr, "Error: Compression level must be set for DCS\n");
+      return EXIT_FAILURE;
+    }
+
+    const std::pair<int, int> range =
+        DiscIO::GetAllowedCompressionLevels(DiscIO::WIARVZCompressionType::Zstd, false);
+    if (compression_level_o.value() < range.first || compression_level_o.value() > range.second)
+    {
+      fmt::print(std::cerr, "Error: Compression level not in acceptable range\n");
+      return EXIT_FAILURE;
+    }
+  }
+
+  // --store
+  std::string store_path = options["store"];
+  if (store_path.empty())
+    store_path = PathToString(StringToPath(output_file_path).parent_path() / "chunks");
+
   // Perform the conversion
   const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
 
@@ -333,6 +372,14 @@ int ConvertCommand(const std::vector<std::string>& args)
     break;
   }
 
+  case DiscIO::BlobType::CHUNK_STORE:
+  {
+    success = DiscIO::ConvertToChunkStore(blob_reader.get(), input_file_path, output_file_path,
+                                          store_path, compression_level_o.value(),
+                                          block_size_o.value(), NOOP_STATUS_CALLBACK);
+    break;
+  }
+
   default:
   {
     ASSERT(false);
@@ -0,0 +1,336 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/CryptoBenchCommand.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/Align.h"
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/AES.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/ThreadPool.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/VolumeWii.h"
+
+namespace DolphinTool
+{
+namespace
+{
+using DiscIO::VolumeWii;
+
+constexpr std::array<u8, VolumeWii::AES_KEY_SIZE> KEY{0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae,
+                                                      0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88,
+                                                      0x09, 0xcf, 0x4f, 0x3c};
+
+// Serves decrypted partition data from memory, so that only the hashing and encryption of
+// EncryptGroup are measured.
+class MemoryWiiReader final : public DiscIO::BlobReader
+{
+public:
+  explicit MemoryWiiReader(std::vector<u8> data) : m_data(std::move(data)) {}
+
+  DiscIO::BlobType GetBlobType() const override { return DiscIO::BlobType::PLAIN; }
+  std::unique_ptr<BlobReader> CopyReader() const override
+  {
+    return std::make_unique<MemoryWiiReader>(m_data);
+  }
+
+  u64 GetRawSize() const override { return m_data.size(); }
+  u64 GetDataSize() const override { return m_data.size(); }
+  DiscIO::DataSizeType GetDataSizeType() const override { return DiscIO::DataSizeType::Accurate; }
+
+  u64 GetBlockSize() const override { return 0; }
+  bool HasFastRandomAccessInBlock() const override { return true; }
+  std::string GetCompressionMethod() const override { return {}; }
+  std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
+
+  bool Read(u64 offset, u64 size, u8* out_ptr) override { return false; }
+
+  bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const override
+  {
+    return true;
+  }
+
+  bool ReadWiiDecrypted(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset) override
+  {
+    if (offset + size > m_data.size())
+      return false;
+    std::memcpy(out_ptr, m_data.data() + offset, size);
+    return true;
+  }
+
+private:
+  std::vector<u8> m_data;
+};
+
+// The implementation of VolumeWii::EncryptGroup that this benchmark was written to replace. It
+// hashes each block on a thread of its own, and encrypts the blocks one at a time on a thread for
+// each core.
+bool ReferenceEncryptGroup(u64 offset, u64 partition_data_size, DiscIO::BlobReader* blob,
+                           std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>* out)
+{
+  constexpr size_t BLOCKS = VolumeWii::BLOCKS_PER_GROUP;
+
+  std::vector<std::array<u8, VolumeWii::BLOCK_DATA_SIZE>> in(BLOCKS);
+  std::vector<VolumeWii::HashBlock> hashes(BLOCKS);
+
+  std::array<std::future<void>, BLOCKS> hash_futures;
+  bool success = true;
+  for (size_t i = 0; i < BLOCKS; ++i)
+  {
+    if (success)
+    {
+      if (offset + (i + 1) * VolumeWii::BLOCK_DATA_SIZE <= partition_data_size)
+      {
+        success = blob->ReadWiiDecrypted(offset + i * VolumeWii::BLOCK_DATA_SIZE,
+                                         VolumeWii::BLOCK_DATA_SIZE, in[i].data(), 0);
+      }
+      else
+      {
+        in[i].fill(0);
+      }
+    }
+
+    hash_futures[i] = std::async(std::launch::async, [&in, &hashes, &hash_futures, success, i] {
+      const size_t h1_base = Common::AlignDown(i, 8);
+
+      if (success)
+      {
+        for (size_t j = 0; j < 31; ++j)
+          hashes[i].h0[j] = Common::SHA1::CalculateDigest(in[i].data() + j * 0x400, 0x400);
+        hashes[i].padding_0 = {};
+        hashes[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(hashes[i].h0);
+      }
+
+      if (i % 8 == 7)
+      {
+        for (size_t j = 0; j < 7; ++j)
+          hash_futures[h1_base + j].get();
+
+        if (success)
+        {
+          hashes[h1_base].padding_1 = {};
+          for (size_t j = 1; j < 8; ++j)
+            hashes[h1_base + j].h1 = hashes[h1_base].h1;
+          hashes[0].h2[h1_base / 8] = Common::SHA1::CalculateDigest(hashes[i].h1);
+        }
+
+        if (i == BLOCKS - 1)
+        {
+          for (size_t j = 0; j < 7; ++j)
+            hash_futures[j * 8 + 7].get();
+
+          if (success)
+          {
+            hashes[0].padding_2 = {};
+            for (size_t j = 1; j < BLOCKS; ++j)
+              hashes[j].h2 = hashes[0].h2;
+          }
+        }
+      }
+    });
+  }
+  hash_futures.back().get();
+
+  if (!success)
+    return false;
+
+  const size_t threads =
+      std::min<size_t>(BLOCKS, std::max(1u, std::thread::hardware_concurrency()));
+  std::vector<std::future<void>> encryption_futures(threads);
+  const auto aes_context = Common::AES::CreateContextEncrypt(KEY.data());
+  for (size_t i = 0; i < threads; ++i)
+  {
+    encryption_futures[i] = std::async(
+        std::launch::async,
+        [&](size_t start, size_t end) {
+          for (size_t j = start; j < end; ++j)
+          {
+            u8* out_ptr = out->data() + j * VolumeWii::BLOCK_TOTAL_SIZE;
+            aes_context->CryptIvZero(reinterpret_cast<u8*>(&hashes[j]), out_ptr,
+                                     VolumeWii::BLOCK_HEADER_SIZE);
+            aes_context->Crypt(out_ptr + 0x3D0, in[j].data(),
+                               out_ptr + VolumeWii::BLOCK_HEADER_SIZE, VolumeWii::BLOCK_DATA_SIZE);
+          }
+        },
+        i * BLOCKS / threads, (i + 1) * BLOCKS / threads);
+  }
+  for (std::future<void>& future : encryption_futures)
+    future.get();
+
+  return true;
+}
+
+template <typename Function>
+double MeasureMiBPerSecond(u64 bytes, u32 repetitions, const Function& function)
+{
+  // The fastest repetition is used, as it's the least disturbed by the rest of the system
+  double best_seconds = 0;
+  for (u32 i = 0; i < repetitions; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (i == 0 || seconds < best_seconds)
+      best_seconds = seconds;
+  }
+  return bytes / (1024.0 * 1024.0) / best_seconds;
+}
+
+picojson::value MakeResult(double reference, double batch)
+{
+  picojson::object result;
+  result["reference_mib_per_second"] = picojson::value(reference);
+  result["batch_mib_per_second"] = picojson::value(batch);
+  result["speedup"] = picojson::value(batch / reference);
+  return picojson::value(std::move(result));
+}
+}  // namespace
+
+int CryptoBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: cryptobench [options]...");
+
+  parser.add_option("-g", "--groups")
+      .type("int")
+      .action("store")
+      .help("Number of 2 MiB Wii partition groups to process per repetition. "
+            "[default: %default]")
+      .set_default(16);
+
+  parser.add_option("-r", "--repetitions")
+      .type("int")
+      .action("store")
+      .help("Number of times to repeat each measurement. The fastest is reported. "
+            "[default: %default]")
+      .set_default(5);
+
+  parser.add_option("-t", "--threads")
+      .type("int")
+      .action("store")
+      .help("Number of threads for the batch group encryption, or -1 for one per core but one. "
+            "[default: %default]")
+      .set_default(-1);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const int groups = static_cast<int>(options.get("groups"));
+  const int repetitions = static_cast<int>(options.get("repetitions"));
+  const int threads = static_cast<int>(options.get("threads"));
+  if (groups < 1 || repetitions < 1 || threads < -1)
+  {
+    fmt::print(std::cerr, "Error: Invalid group, repetition or thread count\n");
+    return EXIT_FAILURE;
+  }
+
+  const u64 partition_data_size = static_cast<u64>(groups) * VolumeWii::GROUP_DATA_SIZE;
+  std::vector<u8> data(partition_data_size);
+  u32 seed = 1;
+  for (u8& byte : data)
+  {
+    seed = seed * 1664525 + 1013904223;
+    byte = static_cast<u8>(seed >> 24);
+  }
+
+  picojson::object json;
+  json["groups"] = picojson::value(static_cast<double>(groups));
+
+  // The H0 hashes, which are most of the SHA-1 work of a group
+  {
+    std::vector<const u8*> msgs(partition_data_size / 0x400);
+    for (size_t i = 0; i < msgs.size(); ++i)
+      msgs[i] = data.data() + i * 0x400;
+    std::vector<Common::SHA1::Digest> digests(msgs.size());
+
+    const double reference = MeasureMiBPerSecond(partition_data_size, repetitions, [&] {
+      for (size_t i = 0; i < msgs.size(); ++i)
+        digests[i] = Common::SHA1::CalculateDigest(msgs[i], 0x400);
+    });
+    const double batch = MeasureMiBPerSecond(partition_data_size, repetitions, [&] {
+      Common::SHA1::CalculateDigests(msgs, 0x400, digests.data());
+    });
+    json["sha1"] = MakeResult(reference, batch);
+  }
+
+  // The encryption of the block data, which is most of the AES work of a group
+  {
+    const auto aes_context = Common::AES::CreateContextEncrypt(KEY.data());
+    std::vector<u8> out(partition_data_size);
+    std::vector<Common::AES::Context::Buffer> buffers(partition_data_size /
+                                                      VolumeWii::BLOCK_DATA_SIZE);
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+      const size_t offset = i * VolumeWii::BLOCK_DATA_SIZE;
+      buffers[i] = {data.data() + offset, data.data() + offset, out.data() + offset};
+    }
+
+    const double reference = MeasureMiBPerSecond(partition_data_size, repetitions, [&] {
+      for (const Common::AES::Context::Buffer& buffer : buffers)
+        aes_context->Crypt(buffer.iv, buffer.in, buffer.out, VolumeWii::BLOCK_DATA_SIZE);
+    });
+    const double batch = MeasureMiBPerSecond(partition_data_size, repetitions, [&] {
+      aes_context->CryptMultiple(buffers, VolumeWii::BLOCK_DATA_SIZE);
+    });
+    json["aes_cbc_encrypt"] = MakeResult(reference, batch);
+  }
+
+  // Whole groups, the way RVZ and DirectoryBlob rebuild them when a Wii game is read
+  {
+    MemoryWiiReader reader(std::move(data));
+    auto out = std::make_unique<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>>();
+    auto reference_out = std::make_unique<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>>();
+
+    Common::ThreadPool workers(
+        "Crypto Bench",
+        threads < 0 ? Common::ThreadPool::GetAutomaticThreadCount() : static_cast<u32>(threads));
+
+    bool success = true;
+    const double reference = MeasureMiBPerSecond(partition_data_size, repetitions, [&] {
+      for (int i = 0; i < groups; ++i)
+      {
+        success &= ReferenceEncryptGroup(i * VolumeWii::GROUP_DATA_SIZE, partition_data_size,
+                                         &reader, reference_out.get());
+      }
+    });
+    const double batch = MeasureMiBPerSecond(partition_data_size, repetitions, [&] {
+      for (int i = 0; i < groups; ++i)
+      {
+        success &= VolumeWii::EncryptGroup(i * VolumeWii::GROUP_DATA_SIZE, 0, partition_data_size,
+                                           KEY, &reader, out.get(), {}, &workers);
+      }
+    });
+
+    // Both only hold the last group now, which is enough to catch a mismatch
+    if (!success || *out != *reference_out)
+    {
+      fmt::print(std::cerr, "Error: The batch group encryption doesn't match the reference\n");
+      return EXIT_FAILURE;
+    }
+
+    json["encrypt_group"] = MakeResult(reference, batch);
+    json["threads"] = picojson::value(static_cast<double>(workers.GetThreadCount()));
+  }
+
+  std::cout << picojson::value(json) << '\n';
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
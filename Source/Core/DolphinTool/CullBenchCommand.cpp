@@ -0,0 +1,153 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/CullBenchCommand.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+#include "Core/System.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/CPUCull.h"
+#include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/XFMemory.h"
+
+namespace DolphinTool
+{
+namespace
+{
+template <typename Function>
+double MeasureNanosecondsPerVertex(u64 vertices, u32 repetitions, const Function& function)
+{
+  // The fastest repetition is used, as it's the least disturbed by the rest of the system
+  double best_seconds = 0;
+  for (u32 i = 0; i < repetitions; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (i == 0 || seconds < best_seconds)
+      best_seconds = seconds;
+  }
+  return best_seconds * 1000000000.0 / vertices;
+}
+}  // namespace
+
+int CullBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: cullbench [options]...");
+
+  parser.add_option("-v", "--vertices")
+      .type("int")
+      .action("store")
+      .help("Number of vertices to transform in each draw. [default: %default]")
+      .set_default(3072);
+
+  parser.add_option("-d", "--draws")
+      .type("int")
+      .action("store")
+      .help("Number of draws per repetition. [default: %default]")
+      .set_default(1000);
+
+  parser.add_option("-r", "--repetitions")
+      .type("int")
+      .action("store")
+      .help("Number of times to repeat each measurement. The fastest is reported. "
+            "[default: %default]")
+      .set_default(5);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const int vertex_count = static_cast<int>(options.get("vertices"));
+  const int draws = static_cast<int>(options.get("draws"));
+  const int repetitions = static_cast<int>(options.get("repetitions"));
+  if (vertex_count < 1 || draws < 1 || repetitions < 1)
+  {
+    fmt::print(std::cerr, "Error: Invalid vertex, draw or repetition count\n");
+    return EXIT_FAILURE;
+  }
+
+  u32 seed = 1;
+  const auto next_random = [&seed] {
+    seed = seed * 1664525 + 1013904223;
+    return static_cast<float>(seed >> 8) / (1 << 24) * 2.0f - 1.0f;
+  };
+
+  auto& projection = Core::System::GetInstance().GetVertexShaderManager().constants.projection;
+  for (auto& row : projection)
+  {
+    for (float& value : row)
+      value = next_random();
+  }
+  for (float& value : xfmem.posMatrices)
+    value = next_random();
+  g_main_cp_state.matrix_index_a.PosNormalMtxIdx = 0;
+
+  // A position matrix index followed by 3 floats, like the vertex loaders output them. The
+  // positions are loaded with a fourth float, which may be past the last vertex.
+  constexpr u32 STRIDE = sizeof(u32) + 3 * sizeof(float);
+  std::vector<u8> vertices(vertex_count * STRIDE + sizeof(float));
+  for (int i = 0; i < vertex_count; ++i)
+  {
+    const u32 pos_mtx = (i % 20) * 3;
+    std::memcpy(&vertices[i * STRIDE], &pos_mtx, sizeof(pos_mtx));
+    for (u32 j = 0; j < 3; ++j)
+    {
+      const float value = next_random() * 100.0f;
+      std::memcpy(&vertices[i * STRIDE + sizeof(u32) + j * sizeof(float)], &value, sizeof(value));
+    }
+  }
+  auto* const output = static_cast<CPUCull::TransformedVertex*>(
+      Common::AllocateAlignedMemory(vertex_count * sizeof(CPUCull::TransformedVertex), 64));
+
+  std::vector<bool> allow_avx512_values{false};
+#ifdef _M_X86_64
+  if (cpu_info.bAVX512F && cpu_info.bFMA)
+    allow_avx512_values.push_back(true);
+#endif
+
+  picojson::array results;
+  for (bool allow_avx512 : allow_avx512_values)
+  {
+    for (bool per_vertex_pos_mtx : {false, true})
+    {
+      const CPUCull::TransformFunction transform =
+          CPUCull::GetTransformFunction(true, per_vertex_pos_mtx, allow_avx512);
+      // The position follows the matrix index only if there is one
+      const u8* const src = vertices.data() + (per_vertex_pos_mtx ? 0 : sizeof(u32));
+
+      picojson::object result;
+      result["avx512"] = picojson::value(allow_avx512);
+      result["per_vertex_pos_mtx"] = picojson::value(per_vertex_pos_mtx);
+      result["transform_ns"] = picojson::value(MeasureNanosecondsPerVertex(
+          u64{static_cast<u32>(vertex_count)} * draws, repetitions, [&] {
+            for (int draw = 0; draw < draws; ++draw)
+              transform(output, src, STRIDE, vertex_count);
+          }));
+      results.emplace_back(std::move(result));
+    }
+  }
+  Common::FreeAlignedMemory(output);
+
+  picojson::object json;
+  json["vertices"] = picojson::value(static_cast<double>(vertex_count));
+  json["draws"] = picojson::value(static_cast<double>(draws));
+  json["paths"] = picojson::value(std::move(results));
+  std::cout << picojson::value(json) << '\n';
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -0,0 +1,312 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/DiscBenchCommand.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/ScopeGuard.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/DiscUtils.h"
+#include "DiscIO/WIABlob.h"
+#include "UICommon/UICommon.h"
+
+namespace DolphinTool
+{
+namespace
+{
+constexpr std::array<std::pair<DiscIO::WIARVZCompressionType, const char*>, 6> COMPRESSION_NAMES{{
+    {DiscIO::WIARVZCompressionType::None, "none"},
+    {DiscIO::WIARVZCompressionType::Purge, "purge"},
+    {DiscIO::WIARVZCompressionType::Bzip2, "bzip2"},
+    {DiscIO::WIARVZCompressionType::LZMA, "lzma"},
+    {DiscIO::WIARVZCompressionType::LZMA2, "lzma2"},
+    {DiscIO::WIARVZCompressionType::Zstd, "zstd"},
+}};
+
+std::optional<DiscIO::WIARVZCompressionType> ParseCompressionType(const std::string& name)
+{
+  for (const auto& [type, type_name] : COMPRESSION_NAMES)
+  {
+    if (name == type_name)
+      return type;
+  }
+  return std::nullopt;
+}
+
+const char* GetCompressionName(DiscIO::WIARVZCompressionType compression_type)
+{
+  for (const auto& [type, name] : COMPRESSION_NAMES)
+  {
+    if (type == compression_type)
+      return name;
+  }
+  return "";
+}
+
+bool IsCompressed(DiscIO::WIARVZCompressionType compression_type)
+{
+  return compression_type != DiscIO::WIARVZCompressionType::None &&
+         compression_type != DiscIO::WIARVZCompressionType::Purge;
+}
+
+bool IsSupported(DiscIO::WIARVZCompressionType compression_type, bool rvz)
+{
+  return rvz ? compression_type != DiscIO::WIARVZCompressionType::Purge :
+               compression_type != DiscIO::WIARVZCompressionType::Zstd;
+}
+
+double ToMiBPerSecond(u64 bytes, std::chrono::steady_clock::duration time)
+{
+  return bytes / (1024.0 * 1024.0) / std::chrono::duration<double>(time).count();
+}
+
+// Reads the whole image front to back, the way a verification or a conversion does.
+std::optional<double> BenchmarkSequentialReads(DiscIO::BlobReader* reader, u64 read_size)
+{
+  const u64 data_size = reader->GetDataSize();
+  std::vector<u8> buffer(read_size);
+
+  const auto start = std::chrono::steady_clock::now();
+  for (u64 offset = 0; offset < data_size; offset += read_size)
+  {
+    if (!reader->Read(offset, std::min(read_size, data_size - offset), buffer.data()))
+      return std::nullopt;
+  }
+  return ToMiBPerSecond(data_size, std::chrono::steady_clock::now() - start);
+}
+
+// Reads from aligned offsets spread over the whole image, the way a game seeking between files
+// does. The offsets are the same for every image, so the results can be compared.
+std::optional<double> BenchmarkRandomReads(DiscIO::BlobReader* reader, u64 read_size, u32 reads)
+{
+  const u64 data_size = reader->GetDataSize();
+  if (data_size < read_size)
+    return std::nullopt;
+
+  std::mt19937_64 rng(0);
+  std::uniform_int_distribution<u64> distribution(0, (data_size - read_size) / read_size);
+  std::vector<u8> buffer(read_size);
+
+  const auto start = std::chrono::steady_clock::now();
+  for (u32 i = 0; i < reads; ++i)
+  {
+    if (!reader->Read(distribution(rng) * read_size, read_size, buffer.data()))
+      return std::nullopt;
+  }
+  return ToMiBPerSecond(read_size * reads, std::chrono::steady_clock::now() - start);
+}
+}  // namespace
+
+int DiscBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: discbench [options]...");
+
+  parser.add_option("-u", "--user")
+      .type("string")
+      .action("store")
+      .help("User folder path, required for temporary processing files. "
+            "Will be automatically created if this option is not set.")
+      .set_default("");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the disc image FILE to benchmark with. It is converted with each "
+            "compression method to a temporary file, which is then read.")
+      .metavar("FILE");
+
+  parser.add_option("-f", "--format")
+      .type("string")
+      .action("store")
+      .help("Container format to convert to. [%choices] [default: %default]")
+      .choices({"wia", "rvz"})
+      .set_default("rvz");
+
+  parser.add_option("-c", "--compression")
+      .type("string")
+      .action("append")
+      .help("Compression method to benchmark. Can be given more than once. Defaults to all "
+            "methods the format supports. [%choices]")
+      .choices({"none", "purge", "bzip2", "lzma", "lzma2", "zstd"});
+
+  parser.add_option("-l", "--compression_level")
+      .type("int")
+      .action("store")
+      .help("Level of compression for the selected methods. [default: %default]")
+      .set_default(5);
+
+  parser.add_option("-b", "--block_size")
+      .type("int")
+      .action("store")
+      .help("Block size to convert with. [default: %default]")
+      .set_default(131072);
+
+  parser.add_option("-s", "--read_size")
+      .type("int")
+      .action("store")
+      .help("Number of bytes to read at a time. [default: %default]")
+      .set_default(32768);
+
+  parser.add_option("-r", "--random_reads")
+      .type("int")
+      .action("store")
+      .help("Number of reads from random offsets. [default: %default]")
+      .set_default(1000);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  UICommon::SetUserDirectory(options["user"]);
+  UICommon::Init();
+  Common::ScopeGuard ui_common_guard([] { UICommon::Shutdown(); });
+
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& input_file_path = options["input"];
+
+  const bool rvz = options["format"] == "rvz";
+  const DiscIO::BlobType format = rvz ? DiscIO::BlobType::RVZ : DiscIO::BlobType::WIA;
+
+  std::vector<DiscIO::WIARVZCompressionType> compression_types;
+  for (const std::string& name : options.all("compression"))
+    compression_types.push_back(*ParseCompressionType(name));
+  if (compression_types.empty())
+  {
+    for (const auto& [compression_type, name] : COMPRESSION_NAMES)
+    {
+      if (IsSupported(compression_type, rvz))
+        compression_types.push_back(compression_type);
+    }
+  }
+
+  const int compression_level = static_cast<int>(options.get("compression_level"));
+  for (const DiscIO::WIARVZCompressionType compression_type : compression_types)
+  {
+    if (!IsSupported(compression_type, rvz))
+    {
+      fmt::print(std::cerr, "Error: Compression type is not supported for the container format\n");
+      return EXIT_FAILURE;
+    }
+
+    const std::pair<int, int> range = DiscIO::GetAllowedCompressionLevels(compression_type, false);
+    if (IsCompressed(compression_type) &&
+        (compression_level < range.first || compression_level > range.second))
+    {
+      fmt::print(std::cerr, "Error: Compression level not in acceptable range\n");
+      return EXIT_FAILURE;
+    }
+  }
+
+  const int block_size = static_cast<int>(options.get("block_size"));
+  if (!DiscIO::IsDiscImageBlockSizeValid(block_size, format))
+  {
+    fmt::print(std::cerr, "Error: Block size is not valid for this format\n");
+    return EXIT_FAILURE;
+  }
+
+  const int read_size = static_cast<int>(options.get("read_size"));
+  const int random_reads = static_cast<int>(options.get("random_reads"));
+  if (read_size <= 0 || random_reads < 0)
+  {
+    fmt::print(std::cerr, "Error: Invalid read size or count\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::string temp_dir = File::CreateTempDir();
+  if (temp_dir.empty())
+  {
+    fmt::print(std::cerr, "Error: Could not create a temporary directory\n");
+    return EXIT_FAILURE;
+  }
+  Common::ScopeGuard temp_dir_guard([&temp_dir] { File::DeleteDirRecursively(temp_dir); });
+
+  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+
+  picojson::array results_json;
+  for (const DiscIO::WIARVZCompressionType compression_type : compression_types)
+  {
+    const char* name = GetCompressionName(compression_type);
+    const int level = IsCompressed(compression_type) ? compression_level : 0;
+    const std::string temp_path = fmt::format("{}/{}.{}", temp_dir, name, options["format"]);
+
+    fmt::print(std::cerr, "Converting with {}...\n", name);
+    if (!DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, temp_path, rvz,
+                                   compression_type, level,
+                                   block_size, NOOP_STATUS_CALLBACK))
+    {
+      fmt::print(std::cerr, "Error: Conversion failed\n");
+      return EXIT_FAILURE;
+    }
+
+    std::unique_ptr<DiscIO::BlobReader> reader = DiscIO::CreateBlobReader(temp_path);
+    if (!reader)
+    {
+      fmt::print(std::cerr, "Error: The converted file could not be opened.\n");
+      return EXIT_FAILURE;
+    }
+
+    fmt::print(std::cerr, "Reading with {}...\n", name);
+    const std::optional<double> sequential = BenchmarkSequentialReads(reader.get(), read_size);
+    const std::optional<double> random =
+        BenchmarkRandomReads(reader.get(), read_size, static_cast<u32>(random_reads));
+    if (!sequential || !random)
+    {
+      fmt::print(std::cerr, "Error: Reading the converted file failed\n");
+      return EXIT_FAILURE;
+    }
+
+    picojson::object result_json;
+    result_json["compression"] = picojson::value(name);
+    result_json["compression_level"] = picojson::value(static_cast<double>(level));
+    result_json["file_size"] = picojson::value(static_cast<double>(reader->GetRawSize()));
+    result_json["sequential_mib_per_second"] = picojson::value(*sequential);
+    result_json["random_mib_per_second"] = picojson::value(*random);
+    results_json.emplace_back(std::move(result_json));
+
+    // Don't keep several converted copies of the image around at the same time
+    reader.reset();
+    File::Delete(temp_path);
+  }
+
+  picojson::object json;
+  json["file"] = picojson::value(input_file_path);
+  json["format"] = picojson::value(options["format"]);
+  json["block_size"] = picojson::value(static_cast<double>(block_size));
+  json["data_size"] = picojson::value(static_cast<double>(blob_reader->GetDataSize()));
+  json["read_size"] = picojson::value(static_cast<double>(read_size));
+  json["random_reads"] = picojson::value(static_cast<double>(random_reads));
+  json["results"] = picojson::value(std::move(results_json));
+
+  std::cout << picojson::value(json) << '\n';
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
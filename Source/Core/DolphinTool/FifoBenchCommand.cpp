@@ -0,0 +1,288 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/FifoBenchCommand.h"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "AudioCommon/AudioCommon.h"
+#include "Common/Config/Config.h"
+#include "Common/EnumMap.h"
+#include "Common/Event.h"
+#include "Common/FileUtil.h"
+#include "Common/ScopeGuard.h"
+#include "Common/WindowSystemInfo.h"
+#include "Core/Boot/Boot.h"
+#include "Core/BootManager.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+#include "VideoCommon/Statistics.h"
+
+namespace DolphinTool
+{
+namespace
+{
+using PhaseTimes = Common::EnumMap<std::chrono::nanoseconds, VideoPhase::TextureDecode>;
+
+constexpr std::array<std::pair<VideoPhase, const char*>, 7> PHASE_NAMES{{
+    {VideoPhase::OpcodeDecode, "opcode_decode"},
+    {VideoPhase::VertexLoading, "vertex_loading"},
+    {VideoPhase::BPWrites, "bp_writes"},
+    {VideoPhase::CPWrites, "cp_writes"},
+    {VideoPhase::XFWrites, "xf_writes"},
+    {VideoPhase::TextureCacheLookup, "texture_cache_lookup"},
+    {VideoPhase::TextureDecode, "texture_decode"},
+}};
+
+struct FrameTiming
+{
+  u32 frame;
+  std::chrono::nanoseconds time;
+  PhaseTimes phases;
+};
+
+// Collects the timings of each frame from FifoPlayer's frame callback, which is called on the CPU
+// thread right before each frame is written.
+class FrameTimer
+{
+public:
+  // If frames is 0, one pass through the log is timed.
+  FrameTimer(u32 warmup_frames, u32 frames) : m_warmup_frames(warmup_frames), m_frames(frames) {}
+
+  void OnFrameStart(u32 frame, u32 frames_in_log)
+  {
+    const auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard lk(m_mutex);
+    if (m_finished)
+      return;
+
+    if (m_frames == 0)
+      m_frames = frames_in_log;
+
+    if (m_frames_seen > m_warmup_frames)
+    {
+      PhaseTimes phases;
+      for (const auto& [phase, name] : PHASE_NAMES)
+        phases[phase] = g_stats.phase_times[phase] - m_last_phase_times[phase];
+      m_timings.push_back({m_last_frame, now - m_last_time, phases});
+
+      if (m_timings.size() >= m_frames)
+      {
+        m_finished = true;
+        m_done.Set();
+        return;
+      }
+    }
+
+    ++m_frames_seen;
+    m_last_frame = frame;
+    m_last_time = now;
+    m_last_phase_times = g_stats.phase_times;
+  }
+
+  // Returns true once all frames have been timed.
+  bool WaitFor(std::chrono::milliseconds timeout) { return m_done.WaitFor(timeout); }
+
+  std::vector<FrameTiming> GetTimings() const
+  {
+    std::lock_guard lk(m_mutex);
+    return m_timings;
+  }
+
+private:
+  const u32 m_warmup_frames;
+  u32 m_frames;
+
+  mutable std::mutex m_mutex;
+  Common::Event m_done;
+  bool m_finished = false;
+  u32 m_frames_seen = 0;
+  u32 m_last_frame = 0;
+  std::chrono::steady_clock::time_point m_last_time;
+  PhaseTimes m_last_phase_times{};
+  std::vector<FrameTiming> m_timings;
+};
+
+double ToMilliseconds(std::chrono::nanoseconds time)
+{
+  return std::chrono::duration<double, std::milli>(time).count();
+}
+
+picojson::object PhasesToJson(const PhaseTimes& phases)
+{
+  picojson::object json;
+  for (const auto& [phase, name] : PHASE_NAMES)
+    json[name] = picojson::value(ToMilliseconds(phases[phase]));
+  return json;
+}
+}  // namespace
+
+int FifoBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: fifobench [options]...");
+
+  parser.add_option("-u", "--user")
+      .type("string")
+      .action("store")
+      .help("User folder path. Will be automatically created if this option is not set.")
+      .set_default("");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the FIFO log (.dff) to replay.")
+      .metavar("FILE");
+
+  parser.add_option("-b", "--backend")
+      .type("string")
+      .action("store")
+      .help("Video backend to replay with. [%choices]")
+      .choices({"null", "software"})
+      .set_default("null");
+
+  parser.add_option("-f", "--frames")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of frames to time. The log is looped if it has fewer frames. "
+            "Defaults to the number of frames in the log.")
+      .metavar("COUNT");
+
+  parser.add_option("-w", "--warmup")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of frames to replay before timing starts. [default: %default]")
+      .metavar("COUNT")
+      .set_default(0);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  UICommon::SetUserDirectory(options["user"]);
+  UICommon::Init();
+  Common::ScopeGuard ui_common_guard([] { UICommon::Shutdown(); });
+
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& input_file_path = options["input"];
+  if (!File::Exists(input_file_path))
+  {
+    fmt::print(std::cerr, "Error: Input file does not exist\n");
+    return EXIT_FAILURE;
+  }
+
+  const int frames = options.is_set("frames") ? static_cast<int>(options.get("frames")) : 0;
+  const int warmup_frames = static_cast<int>(options.get("warmup"));
+  if ((options.is_set("frames") && frames <= 0) || warmup_frames < 0)
+  {
+    fmt::print(std::cerr, "Error: Invalid frame count\n");
+    return EXIT_FAILURE;
+  }
+
+  // The config names of the respective video backends
+  const std::string backend = options["backend"] == "software" ? "Software Renderer" : "Null";
+
+  // Run the GPU on the CPU thread, so the phase times are only ever touched by one thread and the
+  // time between two frame callbacks includes all work for the frame. Don't limit the speed, and
+  // don't require an audio device.
+  Config::SetCurrent(Config::MAIN_GFX_BACKEND, backend);
+  Config::SetCurrent(Config::MAIN_CPU_THREAD, false);
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  Config::SetCurrent(Config::MAIN_AUDIO_BACKEND, std::string(BACKEND_NULLSOUND));
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+
+  auto& system = Core::System::GetInstance();
+  auto& fifo_player = system.GetFifoPlayer();
+
+  FrameTimer frame_timer(static_cast<u32>(warmup_frames), static_cast<u32>(frames));
+  fifo_player.SetFrameWrittenCallback([&] {
+    frame_timer.OnFrameStart(fifo_player.GetCurrentFrameNum(),
+                             fifo_player.GetFrameRangeEnd() - fifo_player.GetFrameRangeStart() + 1);
+  });
+  Common::ScopeGuard callback_guard([&] { fifo_player.SetFrameWrittenCallback({}); });
+
+  g_stats.phase_times = {};
+  g_stats.phase_timing_enabled = true;
+  Common::ScopeGuard phase_timing_guard([] { g_stats.phase_timing_enabled = false; });
+
+  WindowSystemInfo wsi;
+  wsi.type = WindowSystemType::Headless;
+
+  if (!BootManager::BootCore(system, BootParameters::GenerateFromFile(input_file_path), wsi))
+  {
+    fmt::print(std::cerr, "Error: Could not start replaying the FIFO log\n");
+    return EXIT_FAILURE;
+  }
+
+  bool completed = false;
+  while (!(completed = frame_timer.WaitFor(std::chrono::milliseconds(100))))
+  {
+    Core::HostDispatchJobs(system);
+    if (Core::IsUninitialized(system))
+      break;
+  }
+
+  Core::Stop(system);
+  while (!Core::IsUninitialized(system))
+  {
+    Core::HostDispatchJobs(system);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  Core::Shutdown(system);
+
+  if (!completed)
+  {
+    fmt::print(std::cerr, "Error: Emulation stopped before all frames were replayed\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::vector<FrameTiming> timings = frame_timer.GetTimings();
+
+  std::chrono::nanoseconds total_time{};
+  PhaseTimes total_phases{};
+  picojson::array frames_json;
+  for (const FrameTiming& timing : timings)
+  {
+    total_time += timing.time;
+    for (const auto& [phase, name] : PHASE_NAMES)
+      total_phases[phase] += timing.phases[phase];
+
+    picojson::object frame_json;
+    frame_json["frame"] = picojson::value(static_cast<double>(timing.frame));
+    frame_json["time_ms"] = picojson::value(ToMilliseconds(timing.time));
+    frame_json["phases_ms"] = picojson::value(PhasesToJson(timing.phases));
+    frames_json.emplace_back(std::move(frame_json));
+  }
+
+  picojson::object json;
+  json["file"] = picojson::value(input_file_path);
+  json["backend"] = picojson::value(backend);
+  json["frame_count"] = picojson::value(static_cast<double>(timings.size()));
+  json["total_time_ms"] = picojson::value(ToMilliseconds(total_time));
+  json["average_frame_time_ms"] = picojson::value(ToMilliseconds(total_time) / timings.size());
+  json["phases_ms"] = picojson::value(PhasesToJson(total_phases));
+  json["frames"] = picojson::value(std::move(frames_json));
+
+  std::cout << picojson::value(json) << '\n';
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
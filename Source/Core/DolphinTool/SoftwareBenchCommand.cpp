@@ -0,0 +1,202 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/SoftwareBenchCommand.h"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/ScopeGuard.h"
+#include "VideoBackends/Software/Tev.h"
+#include "VideoBackends/Software/TextureSampler.h"
+#include "VideoCommon/BPMemory.h"
+
+namespace DolphinTool
+{
+namespace
+{
+constexpr size_t QUAD_SIZE = TextureSampler::QUAD_SIZE;
+
+template <typename Function>
+double MeasureNanosecondsPerPixel(u64 pixels, u32 repetitions, const Function& function)
+{
+  // The fastest repetition is used, as it's the least disturbed by the rest of the system
+  double best_seconds = 0;
+  for (u32 i = 0; i < repetitions; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (i == 0 || seconds < best_seconds)
+      best_seconds = seconds;
+  }
+  return best_seconds * 1000000000.0 / pixels;
+}
+
+// The kernels of the software renderer are picked by what the CPU supports, so each of the
+// narrower paths is measured by hiding the wider instruction sets.
+struct KernelPath
+{
+  const char* name;
+  bool avx2;
+  bool sse4_1;
+};
+
+std::vector<KernelPath> GetKernelPaths()
+{
+  std::vector<KernelPath> paths{{"scalar", false, false}};
+#ifdef _M_X86_64
+  if (cpu_info.bSSE4_1)
+    paths.push_back({"sse4_1", false, true});
+  if (cpu_info.bAVX2)
+    paths.push_back({"avx2", true, true});
+#endif
+  return paths;
+}
+}  // namespace
+
+int SoftwareBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: swbench [options]...");
+
+  parser.add_option("-p", "--pixels")
+      .type("int")
+      .action("store")
+      .help("Number of pixels to shade per repetition, in quads like the rasterizer does. "
+            "[default: %default]")
+      .set_default(1 << 20);
+
+  parser.add_option("-r", "--repetitions")
+      .type("int")
+      .action("store")
+      .help("Number of times to repeat each measurement. The fastest is reported. "
+            "[default: %default]")
+      .set_default(5);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const int pixels = static_cast<int>(options.get("pixels"));
+  const int repetitions = static_cast<int>(options.get("repetitions"));
+  if (pixels < static_cast<int>(QUAD_SIZE) || repetitions < 1)
+  {
+    fmt::print(std::cerr, "Error: Invalid pixel or repetition count\n");
+    return EXIT_FAILURE;
+  }
+
+  // The inputs of one block of pixels are reused over and over again, as the texels and registers
+  // of neighbouring quads are in the CPU caches when the software renderer shades them.
+  constexpr size_t BLOCK_PIXELS = 1024;
+  const u32 blocks = static_cast<u32>((pixels + BLOCK_PIXELS - 1) / BLOCK_PIXELS);
+
+  u32 seed = 1;
+  const auto next_random = [&seed] {
+    seed = seed * 1664525 + 1013904223;
+    return seed;
+  };
+
+  std::array<std::vector<u32>, 4> texels;
+  for (std::vector<u32>& row : texels)
+  {
+    row.resize(BLOCK_PIXELS);
+    for (u32& texel : row)
+      texel = next_random();
+  }
+  std::vector<s32> fract_s(BLOCK_PIXELS);
+  std::vector<s32> fract_t(BLOCK_PIXELS);
+  for (size_t i = 0; i < BLOCK_PIXELS; ++i)
+  {
+    fract_s[i] = next_random() >> 25;
+    fract_t[i] = next_random() >> 25;
+  }
+
+  std::vector<Tev::QuadInputs> tev_inputs(BLOCK_PIXELS / QUAD_SIZE);
+  for (Tev::QuadInputs& quad : tev_inputs)
+  {
+    for (auto* values : {&quad.a, &quad.b, &quad.c, &quad.d})
+    {
+      for (s16& value : *values)
+        value = static_cast<s16>(next_random() >> 16);
+    }
+  }
+  // A typical modulate stage: (tex * ras) * 2 - 0.5, clamped
+  TevStageCombiner::ColorCombiner cc;
+  TevStageCombiner::AlphaCombiner ac;
+  cc.hex = 0;
+  cc.scale = TevScale::Scale2;
+  cc.bias = TevBias::SubHalf;
+  cc.clamp = true;
+  ac.hex = 0;
+  ac.scale = TevScale::Scale2;
+  ac.bias = TevBias::SubHalf;
+  ac.clamp = true;
+
+  std::vector<u32> samples(BLOCK_PIXELS);
+  std::vector<Tev::QuadOutputs> tev_outputs(tev_inputs.size());
+
+  const CPUInfo saved_cpu_info = cpu_info;
+  Common::ScopeGuard restore_guard([&] { cpu_info = saved_cpu_info; });
+
+  picojson::array results;
+  for (const KernelPath& path : GetKernelPaths())
+  {
+    cpu_info.bAVX2 = path.avx2;
+    cpu_info.bSSE4_1 = path.sse4_1;
+
+    const auto measure = [&](const auto& function) {
+      return picojson::value(
+          MeasureNanosecondsPerPixel(u64{blocks} * BLOCK_PIXELS, repetitions, function));
+    };
+
+    picojson::object result;
+    result["path"] = picojson::value(path.name);
+    result["bilinear_ns"] = measure([&] {
+      for (u32 block = 0; block < blocks; ++block)
+      {
+        for (size_t i = 0; i < BLOCK_PIXELS; i += QUAD_SIZE)
+        {
+          TextureSampler::BilinearFilterSpan(
+              {&texels[0][i], &texels[1][i], &texels[2][i], &texels[3][i]}, &fract_s[i],
+              &fract_t[i], &samples[i], QUAD_SIZE);
+        }
+      }
+    });
+    result["lerp_mips_ns"] = measure([&] {
+      for (u32 block = 0; block < blocks; ++block)
+      {
+        for (size_t i = 0; i < BLOCK_PIXELS; i += QUAD_SIZE)
+        {
+          TextureSampler::LerpMipsSpan(&texels[0][i], &texels[1][i], fract_s[i] >> 3, &samples[i],
+                                       QUAD_SIZE);
+        }
+      }
+    });
+    result["tev_combine_ns"] = measure([&] {
+      for (u32 block = 0; block < blocks; ++block)
+      {
+        for (size_t i = 0; i < tev_inputs.size(); ++i)
+          Tev::CombineRegular(cc, ac, tev_inputs[i], tev_outputs[i]);
+      }
+    });
+    results.emplace_back(std::move(result));
+  }
+
+  picojson::object json;
+  json["pixels"] = picojson::value(static_cast<double>(u64{blocks} * BLOCK_PIXELS));
+  json["paths"] = picojson::value(std::move(results));
+  std::cout << picojson::value(json) << '\n';
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -0,0 +1,222 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/StateBenchCommand.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/ScopeGuard.h"
+#include "Common/ThreadPool.h"
+#include "Core/State.h"
+#include "UICommon/UICommon.h"
+
+namespace DolphinTool
+{
+namespace
+{
+constexpr std::array<std::pair<State::CompressionType, const char*>, 4> COMPRESSION_NAMES{{
+    {State::CompressionType::Uncompressed, "none"},
+    {State::CompressionType::LZ4, "lz4"},
+    {State::CompressionType::ChunkedLZ4, "chunked-lz4"},
+    {State::CompressionType::ChunkedZstd, "chunked-zstd"},
+}};
+
+std::optional<State::CompressionType> ParseCompressionType(const std::string& name)
+{
+  for (const auto& [type, type_name] : COMPRESSION_NAMES)
+  {
+    if (name == type_name)
+      return type;
+  }
+  return std::nullopt;
+}
+
+const char* GetCompressionName(State::CompressionType compression_type)
+{
+  for (const auto& [type, name] : COMPRESSION_NAMES)
+  {
+    if (type == compression_type)
+      return name;
+  }
+  return "";
+}
+
+// Runs function the given number of times and returns the fastest run in MiB per second of
+// uncompressed state data, as it's the least disturbed by the rest of the system. Returns nullopt
+// if any run fails.
+template <typename Function>
+std::optional<double> MeasureMiBPerSecond(u64 bytes, u32 repetitions, const Function& function)
+{
+  double best_seconds = 0;
+  for (u32 i = 0; i < repetitions; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    if (!function())
+      return std::nullopt;
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (i == 0 || seconds < best_seconds)
+      best_seconds = seconds;
+  }
+  return bytes / (1024.0 * 1024.0) / best_seconds;
+}
+}  // namespace
+
+int StateBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: statebench [options]...");
+
+  parser.add_option("-u", "--user")
+      .type("string")
+      .action("store")
+      .help("User folder path, required for temporary processing files. "
+            "Will be automatically created if this option is not set.")
+      .set_default("");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the savestate FILE to benchmark with. Its data is saved with each "
+            "compression method to a temporary file, which is then loaded.")
+      .metavar("FILE");
+
+  parser.add_option("-c", "--compression")
+      .type("string")
+      .action("append")
+      .help("Compression method to benchmark. Can be given more than once. Defaults to all "
+            "methods. [%choices]")
+      .choices({"none", "lz4", "chunked-lz4", "chunked-zstd"});
+
+  parser.add_option("-r", "--repetitions")
+      .type("int")
+      .action("store")
+      .help("Number of times to repeat each measurement. The fastest is reported. "
+            "[default: %default]")
+      .set_default(5);
+
+  parser.add_option("-t", "--threads")
+      .type("int")
+      .action("store")
+      .help("Number of threads for the chunked methods, or -1 for one per core but one. "
+            "[default: %default]")
+      .set_default(-1);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  UICommon::SetUserDirectory(options["user"]);
+  UICommon::Init();
+  Common::ScopeGuard ui_common_guard([] { UICommon::Shutdown(); });
+
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& input_file_path = options["input"];
+
+  std::vector<State::CompressionType> compression_types;
+  for (const std::string& name : options.all("compression"))
+    compression_types.push_back(*ParseCompressionType(name));
+  if (compression_types.empty())
+  {
+    for (const auto& [compression_type, name] : COMPRESSION_NAMES)
+      compression_types.push_back(compression_type);
+  }
+
+  const int repetitions = static_cast<int>(options.get("repetitions"));
+  const int threads = static_cast<int>(options.get("threads"));
+  if (repetitions < 1 || threads < -1)
+  {
+    fmt::print(std::cerr, "Error: Invalid repetition or thread count\n");
+    return EXIT_FAILURE;
+  }
+
+  Common::UniqueBuffer<u8> data;
+  if (!State::ReadStateFileData(input_file_path, data))
+  {
+    fmt::print(std::cerr, "Error: The input file could not be read as a savestate.\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::string temp_dir = File::CreateTempDir();
+  if (temp_dir.empty())
+  {
+    fmt::print(std::cerr, "Error: Could not create a temporary directory\n");
+    return EXIT_FAILURE;
+  }
+  Common::ScopeGuard temp_dir_guard([&temp_dir] { File::DeleteDirRecursively(temp_dir); });
+
+  Common::ThreadPool workers(
+      "State Bench",
+      threads < 0 ? Common::ThreadPool::GetAutomaticThreadCount() : static_cast<u32>(threads));
+
+  picojson::array results_json;
+  for (const State::CompressionType compression_type : compression_types)
+  {
+    const char* name = GetCompressionName(compression_type);
+    const std::string temp_path = fmt::format("{}/{}.sav", temp_dir, name);
+
+    // Like a savestate, each run includes writing the file, so that it isn't only the speed of
+    // the compressor that is measured.
+    fmt::print(std::cerr, "Saving with {}...\n", name);
+    const std::optional<double> save = MeasureMiBPerSecond(data.size(), repetitions, [&] {
+      File::IOFile f(temp_path, "wb");
+      State::WritePayloadToFile(data, compression_type, f, workers);
+      return f.Close();
+    });
+
+    u64 file_size = 0;
+    Common::UniqueBuffer<u8> loaded;
+    fmt::print(std::cerr, "Loading with {}...\n", name);
+    const std::optional<double> load = MeasureMiBPerSecond(data.size(), repetitions, [&] {
+      File::IOFile f(temp_path, "rb");
+      file_size = f.GetSize();
+      return State::ReadPayloadFromFile(loaded, data.size(), compression_type, f, workers);
+    });
+
+    if (!save || !load || loaded.size() != data.size() ||
+        !std::equal(loaded.begin(), loaded.end(), data.begin()))
+    {
+      fmt::print(std::cerr, "Error: The state data didn't survive saving and loading\n");
+      return EXIT_FAILURE;
+    }
+
+    picojson::object result_json;
+    result_json["compression"] = picojson::value(name);
+    result_json["file_size"] = picojson::value(static_cast<double>(file_size));
+    result_json["save_mib_per_second"] = picojson::value(*save);
+    result_json["load_mib_per_second"] = picojson::value(*load);
+    results_json.emplace_back(std::move(result_json));
+
+    File::Delete(temp_path);
+  }
+
+  picojson::object json;
+  json["file"] = picojson::value(input_file_path);
+  json["data_size"] = picojson::value(static_cast<double>(data.size()));
+  json["threads"] = picojson::value(static_cast<double>(workers.GetThreadCount()));
+  json["results"] = picojson::value(std::move(results_json));
+
+  std::cout << picojson::value(json) << '\n';
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
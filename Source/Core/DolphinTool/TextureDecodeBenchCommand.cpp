@@ -0,0 +1,182 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/TextureDecodeBenchCommand.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/ScopeGuard.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace DolphinTool
+{
+namespace
+{
+struct NamedFormat
+{
+  const char* name;
+  TextureFormat format;
+};
+
+constexpr NamedFormat FORMATS[] = {
+    {"I4", TextureFormat::I4},         {"I8", TextureFormat::I8},
+    {"IA4", TextureFormat::IA4},       {"IA8", TextureFormat::IA8},
+    {"RGB565", TextureFormat::RGB565}, {"RGB5A3", TextureFormat::RGB5A3},
+    {"RGBA8", TextureFormat::RGBA8},   {"C4", TextureFormat::C4},
+    {"C8", TextureFormat::C8},         {"C14X2", TextureFormat::C14X2},
+    {"CMPR", TextureFormat::CMPR},
+};
+
+struct NamedTLUTFormat
+{
+  const char* name;
+  TLUTFormat format;
+};
+
+constexpr NamedTLUTFormat TLUT_FORMATS[] = {
+    {"IA8", TLUTFormat::IA8}, {"RGB565", TLUTFormat::RGB565}, {"RGB5A3", TLUTFormat::RGB5A3}};
+
+template <typename Function>
+double MeasureNanosecondsPerTexel(u64 texels, u32 repetitions, const Function& function)
+{
+  // The fastest repetition is used, as it's the least disturbed by the rest of the system
+  double best_seconds = 0;
+  for (u32 i = 0; i < repetitions; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (i == 0 || seconds < best_seconds)
+      best_seconds = seconds;
+  }
+  return best_seconds * 1000000000.0 / texels;
+}
+
+// The x86-64 decoders are picked by what the CPU supports, so each of the narrower paths is
+// measured by hiding the wider instruction sets. ARM64 always uses its NEON decoders.
+struct DecoderPath
+{
+  const char* name;
+  bool avx2;
+  bool ssse3;
+};
+
+std::vector<DecoderPath> GetDecoderPaths()
+{
+#ifdef _M_X86_64
+  std::vector<DecoderPath> paths{{"sse2", false, false}};
+  if (cpu_info.bSSSE3)
+    paths.push_back({"ssse3", false, true});
+  if (cpu_info.bAVX2)
+    paths.push_back({"avx2", true, true});
+  return paths;
+#elif defined(_M_ARM_64)
+  return {{"neon", false, false}};
+#else
+  return {{"generic", false, false}};
+#endif
+}
+}  // namespace
+
+int TextureDecodeBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: texdecodebench [options]...");
+
+  parser.add_option("-s", "--size")
+      .type("int")
+      .action("store")
+      .help("Width and height of the decoded textures in texels. Must be a multiple of 8. "
+            "[default: %default]")
+      .set_default(1024);
+
+  parser.add_option("-r", "--repetitions")
+      .type("int")
+      .action("store")
+      .help("Number of times to repeat each measurement. The fastest is reported. "
+            "[default: %default]")
+      .set_default(30);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const int size = static_cast<int>(options.get("size"));
+  const int repetitions = static_cast<int>(options.get("repetitions"));
+  if (size < 8 || size > 8192 || size % 8 != 0 || repetitions < 1)
+  {
+    fmt::print(std::cerr, "Error: Invalid texture size or repetition count\n");
+    return EXIT_FAILURE;
+  }
+
+  // RGBA8 is the largest format with 4 bytes per texel, and C14X2 uses the largest palette
+  const u64 texels = u64{static_cast<u32>(size)} * static_cast<u32>(size);
+  std::vector<u8> src(texels * 4);
+  std::vector<u8> tlut(2 * 16384);
+  u32 seed = 1;
+  for (std::vector<u8>* data : {&src, &tlut})
+  {
+    for (u8& byte : *data)
+    {
+      seed = seed * 1664525 + 1013904223;
+      byte = static_cast<u8>(seed >> 24);
+    }
+  }
+  std::vector<u8> dst(texels * 4);
+
+  const CPUInfo saved_cpu_info = cpu_info;
+  Common::ScopeGuard restore_guard([&] { cpu_info = saved_cpu_info; });
+
+  picojson::array results;
+  for (const DecoderPath& path : GetDecoderPaths())
+  {
+#ifdef _M_X86_64
+    cpu_info.bAVX2 = path.avx2;
+    cpu_info.bSSSE3 = path.ssse3;
+#endif
+
+    picojson::object formats;
+    for (const auto& [name, format] : FORMATS)
+    {
+      const auto measure = [&](TLUTFormat tlut_format) {
+        return picojson::value(MeasureNanosecondsPerTexel(texels, repetitions, [&] {
+          TexDecoder_Decode(dst.data(), src.data(), size, size, format, tlut.data(), tlut_format);
+        }));
+      };
+
+      // Paletted formats are measured with every palette format, as those are decoded differently
+      if (IsColorIndexed(format))
+      {
+        for (const auto& [tlut_name, tlut_format] : TLUT_FORMATS)
+          formats[fmt::format("{}_{}", name, tlut_name)] = measure(tlut_format);
+      }
+      else
+      {
+        formats[name] = measure(TLUTFormat::IA8);
+      }
+    }
+
+    picojson::object result;
+    result["path"] = picojson::value(path.name);
+    result["ns_per_texel"] = picojson::value(std::move(formats));
+    results.emplace_back(std::move(result));
+  }
+
+  picojson::object json;
+  json["texels"] = picojson::value(static_cast<double>(texels));
+  json["paths"] = picojson::value(std::move(results));
+  std::cout << picojson::value(json) << '\n';
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -0,0 +1,132 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/TextureHashBenchCommand.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+#include "Common/StringUtil.h"
+
+namespace DolphinTool
+{
+namespace
+{
+// The sample counts of the "Fast" and "Medium" safe texture cache settings
+constexpr u32 FAST_SAMPLES = 128;
+constexpr u32 MEDIUM_SAMPLES = 512;
+
+template <typename Function>
+double MeasureNanosecondsPerHash(u64 hashes, u32 repetitions, const Function& function)
+{
+  // The fastest repetition is used, as it's the least disturbed by the rest of the system
+  double best_seconds = 0;
+  for (u32 i = 0; i < repetitions; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (i == 0 || seconds < best_seconds)
+      best_seconds = seconds;
+  }
+  return best_seconds * 1000000000.0 / hashes;
+}
+}  // namespace
+
+int TextureHashBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: texhashbench [options]...");
+
+  parser.add_option("-s", "--sizes")
+      .action("store")
+      .help("Comma-separated texture sizes in bytes. [default: %default]")
+      .set_default("2048,32768,131072,524288,2097152");
+
+  parser.add_option("-m", "--memory")
+      .type("int")
+      .action("store")
+      .help("MiB of textures to hash per repetition. Textures are read from memory which doesn't "
+            "fit in the CPU caches, like emulated RAM usually doesn't. [default: %default]")
+      .set_default(64);
+
+  parser.add_option("-r", "--repetitions")
+      .type("int")
+      .action("store")
+      .help("Number of times to repeat each measurement. The fastest is reported. "
+            "[default: %default]")
+      .set_default(5);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const int memory_mib = static_cast<int>(options.get("memory"));
+  const int repetitions = static_cast<int>(options.get("repetitions"));
+  if (memory_mib < 1 || repetitions < 1)
+  {
+    fmt::print(std::cerr, "Error: Invalid memory size or repetition count\n");
+    return EXIT_FAILURE;
+  }
+
+  std::vector<u32> sizes;
+  for (const std::string& size_str : SplitString(options["sizes"], ','))
+  {
+    u32 size;
+    if (!TryParse(size_str, &size) || size < 32 || size > static_cast<u32>(memory_mib) << 20)
+    {
+      fmt::print(std::cerr, "Error: Invalid texture size \"{}\"\n", size_str);
+      return EXIT_FAILURE;
+    }
+    sizes.push_back(size);
+  }
+
+  std::vector<u8> memory(static_cast<size_t>(memory_mib) << 20);
+  u32 seed = 1;
+  for (u8& byte : memory)
+  {
+    seed = seed * 1664525 + 1013904223;
+    byte = static_cast<u8>(seed >> 24);
+  }
+
+  picojson::array results;
+  for (const u32 size : sizes)
+  {
+    const u32 textures = static_cast<u32>(memory.size() / size);
+    const auto hash_all = [&](const auto& get_samples) {
+      return MeasureNanosecondsPerHash(textures, repetitions, [&] {
+        for (u32 i = 0; i < textures; ++i)
+          Common::GetHash64(memory.data() + size_t{i} * size, size, get_samples(size));
+      });
+    };
+
+    picojson::object result;
+    result["bytes"] = picojson::value(static_cast<double>(size));
+    result["sampled_fast_ns"] = picojson::value(hash_all([](u32) { return FAST_SAMPLES; }));
+    result["sampled_medium_ns"] = picojson::value(hash_all([](u32) { return MEDIUM_SAMPLES; }));
+
+    // With one sample less than there are words, the CRC32 hash still visits every word, which is
+    // how full hashes are computed where XXH3 isn't used.
+    result["full_crc32_ns"] =
+        picojson::value(hash_all([](u32 len) { return std::max(len / 8, 2u) - 1; }));
+    // XXH3 with AVX2 or AVX-512 on x86-64 with the bundled xxHash, the CRC32 loop elsewhere
+    result["full_ns"] = picojson::value(hash_all([](u32) { return 0u; }));
+    results.emplace_back(std::move(result));
+  }
+
+  picojson::object json;
+  json["textures"] = picojson::value(std::move(results));
+  std::cout << picojson::value(json) << '\n';
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -0,0 +1,277 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/TextureIndexBenchCommand.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FlatHashMultiMap.h"
+
+namespace DolphinTool
+{
+namespace
+{
+// The parts of a TCacheEntry which GetTexture compares when it looks up a texture by hash
+struct Entry
+{
+  u32 format;
+  u32 width;
+  u32 height;
+  u32 levels;
+};
+
+using EntryPtr = std::shared_ptr<Entry>;
+
+enum class OpType
+{
+  Lookup,
+  Replace,
+};
+
+struct Op
+{
+  OpType type;
+  // For lookups, the texture to look for. For replacements, the texture to invalidate.
+  size_t texture;
+  // For replacements, the hash of the texture which is created in its place
+  u64 new_hash;
+};
+
+struct Workload
+{
+  std::vector<u64> hashes;
+  std::vector<EntryPtr> entries;
+  std::vector<Op> ops;
+};
+
+class Random
+{
+public:
+  u64 Next()
+  {
+    m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return m_state ^ (m_state >> 29);
+  }
+
+private:
+  u64 m_state = 1;
+};
+
+// Models a game which keeps a set of textures in the cache, binds them over and over, and now and
+// then loads a new one in place of an old one. Some textures share a hash with a texture of
+// another format, like paletted textures which only differ by their palette format, so some
+// lookups have to skip an entry.
+Workload MakeWorkload(size_t textures, size_t ops, u32 replace_percent)
+{
+  Random random;
+  Workload workload;
+  for (size_t i = 0; i < textures; ++i)
+  {
+    const bool shares_hash = i % 8 == 7;
+    workload.hashes.push_back(shares_hash ? workload.hashes[i - 1] : random.Next());
+    const u32 n = static_cast<u32>(i);
+    workload.entries.push_back(
+        std::make_shared<Entry>(Entry{n % 8, 64u << (n % 3), 64u << (n % 2), 1 + n % 4}));
+  }
+
+  for (size_t i = 0; i < ops; ++i)
+  {
+    const u64 value = random.Next();
+    const bool replace = value % 100 < replace_percent;
+    workload.ops.push_back(
+        {replace ? OpType::Replace : OpType::Lookup, (value >> 8) % textures, random.Next()});
+  }
+  return workload;
+}
+
+bool Matches(const Entry& entry, const Entry& wanted)
+{
+  return entry.format == wanted.format && entry.levels >= wanted.levels &&
+         entry.width == wanted.width && entry.height == wanted.height;
+}
+
+// The index the texture cache used before Common::FlatHashMultiMap
+class MultimapIndex
+{
+public:
+  void Insert(u64 hash, const EntryPtr& entry) { m_map.emplace(hash, entry); }
+
+  bool Find(u64 hash, const Entry& wanted)
+  {
+    const auto [first, last] = m_map.equal_range(hash);
+    for (auto iter = first; iter != last; ++iter)
+    {
+      if (Matches(*iter->second, wanted))
+        return true;
+    }
+    return false;
+  }
+
+  void Erase(u64 hash, const EntryPtr& entry)
+  {
+    const auto [first, last] = m_map.equal_range(hash);
+    for (auto iter = first; iter != last; ++iter)
+    {
+      if (iter->second == entry)
+      {
+        m_map.erase(iter);
+        return;
+      }
+    }
+  }
+
+private:
+  std::multimap<u64, EntryPtr> m_map;
+};
+
+class FlatIndex
+{
+public:
+  void Insert(u64 hash, const EntryPtr& entry) { m_map.Insert(hash, entry); }
+
+  bool Find(u64 hash, const Entry& wanted)
+  {
+    return m_map.FindIf(hash, [&](const EntryPtr& e) { return Matches(*e, wanted); }) != nullptr;
+  }
+
+  void Erase(u64 hash, const EntryPtr& entry)
+  {
+    m_map.EraseIf(hash, [&](const EntryPtr& e) { return e == entry; });
+  }
+
+private:
+  Common::FlatHashMultiMap<EntryPtr> m_map;
+};
+
+// Runs the workload and returns the number of lookups which found their texture
+template <typename Index>
+size_t RunWorkload(const Workload& workload)
+{
+  Index index;
+  std::vector<u64> hashes = workload.hashes;
+  for (size_t i = 0; i < hashes.size(); ++i)
+    index.Insert(hashes[i], workload.entries[i]);
+
+  size_t hits = 0;
+  for (const Op& op : workload.ops)
+  {
+    if (op.type == OpType::Lookup)
+    {
+      hits += index.Find(hashes[op.texture], *workload.entries[op.texture]);
+    }
+    else
+    {
+      // A new texture is only created after the lookup for it failed
+      hits += index.Find(op.new_hash, *workload.entries[op.texture]);
+      index.Erase(hashes[op.texture], workload.entries[op.texture]);
+      hashes[op.texture] = op.new_hash;
+      index.Insert(hashes[op.texture], workload.entries[op.texture]);
+    }
+  }
+  return hits;
+}
+
+template <typename Function>
+double MeasureMillionOpsPerSecond(u64 ops, u32 repetitions, const Function& function)
+{
+  // The fastest repetition is used, as it's the least disturbed by the rest of the system
+  double best_seconds = 0;
+  for (u32 i = 0; i < repetitions; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (i == 0 || seconds < best_seconds)
+      best_seconds = seconds;
+  }
+  return ops / 1000000.0 / best_seconds;
+}
+}  // namespace
+
+int TextureIndexBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: texindexbench [options]...");
+
+  parser.add_option("-n", "--textures")
+      .type("int")
+      .action("store")
+      .help("Number of textures in the cache. [default: %default]")
+      .set_default(2048);
+
+  parser.add_option("-o", "--operations")
+      .type("int")
+      .action("store")
+      .help("Number of lookups and replacements per repetition. [default: %default]")
+      .set_default(4000000);
+
+  parser.add_option("-p", "--replace-percent")
+      .type("int")
+      .action("store")
+      .help("Percentage of operations which replace a texture instead of looking one up. "
+            "[default: %default]")
+      .set_default(5);
+
+  parser.add_option("-r", "--repetitions")
+      .type("int")
+      .action("store")
+      .help("Number of times to repeat each measurement. The fastest is reported. "
+            "[default: %default]")
+      .set_default(5);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const int textures = static_cast<int>(options.get("textures"));
+  const int operations = static_cast<int>(options.get("operations"));
+  const int replace_percent = static_cast<int>(options.get("replace-percent"));
+  const int repetitions = static_cast<int>(options.get("repetitions"));
+  if (textures < 1 || operations < 1 || replace_percent < 0 || replace_percent > 100 ||
+      repetitions < 1)
+  {
+    fmt::print(std::cerr, "Error: Invalid texture, operation, percentage or repetition count\n");
+    return EXIT_FAILURE;
+  }
+
+  const Workload workload = MakeWorkload(textures, operations, replace_percent);
+
+  size_t multimap_hits = 0;
+  size_t flat_hits = 0;
+  const double multimap = MeasureMillionOpsPerSecond(operations, repetitions, [&] {
+    multimap_hits = RunWorkload<MultimapIndex>(workload);
+  });
+  const double flat = MeasureMillionOpsPerSecond(operations, repetitions, [&] {
+    flat_hits = RunWorkload<FlatIndex>(workload);
+  });
+
+  if (multimap_hits != flat_hits)
+  {
+    fmt::print(std::cerr, "Error: The indices found a different number of textures\n");
+    return EXIT_FAILURE;
+  }
+
+  picojson::object json;
+  json["textures"] = picojson::value(static_cast<double>(textures));
+  json["operations"] = picojson::value(static_cast<double>(operations));
+  json["replace_percent"] = picojson::value(static_cast<double>(replace_percent));
+  json["hits"] = picojson::value(static_cast<double>(flat_hits));
+  json["multimap_mops_per_second"] = picojson::value(multimap);
+  json["flat_mops_per_second"] = picojson::value(flat);
+  json["speedup"] = picojson::value(flat / multimap);
+
+  std::cout << picojson::value(json) << '\n';
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -0,0 +1,149 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/TexturePackCommand.h"
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/Assets/TextureAssetUtils.h"
+#include "VideoCommon/Assets/TexturePack.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace DolphinTool
+{
+// Mip levels are stored in files named after their texture, followed by _mip<N>. They are loaded
+// together with the texture, so they aren't textures on their own.
+static bool IsMipLevelFile(std::string_view filename)
+{
+  const size_t mip_index = filename.rfind("_mip");
+  if (mip_index == std::string_view::npos || mip_index + 4 == filename.size())
+    return false;
+  return filename.substr(mip_index + 4).find_first_not_of("0123456789") == std::string_view::npos;
+}
+
+int TexturePackCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: texturepack [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the texture pack DIRECTORY, which is searched recursively for PNG and DDS "
+            "files.")
+      .metavar("DIRECTORY");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the destination FILE. Place it in the texture directory of the game, "
+            "instead of the loose files.")
+      .metavar("FILE");
+
+  parser.add_option("-c", "--compression_level")
+      .type("int")
+      .action("store")
+      .help("Zstandard compression level of the texture data, or 0 to store it uncompressed. "
+            "[default: %default]")
+      .set_default(0);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& input_directory = options["input"];
+  if (!File::IsDirectory(input_directory))
+  {
+    fmt::print(std::cerr, "Error: Input directory does not exist\n");
+    return EXIT_FAILURE;
+  }
+
+  if (!options.is_set("output"))
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& output_file_path = options["output"];
+
+  const int compression_level = static_cast<int>(options.get("compression_level"));
+  if (compression_level < 0 || compression_level > 22)
+  {
+    fmt::print(std::cerr, "Error: Compression level must be between 0 and 22\n");
+    return EXIT_FAILURE;
+  }
+
+  // The pack stores textures in the format they are loaded in. Keep compressed DDS textures as
+  // they are, instead of decompressing them like for a backend which doesn't support them.
+  g_backend_info.bSupportsST3CTextures = true;
+  g_backend_info.bSupportsBPTCTextures = true;
+
+  VideoCommon::TexturePackWriter writer;
+  if (!writer.Open(output_file_path, compression_level))
+  {
+    fmt::print(std::cerr, "Error: Could not create the output file\n");
+    return EXIT_FAILURE;
+  }
+
+  constexpr auto extensions = std::to_array<std::string_view>({".png", ".dds"});
+  size_t texture_count = 0;
+  bool failed = false;
+  for (const std::string& path : Common::DoFileSearch(input_directory, extensions, true))
+  {
+    std::string filename;
+    SplitPath(path, nullptr, &filename, nullptr);
+    if (!filename.starts_with("tex1_") || IsMipLevelFile(filename))
+      continue;
+
+    // Same as when loading the textures from the texture directory
+    const size_t arb_index = filename.rfind("_arb");
+    const bool has_arbitrary_mipmaps = arb_index != std::string::npos;
+    if (has_arbitrary_mipmaps)
+      filename.erase(arb_index, 4);
+
+    VideoCommon::CustomTextureData data;
+    if (!VideoCommon::LoadTextureDataFromFile(filename, StringToPath(path),
+                                              AbstractTextureType::Texture_2D, &data) ||
+        !VideoCommon::PurgeInvalidMipsFromTextureData(filename, &data))
+    {
+      fmt::print(std::cerr, "Error: Could not load {}\n", path);
+      failed = true;
+      continue;
+    }
+
+    if (!writer.AddTexture(filename, has_arbitrary_mipmaps, data))
+    {
+      fmt::print(std::cerr, "Error: Could not add {}, the texture may exist more than once\n",
+                 path);
+      failed = true;
+      continue;
+    }
+
+    ++texture_count;
+  }
+
+  if (!writer.Finish())
+  {
+    fmt::print(std::cerr, "Error: Could not write the output file\n");
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "Added {} textures to {}\n", texture_count, output_file_path);
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -10,8 +10,20 @@
 #include <fmt/ostream.h>
 
 #include "DolphinTool/ConvertCommand.h"
+#include "DolphinTool/CryptoBenchCommand.h"
+#include "DolphinTool/CullBenchCommand.h"
+#include "DolphinTool/DiscBenchCommand.h"
 #include "DolphinTool/ExtractCommand.h"
+#include "DolphinTool/FifoBenchCommand.h"
 #include "DolphinTool/HeaderCommand.h"
+#include "DolphinTool/SoftwareBenchCommand.h"
+#include "DolphinTool/StateBenchCommand.h"
+#include "DolphinTool/TextureDecodeBenchCommand.h"
+#include "DolphinTool/TextureHashBenchCommand.h"
+#include "DolphinTool/TextureIndexBenchCommand.h"
+#include "DolphinTool/TexturePackCommand.h"
+#include "DolphinTool/UIDCacheCommand.h"
+#include "DolphinTool/UidMapBenchCommand.h"
 #include "DolphinTool/VerifyCommand.h"
 
 #ifdef _WIN32
@@ -22,7 +34,10 @@ static void PrintUsage()
 {
   fmt::print(std::cerr, "usage: dolphin-tool COMMAND -h\n"
                         "\n"
-                        "commands supported: [convert, verify, header, extract]\n");
+                        "commands supported: [convert, verify, header, extract, fifobench, "
+                        "texturepack, uidcache, discbench, cryptobench, statebench, "
+                        "texindexbench, texhashbench, uidmapbench, swbench, cullbench, "
+                        "texdecodebench]\n");
 }
 
 #ifdef _WIN32
@@ -49,6 +64,30 @@ int main(int argc, char* argv[])
     return DolphinTool::HeaderCommand(args);
   else if (command_str == "extract")
     return DolphinTool::Extract(args);
+  else if (command_str == "fifobench")
+    return DolphinTool::FifoBenchCommand(args);
+  else if (command_str == "texturepack")
+    return DolphinTool::TexturePackCommand(args);
+  else if (command_str == "uidcache")
+    return DolphinTool::UIDCacheCommand(args);
+  else if (command_str == "discbench")
+    return DolphinTool::DiscBenchCommand(args);
+  else if (command_str == "cryptobench")
+    return DolphinTool::CryptoBenchCommand(args);
+  else if (command_str == "statebench")
+    return DolphinTool::StateBenchCommand(args);
+  else if (command_str == "texindexbench")
+    return DolphinTool::TextureIndexBenchCommand(args);
+  else if (command_str == "texhashbench")
+    return DolphinTool::TextureHashBenchCommand(args);
+  else if (command_str == "uidmapbench")
+    return DolphinTool::UidMapBenchCommand(args);
+  else if (command_str == "swbench")
+    return DolphinTool::SoftwareBenchCommand(args);
+  else if (command_str == "cullbench")
+    return DolphinTool::CullBenchCommand(args);
+  else if (command_str == "texdecodebench")
+    return DolphinTool::TextureDecodeBenchCommand(args);
   PrintUsage();
   return EXIT_FAILURE;
 }
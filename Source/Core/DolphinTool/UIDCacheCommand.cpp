@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/UIDCacheCommand.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileUtil.h"
+#include "UICommon/UICommon.h"
+#include "VideoCommon/GXPipelineTypes.h"
+#include "VideoCommon/PipelineUIDCache.h"
+
+namespace DolphinTool
+{
+int UIDCacheCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: uidcache [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("append")
+      .help("Path to a UID cache FILE to merge. Can be given more than once.")
+      .metavar("FILE");
+
+  parser.add_option("-g", "--game_id")
+      .type("string")
+      .action("store")
+      .help("Optional. Also merge the UID cache which Dolphin wrote for the game with this ID. If "
+            "no output is set, the result is written to the shared UID cache of the game, which "
+            "Dolphin compiles the pipelines of at boot.")
+      .metavar("ID");
+
+  parser.add_option("-u", "--user")
+      .type("string")
+      .action("store")
+      .help("User folder path of the game ID option. Will be automatically created if this "
+            "option is not set.")
+      .set_default("");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the destination FILE. The UIDs are written sorted and without duplicates, so "
+            "merging the same caches in any order gives the same file.")
+      .metavar("FILE");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  std::list<std::string> input_paths = options.all("input");
+  std::string output_path = options["output"];
+  if (options.is_set("game_id"))
+  {
+    UICommon::SetUserDirectory(options["user"]);
+    UICommon::CreateDirectories();
+
+    const std::string& game_id = options["game_id"];
+    input_paths.push_back(VideoCommon::PipelineUIDCache::GetUserCachePath(game_id));
+    if (!options.is_set("output"))
+      output_path = VideoCommon::PipelineUIDCache::GetSharedCachePath(game_id);
+  }
+
+  if (input_paths.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  if (output_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+
+  std::vector<VideoCommon::SerializedGXPipelineUid> uids;
+  bool failed = false;
+  for (const std::string& path : input_paths)
+  {
+    const auto file_uids = VideoCommon::PipelineUIDCache::ReadUIDs(path);
+    if (!file_uids)
+    {
+      fmt::print(std::cerr, "Error: {} is not a UID cache of version {}\n", path,
+                 VideoCommon::GX_PIPELINE_UID_VERSION);
+      failed = true;
+      continue;
+    }
+    uids.insert(uids.end(), file_uids->begin(), file_uids->end());
+  }
+
+  const size_t read_count = uids.size();
+  VideoCommon::PipelineUIDCache::Canonicalize(&uids);
+
+  if (!File::CreateFullPath(output_path) ||
+      !VideoCommon::PipelineUIDCache::WriteUIDs(output_path, uids))
+  {
+    fmt::print(std::cerr, "Error: Could not write the output file\n");
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "Wrote {} pipeline UIDs to {} ({} duplicates removed)\n", uids.size(),
+             output_path, read_count - uids.size());
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
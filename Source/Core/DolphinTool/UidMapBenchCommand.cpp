@@ -0,0 +1,275 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/UidMapBenchCommand.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/GXPipelineTypes.h"
+#include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/PipelineUIDCache.h"
+#include "VideoCommon/UidMap.h"
+
+namespace DolphinTool
+{
+namespace
+{
+using VideoCommon::GXPipelineUid;
+
+// The value type of the shader cache's pipeline map
+using Value = std::pair<std::unique_ptr<int>, bool>;
+
+class Random
+{
+public:
+  u64 Next()
+  {
+    m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return m_state ^ (m_state >> 29);
+  }
+
+private:
+  u64 m_state = 1;
+};
+
+// Only the addresses of the vertex formats are compared, so they are stood in for by distinct
+// made-up pointers.
+const NativeVertexFormat* FakeVertexFormat(size_t index)
+{
+  return reinterpret_cast<const NativeVertexFormat*>((index + 1) * 64);
+}
+
+std::vector<GXPipelineUid> ReadUids(const std::string& path)
+{
+  std::vector<GXPipelineUid> uids;
+  const auto serialized_uids = VideoCommon::PipelineUIDCache::ReadUIDs(path);
+  if (!serialized_uids)
+    return uids;
+
+  std::map<PortableVertexDeclaration, const NativeVertexFormat*> vertex_formats;
+  for (const VideoCommon::SerializedGXPipelineUid& serialized_uid : *serialized_uids)
+  {
+    GXPipelineUid& uid = uids.emplace_back();
+    auto [it, inserted] = vertex_formats.try_emplace(serialized_uid.vertex_decl);
+    if (inserted)
+      it->second = FakeVertexFormat(vertex_formats.size() - 1);
+    uid.vertex_format = it->second;
+    uid.vs_uid = serialized_uid.vs_uid;
+    uid.gs_uid = serialized_uid.gs_uid;
+    uid.ps_uid = serialized_uid.ps_uid;
+    uid.rasterization_state.hex = serialized_uid.rasterization_state_bits;
+    uid.depth_state.hex = serialized_uid.depth_state_bits;
+    uid.blending_state.hex = serialized_uid.blending_state_bits;
+  }
+  return uids;
+}
+
+// Pipelines of a game mostly differ in a few bytes of their shader UIDs, so that's what the
+// made-up UIDs do too. This makes their std::map comparisons as long as those of real ones.
+std::vector<GXPipelineUid> MakeUids(size_t count)
+{
+  Random random;
+  std::vector<GXPipelineUid> uids(count);
+  for (GXPipelineUid& uid : uids)
+  {
+    uid.vertex_format = FakeVertexFormat(random.Next() % 16);
+
+    u8* const vs_data = reinterpret_cast<u8*>(uid.vs_uid.GetUidData());
+    for (int i = 0; i < 4; ++i)
+      vs_data[random.Next() % uid.vs_uid.GetUidDataSize()] = static_cast<u8>(random.Next());
+
+    u8* const ps_data = reinterpret_cast<u8*>(uid.ps_uid.GetUidData());
+    for (int i = 0; i < 8; ++i)
+      ps_data[random.Next() % uid.ps_uid.GetUidDataSize()] = static_cast<u8>(random.Next());
+
+    uid.blending_state.hex = static_cast<u32>(random.Next() % 4);
+  }
+  return uids;
+}
+
+struct UidHash
+{
+  size_t operator()(const GXPipelineUid& uid) const noexcept
+  {
+    return static_cast<size_t>(VideoCommon::HashUid(uid));
+  }
+};
+
+// The map the shader cache used before it used std::unordered_map
+class OrderedMap
+{
+public:
+  void Reserve(size_t) {}
+  Value& operator[](const GXPipelineUid& uid) { return m_map[uid]; }
+  bool Contains(const GXPipelineUid& uid) const { return m_map.contains(uid); }
+
+private:
+  std::map<GXPipelineUid, Value> m_map;
+};
+
+// The map the shader cache used before VideoCommon::UidMap
+class UnorderedMap
+{
+public:
+  void Reserve(size_t count) { m_map.reserve(count); }
+  Value& operator[](const GXPipelineUid& uid) { return m_map[uid]; }
+  bool Contains(const GXPipelineUid& uid) const { return m_map.contains(uid); }
+
+private:
+  std::unordered_map<GXPipelineUid, Value, UidHash> m_map;
+};
+
+class FlatMap
+{
+public:
+  void Reserve(size_t count) { m_map.Reserve(count); }
+  Value& operator[](const GXPipelineUid& uid) { return m_map[uid]; }
+  bool Contains(const GXPipelineUid& uid) { return m_map.Contains(uid); }
+
+private:
+  VideoCommon::UidMap<GXPipelineUid, Value> m_map;
+};
+
+template <typename Function>
+double MeasureMillionOpsPerSecond(u64 ops, u32 repetitions, const Function& function)
+{
+  // The fastest repetition is used, as it's the least disturbed by the rest of the system
+  double best_seconds = 0;
+  for (u32 i = 0; i < repetitions; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (i == 0 || seconds < best_seconds)
+      best_seconds = seconds;
+  }
+  return ops / 1000000.0 / best_seconds;
+}
+
+// Measures filling a map with the UIDs, like loading the UID cache does (which reserves the map
+// first), and looking the UIDs up in a random order, like a game does when it changes state.
+template <typename Map>
+picojson::value Measure(const std::vector<GXPipelineUid>& uids,
+                        const std::vector<u32>& lookup_order, u32 repetitions, size_t* hits)
+{
+  const double insert = MeasureMillionOpsPerSecond(uids.size(), repetitions, [&] {
+    Map map;
+    map.Reserve(uids.size());
+    for (const GXPipelineUid& uid : uids)
+      map[uid].second = false;
+  });
+
+  Map map;
+  for (const GXPipelineUid& uid : uids)
+    map[uid].second = false;
+  const double lookup = MeasureMillionOpsPerSecond(lookup_order.size(), repetitions, [&] {
+    *hits = 0;
+    for (const u32 index : lookup_order)
+      *hits += map.Contains(uids[index]);
+  });
+
+  picojson::object result;
+  result["insert_mops_per_second"] = picojson::value(insert);
+  result["lookup_mops_per_second"] = picojson::value(lookup);
+  return picojson::value(std::move(result));
+}
+}  // namespace
+
+int UidMapBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: uidmapbench [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Optional. Path to a UID cache FILE to take the pipeline UIDs from. If not set, "
+            "made-up UIDs are used.")
+      .metavar("FILE");
+
+  parser.add_option("-n", "--uids")
+      .type("int")
+      .action("store")
+      .help("Number of made-up pipeline UIDs. [default: %default]")
+      .set_default(4096);
+
+  parser.add_option("-l", "--lookups")
+      .type("int")
+      .action("store")
+      .help("Number of lookups per repetition. [default: %default]")
+      .set_default(2000000);
+
+  parser.add_option("-r", "--repetitions")
+      .type("int")
+      .action("store")
+      .help("Number of times to repeat each measurement. The fastest is reported. "
+            "[default: %default]")
+      .set_default(5);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const int uid_count = static_cast<int>(options.get("uids"));
+  const int lookups = static_cast<int>(options.get("lookups"));
+  const int repetitions = static_cast<int>(options.get("repetitions"));
+  if (uid_count < 1 || lookups < 1 || repetitions < 1)
+  {
+    fmt::print(std::cerr, "Error: Invalid UID, lookup or repetition count\n");
+    return EXIT_FAILURE;
+  }
+
+  std::vector<GXPipelineUid> uids;
+  if (options.is_set("input"))
+  {
+    uids = ReadUids(options["input"]);
+    if (uids.empty())
+    {
+      fmt::print(std::cerr, "Error: Could not read any UIDs from the input\n");
+      return EXIT_FAILURE;
+    }
+  }
+  else
+  {
+    uids = MakeUids(uid_count);
+  }
+
+  Random random;
+  std::vector<u32> lookup_order(lookups);
+  for (u32& index : lookup_order)
+    index = static_cast<u32>(random.Next() % uids.size());
+
+  size_t ordered_hits = 0;
+  size_t unordered_hits = 0;
+  size_t flat_hits = 0;
+  picojson::object json;
+  json["uids"] = picojson::value(static_cast<double>(uids.size()));
+  json["uid_size"] = picojson::value(static_cast<double>(sizeof(GXPipelineUid)));
+  json["std_map"] = Measure<OrderedMap>(uids, lookup_order, repetitions, &ordered_hits);
+  json["std_unordered_map"] =
+      Measure<UnorderedMap>(uids, lookup_order, repetitions, &unordered_hits);
+  json["uid_map"] = Measure<FlatMap>(uids, lookup_order, repetitions, &flat_hits);
+
+  if (ordered_hits != lookup_order.size() || unordered_hits != lookup_order.size() ||
+      flat_hits != lookup_order.size())
+  {
+    fmt::print(std::cerr, "Error: A map didn't find all of its UIDs\n");
+    return EXIT_FAILURE;
+  }
+
+  std::cout << picojson::value(json) << '\n';
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -3,13 +3,20 @@
 
 #include "DolphinTool/VerifyCommand.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <list>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
 #include <fmt/ostream.h>
 
+#include "Common/ThreadPool.h"
 #include "Core/AchievementManager.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/VolumeVerifier.h"
@@ -72,6 +79,76 @@ static void PrintFullReport(const DiscIO::VolumeVerifier::Result& result)
   }
 }
 
+// Spreads a read rate limit over all the images that are verified at the same time, so that a
+// batch doesn't saturate a disk that is also used for other things.
+class ReadBudget
+{
+public:
+  explicit ReadBudget(u64 bytes_per_second) : m_bytes_per_second(bytes_per_second) {}
+
+  // Blocks until the budget allows the given amount of bytes to be read.
+  void Consume(u64 bytes)
+  {
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point start;
+    {
+      std::lock_guard lk(m_mutex);
+      start = std::max(m_next_free_time, Clock::now());
+      m_next_free_time = start + std::chrono::duration_cast<Clock::duration>(
+                                     std::chrono::duration<double>(static_cast<double>(bytes) /
+                                                                   m_bytes_per_second));
+    }
+    std::this_thread::sleep_until(start);
+  }
+
+private:
+  std::mutex m_mutex;
+  const u64 m_bytes_per_second;
+  std::chrono::steady_clock::time_point m_next_free_time;
+};
+
+struct VerifyResult
+{
+  bool opened = false;
+  DiscIO::VolumeVerifier::Result result;
+  std::string rc_hash = "0";
+};
+
+static VerifyResult VerifyFile(const std::string& path, DiscIO::Hashes<bool> hashes_to_calculate,
+                               bool rc_hash_calculate, ReadBudget* read_budget)
+{
+  VerifyResult verify_result;
+
+  // Open the volume
+  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateVolume(path);
+  if (!volume)
+    return verify_result;
+  verify_result.opened = true;
+
+  // Verify the volume
+  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
+  // Only the bytes that are read from the disc count, not the ones that are hashed or reused
+  // from the previous chunk
+  if (read_budget)
+    verifier.SetReadCallback([read_budget](u64 bytes) { read_budget->Consume(bytes); });
+  verifier.Start();
+  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
+    verifier.Process();
+  verifier.Finish();
+  verify_result.result = verifier.GetResult();
+
+#ifdef USE_RETRO_ACHIEVEMENTS
+  // Calculate rcheevos hash
+  if (rc_hash_calculate)
+  {
+    verify_result.rc_hash = AchievementManager::CalculateHash(path);
+  }
+#endif
+
+  return verify_result;
+}
+
 int VerifyCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -87,8 +164,8 @@ int VerifyCommand(const std::vector<std::string>& args)
 
   parser.add_option("-i", "--input")
       .type("string")
-      .action("store")
-      .help("Path to input file.")
+      .action("append")
+      .help("Path to input file. Can be given more than once to verify several files.")
       .metavar("FILE");
 
   parser.add_option("-a", "--algorithm")
@@ -98,6 +175,19 @@ int VerifyCommand(const std::vector<std::string>& args)
             "[%choices]")
       .choices({"crc32", "md5", "sha1", "rchash"});
 
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Number of files to verify at the same time when several are given. "
+            "[default: %default]")
+      .set_default(2);
+
+  parser.add_option("-r", "--read_limit")
+      .type("int")
+      .action("store")
+      .help("Optional. Maximum combined read rate of all files being verified, in MiB/s.")
+      .metavar("MIBPS");
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -111,10 +201,30 @@ int VerifyCommand(const std::vector<std::string>& args)
     fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const std::string& input_file_path = options["input"];
+  const std::list<std::string>& input_list = options.all("input");
+  const std::vector<std::string> input_file_paths(input_list.begin(), input_list.end());
+  const bool batch = input_file_paths.size() > 1;
+
+  const int jobs = static_cast<int>(options.get("jobs"));
+  if (jobs < 1)
+  {
+    fmt::print(std::cerr, "Error: Invalid number of jobs\n");
+    return EXIT_FAILURE;
+  }
+
+  std::optional<ReadBudget> read_budget;
+  if (options.is_set("read_limit"))
+  {
+    const int read_limit = static_cast<int>(options.get("read_limit"));
+    if (read_limit < 1)
+    {
+      fmt::print(std::cerr, "Error: Invalid read limit\n");
+      return EXIT_FAILURE;
+    }
+    read_budget.emplace(static_cast<u64>(read_limit) * 1024 * 1024);
+  }
 
   bool rc_hash_calculate = false;
-  std::string rc_hash_result = "0";
 
   DiscIO::Hashes<bool> hashes_to_calculate{};
   const bool algorithm_is_set = options.is_set("algorithm");
@@ -145,54 +255,72 @@ int VerifyCommand(const std::vector<std::string>& args)
     return EXIT_FAILURE;
   }
 
-  // Open the volume
-  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateVolume(input_file_path);
-  if (!volume)
-  {
-    fmt::print(std::cerr, "Error: Unable to open input file\n");
-    return EXIT_FAILURE;
-  }
+  // Verify the volumes. The calling thread takes part in the work, so one thread fewer is needed.
+  std::vector<VerifyResult> results(input_file_paths.size());
+  Common::ThreadPool workers;
+  if (batch && jobs > 1)
+    workers.Reset("Verify", static_cast<u32>(jobs - 1));
+  workers.ParallelFor(input_file_paths.size(), [&](size_t i) {
+    results[i] = VerifyFile(input_file_paths[i], hashes_to_calculate, rc_hash_calculate,
+                            read_budget ? &*read_budget : nullptr);
+  });
+  workers.Shutdown();
 
-  // Verify the volume
-  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
-  verifier.Start();
-  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
+  // Print the report
+  bool success = true;
+  for (size_t i = 0; i < input_file_paths.size(); ++i)
   {
-    verifier.Process();
-  }
-  verifier.Finish();
-  const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
+    const std::string& input_file_path = input_file_paths[i];
+    const VerifyResult& verify_result = results[i];
+    const DiscIO::VolumeVerifier::Result& result = verify_result.result;
 
-#ifdef USE_RETRO_ACHIEVEMENTS
-  // Calculate rcheevos hash
-  if (rc_hash_calculate)
-  {
-    rc_hash_result = AchievementManager::CalculateHash(input_file_path);
-  }
-#endif
+    if (!verify_result.opened)
+    {
+      if (batch)
+        fmt::print(std::cerr, "Error: Unable to open input file {}\n", input_file_path);
+      else
+        fmt::print(std::cerr, "Error: Unable to open input file\n");
+      success = false;
+      continue;
+    }
 
-  // Print the report
-  if (!algorithm_is_set)
-  {
-    PrintFullReport(result);
-  }
-  else
-  {
+    if (!algorithm_is_set)
+    {
+      if (batch)
+        fmt::print(std::cout, "File: {}\n", input_file_path);
+      PrintFullReport(result);
+      continue;
+    }
+
+    std::string hash;
     if (hashes_to_calculate.crc32 && !result.hashes.crc32.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.crc32));
+      hash = HashToHexString(result.hashes.crc32);
     else if (hashes_to_calculate.md5 && !result.hashes.md5.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.md5));
+      hash = HashToHexString(result.hashes.md5);
     else if (hashes_to_calculate.sha1 && !result.hashes.sha1.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.sha1));
+      hash = HashToHexString(result.hashes.sha1);
     else if (rc_hash_calculate)
-      fmt::print(std::cout, "{}\n", rc_hash_result);
+      hash = verify_result.rc_hash;
+
+    if (hash.empty())
+    {
+      if (batch)
+        fmt::print(std::cerr, "Error: No hash computed for {}\n", input_file_path);
+      else
+        fmt::print(std::cerr, "Error: No hash computed\n");
+      success = false;
+    }
+    else if (batch)
+    {
+      // The same layout as the output of sha1sum and similar tools
+      fmt::print(std::cout, "{}  {}\n", hash, input_file_path);
+    }
     else
     {
-      fmt::print(std::cerr, "Error: No hash computed\n");
-      return EXIT_FAILURE;
+      fmt::print(std::cout, "{}\n", hash);
     }
   }
 
-  return EXIT_SUCCESS;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 }  // namespace DolphinTool
@@ -30,7 +30,8 @@ std::vector<std::string> FindAllGamePaths(std::span<const std::string_view> dire
 {
   constexpr auto search_extensions =
       std::to_array<std::string_view>({".gcm", ".tgc", ".bin", ".iso", ".ciso", ".gcz", ".wbfs",
-                                       ".wia", ".rvz", ".nfs", ".wad", ".dol", ".elf", ".json"});
+                                       ".wia", ".rvz", ".nfs", ".dcs", ".wad", ".dol", ".elf",
+                                       ".json"});
 
   // TODO: We could process paths iteratively as they are found
   return Common::DoFileSearch(directories_to_scan, search_extensions, recursive_scan);
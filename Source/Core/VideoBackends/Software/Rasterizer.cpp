@@ -4,11 +4,16 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstring>
+#include <memory>
 #include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+#include "Common/ThreadPool.h"
 
 #include "VideoBackends/Software/NativeVertexFormat.h"
 #include "VideoBackends/Software/SWEfbInterface.h"
@@ -18,11 +23,20 @@
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
 namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
+static_assert(BLOCK_SIZE * BLOCK_SIZE == Tev::QUAD_SIZE);
+
+// When drawing on several threads, the EFB is split into tiles of this size which are drawn
+// independently. It must be a multiple of BLOCK_SIZE so that every block lies in a single tile.
+static constexpr int TILE_SIZE = 32;
+static_assert(TILE_SIZE % BLOCK_SIZE == 0);
+static constexpr int NUM_TILES_X = (EFB_WIDTH + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr int NUM_TILES_Y = (EFB_HEIGHT + TILE_SIZE - 1) / TILE_SIZE;
 
 struct SlopeContext
 {
@@ -95,21 +109,67 @@ struct Slope
   }
 };
 
-static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
+// Everything needed to draw a triangle. Each thread drawing tiles has its own copy.
+struct RasterState
+{
+  Slope ZSlope;
+  Slope WSlope;
+  Slope ColorSlopes[2][4];
+  Slope TexSlopes[8][3];
+
+  Tev tev;
+  RasterBlock rasterBlock;
+};
 
-static Tev tev;
-static RasterBlock rasterBlock;
+// A triangle recorded for deferred drawing, along with the scissor rectangle to draw it with.
+struct BinnedTriangle
+{
+  OutputVertexData v0;
+  OutputVertexData v1;
+  OutputVertexData v2;
+  u32 scissor_index;
+};
+
+// The state used on the GPU thread. Its ZSlope is always kept up to date, as zfreeze relies on
+// the slope of the last triangle from previous draws.
+static RasterState s_state;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+static Common::ThreadPool s_workers;
+static std::vector<std::unique_ptr<RasterState>> s_worker_states;
+
+// Triangles of the current batch in submission order, and for each tile the indices of the
+// triangles which touch it.
+static std::vector<BinnedTriangle> s_binned_triangles;
+static std::array<std::vector<u32>, NUM_TILES_X * NUM_TILES_Y> s_bins;
+static u32 s_used_bins = 0;
+
 void Init()
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
   // needs to be set to an (untested) default value.
-  ZSlope = Slope();
+  s_state.ZSlope = Slope();
+
+  const u32 threads = g_Config.GetSoftwareRasterizerThreads();
+  s_workers.Reset("Software Rasterizer", threads);
+  s_worker_states.clear();
+  if (threads > 0)
+  {
+    // The thread flushing the batch draws tiles too.
+    for (u32 i = 0; i < threads + 1; i++)
+      s_worker_states.emplace_back(std::make_unique<RasterState>());
+  }
+}
+
+void Shutdown()
+{
+  s_workers.Shutdown();
+  s_worker_states.clear();
+  s_binned_triangles.clear();
+  for (std::vector<u32>& bin : s_bins)
+    bin.clear();
+  s_used_bins = 0;
 }
 
 void ScissorChanged()
@@ -143,41 +203,46 @@ static inline int iround(float x)
 
 void SetTevKonstColors()
 {
-  tev.SetKonstColors();
+  s_state.tev.SetKonstColors();
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+// Sets up a pixel of the block for drawing, returning whether it passed the early depth test
+static bool SetupPixel(RasterState& state, s32 x, s32 y, s32 xi, s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  Tev& tev = state.tev;
+  const RasterBlock& rasterBlock = state.rasterBlock;
+
+  ++tev.counters.rasterized_pixels;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  s32 z = (s32)std::clamp<float>(state.ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
     // TODO: Test if perf regs are incremented even if test is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
+    ++tev.counters.perf_quad_count[PQ_ZCOMP_INPUT_ZCOMPLOC];
     if (bpmem.zmode.test_enable)
     {
       // early z
       if (!EfbInterface::ZCompare(x, y, z))
-        return;
+        return false;
     }
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
+    ++tev.counters.perf_quad_count[PQ_ZCOMP_OUTPUT_ZCOMPLOC];
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  Tev::Pixel& tev_pixel = tev.Pixels[xi + yi * BLOCK_SIZE];
 
-  tev.Position[0] = x;
-  tev.Position[1] = y;
-  tev.Position[2] = z;
+  tev_pixel.Position[0] = x;
+  tev_pixel.Position[1] = y;
+  tev_pixel.Position[2] = z;
 
   //  colors
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      const float color = ColorSlopes[i][comp].GetValue(x, y);
-      tev.Color[i][comp] = (u8)std::clamp<float>(color, 0.0f, 255.0f);
+      const float color = state.ColorSlopes[i][comp].GetValue(x, y);
+      tev_pixel.Color[i][comp] = (u8)std::clamp<float>(color, 0.0f, 255.0f);
     }
   }
 
@@ -185,10 +250,23 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
     // multiply by 128 because TEV stores UVs as s17.7
-    tev.Uv[i].s = (s32)(pixel.Uv[i][0] * 128);
-    tev.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
+    tev_pixel.Uv[i].s = (s32)(pixel.Uv[i][0] * 128);
+    tev_pixel.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
   }
 
+  return true;
+}
+
+// Draws the pixels of the block which were set up, whose bits are set in pixel_mask. TEV works on
+// all pixels of the block together.
+static void DrawBlock(RasterState& state, u32 pixel_mask)
+{
+  if (pixel_mask == 0)
+    return;
+
+  Tev& tev = state.tev;
+  const RasterBlock& rasterBlock = state.rasterBlock;
+
   for (unsigned int i = 0; i < bpmem.genMode.numindstages; i++)
   {
     tev.IndirectLod[i] = rasterBlock.IndirectLod[i];
@@ -201,10 +279,11 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
     tev.TextureLinear[i] = rasterBlock.TextureLinear[i];
   }
 
-  tev.Draw();
+  tev.Draw(pixel_mask);
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear,
+                                u32 texmap, u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -215,9 +294,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -255,8 +334,10 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(RasterState& state, s32 blockX, s32 blockY)
 {
+  RasterBlock& rasterBlock = state.rasterBlock;
+
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
     for (s32 xi = 0; xi < BLOCK_SIZE; xi++)
@@ -266,19 +347,19 @@ static void BuildBlock(s32 blockX, s32 blockY)
       s32 x = xi + blockX;
       s32 y = yi + blockY;
 
-      float invW = 1.0f / WSlope.GetValue(x, y);
+      float invW = 1.0f / state.WSlope.GetValue(x, y);
       pixel.InvW = invW;
 
       // tex coords
       for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
       {
         float projection = invW;
-        float q = TexSlopes[i][2].GetValue(x, y) * invW;
+        float q = state.TexSlopes[i][2].GetValue(x, y) * invW;
         if (q != 0.0f)
           projection = invW / q;
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(x, y) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(x, y) * projection;
+        pixel.Uv[i][0] = state.TexSlopes[i][0].GetValue(x, y) * projection;
+        pixel.Uv[i][1] = state.TexSlopes[i][1].GetValue(x, y) * projection;
       }
     }
   }
@@ -288,7 +369,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -300,30 +382,62 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
 
-void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
-                  const OutputVertexData* v2, s32 x_off, s32 y_off)
+static void UpdateZSlope(RasterState& state, const OutputVertexData* v0,
+                         const OutputVertexData* v1, const OutputVertexData* v2, s32 x_off,
+                         s32 y_off)
 {
   if (!bpmem.genMode.zfreeze)
   {
     const s32 X1 = iround(16.0f * (v0->screenPosition.x - x_off)) - 9;
     const s32 Y1 = iround(16.0f * (v0->screenPosition.y - y_off)) - 9;
     const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, x_off, y_off);
-    ZSlope = Slope(v0->screenPosition.z, v1->screenPosition.z, v2->screenPosition.z, ctx);
+    state.ZSlope = Slope(v0->screenPosition.z, v1->screenPosition.z, v2->screenPosition.z, ctx);
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
+                  const OutputVertexData* v2, s32 x_off, s32 y_off)
+{
+  UpdateZSlope(s_state, v0, v1, v2, x_off, y_off);
+}
+
+// Returns the pixels of the scissor rectangle which the bounding rectangle of the triangle covers.
+static MathUtil::Rectangle<int> GetTriangleBounds(const OutputVertexData* v0,
+                                                  const OutputVertexData* v1,
+                                                  const OutputVertexData* v2,
+                                                  const BPFunctions::ScissorRect& scissor)
+{
+  // 28.4 fixed-point coordinates, see DrawTriangleFrontFace
+  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
+
+  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
+
+  return MathUtil::Rectangle<int>(
+      std::max((std::min(std::min(X1, X2), X3) + 0xF) >> 4, scissor.rect.left),
+      std::max((std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4, scissor.rect.top),
+      std::min((std::max(std::max(X1, X2), X3) + 0xF) >> 4, scissor.rect.right),
+      std::min((std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4, scissor.rect.bottom));
+}
+
+// Draws the part of the triangle which lies within both the scissor rectangle and clip_rect.
+static void DrawTriangleFrontFace(RasterState& state, const OutputVertexData* v0,
+                                  const OutputVertexData* v1, const OutputVertexData* v2,
+                                  const BPFunctions::ScissorRect& scissor,
+                                  const MathUtil::Rectangle<int>& clip_rect)
 {
   // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
   // zfreeze depends on it
-  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+  UpdateZSlope(state, v0, v1, v2, scissor.x_off, scissor.y_off);
 
   // adapted from http://devmaster.net/posts/6145/advanced-rasterization
 
@@ -367,10 +481,10 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   ASSERT(scissor.rect.top >= 0);
   ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
 
-  minx = std::max(minx, scissor.rect.left);
-  maxx = std::min(maxx, scissor.rect.right);
-  miny = std::max(miny, scissor.rect.top);
-  maxy = std::min(maxy, scissor.rect.bottom);
+  minx = std::max({minx, scissor.rect.left, clip_rect.left});
+  maxx = std::min({maxx, scissor.rect.right, clip_rect.right});
+  miny = std::max({miny, scissor.rect.top, clip_rect.top});
+  maxy = std::min({maxy, scissor.rect.bottom, clip_rect.bottom});
 
   if (minx >= maxx || miny >= maxy)
     return;
@@ -381,21 +495,24 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
 
   float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
                 1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
+  state.WSlope = Slope(w[0], w[1], w[2], ctx);
 
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
   {
     for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    {
+      state.ColorSlopes[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
   }
 
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
-    TexSlopes[i][0] =
+    state.TexSlopes[i][0] =
         Slope(v0->texCoords[i].x * w[0], v1->texCoords[i].x * w[1], v2->texCoords[i].x * w[2], ctx);
-    TexSlopes[i][1] =
+    state.TexSlopes[i][1] =
         Slope(v0->texCoords[i].y * w[0], v1->texCoords[i].y * w[1], v2->texCoords[i].y * w[2], ctx);
-    TexSlopes[i][2] =
+    state.TexSlopes[i][2] =
         Slope(v0->texCoords[i].z * w[0], v1->texCoords[i].z * w[1], v2->texCoords[i].z * w[2], ctx);
   }
 
@@ -453,7 +570,9 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(state, x, y);
+
+      u32 pixel_mask = 0;
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
@@ -463,7 +582,8 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            if (SetupPixel(state, x + ix, y + iy, ix, iy))
+              pixel_mask |= 1u << (ix + iy * BLOCK_SIZE);
           }
         }
       }
@@ -485,8 +605,11 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
             {
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
-              if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+              if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy &&
+                  SetupPixel(state, x + ix, y + iy, ix, iy))
+              {
+                pixel_mask |= 1u << (ix + iy * BLOCK_SIZE);
+              }
             }
 
             CX1 -= FDY12;
@@ -499,16 +622,129 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
           CY3 += FDX31;
         }
       }
+
+      DrawBlock(state, pixel_mask);
     }
   }
 }
 
+static constexpr MathUtil::Rectangle<int> FULL_EFB_RECT(0, 0, EFB_WIDTH, EFB_HEIGHT);
+
+static MathUtil::Rectangle<int> GetTileRect(u32 tile)
+{
+  const int x = static_cast<int>(tile % NUM_TILES_X) * TILE_SIZE;
+  const int y = static_cast<int>(tile / NUM_TILES_X) * TILE_SIZE;
+  return MathUtil::Rectangle<int>(x, y, std::min(x + TILE_SIZE, static_cast<int>(EFB_WIDTH)),
+                                  std::min(y + TILE_SIZE, static_cast<int>(EFB_HEIGHT)));
+}
+
+static void BinTriangle(const OutputVertexData* v0, const OutputVertexData* v1,
+                        const OutputVertexData* v2)
+{
+  for (u32 i = 0; i < static_cast<u32>(scissors.size()); i++)
+  {
+    const BPFunctions::ScissorRect& scissor = scissors[i];
+
+    // Keep the GPU thread's z slope in the same state as if the triangle was drawn immediately.
+    UpdateZSlope(s_state, v0, v1, v2, scissor.x_off, scissor.y_off);
+
+    const MathUtil::Rectangle<int> bounds = GetTriangleBounds(v0, v1, v2, scissor);
+    if (bounds.left >= bounds.right || bounds.top >= bounds.bottom)
+      continue;
+
+    const u32 index = static_cast<u32>(s_binned_triangles.size());
+    s_binned_triangles.push_back({*v0, *v1, *v2, i});
+
+    // Blocks are aligned to BLOCK_SIZE, so a triangle may touch a block that starts just left of
+    // or above its bounding rectangle. Tiles are aligned the same way, so this doesn't matter.
+    const int tile_left = bounds.left / TILE_SIZE;
+    const int tile_right = (bounds.right - 1) / TILE_SIZE;
+    const int tile_top = bounds.top / TILE_SIZE;
+    const int tile_bottom = (bounds.bottom - 1) / TILE_SIZE;
+    for (int ty = tile_top; ty <= tile_bottom; ty++)
+    {
+      for (int tx = tile_left; tx <= tile_right; tx++)
+      {
+        std::vector<u32>& bin = s_bins[ty * NUM_TILES_X + tx];
+        if (bin.empty())
+          s_used_bins++;
+        bin.push_back(index);
+      }
+    }
+  }
+}
+
+static void DrawTile(RasterState& state, u32 tile)
+{
+  const MathUtil::Rectangle<int> tile_rect = GetTileRect(tile);
+
+  // Tiles don't depend on which thread drew what before them.
+  state.ZSlope = s_state.ZSlope;
+  state.tev.ResetCarriedState();
+  for (const u32 index : s_bins[tile])
+  {
+    const BinnedTriangle& triangle = s_binned_triangles[index];
+    DrawTriangleFrontFace(state, &triangle.v0, &triangle.v1, &triangle.v2,
+                          scissors[triangle.scissor_index], tile_rect);
+  }
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
   INCSTAT(g_stats.this_frame.num_triangles_drawn);
 
+  if (s_workers.IsRunning())
+  {
+    BinTriangle(v0, v1, v2);
+    return;
+  }
+
   for (const auto& scissor : scissors)
-    DrawTriangleFrontFace(v0, v1, v2, scissor);
+    DrawTriangleFrontFace(s_state, v0, v1, v2, scissor, FULL_EFB_RECT);
+}
+
+void Flush()
+{
+  if (!s_binned_triangles.empty())
+  {
+    // When the TEV reads what the previous pixel left behind, the result depends on the order of
+    // all pixels of the batch, which only drawing it on one thread keeps.
+    if (s_used_bins > 1 && !Tev::ReadsCarriedState())
+    {
+      // Each tile is only ever touched by one thread, and the triangles in a tile are drawn in
+      // submission order, so the result is the same as drawing everything on one thread.
+      std::atomic<u32> next_tile = 0;
+      for (const auto& state : s_worker_states)
+        state->tev.SetKonstColors();
+
+      s_workers.ParallelFor(s_worker_states.size(), [&](size_t i) {
+        RasterState& state = *s_worker_states[i];
+        for (u32 tile = next_tile++; tile < s_bins.size(); tile = next_tile++)
+          DrawTile(state, tile);
+      });
+
+      for (const auto& state : s_worker_states)
+        state->tev.FlushCounters();
+    }
+    else
+    {
+      // Nothing to gain from waking the workers up.
+      const Slope z_slope = s_state.ZSlope;
+      for (const BinnedTriangle& triangle : s_binned_triangles)
+      {
+        DrawTriangleFrontFace(s_state, &triangle.v0, &triangle.v1, &triangle.v2,
+                              scissors[triangle.scissor_index], FULL_EFB_RECT);
+      }
+      s_state.ZSlope = z_slope;
+    }
+
+    s_binned_triangles.clear();
+    for (std::vector<u32>& bin : s_bins)
+      bin.clear();
+    s_used_bins = 0;
+  }
+
+  s_state.tev.FlushCounters();
 }
 }  // namespace Rasterizer
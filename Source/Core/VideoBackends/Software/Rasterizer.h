@@ -10,6 +10,7 @@ struct OutputVertexData;
 namespace Rasterizer
 {
 void Init();
+void Shutdown();
 void ScissorChanged();
 
 void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
@@ -17,6 +18,11 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2);
 
+// Finishes drawing all triangles submitted so far. When rasterizer threads are enabled, triangles
+// are only binned into tiles until this is called, so it must happen before anything that depends
+// on the contents of the EFB or on BP state the triangles were submitted with.
+void Flush();
+
 void SetTevKonstColors();
 
 struct RasterBlockPixel
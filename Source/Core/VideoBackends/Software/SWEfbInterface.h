@@ -56,7 +56,8 @@ void EncodeXFB(u8* xfb_in_ram, u32 memory_stride, const MathUtil::Rectangle<int>
 
 u32 GetPerfQueryResult(PerfQueryType type);
 void ResetPerfQuery();
-void IncPerfCounterQuadCount(PerfQueryType type);
+// counts the given number of pixels towards a performance counter
+void IncPerfCounterQuadCount(PerfQueryType type, u32 pixels);
 }  // namespace EfbInterface
 
 namespace SW
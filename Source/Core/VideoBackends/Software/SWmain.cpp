@@ -107,5 +107,7 @@ bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
 void VideoSoftware::Shutdown()
 {
   ShutdownShared();
+
+  Rasterizer::Shutdown();
 }
 }  // namespace SW
@@ -4,11 +4,15 @@
 #include "VideoBackends/Software/Tev.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <cstring>
 
 #include "Common/Assert.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/Inline.h"
+#include "Common/Intrinsics.h"
 
 #include "Core/System.h"
 
@@ -31,39 +35,41 @@ static inline s16 Clamp1024(s16 in)
   return std::clamp<s16>(in, -1024, 1023);
 }
 
-void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
+void Tev::SetRasColor(int pixel, RasColorChan colorChan, u32 swaptable)
 {
+  PixelState& state = m_pixels[pixel];
+
   switch (colorChan)
   {
   case RasColorChan::Color0:
   {
-    const u8* color = Color[0];
+    const u8* color = Pixels[pixel].Color[0];
     const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
-    RasColor.r = color[u32(swap[ColorChannel::Red])];
-    RasColor.g = color[u32(swap[ColorChannel::Green])];
-    RasColor.b = color[u32(swap[ColorChannel::Blue])];
-    RasColor.a = color[u32(swap[ColorChannel::Alpha])];
+    state.RasColor.r = color[u32(swap[ColorChannel::Red])];
+    state.RasColor.g = color[u32(swap[ColorChannel::Green])];
+    state.RasColor.b = color[u32(swap[ColorChannel::Blue])];
+    state.RasColor.a = color[u32(swap[ColorChannel::Alpha])];
   }
   break;
   case RasColorChan::Color1:
   {
-    const u8* color = Color[1];
+    const u8* color = Pixels[pixel].Color[1];
     const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
-    RasColor.r = color[u32(swap[ColorChannel::Red])];
-    RasColor.g = color[u32(swap[ColorChannel::Green])];
-    RasColor.b = color[u32(swap[ColorChannel::Blue])];
-    RasColor.a = color[u32(swap[ColorChannel::Alpha])];
+    state.RasColor.r = color[u32(swap[ColorChannel::Red])];
+    state.RasColor.g = color[u32(swap[ColorChannel::Green])];
+    state.RasColor.b = color[u32(swap[ColorChannel::Blue])];
+    state.RasColor.a = color[u32(swap[ColorChannel::Alpha])];
   }
   break;
   case RasColorChan::AlphaBump:
   {
-    RasColor = TevColor::All(AlphaBump);
+    state.RasColor = TevColor::All(state.AlphaBump);
   }
   break;
   case RasColorChan::NormalizedAlphaBump:
   {
-    const u8 normalized = AlphaBump | AlphaBump >> 5;
-    RasColor = TevColor::All(normalized);
+    const u8 normalized = state.AlphaBump | state.AlphaBump >> 5;
+    state.RasColor = TevColor::All(normalized);
   }
   break;
   default:
@@ -71,35 +77,234 @@ void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
     if (colorChan != RasColorChan::Zero)
       PanicAlertFmt("Invalid ras color channel: {}", colorChan);
 
-    RasColor = TevColor::All(0);
+    state.RasColor = TevColor::All(0);
   }
   break;
   }
 }
 
-void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
+s16 Tev::CombineColorRegular(const TevStageCombiner::ColorCombiner& cc,
+                             const InputRegType& InputReg)
 {
-  for (int i = BLU_C; i <= RED_C; i++)
+  const u16 c = InputReg.c + (InputReg.c >> 7);
+
+  s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
+  temp <<= s_ScaleLShiftLUT[cc.scale];
+  temp += (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
+  temp >>= 8;
+  temp = cc.op == TevOp::Sub ? -temp : temp;
+
+  s32 result = ((InputReg.d + s_BiasLUT[cc.bias]) << s_ScaleLShiftLUT[cc.scale]) + temp;
+  result = result >> s_ScaleRShiftLUT[cc.scale];
+
+  return cc.clamp ? Clamp255(static_cast<s16>(result)) : Clamp1024(static_cast<s16>(result));
+}
+
+s16 Tev::CombineAlphaRegular(const TevStageCombiner::AlphaCombiner& ac,
+                             const InputRegType& InputReg)
+{
+  const u16 c = InputReg.c + (InputReg.c >> 7);
+
+  s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
+  temp <<= s_ScaleLShiftLUT[ac.scale];
+  temp += (ac.scale == TevScale::Divide2) ? 0 : (ac.op == TevOp::Sub) ? 127 : 128;
+  temp = ac.op == TevOp::Sub ? (-temp >> 8) : (temp >> 8);
+
+  s32 result = ((InputReg.d + s_BiasLUT[ac.bias]) << s_ScaleLShiftLUT[ac.scale]) + temp;
+  result = result >> s_ScaleRShiftLUT[ac.scale];
+
+  return ac.clamp ? Clamp255(static_cast<s16>(result)) : Clamp1024(static_cast<s16>(result));
+}
+
+#if defined(_M_X86_64)
+namespace
+{
+// The settings of the alpha combiner for the alpha lanes and of the color combiner for the other
+// lanes, repeated for each pixel in a vector.
+//
+// The vectorized combiners compute ((sign * (x << lshift)) + round) >> 8, where x is
+// a * (256 - c) + b * c. For the color combiner, subtracting negates the rounded result, which is
+// the same as rounding the negated value up. For the alpha combiner, the value is negated before
+// rounding.
+struct CombinerLanes
+{
+  s32 lshift[4];
+  s32 scale[4];  // (1 << lshift)
+  s32 sign[4];
+  s32 round[4];
+  s32 bias[4];
+  s32 rshift[4];
+  s32 rshift_mask[4];
+  s32 clamp_min[4];
+  s32 clamp_max[4];
+};
+
+FUNCTION_TARGET_SSR41
+DOLPHIN_FORCE_INLINE __m128i LoadLanes_SSE41(const s32 (&lanes)[4])
+{
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes));
+}
+
+// Finishes the combiners for the four components of one pixel, given a * (256 - c) + b * c and d
+FUNCTION_TARGET_SSR41
+DOLPHIN_FORCE_INLINE __m128i CombineLanes_SSE41(const CombinerLanes& lanes, __m128i x, __m128i d)
+{
+  const __m128i scale = LoadLanes_SSE41(lanes.scale);
+  __m128i temp = _mm_mullo_epi32(x, _mm_sign_epi32(scale, LoadLanes_SSE41(lanes.sign)));
+  temp = _mm_srai_epi32(_mm_add_epi32(temp, LoadLanes_SSE41(lanes.round)), 8);
+
+  __m128i result = _mm_mullo_epi32(_mm_add_epi32(d, LoadLanes_SSE41(lanes.bias)), scale);
+  result = _mm_add_epi32(result, temp);
+  result = _mm_blendv_epi8(result, _mm_srai_epi32(result, 1), LoadLanes_SSE41(lanes.rshift_mask));
+  result = _mm_max_epi32(result, LoadLanes_SSE41(lanes.clamp_min));
+  return _mm_min_epi32(result, LoadLanes_SSE41(lanes.clamp_max));
+}
+
+FUNCTION_TARGET_SSR41
+void CombineRegular_SSE41(const CombinerLanes& lanes, const Tev::QuadInputs& inputs,
+                          Tev::QuadOutputs& outputs)
+{
+  const __m128i byte_mask = _mm_set1_epi16(0xFF);
+  for (size_t i = 0; i < outputs.size(); i += 8)
   {
-    const InputRegType& InputReg = inputs[i];
+    const __m128i a =
+        _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&inputs.a[i])), byte_mask);
+    const __m128i b =
+        _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&inputs.b[i])), byte_mask);
+    __m128i c =
+        _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&inputs.c[i])), byte_mask);
+    c = _mm_add_epi16(c, _mm_srli_epi16(c, 7));
+    // d is an 11-bit signed value
+    __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&inputs.d[i]));
+    d = _mm_srai_epi16(_mm_slli_epi16(d, 5), 5);
+    const __m128i d_sign = _mm_srai_epi16(d, 15);
+
+    // pmaddwd computes a * (256 - c) + b * c for each lane in one go
+    const __m128i c_inv = _mm_sub_epi16(_mm_set1_epi16(256), c);
+    const __m128i x_lo =
+        _mm_madd_epi16(_mm_unpacklo_epi16(a, b), _mm_unpacklo_epi16(c_inv, c));
+    const __m128i x_hi =
+        _mm_madd_epi16(_mm_unpackhi_epi16(a, b), _mm_unpackhi_epi16(c_inv, c));
+
+    const __m128i result_lo = CombineLanes_SSE41(lanes, x_lo, _mm_unpacklo_epi16(d, d_sign));
+    const __m128i result_hi = CombineLanes_SSE41(lanes, x_hi, _mm_unpackhi_epi16(d, d_sign));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&outputs[i]),
+                     _mm_packs_epi32(result_lo, result_hi));
+  }
+}
+
+FUNCTION_TARGET_AVX2
+DOLPHIN_FORCE_INLINE __m256i LoadLanes_AVX2(const s32 (&lanes)[4])
+{
+  return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes)));
+}
+
+// Finishes the combiners for the four components of two pixels, given a * (256 - c) + b * c and d
+FUNCTION_TARGET_AVX2
+DOLPHIN_FORCE_INLINE __m256i CombineLanes_AVX2(const CombinerLanes& lanes, __m256i x, __m256i d)
+{
+  const __m256i lshift = LoadLanes_AVX2(lanes.lshift);
+  __m256i temp = _mm256_sign_epi32(_mm256_sllv_epi32(x, lshift), LoadLanes_AVX2(lanes.sign));
+  temp = _mm256_srai_epi32(_mm256_add_epi32(temp, LoadLanes_AVX2(lanes.round)), 8);
+
+  __m256i result = _mm256_sllv_epi32(_mm256_add_epi32(d, LoadLanes_AVX2(lanes.bias)), lshift);
+  result = _mm256_add_epi32(result, temp);
+  result = _mm256_srav_epi32(result, LoadLanes_AVX2(lanes.rshift));
+  result = _mm256_max_epi32(result, LoadLanes_AVX2(lanes.clamp_min));
+  return _mm256_min_epi32(result, LoadLanes_AVX2(lanes.clamp_max));
+}
 
-    const u16 c = InputReg.c + (InputReg.c >> 7);
+FUNCTION_TARGET_AVX2
+void CombineRegular_AVX2(const CombinerLanes& lanes, const Tev::QuadInputs& inputs,
+                         Tev::QuadOutputs& outputs)
+{
+  static_assert(sizeof(outputs) == sizeof(__m256i));
+
+  const __m256i byte_mask = _mm256_set1_epi16(0xFF);
+  const __m256i a =
+      _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&inputs.a)), byte_mask);
+  const __m256i b =
+      _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&inputs.b)), byte_mask);
+  __m256i c =
+      _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&inputs.c)), byte_mask);
+  c = _mm256_add_epi16(c, _mm256_srli_epi16(c, 7));
+  // d is an 11-bit signed value
+  __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&inputs.d));
+  d = _mm256_srai_epi16(_mm256_slli_epi16(d, 5), 5);
+  const __m256i d_sign = _mm256_srai_epi16(d, 15);
+
+  // The unpacks work within each half of the vectors, so the low results are of the first and the
+  // third pixel, and the high results are of the second and the fourth pixel. Packing them puts
+  // them back in order.
+  const __m256i c_inv = _mm256_sub_epi16(_mm256_set1_epi16(256), c);
+  const __m256i x_lo =
+      _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), _mm256_unpacklo_epi16(c_inv, c));
+  const __m256i x_hi =
+      _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), _mm256_unpackhi_epi16(c_inv, c));
+
+  const __m256i result_lo = CombineLanes_AVX2(lanes, x_lo, _mm256_unpacklo_epi16(d, d_sign));
+  const __m256i result_hi = CombineLanes_AVX2(lanes, x_hi, _mm256_unpackhi_epi16(d, d_sign));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(&outputs),
+                      _mm256_packs_epi32(result_lo, result_hi));
+}
+}  // namespace
+#endif
 
-    s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-    temp <<= s_ScaleLShiftLUT[cc.scale];
-    temp += (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
-    temp >>= 8;
-    temp = cc.op == TevOp::Sub ? -temp : temp;
+void Tev::CombineRegular(const TevStageCombiner::ColorCombiner& cc,
+                         const TevStageCombiner::AlphaCombiner& ac, const QuadInputs& inputs,
+                         QuadOutputs& outputs)
+{
+#if defined(_M_X86_64)
+  if (cpu_info.bSSE4_1)
+  {
+    CombinerLanes lanes;
+    for (int i = 0; i < 4; i++)
+    {
+      const bool alpha = i == ALP_C;
+      const TevScale scale = alpha ? ac.scale : cc.scale;
+      const TevOp op = alpha ? ac.op : cc.op;
+      const bool clamp = alpha ? ac.clamp : cc.clamp;
+      const s32 round = (scale == TevScale::Divide2) ? 0 : (op == TevOp::Sub) ? 127 : 128;
+
+      lanes.lshift[i] = s_ScaleLShiftLUT[scale];
+      lanes.scale[i] = 1 << s_ScaleLShiftLUT[scale];
+      lanes.sign[i] = op == TevOp::Sub ? -1 : 1;
+      lanes.round[i] = op != TevOp::Sub ? round : alpha ? -round : 255 - round;
+      lanes.bias[i] = s_BiasLUT[alpha ? ac.bias : cc.bias];
+      lanes.rshift[i] = s_ScaleRShiftLUT[scale];
+      lanes.rshift_mask[i] = s_ScaleRShiftLUT[scale] != 0 ? -1 : 0;
+      lanes.clamp_min[i] = clamp ? 0 : -1024;
+      lanes.clamp_max[i] = clamp ? 255 : 1023;
+    }
 
-    s32 result = ((InputReg.d + s_BiasLUT[cc.bias]) << s_ScaleLShiftLUT[cc.scale]) + temp;
-    result = result >> s_ScaleRShiftLUT[cc.scale];
+    if (cpu_info.bAVX2)
+      CombineRegular_AVX2(lanes, inputs, outputs);
+    else
+      CombineRegular_SSE41(lanes, inputs, outputs);
+    return;
+  }
+#endif
 
-    Reg[cc.dest][i] = result;
+  for (size_t i = 0; i < outputs.size(); i++)
+  {
+    InputRegType InputReg;
+    InputReg.a = inputs.a[i];
+    InputReg.b = inputs.b[i];
+    InputReg.c = inputs.c[i];
+    InputReg.d = inputs.d[i];
+
+    if (i % 4 == ALP_C)
+      outputs[i] = CombineAlphaRegular(ac, InputReg);
+    else
+      outputs[i] = CombineColorRegular(cc, InputReg);
   }
 }
 
-void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
+void Tev::DrawColorCompare(int pixel, const TevStageCombiner::ColorCombiner& cc,
+                           const InputRegType inputs[4])
 {
+  PixelState& state = m_pixels[pixel];
+
   for (int i = BLU_C; i <= RED_C; i++)
   {
     u32 a, b;
@@ -131,31 +336,17 @@ void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const Inpu
     }
 
     if (cc.comparison == TevComparison::GT)
-      Reg[cc.dest][i] = inputs[i].d + ((a > b) ? inputs[i].c : 0);
+      state.Reg[cc.dest][i] = inputs[i].d + ((a > b) ? inputs[i].c : 0);
     else
-      Reg[cc.dest][i] = inputs[i].d + ((a == b) ? inputs[i].c : 0);
+      state.Reg[cc.dest][i] = inputs[i].d + ((a == b) ? inputs[i].c : 0);
   }
 }
 
-void Tev::DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
+void Tev::DrawAlphaCompare(int pixel, const TevStageCombiner::AlphaCombiner& ac,
+                           const InputRegType inputs[4])
 {
-  const InputRegType& InputReg = inputs[ALP_C];
+  PixelState& state = m_pixels[pixel];
 
-  const u16 c = InputReg.c + (InputReg.c >> 7);
-
-  s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-  temp <<= s_ScaleLShiftLUT[ac.scale];
-  temp += (ac.scale == TevScale::Divide2) ? 0 : (ac.op == TevOp::Sub) ? 127 : 128;
-  temp = ac.op == TevOp::Sub ? (-temp >> 8) : (temp >> 8);
-
-  s32 result = ((InputReg.d + s_BiasLUT[ac.bias]) << s_ScaleLShiftLUT[ac.scale]) + temp;
-  result = result >> s_ScaleRShiftLUT[ac.scale];
-
-  Reg[ac.dest].a = result;
-}
-
-void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
-{
   u32 a, b;
   switch (ac.compare_mode)
   {
@@ -185,9 +376,9 @@ void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const Inpu
   }
 
   if (ac.comparison == TevComparison::GT)
-    Reg[ac.dest].a = inputs[ALP_C].d + ((a > b) ? inputs[ALP_C].c : 0);
+    state.Reg[ac.dest].a = inputs[ALP_C].d + ((a > b) ? inputs[ALP_C].c : 0);
   else
-    Reg[ac.dest].a = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
+    state.Reg[ac.dest].a = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
 }
 
 static bool AlphaCompare(int alpha, int ref, CompareMode comp)
@@ -261,10 +452,12 @@ static inline s32 WrapIndirectCoord(s32 coord, IndTexWrap wrapMode)
   }
 }
 
-void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
+void Tev::Indirect(int pixel, unsigned int stageNum, s32 s, s32 t)
 {
+  PixelState& state = m_pixels[pixel];
+
   const TevStageIndirect& indirect = bpmem.tevind[stageNum];
-  const u8* indmap = IndirectTex[indirect.bt];
+  const u8* indmap = state.IndirectTex[indirect.bt];
 
   s32 indcoord[3];
 
@@ -272,16 +465,16 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
   switch (indirect.bs)
   {
   case IndTexBumpAlpha::Off:
-    AlphaBump = 0;
+    state.AlphaBump = 0;
     break;
   case IndTexBumpAlpha::S:
-    AlphaBump = indmap[TextureSampler::ALP_SMP];
+    state.AlphaBump = indmap[TextureSampler::ALP_SMP];
     break;
   case IndTexBumpAlpha::T:
-    AlphaBump = indmap[TextureSampler::BLU_SMP];
+    state.AlphaBump = indmap[TextureSampler::BLU_SMP];
     break;
   case IndTexBumpAlpha::U:
-    AlphaBump = indmap[TextureSampler::GRN_SMP];
+    state.AlphaBump = indmap[TextureSampler::GRN_SMP];
     break;
   default:
     PanicAlertFmt("Invalid alpha bump {}", indirect.bs);
@@ -302,25 +495,25 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
     indcoord[0] = indmap[TextureSampler::ALP_SMP] + bias[0];
     indcoord[1] = indmap[TextureSampler::BLU_SMP] + bias[1];
     indcoord[2] = indmap[TextureSampler::GRN_SMP] + bias[2];
-    AlphaBump = AlphaBump & 0xf8;
+    state.AlphaBump = state.AlphaBump & 0xf8;
     break;
   case IndTexFormat::ITF_5:
     indcoord[0] = (indmap[TextureSampler::ALP_SMP] >> 3) + bias[0];
     indcoord[1] = (indmap[TextureSampler::BLU_SMP] >> 3) + bias[1];
     indcoord[2] = (indmap[TextureSampler::GRN_SMP] >> 3) + bias[2];
-    AlphaBump = AlphaBump << 5;
+    state.AlphaBump = state.AlphaBump << 5;
     break;
   case IndTexFormat::ITF_4:
     indcoord[0] = (indmap[TextureSampler::ALP_SMP] >> 4) + bias[0];
     indcoord[1] = (indmap[TextureSampler::BLU_SMP] >> 4) + bias[1];
     indcoord[2] = (indmap[TextureSampler::GRN_SMP] >> 4) + bias[2];
-    AlphaBump = AlphaBump << 4;
+    state.AlphaBump = state.AlphaBump << 4;
     break;
   case IndTexFormat::ITF_3:
     indcoord[0] = (indmap[TextureSampler::ALP_SMP] >> 5) + bias[0];
     indcoord[1] = (indmap[TextureSampler::BLU_SMP] >> 5) + bias[1];
     indcoord[2] = (indmap[TextureSampler::GRN_SMP] >> 5) + bias[2];
-    AlphaBump = AlphaBump << 3;
+    state.AlphaBump = state.AlphaBump << 3;
     break;
   default:
     PanicAlertFmt("Invalid indirect format {}", indirect.fmt);
@@ -374,33 +567,120 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
 
   if (indirect.fb_addprev)
   {
-    TexCoord.s += (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
-    TexCoord.t += (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
+    state.TexCoord.s += (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
+    state.TexCoord.t += (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
   }
   else
   {
-    TexCoord.s = (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
-    TexCoord.t = (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
+    state.TexCoord.s = (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
+    state.TexCoord.t = (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
   }
 }
 
-void Tev::Draw()
+// Only unusual settings read carried state, like a tex.rgb input before the first stage that
+// samples a texture.
+bool Tev::ReadsCarriedState()
 {
-  ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
-  ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
+  bool sampled_texture = false;
+  for (u32 stage = 0; stage <= bpmem.genMode.numtevstages; ++stage)
+  {
+    const TevStageIndirect& indirect = bpmem.tevind[stage];
+    if (stage == 0 && indirect.fb_addprev)
+      return true;
+    if (indirect.bt >= bpmem.genMode.numindstages &&
+        (indirect.bs != IndTexBumpAlpha::Off || indirect.matrix_index != IndMtxIndex::Off))
+    {
+      return true;
+    }
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+    if (bpmem.tevorders[stage >> 1].getEnable(stage & 1))
+    {
+      sampled_texture = true;
+      continue;
+    }
+
+    const TevStageCombiner::ColorCombiner& cc = bpmem.combiners[stage].colorC;
+    const TevStageCombiner::AlphaCombiner& ac = bpmem.combiners[stage].alphaC;
+    const auto is_tex_color = [](TevColorArg arg) {
+      return arg == TevColorArg::TexColor || arg == TevColorArg::TexAlpha;
+    };
+    const bool reads_texture = is_tex_color(cc.a) || is_tex_color(cc.b) || is_tex_color(cc.c) ||
+                               is_tex_color(cc.d) || ac.a == TevAlphaArg::TexAlpha ||
+                               ac.b == TevAlphaArg::TexAlpha || ac.c == TevAlphaArg::TexAlpha ||
+                               ac.d == TevAlphaArg::TexAlpha;
+    if (reads_texture && !sampled_texture)
+      return true;
+  }
 
+  // The z texture uses the texel of the last stage which sampled one
+  return bpmem.ztex2.op != ZTexOp::Disabled && !sampled_texture;
+}
+
+void Tev::LoadCarriedState(int pixel)
+{
+  PixelState& state = m_pixels[pixel];
+  state.RawTexColor = m_carried_state.RawTexColor;
+  state.TexColor = m_carried_state.TexColor;
+  std::memcpy(state.IndirectTex, m_carried_state.IndirectTex, sizeof(state.IndirectTex));
+  state.TexCoord = m_carried_state.TexCoord;
+}
+
+void Tev::StoreCarriedState(int pixel)
+{
+  const PixelState& state = m_pixels[pixel];
+  m_carried_state.RawTexColor = state.RawTexColor;
+  m_carried_state.TexColor = state.TexColor;
+  std::memcpy(m_carried_state.IndirectTex, state.IndirectTex, sizeof(state.IndirectTex));
+  m_carried_state.TexCoord = state.TexCoord;
+}
+
+void Tev::Draw(u32 pixel_mask)
+{
+  if (pixel_mask == 0)
+    return;
+
+  // A pixel which reads what the one before it left behind can only be shaded once that one is
+  // done, so the quad is shaded again for each of its pixels then. Otherwise only the state of the
+  // last pixel that is drawn is kept for the next quad, rather than that of a masked out one.
+  if (ReadsCarriedState())
+  {
+    for (int i = 0; i < QUAD_SIZE; i++)
+    {
+      if (!(pixel_mask & (1u << i)))
+        continue;
+
+      LoadCarriedState(i);
+      Shade();
+      StoreCarriedState(i);
+      DrawPixel(i);
+    }
+    return;
+  }
+
+  Shade();
+  for (int i = 0; i < QUAD_SIZE; i++)
+  {
+    if (pixel_mask & (1u << i))
+      DrawPixel(i);
+  }
+  StoreCarriedState(31 - std::countl_zero(pixel_mask));
+}
+
+void Tev::Shade()
+{
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
 
   // initial color values
-  for (int i = 0; i < 4; i++)
+  for (PixelState& pixel : m_pixels)
   {
-    Reg[static_cast<TevOutput>(i)].r = pixel_shader_manager.constants.colors[i][0];
-    Reg[static_cast<TevOutput>(i)].g = pixel_shader_manager.constants.colors[i][1];
-    Reg[static_cast<TevOutput>(i)].b = pixel_shader_manager.constants.colors[i][2];
-    Reg[static_cast<TevOutput>(i)].a = pixel_shader_manager.constants.colors[i][3];
+    for (int i = 0; i < 4; i++)
+    {
+      pixel.Reg[static_cast<TevOutput>(i)].r = pixel_shader_manager.constants.colors[i][0];
+      pixel.Reg[static_cast<TevOutput>(i)].g = pixel_shader_manager.constants.colors[i][1];
+      pixel.Reg[static_cast<TevOutput>(i)].b = pixel_shader_manager.constants.colors[i][2];
+      pixel.Reg[static_cast<TevOutput>(i)].a = pixel_shader_manager.constants.colors[i][3];
+    }
   }
 
   for (unsigned int stageNum = 0; stageNum < bpmem.genMode.numindstages; stageNum++)
@@ -422,9 +702,18 @@ void Tev::Draw()
     const s32 scaleS = stageOdd ? texscale.ss1 : texscale.ss0;
     const s32 scaleT = stageOdd ? texscale.ts1 : texscale.ts0;
 
-    TextureSampler::Sample(Uv[texcoordSel].s >> scaleS, Uv[texcoordSel].t >> scaleT,
-                           IndirectLod[stageNum], IndirectLinear[stageNum], texmap,
-                           IndirectTex[stageNum]);
+    s32 s[QUAD_SIZE];
+    s32 t[QUAD_SIZE];
+    for (int i = 0; i < QUAD_SIZE; i++)
+    {
+      s[i] = Pixels[i].Uv[texcoordSel].s >> scaleS;
+      t[i] = Pixels[i].Uv[texcoordSel].t >> scaleT;
+    }
+
+    u32 samples[QUAD_SIZE];
+    TextureSampler::Sample(s, t, IndirectLod[stageNum], IndirectLinear[stageNum], texmap, samples);
+    for (int i = 0; i < QUAD_SIZE; i++)
+      std::memcpy(m_pixels[i].IndirectTex[stageNum], &samples[i], sizeof(u32));
   }
 
   for (unsigned int stageNum = 0; stageNum <= bpmem.genMode.numtevstages; stageNum++)
@@ -445,104 +734,166 @@ void Tev::Draw()
     if (texcoordSel >= bpmem.genMode.numtexgens)
       texcoordSel = 0;
 
-    Indirect(stageNum, Uv[texcoordSel].s, Uv[texcoordSel].t);
+    for (int i = 0; i < QUAD_SIZE; i++)
+      Indirect(i, stageNum, Pixels[i].Uv[texcoordSel].s, Pixels[i].Uv[texcoordSel].t);
 
     // sample texture
     if (order.getEnable(stageOdd))
     {
       // RGBA
-      u8 texel[4];
+      u32 texels[QUAD_SIZE]{};
 
       if (bpmem.genMode.numtexgens > 0)
       {
-        TextureSampler::Sample(TexCoord.s, TexCoord.t, TextureLod[stageNum],
-                               TextureLinear[stageNum], texmap, texel);
-      }
-      else
-      {
-        // It seems like the result is always black when no tex coords are enabled, but further
-        // hardware testing is needed.
-        std::memset(texel, 0, 4);
+        s32 s[QUAD_SIZE];
+        s32 t[QUAD_SIZE];
+        for (int i = 0; i < QUAD_SIZE; i++)
+        {
+          s[i] = m_pixels[i].TexCoord.s;
+          t[i] = m_pixels[i].TexCoord.t;
+        }
+
+        TextureSampler::Sample(s, t, TextureLod[stageNum], TextureLinear[stageNum], texmap,
+                               texels);
       }
-
-      RawTexColor.r = texel[u32(ColorChannel::Red)];
-      RawTexColor.g = texel[u32(ColorChannel::Green)];
-      RawTexColor.b = texel[u32(ColorChannel::Blue)];
-      RawTexColor.a = texel[u32(ColorChannel::Alpha)];
+      // It seems like the result is always black when no tex coords are enabled, but further
+      // hardware testing is needed.
 
       const auto& swap = bpmem.tevksel.GetSwapTable(ac.tswap);
-      TexColor.r = texel[u32(swap[ColorChannel::Red])];
-      TexColor.g = texel[u32(swap[ColorChannel::Green])];
-      TexColor.b = texel[u32(swap[ColorChannel::Blue])];
-      TexColor.a = texel[u32(swap[ColorChannel::Alpha])];
+      for (int i = 0; i < QUAD_SIZE; i++)
+      {
+        PixelState& pixel = m_pixels[i];
+        u8 texel[4];
+        std::memcpy(texel, &texels[i], sizeof(texel));
+
+        pixel.RawTexColor.r = texel[u32(ColorChannel::Red)];
+        pixel.RawTexColor.g = texel[u32(ColorChannel::Green)];
+        pixel.RawTexColor.b = texel[u32(ColorChannel::Blue)];
+        pixel.RawTexColor.a = texel[u32(ColorChannel::Alpha)];
+
+        pixel.TexColor.r = texel[u32(swap[ColorChannel::Red])];
+        pixel.TexColor.g = texel[u32(swap[ColorChannel::Green])];
+        pixel.TexColor.b = texel[u32(swap[ColorChannel::Blue])];
+        pixel.TexColor.a = texel[u32(swap[ColorChannel::Alpha])];
+      }
     }
 
     // set konst for this stage
     const auto kc = bpmem.tevksel.GetKonstColor(stageNum);
     const auto ka = bpmem.tevksel.GetKonstAlpha(stageNum);
-    StageKonst.r = m_KonstLUT[kc].r;
-    StageKonst.g = m_KonstLUT[kc].g;
-    StageKonst.b = m_KonstLUT[kc].b;
-    StageKonst.a = m_KonstLUT[ka].a;
-
-    // set color
-    SetRasColor(order.getColorChan(stageOdd), ac.rswap);
+    const TevColor stage_konst(m_KonstLUT[ka].a, m_KonstLUT[kc].b, m_KonstLUT[kc].g,
+                               m_KonstLUT[kc].r);
 
     // combine inputs
-    InputRegType inputs[4];
-    inputs[BLU_C].a = m_ColorInputLUT[cc.a].b;
-    inputs[BLU_C].b = m_ColorInputLUT[cc.b].b;
-    inputs[BLU_C].c = m_ColorInputLUT[cc.c].b;
-    inputs[BLU_C].d = m_ColorInputLUT[cc.d].b;
-    inputs[GRN_C].a = m_ColorInputLUT[cc.a].g;
-    inputs[GRN_C].b = m_ColorInputLUT[cc.b].g;
-    inputs[GRN_C].c = m_ColorInputLUT[cc.c].g;
-    inputs[GRN_C].d = m_ColorInputLUT[cc.d].g;
-    inputs[RED_C].a = m_ColorInputLUT[cc.a].r;
-    inputs[RED_C].b = m_ColorInputLUT[cc.b].r;
-    inputs[RED_C].c = m_ColorInputLUT[cc.c].r;
-    inputs[RED_C].d = m_ColorInputLUT[cc.d].r;
-    inputs[ALP_C].a = m_AlphaInputLUT[ac.a].a;
-    inputs[ALP_C].b = m_AlphaInputLUT[ac.b].a;
-    inputs[ALP_C].c = m_AlphaInputLUT[ac.c].a;
-    inputs[ALP_C].d = m_AlphaInputLUT[ac.d].a;
-
-    if (cc.bias != TevBias::Compare)
-      DrawColorRegular(cc, inputs);
-    else
-      DrawColorCompare(cc, inputs);
-
-    if (cc.clamp)
+    QuadInputs inputs;
+    for (int i = 0; i < QUAD_SIZE; i++)
     {
-      Reg[cc.dest].r = Clamp255(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp255(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp255(Reg[cc.dest].b);
+      PixelState& pixel = m_pixels[i];
+      pixel.StageKonst = stage_konst;
+
+      // set color
+      SetRasColor(i, order.getColorChan(stageOdd), ac.rswap);
+
+      const int base = i * 4;
+      inputs.a[base + BLU_C] = pixel.m_ColorInputLUT[cc.a].b;
+      inputs.b[base + BLU_C] = pixel.m_ColorInputLUT[cc.b].b;
+      inputs.c[base + BLU_C] = pixel.m_ColorInputLUT[cc.c].b;
+      inputs.d[base + BLU_C] = pixel.m_ColorInputLUT[cc.d].b;
+      inputs.a[base + GRN_C] = pixel.m_ColorInputLUT[cc.a].g;
+      inputs.b[base + GRN_C] = pixel.m_ColorInputLUT[cc.b].g;
+      inputs.c[base + GRN_C] = pixel.m_ColorInputLUT[cc.c].g;
+      inputs.d[base + GRN_C] = pixel.m_ColorInputLUT[cc.d].g;
+      inputs.a[base + RED_C] = pixel.m_ColorInputLUT[cc.a].r;
+      inputs.b[base + RED_C] = pixel.m_ColorInputLUT[cc.b].r;
+      inputs.c[base + RED_C] = pixel.m_ColorInputLUT[cc.c].r;
+      inputs.d[base + RED_C] = pixel.m_ColorInputLUT[cc.d].r;
+      inputs.a[base + ALP_C] = pixel.m_AlphaInputLUT[ac.a].a;
+      inputs.b[base + ALP_C] = pixel.m_AlphaInputLUT[ac.b].a;
+      inputs.c[base + ALP_C] = pixel.m_AlphaInputLUT[ac.c].a;
+      inputs.d[base + ALP_C] = pixel.m_AlphaInputLUT[ac.d].a;
     }
-    else
+
+    // The regular combiners run on the whole quad at once, while the compare modes are done
+    // per pixel
+    QuadOutputs outputs;
+    if (cc.bias != TevBias::Compare || ac.bias != TevBias::Compare)
+      CombineRegular(cc, ac, inputs, outputs);
+
+    for (int i = 0; i < QUAD_SIZE; i++)
     {
-      Reg[cc.dest].r = Clamp1024(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp1024(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp1024(Reg[cc.dest].b);
-    }
+      PixelState& pixel = m_pixels[i];
+      const int base = i * 4;
 
-    if (ac.bias != TevBias::Compare)
-      DrawAlphaRegular(ac, inputs);
-    else
-      DrawAlphaCompare(ac, inputs);
+      InputRegType compare_inputs[4];
+      if (cc.bias == TevBias::Compare || ac.bias == TevBias::Compare)
+      {
+        for (int j = 0; j < 4; j++)
+        {
+          compare_inputs[j].a = inputs.a[base + j];
+          compare_inputs[j].b = inputs.b[base + j];
+          compare_inputs[j].c = inputs.c[base + j];
+          compare_inputs[j].d = inputs.d[base + j];
+        }
+      }
 
-    if (ac.clamp)
-      Reg[ac.dest].a = Clamp255(Reg[ac.dest].a);
-    else
-      Reg[ac.dest].a = Clamp1024(Reg[ac.dest].a);
+      if (cc.bias != TevBias::Compare)
+      {
+        pixel.Reg[cc.dest].b = outputs[base + BLU_C];
+        pixel.Reg[cc.dest].g = outputs[base + GRN_C];
+        pixel.Reg[cc.dest].r = outputs[base + RED_C];
+      }
+      else
+      {
+        DrawColorCompare(i, cc, compare_inputs);
+
+        if (cc.clamp)
+        {
+          pixel.Reg[cc.dest].r = Clamp255(pixel.Reg[cc.dest].r);
+          pixel.Reg[cc.dest].g = Clamp255(pixel.Reg[cc.dest].g);
+          pixel.Reg[cc.dest].b = Clamp255(pixel.Reg[cc.dest].b);
+        }
+        else
+        {
+          pixel.Reg[cc.dest].r = Clamp1024(pixel.Reg[cc.dest].r);
+          pixel.Reg[cc.dest].g = Clamp1024(pixel.Reg[cc.dest].g);
+          pixel.Reg[cc.dest].b = Clamp1024(pixel.Reg[cc.dest].b);
+        }
+      }
+
+      if (ac.bias != TevBias::Compare)
+      {
+        pixel.Reg[ac.dest].a = outputs[base + ALP_C];
+      }
+      else
+      {
+        DrawAlphaCompare(i, ac, compare_inputs);
+
+        if (ac.clamp)
+          pixel.Reg[ac.dest].a = Clamp255(pixel.Reg[ac.dest].a);
+        else
+          pixel.Reg[ac.dest].a = Clamp1024(pixel.Reg[ac.dest].a);
+      }
+    }
   }
+}
+
+void Tev::DrawPixel(int pixel)
+{
+  PixelState& state = m_pixels[pixel];
+  s32* const position = Pixels[pixel].Position;
+
+  ASSERT(position[0] >= 0 && position[0] < s32(EFB_WIDTH));
+  ASSERT(position[1] >= 0 && position[1] < s32(EFB_HEIGHT));
+
+  ++counters.tev_pixels_in;
 
   // convert to 8 bits per component
   // the results of the last tev stage are put onto the screen,
   // regardless of the used destination register - TODO: Verify!
   const auto& color_index = bpmem.combiners[bpmem.genMode.numtevstages].colorC.dest;
   const auto& alpha_index = bpmem.combiners[bpmem.genMode.numtevstages].alphaC.dest;
-  u8 output[4] = {(u8)Reg[alpha_index].a, (u8)Reg[color_index].b, (u8)Reg[color_index].g,
-                  (u8)Reg[color_index].r};
+  u8 output[4] = {(u8)state.Reg[alpha_index].a, (u8)state.Reg[color_index].b,
+                  (u8)state.Reg[color_index].g, (u8)state.Reg[color_index].r};
 
   if (!TevAlphaTest(output[ALP_C]))
     return;
@@ -554,22 +905,23 @@ void Tev::Draw()
     switch (bpmem.ztex2.type)
     {
     case ZTexFormat::U8:
-      ztex += RawTexColor[ALP_C];
+      ztex += state.RawTexColor[ALP_C];
       break;
     case ZTexFormat::U16:
-      ztex += RawTexColor[ALP_C] << 8 | RawTexColor[RED_C];
+      ztex += state.RawTexColor[ALP_C] << 8 | state.RawTexColor[RED_C];
       break;
     case ZTexFormat::U24:
-      ztex += RawTexColor[RED_C] << 16 | RawTexColor[GRN_C] << 8 | RawTexColor[BLU_C];
+      ztex += state.RawTexColor[RED_C] << 16 | state.RawTexColor[GRN_C] << 8 |
+              state.RawTexColor[BLU_C];
       break;
     default:
       PanicAlertFmt("Invalid ztex format {}", bpmem.ztex2.type);
     }
 
     if (bpmem.ztex2.op == ZTexOp::Add)
-      ztex += Position[2];
+      ztex += position[2];
 
-    Position[2] = ztex & 0x00ffffff;
+    position[2] = ztex & 0x00ffffff;
   }
 
   // fog
@@ -581,7 +933,7 @@ void Tev::Draw()
     {
       // perspective
       // ze = A/(B - (Zs >> B_SHF))
-      const s32 denom = bpmem.fog.b_magnitude - (Position[2] >> bpmem.fog.b_shift);
+      const s32 denom = bpmem.fog.b_magnitude - (position[2] >> bpmem.fog.b_shift);
       // in addition downscale magnitude and zs to 0.24 bits
       ze = (bpmem.fog.GetA() * 16777215.0f) / static_cast<float>(denom);
     }
@@ -590,7 +942,7 @@ void Tev::Draw()
       // orthographic
       // ze = a*Zs
       // in addition downscale zs to 0.24 bits
-      ze = bpmem.fog.GetA() * (static_cast<float>(Position[2]) / 16777215.0f);
+      ze = bpmem.fog.GetA() * (static_cast<float>(position[2]) / 16777215.0f);
     }
 
     if (bpmem.fogRange.Base.Enabled)
@@ -602,7 +954,7 @@ void Tev::Draw()
 
       // First, calculate the offset from the viewport center (normalized to 0..1)
       const float offset =
-          (Position[0] - (static_cast<s32>(bpmem.fogRange.Base.Center.Value()) - 342)) /
+          (position[0] - (static_cast<s32>(bpmem.fogRange.Base.Center.Value()) - 342)) /
           static_cast<float>(xfmem.viewport.wd);
 
       // Based on that, choose the index such that points which are far away from the z-axis use the
@@ -663,23 +1015,25 @@ void Tev::Draw()
   if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+    ++counters.perf_quad_count[PQ_ZCOMP_INPUT];
 
-    if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
+    if (!EfbInterface::ZCompare(position[0], position[1], position[2]))
       return;
 
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    ++counters.perf_quad_count[PQ_ZCOMP_OUTPUT];
   }
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  counters.bbox_left = std::min(counters.bbox_left, static_cast<u16>(position[0] & ~1));
+  counters.bbox_right = std::max(counters.bbox_right, static_cast<u16>(position[0] | 1));
+  counters.bbox_top = std::min(counters.bbox_top, static_cast<u16>(position[1] & ~1));
+  counters.bbox_bottom = std::max(counters.bbox_bottom, static_cast<u16>(position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+  ++counters.tev_pixels_out;
+  ++counters.perf_quad_count[PQ_BLEND_INPUT];
 
-  EfbInterface::BlendTev(Position[0], Position[1], output);
+  EfbInterface::BlendTev(position[0], position[1], output);
 }
 
 void Tev::SetKonstColors()
@@ -695,3 +1049,25 @@ void Tev::SetKonstColors()
     KonstantColors[i].a = pixel_shader_manager.constants.kcolors[i][3];
   }
 }
+
+void Tev::FlushCounters()
+{
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, counters.rasterized_pixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, counters.tev_pixels_in);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, counters.tev_pixels_out);
+
+  for (int i = 0; i < PQ_NUM_MEMBERS; i++)
+  {
+    if (counters.perf_quad_count[i] != 0)
+      EfbInterface::IncPerfCounterQuadCount(static_cast<PerfQueryType>(i),
+                                            counters.perf_quad_count[i]);
+  }
+
+  if (counters.bbox_left <= counters.bbox_right)
+  {
+    BBoxManager::Update(counters.bbox_left, counters.bbox_right, counters.bbox_top,
+                        counters.bbox_bottom);
+  }
+
+  counters = {};
+}
@@ -5,11 +5,19 @@
 
 #include <array>
 
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoBackends/Software/TextureSampler.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
+public:
+  // The pixels of a 2x2 quad go through the TEV stages together
+  static constexpr int QUAD_SIZE = TextureSampler::QUAD_SIZE;
+
+private:
   struct TevColor
   {
     constexpr TevColor() = default;
@@ -104,14 +112,6 @@ class Tev
     signed t : 24;
   };
 
-  // color order: ABGR
-  Common::EnumMap<TevColor, TevOutput::Color2> Reg;
-  std::array<TevColor, 4> KonstantColors;
-  TevColor RawTexColor;
-  TevColor TexColor;
-  TevColor RasColor;
-  TevColor StageKonst;
-
   // Fixed constants, corresponding to KonstSel
   static constexpr s16 V0 = 0;
   static constexpr s16 V1_8 = 32;
@@ -123,38 +123,65 @@ class Tev
   static constexpr s16 V7_8 = 223;
   static constexpr s16 V1 = 255;
 
-  u8 AlphaBump = 0;
-  u8 IndirectTex[4][4]{};
-  TextureCoordinateType TexCoord{};
-
-  const Common::EnumMap<TevColorRef, TevColorArg::Zero> m_ColorInputLUT{
-      TevColorRef::Color(Reg[TevOutput::Prev]),    // prev.rgb
-      TevColorRef::Alpha(Reg[TevOutput::Prev]),    // prev.aaa
-      TevColorRef::Color(Reg[TevOutput::Color0]),  // c0.rgb
-      TevColorRef::Alpha(Reg[TevOutput::Color0]),  // c0.aaa
-      TevColorRef::Color(Reg[TevOutput::Color1]),  // c1.rgb
-      TevColorRef::Alpha(Reg[TevOutput::Color1]),  // c1.aaa
-      TevColorRef::Color(Reg[TevOutput::Color2]),  // c2.rgb
-      TevColorRef::Alpha(Reg[TevOutput::Color2]),  // c2.aaa
-      TevColorRef::Color(TexColor),                // tex.rgb
-      TevColorRef::Alpha(TexColor),                // tex.aaa
-      TevColorRef::Color(RasColor),                // ras.rgb
-      TevColorRef::Alpha(RasColor),                // ras.aaa
-      TevColorRef::All(V1),                        // one
-      TevColorRef::All(V1_2),                      // half
-      TevColorRef::Color(StageKonst),              // konst
-      TevColorRef::All(V0),                        // zero
+  // The state of one pixel of the quad as it goes through the TEV stages
+  struct PixelState
+  {
+    // color order: ABGR
+    Common::EnumMap<TevColor, TevOutput::Color2> Reg;
+    TevColor RawTexColor;
+    TevColor TexColor;
+    TevColor RasColor;
+    TevColor StageKonst;
+
+    u8 AlphaBump = 0;
+    u8 IndirectTex[4][4]{};
+    TextureCoordinateType TexCoord{};
+
+    const Common::EnumMap<TevColorRef, TevColorArg::Zero> m_ColorInputLUT{
+        TevColorRef::Color(Reg[TevOutput::Prev]),    // prev.rgb
+        TevColorRef::Alpha(Reg[TevOutput::Prev]),    // prev.aaa
+        TevColorRef::Color(Reg[TevOutput::Color0]),  // c0.rgb
+        TevColorRef::Alpha(Reg[TevOutput::Color0]),  // c0.aaa
+        TevColorRef::Color(Reg[TevOutput::Color1]),  // c1.rgb
+        TevColorRef::Alpha(Reg[TevOutput::Color1]),  // c1.aaa
+        TevColorRef::Color(Reg[TevOutput::Color2]),  // c2.rgb
+        TevColorRef::Alpha(Reg[TevOutput::Color2]),  // c2.aaa
+        TevColorRef::Color(TexColor),                // tex.rgb
+        TevColorRef::Alpha(TexColor),                // tex.aaa
+        TevColorRef::Color(RasColor),                // ras.rgb
+        TevColorRef::Alpha(RasColor),                // ras.aaa
+        TevColorRef::All(V1),                        // one
+        TevColorRef::All(V1_2),                      // half
+        TevColorRef::Color(StageKonst),              // konst
+        TevColorRef::All(V0),                        // zero
+    };
+    const Common::EnumMap<TevAlphaRef, TevAlphaArg::Zero> m_AlphaInputLUT{
+        TevAlphaRef(Reg[TevOutput::Prev]),    // prev
+        TevAlphaRef(Reg[TevOutput::Color0]),  // c0
+        TevAlphaRef(Reg[TevOutput::Color1]),  // c1
+        TevAlphaRef(Reg[TevOutput::Color2]),  // c2
+        TevAlphaRef(TexColor),                // tex
+        TevAlphaRef(RasColor),                // ras
+        TevAlphaRef(StageKonst),              // konst
+        TevAlphaRef(V0),                      // zero
+    };
   };
-  const Common::EnumMap<TevAlphaRef, TevAlphaArg::Zero> m_AlphaInputLUT{
-      TevAlphaRef(Reg[TevOutput::Prev]),    // prev
-      TevAlphaRef(Reg[TevOutput::Color0]),  // c0
-      TevAlphaRef(Reg[TevOutput::Color1]),  // c1
-      TevAlphaRef(Reg[TevOutput::Color2]),  // c2
-      TevAlphaRef(TexColor),                // tex
-      TevAlphaRef(RasColor),                // ras
-      TevAlphaRef(StageKonst),              // konst
-      TevAlphaRef(V0),                      // zero
+
+  std::array<PixelState, QUAD_SIZE> m_pixels;
+
+  // The parts of PixelState which some settings read before the TEV stages of a pixel have written
+  // them, so that they see what the pixel drawn before it left behind.
+  struct CarriedState
+  {
+    TevColor RawTexColor;
+    TevColor TexColor;
+    u8 IndirectTex[4][4]{};
+    TextureCoordinateType TexCoord{};
   };
+  CarriedState m_carried_state;
+
+  std::array<TevColor, 4> KonstantColors;
+
   const Common::EnumMap<TevKonstRef, KonstSel::K3_A> m_KonstLUT{
       TevKonstRef::Value(V1),    // 1
       TevKonstRef::Value(V7_8),  // 7/8
@@ -204,24 +231,57 @@ class Tev
     INDIRECT = 32
   };
 
-  void SetRasColor(RasColorChan colorChan, u32 swaptable);
+  void SetRasColor(int pixel, RasColorChan colorChan, u32 swaptable);
 
-  void DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
-  void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
-  void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
-  void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
+  static s16 CombineColorRegular(const TevStageCombiner::ColorCombiner& cc,
+                                 const InputRegType& InputReg);
+  static s16 CombineAlphaRegular(const TevStageCombiner::AlphaCombiner& ac,
+                                 const InputRegType& InputReg);
+  void DrawColorCompare(int pixel, const TevStageCombiner::ColorCombiner& cc,
+                        const InputRegType inputs[4]);
+  void DrawAlphaCompare(int pixel, const TevStageCombiner::AlphaCombiner& ac,
+                        const InputRegType inputs[4]);
 
-  void Indirect(unsigned int stageNum, s32 s, s32 t);
+  void Indirect(int pixel, unsigned int stageNum, s32 s, s32 t);
+  void DrawPixel(int pixel);
+
+  // Runs the TEV stages for every pixel of the quad
+  void Shade();
+  void LoadCarriedState(int pixel);
+  void StoreCarriedState(int pixel);
 
 public:
-  s32 Position[3]{};
-  u8 Color[2][4]{};  // must be RGBA for correct swap table ordering
-  TextureCoordinateType Uv[8]{};
+  // The inputs of one pixel of the quad
+  struct Pixel
+  {
+    s32 Position[3]{};
+    u8 Color[2][4]{};  // must be RGBA for correct swap table ordering
+    TextureCoordinateType Uv[8]{};
+  };
+  std::array<Pixel, QUAD_SIZE> Pixels;
+
+  // The LODs are shared by the whole quad
   s32 IndirectLod[4]{};
   bool IndirectLinear[4]{};
   s32 TextureLod[16]{};
   bool TextureLinear[16]{};
 
+  // Side effects of drawing which are shared by the whole EFB (statistics, performance counters
+  // and the bounding box). They are tallied per Tev instance and applied by FlushCounters, which
+  // allows several instances to draw different parts of the EFB at the same time.
+  struct Counters
+  {
+    u32 rasterized_pixels = 0;
+    u32 tev_pixels_in = 0;
+    u32 tev_pixels_out = 0;
+    std::array<u32, PQ_NUM_MEMBERS> perf_quad_count{};
+    u16 bbox_left = 0xFFFF;
+    u16 bbox_right = 0;
+    u16 bbox_top = 0xFFFF;
+    u16 bbox_bottom = 0;
+  };
+  Counters counters;
+
   enum
   {
     ALP_C,
@@ -230,6 +290,32 @@ public:
     RED_C
   };
 
+  // The inputs of the regular color and alpha combiners of a stage for every pixel of the quad,
+  // with the components of each pixel in ABGR order. These are the raw register values, which are
+  // truncated to the widths of the combiner inputs.
+  struct QuadInputs
+  {
+    std::array<s16, QUAD_SIZE * 4> a;
+    std::array<s16, QUAD_SIZE * 4> b;
+    std::array<s16, QUAD_SIZE * 4> c;
+    std::array<s16, QUAD_SIZE * 4> d;
+  };
+  using QuadOutputs = std::array<s16, QUAD_SIZE * 4>;
+
+  // Runs the regular color and alpha combiners of a stage, including the clamping of the results,
+  // for every pixel of the quad at once.
+  static void CombineRegular(const TevStageCombiner::ColorCombiner& cc,
+                             const TevStageCombiner::AlphaCombiner& ac, const QuadInputs& inputs,
+                             QuadOutputs& outputs);
+
   void SetKonstColors();
-  void Draw();
+  // Draws the pixels of the quad whose bits are set in pixel_mask. The other pixels may still go
+  // through the TEV stages, but don't affect the EFB or the pixels drawn after them.
+  void Draw(u32 pixel_mask);
+  void FlushCounters();
+
+  // Whether the current TEV configuration reads state left behind by the previously drawn pixel,
+  // which makes the output depend on the order pixels are drawn in.
+  static bool ReadsCarriedState();
+  void ResetCarriedState() { m_carried_state = {}; }
 };
@@ -4,9 +4,13 @@
 #include "VideoBackends/Software/TextureSampler.h"
 
 #include <algorithm>
+#include <cstring>
 #include <span>
 
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/Inline.h"
+#include "Common/Intrinsics.h"
 #include "Common/MsgHandler.h"
 #include "Common/SpanUtils.h"
 #include "Core/HW/Memmap.h"
@@ -53,6 +57,7 @@ static inline void WrapCoord(int* coordp, WrapMode wrap_mode, int image_size)
   *coordp = coord;
 }
 
+
 static inline void SetTexel(const u8* inTexel, u32* outTexel, u32 fract)
 {
   outTexel[0] = inTexel[0] * fract;
@@ -69,7 +74,242 @@ static inline void AddTexel(const u8* inTexel, u32* outTexel, u32 fract)
   outTexel[3] += inTexel[3] * fract;
 }
 
-void Sample(s32 s, s32 t, s32 lod, bool linear, u8 texmap, u8* sample)
+void BilinearFilter(const u8 texels[4][4], s32 fract_s, s32 fract_t, u8* sample)
+{
+  u32 texel[4];
+  SetTexel(texels[0], texel, (128 - fract_s) * (128 - fract_t));
+  AddTexel(texels[1], texel, fract_s * (128 - fract_t));
+  AddTexel(texels[2], texel, (128 - fract_s) * fract_t);
+  AddTexel(texels[3], texel, fract_s * fract_t);
+
+  sample[0] = (u8)(texel[0] >> 14);
+  sample[1] = (u8)(texel[1] >> 14);
+  sample[2] = (u8)(texel[2] >> 14);
+  sample[3] = (u8)(texel[3] >> 14);
+}
+
+void LerpMips(const u8* base_mip, const u8* next_mip, s32 lod_fract, u8* sample)
+{
+  u32 texel[4];
+  SetTexel(base_mip, texel, 16 - lod_fract);
+  AddTexel(next_mip, texel, lod_fract);
+
+  sample[0] = (u8)(texel[0] >> 4);
+  sample[1] = (u8)(texel[1] >> 4);
+  sample[2] = (u8)(texel[2] >> 4);
+  sample[3] = (u8)(texel[3] >> 4);
+}
+
+#if defined(_M_X86_64)
+// The vectorized filters work on four pixels at a time. The even and the odd components of the
+// pixels are handled separately, as 16-bit values which stay within the 32-bit lane of their pixel.
+//
+// Bilinear filtering is done horizontally first and vertically second. This gives exactly the same
+// result as weighing all four texels at once, since the weights of the texels are products of the
+// horizontal and the vertical weights, and it keeps the horizontal results within 16 bits.
+
+static DOLPHIN_FORCE_INLINE __m128i LerpTexels(__m128i texel0, __m128i texel1, __m128i weight0,
+                                               __m128i weight1)
+{
+  return _mm_add_epi16(_mm_mullo_epi16(texel0, weight0), _mm_mullo_epi16(texel1, weight1));
+}
+
+// Weighs the horizontally filtered top and bottom rows of four pixels with the packed vertical
+// weights, giving the 8-bit results as 16-bit values in the lanes of the inputs.
+FUNCTION_TARGET_SSR41
+static DOLPHIN_FORCE_INLINE __m128i LerpRows_SSE41(__m128i top, __m128i bottom, __m128i weights)
+{
+  const __m128i sum01 =
+      _mm_madd_epi16(_mm_unpacklo_epi16(top, bottom), _mm_unpacklo_epi32(weights, weights));
+  const __m128i sum23 =
+      _mm_madd_epi16(_mm_unpackhi_epi16(top, bottom), _mm_unpackhi_epi32(weights, weights));
+  return _mm_packus_epi32(_mm_srli_epi32(sum01, 14), _mm_srli_epi32(sum23, 14));
+}
+
+FUNCTION_TARGET_SSR41
+static void BilinearFilterSpan_SSE41(const std::array<const u32*, 4>& texels, const s32* fract_s,
+                                     const s32* fract_t, u32* samples, size_t count)
+{
+  const __m128i even_mask = _mm_set1_epi32(0x00FF00FF);
+  for (size_t i = 0; i < count; i += 4)
+  {
+    const __m128i fs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fract_s + i));
+    const __m128i ft = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fract_t + i));
+    const __m128i weight_s1 = _mm_or_si128(fs, _mm_slli_epi32(fs, 16));
+    const __m128i weight_s0 = _mm_sub_epi16(_mm_set1_epi16(128), weight_s1);
+    const __m128i weights_t =
+        _mm_or_si128(_mm_sub_epi32(_mm_set1_epi32(128), ft), _mm_slli_epi32(ft, 16));
+
+    const __m128i t0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(texels[0] + i));
+    const __m128i t1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(texels[1] + i));
+    const __m128i t2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(texels[2] + i));
+    const __m128i t3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(texels[3] + i));
+
+    const __m128i top_even = LerpTexels(_mm_and_si128(t0, even_mask), _mm_and_si128(t1, even_mask),
+                                        weight_s0, weight_s1);
+    const __m128i top_odd =
+        LerpTexels(_mm_srli_epi16(t0, 8), _mm_srli_epi16(t1, 8), weight_s0, weight_s1);
+    const __m128i bottom_even = LerpTexels(
+        _mm_and_si128(t2, even_mask), _mm_and_si128(t3, even_mask), weight_s0, weight_s1);
+    const __m128i bottom_odd =
+        LerpTexels(_mm_srli_epi16(t2, 8), _mm_srli_epi16(t3, 8), weight_s0, weight_s1);
+
+    const __m128i even = LerpRows_SSE41(top_even, bottom_even, weights_t);
+    const __m128i odd = LerpRows_SSE41(top_odd, bottom_odd, weights_t);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(samples + i),
+                     _mm_or_si128(even, _mm_slli_epi16(odd, 8)));
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void BilinearFilterSpan_AVX2(const std::array<const u32*, 4>& texels, const s32* fract_s,
+                                    const s32* fract_t, u32* samples, size_t count)
+{
+  // The top row of texels goes in the low half of the vectors and the bottom row in the high half,
+  // so that both rows are filtered horizontally at once.
+  const __m256i even_mask = _mm256_set1_epi32(0x00FF00FF);
+  for (size_t i = 0; i < count; i += 4)
+  {
+    const __m256i fs =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(fract_s + i)));
+    const __m256i ft =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(fract_t + i)));
+    const __m256i weight_s1 = _mm256_or_si256(fs, _mm256_slli_epi32(fs, 16));
+    const __m256i weight_s0 = _mm256_sub_epi16(_mm256_set1_epi16(128), weight_s1);
+    const __m256i weights_t =
+        _mm256_or_si256(_mm256_sub_epi32(_mm256_set1_epi32(128), ft), _mm256_slli_epi32(ft, 16));
+
+    const __m256i left =
+        _mm256_set_m128i(_mm_loadu_si128(reinterpret_cast<const __m128i*>(texels[2] + i)),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(texels[0] + i)));
+    const __m256i right =
+        _mm256_set_m128i(_mm_loadu_si128(reinterpret_cast<const __m128i*>(texels[3] + i)),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(texels[1] + i)));
+
+    const __m256i rows_even = _mm256_add_epi16(
+        _mm256_mullo_epi16(_mm256_and_si256(left, even_mask), weight_s0),
+        _mm256_mullo_epi16(_mm256_and_si256(right, even_mask), weight_s1));
+    const __m256i rows_odd =
+        _mm256_add_epi16(_mm256_mullo_epi16(_mm256_srli_epi16(left, 8), weight_s0),
+                         _mm256_mullo_epi16(_mm256_srli_epi16(right, 8), weight_s1));
+
+    // Now the even components go in the low half and the odd components in the high half
+    const __m256i top = _mm256_permute2x128_si256(rows_even, rows_odd, 0x20);
+    const __m256i bottom = _mm256_permute2x128_si256(rows_even, rows_odd, 0x31);
+    const __m256i sum01 = _mm256_madd_epi16(_mm256_unpacklo_epi16(top, bottom),
+                                            _mm256_unpacklo_epi32(weights_t, weights_t));
+    const __m256i sum23 = _mm256_madd_epi16(_mm256_unpackhi_epi16(top, bottom),
+                                            _mm256_unpackhi_epi32(weights_t, weights_t));
+    const __m256i result =
+        _mm256_packus_epi32(_mm256_srli_epi32(sum01, 14), _mm256_srli_epi32(sum23, 14));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(samples + i),
+                     _mm_or_si128(_mm256_castsi256_si128(result),
+                                  _mm_slli_epi16(_mm256_extracti128_si256(result, 1), 8)));
+  }
+}
+
+FUNCTION_TARGET_SSR41
+static void LerpMipsSpan_SSE41(const u32* base_mip, const u32* next_mip, s32 lod_fract,
+                               u32* samples, size_t count)
+{
+  const __m128i even_mask = _mm_set1_epi32(0x00FF00FF);
+  const __m128i weight0 = _mm_set1_epi16(static_cast<s16>(16 - lod_fract));
+  const __m128i weight1 = _mm_set1_epi16(static_cast<s16>(lod_fract));
+  for (size_t i = 0; i < count; i += 4)
+  {
+    const __m128i base = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base_mip + i));
+    const __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(next_mip + i));
+    const __m128i even = LerpTexels(_mm_and_si128(base, even_mask), _mm_and_si128(next, even_mask),
+                                    weight0, weight1);
+    const __m128i odd =
+        LerpTexels(_mm_srli_epi16(base, 8), _mm_srli_epi16(next, 8), weight0, weight1);
+    const __m128i result =
+        _mm_or_si128(_mm_srli_epi16(even, 4), _mm_slli_epi16(_mm_srli_epi16(odd, 4), 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(samples + i), result);
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static DOLPHIN_FORCE_INLINE __m256i LerpMips_AVX2(__m256i base, __m256i next, __m256i weight0,
+                                                  __m256i weight1)
+{
+  const __m256i even_mask = _mm256_set1_epi32(0x00FF00FF);
+  const __m256i even =
+      _mm256_add_epi16(_mm256_mullo_epi16(_mm256_and_si256(base, even_mask), weight0),
+                       _mm256_mullo_epi16(_mm256_and_si256(next, even_mask), weight1));
+  const __m256i odd = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_srli_epi16(base, 8), weight0),
+                                       _mm256_mullo_epi16(_mm256_srli_epi16(next, 8), weight1));
+  return _mm256_or_si256(_mm256_srli_epi16(even, 4),
+                         _mm256_slli_epi16(_mm256_srli_epi16(odd, 4), 8));
+}
+
+FUNCTION_TARGET_AVX2
+static void LerpMipsSpan_AVX2(const u32* base_mip, const u32* next_mip, s32 lod_fract,
+                              u32* samples, size_t count)
+{
+  const __m256i weight0 = _mm256_set1_epi16(static_cast<s16>(16 - lod_fract));
+  const __m256i weight1 = _mm256_set1_epi16(static_cast<s16>(lod_fract));
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m256i base = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(base_mip + i));
+    const __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(next_mip + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(samples + i),
+                        LerpMips_AVX2(base, next, weight0, weight1));
+  }
+
+  // A single quad only fills the low half of a vector
+  if (i < count)
+  {
+    const __m256i base =
+        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(base_mip + i)));
+    const __m256i next =
+        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(next_mip + i)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(samples + i),
+                     _mm256_castsi256_si128(LerpMips_AVX2(base, next, weight0, weight1)));
+  }
+}
+#endif
+
+void BilinearFilterSpan(const std::array<const u32*, 4>& texels, const s32* fract_s,
+                        const s32* fract_t, u32* samples, size_t count)
+{
+#if defined(_M_X86_64)
+  if (cpu_info.bAVX2)
+    return BilinearFilterSpan_AVX2(texels, fract_s, fract_t, samples, count);
+  if (cpu_info.bSSE4_1)
+    return BilinearFilterSpan_SSE41(texels, fract_s, fract_t, samples, count);
+#endif
+
+  for (size_t i = 0; i < count; i++)
+  {
+    u8 pixel_texels[4][4];
+    for (int j = 0; j < 4; j++)
+      std::memcpy(pixel_texels[j], &texels[j][i], sizeof(u32));
+    BilinearFilter(pixel_texels, fract_s[i], fract_t[i], reinterpret_cast<u8*>(&samples[i]));
+  }
+}
+
+void LerpMipsSpan(const u32* base_mip, const u32* next_mip, s32 lod_fract, u32* samples,
+                  size_t count)
+{
+#if defined(_M_X86_64)
+  if (cpu_info.bAVX2)
+    return LerpMipsSpan_AVX2(base_mip, next_mip, lod_fract, samples, count);
+  if (cpu_info.bSSE4_1)
+    return LerpMipsSpan_SSE41(base_mip, next_mip, lod_fract, samples, count);
+#endif
+
+  for (size_t i = 0; i < count; i++)
+  {
+    LerpMips(reinterpret_cast<const u8*>(&base_mip[i]), reinterpret_cast<const u8*>(&next_mip[i]),
+             lod_fract, reinterpret_cast<u8*>(&samples[i]));
+  }
+}
+
+void Sample(const s32 s[QUAD_SIZE], const s32 t[QUAD_SIZE], s32 lod, bool linear, u8 texmap,
+            u32 samples[QUAD_SIZE])
 {
   int baseMip = 0;
   bool mipLinear = false;
@@ -93,28 +333,22 @@ void Sample(s32 s, s32 t, s32 lod, bool linear, u8 texmap, u8* sample)
 
   if (mipLinear)
   {
-    u8 sampledTex[4];
-    u32 texel[4];
-
-    SampleMip(s, t, baseMip, linear, texmap, sampledTex);
-    SetTexel(sampledTex, texel, (16 - lodFract));
+    u32 sampledTex[2][QUAD_SIZE];
 
-    SampleMip(s, t, baseMip + 1, linear, texmap, sampledTex);
-    AddTexel(sampledTex, texel, lodFract);
+    SampleMip(s, t, baseMip, linear, texmap, sampledTex[0]);
+    SampleMip(s, t, baseMip + 1, linear, texmap, sampledTex[1]);
 
-    sample[0] = (u8)(texel[0] >> 4);
-    sample[1] = (u8)(texel[1] >> 4);
-    sample[2] = (u8)(texel[2] >> 4);
-    sample[3] = (u8)(texel[3] >> 4);
+    LerpMipsSpan(sampledTex[0], sampledTex[1], lodFract, samples, QUAD_SIZE);
   }
   else
 #endif
   {
-    SampleMip(s, t, baseMip, linear, texmap, sample);
+    SampleMip(s, t, baseMip, linear, texmap, samples);
   }
 }
 
-void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
+void SampleMip(const s32 s[QUAD_SIZE], const s32 t[QUAD_SIZE], s32 mip, bool linear, u8 texmap,
+               u32 samples[QUAD_SIZE])
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -147,8 +381,9 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
   const int tlutAddress = texTlut.tmem_offset << 9;
   const std::span<const u8> tlut = TexDecoder_GetTmemSpan(tlutAddress);
 
-  // reduce sample location and texture size to mip level
+  // reduce texture size to mip level
   // move texture pointer to mip location
+  const int mip_shift = mip;
   if (mip)
   {
     int mipWidth = image_width_minus_1 + 1;
@@ -160,8 +395,6 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
 
     image_width_minus_1 >>= mip;
     image_height_minus_1 >>= mip;
-    s >>= mip;
-    t >>= mip;
 
     while (mip)
     {
@@ -176,92 +409,72 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
     }
   }
 
-  if (linear)
-  {
-    // offset linear sampling
-    s -= 64;
-    t -= 64;
-
-    // integer part of sample location
-    int imageS = s >> 7;
-    int imageT = t >> 7;
-
-    // linear sampling
-    int imageSPlus1 = imageS + 1;
-    const int fractS = s & 0x7f;
-
-    int imageTPlus1 = imageT + 1;
-    const int fractT = t & 0x7f;
-
-    u8 sampledTex[4];
-    u32 texel[4];
-
-    WrapCoord(&imageS, tm0.wrap_s, image_width_minus_1 + 1);
-    WrapCoord(&imageT, tm0.wrap_t, image_height_minus_1 + 1);
-    WrapCoord(&imageSPlus1, tm0.wrap_s, image_width_minus_1 + 1);
-    WrapCoord(&imageTPlus1, tm0.wrap_t, image_height_minus_1 + 1);
-
-    if (!(texfmt == TextureFormat::RGBA8 && texUnit.texImage1.cache_manually_managed))
+  const bool from_tmem_rgba8 =
+      texfmt == TextureFormat::RGBA8 && texUnit.texImage1.cache_manually_managed;
+  const auto decode_texel = [&](u32* texel, int imageS, int imageT) {
+    if (!from_tmem_rgba8)
     {
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageS, imageT, image_width_minus_1, texfmt,
-                             tlut, tlutfmt);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageSPlus1, imageT, image_width_minus_1,
-                             texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageS, imageTPlus1, image_width_minus_1,
-                             texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageSPlus1, imageTPlus1, image_width_minus_1,
-                             texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
+      TexDecoder_DecodeTexel(reinterpret_cast<u8*>(texel), image_src, imageS, imageT,
+                             image_width_minus_1, texfmt, tlut, tlutfmt);
     }
     else
     {
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageS, imageT,
-                                          image_width_minus_1);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageSPlus1, imageT,
-                                          image_width_minus_1);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
+      TexDecoder_DecodeTexelRGBA8FromTmem(reinterpret_cast<u8*>(texel), image_src, image_src_odd,
+                                          imageS, imageT, image_width_minus_1);
+    }
+  };
 
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageS, imageTPlus1,
-                                          image_width_minus_1);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
+  if (linear)
+  {
+    // (s, t), (s + 1, t), (s, t + 1) and (s + 1, t + 1) of each pixel
+    u32 sampledTex[4][QUAD_SIZE];
+    s32 fractS[QUAD_SIZE];
+    s32 fractT[QUAD_SIZE];
 
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageSPlus1,
-                                          imageTPlus1, image_width_minus_1);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
+    for (int i = 0; i < QUAD_SIZE; i++)
+    {
+      // reduce sample location to mip level, and offset linear sampling
+      const s32 pixel_s = (s[i] >> mip_shift) - 64;
+      const s32 pixel_t = (t[i] >> mip_shift) - 64;
+
+      // integer part of sample location
+      int imageS = pixel_s >> 7;
+      int imageT = pixel_t >> 7;
+
+      // linear sampling
+      int imageSPlus1 = imageS + 1;
+      fractS[i] = pixel_s & 0x7f;
+
+      int imageTPlus1 = imageT + 1;
+      fractT[i] = pixel_t & 0x7f;
+
+      WrapCoord(&imageS, tm0.wrap_s, image_width_minus_1 + 1);
+      WrapCoord(&imageT, tm0.wrap_t, image_height_minus_1 + 1);
+      WrapCoord(&imageSPlus1, tm0.wrap_s, image_width_minus_1 + 1);
+      WrapCoord(&imageTPlus1, tm0.wrap_t, image_height_minus_1 + 1);
+
+      decode_texel(&sampledTex[0][i], imageS, imageT);
+      decode_texel(&sampledTex[1][i], imageSPlus1, imageT);
+      decode_texel(&sampledTex[2][i], imageS, imageTPlus1);
+      decode_texel(&sampledTex[3][i], imageSPlus1, imageTPlus1);
     }
 
-    sample[0] = (u8)(texel[0] >> 14);
-    sample[1] = (u8)(texel[1] >> 14);
-    sample[2] = (u8)(texel[2] >> 14);
-    sample[3] = (u8)(texel[3] >> 14);
+    BilinearFilterSpan({sampledTex[0], sampledTex[1], sampledTex[2], sampledTex[3]}, fractS,
+                       fractT, samples, QUAD_SIZE);
   }
   else
   {
-    // integer part of sample location
-    int imageS = s >> 7;
-    int imageT = t >> 7;
+    for (int i = 0; i < QUAD_SIZE; i++)
+    {
+      // integer part of sample location
+      int imageS = (s[i] >> mip_shift) >> 7;
+      int imageT = (t[i] >> mip_shift) >> 7;
 
-    // nearest neighbor sampling
-    WrapCoord(&imageS, tm0.wrap_s, image_width_minus_1 + 1);
-    WrapCoord(&imageT, tm0.wrap_t, image_height_minus_1 + 1);
+      // nearest neighbor sampling
+      WrapCoord(&imageS, tm0.wrap_s, image_width_minus_1 + 1);
+      WrapCoord(&imageT, tm0.wrap_t, image_height_minus_1 + 1);
 
-    if (!(texfmt == TextureFormat::RGBA8 && texUnit.texImage1.cache_manually_managed))
-    {
-      TexDecoder_DecodeTexel(sample, image_src, imageS, imageT, image_width_minus_1, texfmt, tlut,
-                             tlutfmt);
-    }
-    else
-    {
-      TexDecoder_DecodeTexelRGBA8FromTmem(sample, image_src, image_src_odd, imageS, imageT,
-                                          image_width_minus_1);
+      decode_texel(&samples[i], imageS, imageT);
     }
   }
 }
@@ -3,13 +3,41 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+
 #include "Common/CommonTypes.h"
 
 namespace TextureSampler
 {
-void Sample(s32 s, s32 t, s32 lod, bool linear, u8 texmap, u8* sample);
+// The pixels of a 2x2 quad are sampled together, as they share the LOD and are close enough to
+// each other that filtering them at once pays off.
+constexpr int QUAD_SIZE = 4;
+
+// Samples the texture at the locations of the pixels of a quad. Each sample is RGBA8, packed in
+// memory order.
+void Sample(const s32 s[QUAD_SIZE], const s32 t[QUAD_SIZE], s32 lod, bool linear, u8 texmap,
+            u32 samples[QUAD_SIZE]);
+
+void SampleMip(const s32 s[QUAD_SIZE], const s32 t[QUAD_SIZE], s32 mip, bool linear, u8 texmap,
+               u32 samples[QUAD_SIZE]);
+
+// Blends the texels at (s, t), (s + 1, t), (s, t + 1) and (s + 1, t + 1) with the given 7-bit
+// fractions of the sample location. This is the scalar reference for BilinearFilterSpan.
+void BilinearFilter(const u8 texels[4][4], s32 fract_s, s32 fract_t, u8* sample);
+
+// Blends samples from two neighbouring mip levels with the given 4-bit fraction of the LOD. This is
+// the scalar reference for LerpMipsSpan.
+void LerpMips(const u8* base_mip, const u8* next_mip, s32 lod_fract, u8* sample);
+
+// Bilinear filtering of count pixels at once, where count is a multiple of QUAD_SIZE. texels[i]
+// holds the i-th texel (in the order of BilinearFilter) of every pixel.
+void BilinearFilterSpan(const std::array<const u32*, 4>& texels, const s32* fract_s,
+                        const s32* fract_t, u32* samples, size_t count);
 
-void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample);
+// Blends count samples from two mip levels at once, where count is a multiple of QUAD_SIZE.
+void LerpMipsSpan(const u32* base_mip, const u32* next_mip, s32 lod_fract, u32* samples,
+                  size_t count);
 
 enum
 {
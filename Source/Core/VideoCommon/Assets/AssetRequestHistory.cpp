@@ -0,0 +1,94 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/AssetRequestHistory.h"
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+
+namespace VideoCommon
+{
+bool AssetRequestHistory::Load(const std::string& path)
+{
+  Clear();
+
+  std::string contents;
+  if (!File::ReadFileToString(path, contents))
+    return false;
+
+  std::istringstream stream(contents);
+  std::string line;
+  while (std::getline(stream, line))
+  {
+    auto ids = SplitString(line, '\t');
+    std::erase(ids, "");
+    if (ids.size() < 2)
+      continue;
+
+    auto& successors = m_successors[ids.front()];
+    successors.assign(std::make_move_iterator(ids.begin() + 1), std::make_move_iterator(ids.end()));
+    if (successors.size() > MAX_SUCCESSORS)
+      successors.resize(MAX_SUCCESSORS);
+  }
+
+  return true;
+}
+
+bool AssetRequestHistory::Save(const std::string& path) const
+{
+  std::string contents;
+  for (const auto& [asset_id, successors] : m_successors)
+  {
+    if (successors.empty())
+      continue;
+
+    contents += asset_id;
+    for (const auto& successor : successors)
+    {
+      contents += '\t';
+      contents += successor;
+    }
+    contents += '\n';
+  }
+
+  return File::CreateFullPath(path) && File::WriteStringToFile(path, contents);
+}
+
+void AssetRequestHistory::Clear()
+{
+  m_successors.clear();
+  m_recent_requests.clear();
+  m_dirty = false;
+}
+
+const std::vector<CustomAssetLibrary::AssetID>&
+AssetRequestHistory::RecordRequest(const CustomAssetLibrary::AssetID& asset_id)
+{
+  for (const auto& previous_id : m_recent_requests)
+  {
+    auto& successors = m_successors[previous_id];
+
+    if (!successors.empty() && successors.front() == asset_id)
+      continue;
+
+    // Move the asset to the front, so that the assets which followed most recently are kept.
+    const auto it = std::ranges::find(successors, asset_id);
+    if (it != successors.end())
+      successors.erase(it);
+    else if (successors.size() == MAX_SUCCESSORS)
+      successors.pop_back();
+    successors.insert(successors.begin(), asset_id);
+    m_dirty = true;
+  }
+
+  m_recent_requests.push_back(asset_id);
+  if (m_recent_requests.size() > WINDOW_SIZE)
+    m_recent_requests.pop_front();
+
+  return m_successors[asset_id];
+}
+}  // namespace VideoCommon
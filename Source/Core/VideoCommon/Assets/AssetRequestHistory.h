@@ -0,0 +1,48 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
+
+namespace VideoCommon
+{
+// Remembers which assets a game first requested shortly after each other, so that the next time
+// one of them is requested, the ones which followed it can be loaded before the game needs them.
+// The history is meant to be kept per game, in a text file with one line per asset:
+// the asset id followed by the ids of the assets which followed it, most recent first,
+// separated by tabs.
+class AssetRequestHistory
+{
+public:
+  // How many of the previously requested assets a new request is recorded as following.
+  static constexpr size_t WINDOW_SIZE = 8;
+
+  // How many following assets are remembered for each asset.
+  static constexpr size_t MAX_SUCCESSORS = 16;
+
+  bool Load(const std::string& path);
+  bool Save(const std::string& path) const;
+  void Clear();
+
+  bool IsDirty() const { return m_dirty; }
+
+  // Records the first request of an asset in this session, and returns the assets which
+  // followed it before.
+  const std::vector<CustomAssetLibrary::AssetID>&
+  RecordRequest(const CustomAssetLibrary::AssetID& asset_id);
+
+private:
+  std::map<CustomAssetLibrary::AssetID, std::vector<CustomAssetLibrary::AssetID>> m_successors;
+
+  // The assets which were requested last, most recent last.
+  std::deque<CustomAssetLibrary::AssetID> m_recent_requests;
+
+  bool m_dirty = false;
+};
+}  // namespace VideoCommon
@@ -63,6 +63,11 @@ void CustomAssetCache::MarkAssetActive(CustomAsset* asset)
   m_active_assets.MakeAssetHighestPriority(asset->GetHandle(), asset);
 }
 
+void CustomAssetCache::MarkAssetPrefetched(CustomAsset* asset)
+{
+  m_pending_assets.InsertAsset(asset->GetHandle(), asset);
+}
+
 void CustomAssetCache::Update()
 {
   ProcessDirtyAssets();
@@ -93,6 +93,11 @@ public:
   // it has seen activity
   void MarkAssetActive(CustomAsset* asset);
 
+  // Notify the system that this asset will likely be needed soon.
+  // It is loaded after all the assets that were actually requested,
+  // and only if there is memory left for it
+  void MarkAssetPrefetched(CustomAsset* asset);
+
   void Update();
 
 private:
@@ -0,0 +1,293 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TexturePack.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include <xxhash.h>
+#include <zstd.h>
+
+#include "Common/Align.h"
+#include "Common/Logging/Log.h"
+#include "VideoCommon/AbstractTexture.h"
+
+namespace VideoCommon
+{
+namespace
+{
+// Level data is aligned, so that copying it out of the mapping is as fast as it can be.
+constexpr u64 DATA_ALIGNMENT = 64;
+
+template <typename T>
+bool IsValidRange(std::span<const u8> file, u64 offset, u64 count)
+{
+  return offset % alignof(T) == 0 && offset <= file.size() &&
+         count <= (file.size() - offset) / sizeof(T);
+}
+
+template <typename T>
+std::span<const T> GetRecords(std::span<const u8> file, u64 offset, u64 count)
+{
+  return {reinterpret_cast<const T*>(file.data() + offset), static_cast<size_t>(count)};
+}
+
+// The number of bytes the GPU upload reads for the level.
+u64 GetRequiredSize(const TexturePack::LevelRecord& level)
+{
+  const auto format = static_cast<AbstractTextureFormat>(level.format);
+  const u64 rows = AbstractTexture::IsCompressedFormat(format) ? (u64{level.height} + 3) / 4 :
+                                                                 u64{level.height};
+  return u64{AbstractTexture::CalculateStrideForFormat(format, level.row_length)} * rows;
+}
+
+bool IsValidLevel(std::span<const u8> file, const TexturePack::LevelRecord& level)
+{
+  if (level.format >= static_cast<u8>(AbstractTextureFormat::Undefined) || level.width == 0 ||
+      level.height == 0 || level.row_length < level.width)
+  {
+    return false;
+  }
+
+  if (level.data_offset > file.size() || level.stored_size > file.size() - level.data_offset)
+    return false;
+
+  // The decoded size is allocated before decompressing, so it must be exactly what the level needs
+  // rather than whatever the index says.
+  if (level.size != GetRequiredSize(level))
+    return false;
+
+  switch (level.compression)
+  {
+  case TexturePack::Compression::None:
+    return level.stored_size == level.size;
+  case TexturePack::Compression::Zstd:
+    return true;
+  default:
+    return false;
+  }
+}
+}  // namespace
+
+u64 TexturePack::HashName(std::string_view name)
+{
+  return XXH3_64bits(name.data(), name.size());
+}
+
+bool TexturePackReader::Open(const std::string& path)
+{
+  m_textures = {};
+  m_levels = {};
+  m_names = {};
+
+  if (!m_file.Open(path))
+    return false;
+
+  const std::span<const u8> file = m_file.GetData();
+  TexturePack::Header header;
+  if (file.size() < sizeof(header))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is too small", path);
+    m_file.Close();
+    return false;
+  }
+  std::memcpy(&header, file.data(), sizeof(header));
+
+  if (header.magic != TexturePack::MAGIC || header.version != TexturePack::VERSION)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has an unknown format", path);
+    m_file.Close();
+    return false;
+  }
+
+  if (!IsValidRange<TexturePack::TextureRecord>(file, header.textures_offset,
+                                                header.num_textures) ||
+      !IsValidRange<TexturePack::LevelRecord>(file, header.levels_offset, header.num_levels) ||
+      !IsValidRange<char>(file, header.names_offset, header.names_size))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is truncated", path);
+    m_file.Close();
+    return false;
+  }
+
+  const auto textures = GetRecords<TexturePack::TextureRecord>(file, header.textures_offset,
+                                                               header.num_textures);
+  const auto levels =
+      GetRecords<TexturePack::LevelRecord>(file, header.levels_offset, header.num_levels);
+  const std::string_view names(reinterpret_cast<const char*>(file.data() + header.names_offset),
+                               header.names_size);
+
+  const bool valid_textures = std::ranges::all_of(textures, [&](const auto& texture) {
+    return texture.num_levels != 0 && texture.first_level <= levels.size() &&
+           texture.num_levels <= levels.size() - texture.first_level &&
+           texture.name_offset <= names.size() &&
+           texture.name_size <= names.size() - texture.name_offset;
+  });
+  const bool valid_levels =
+      std::ranges::all_of(levels, [&](const auto& level) { return IsValidLevel(file, level); });
+  const bool sorted = std::ranges::is_sorted(textures, {}, &TexturePack::TextureRecord::name_hash);
+  if (!valid_textures || !valid_levels || !sorted)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has an invalid index", path);
+    m_file.Close();
+    return false;
+  }
+
+  m_textures = textures;
+  m_levels = levels;
+  m_names = names;
+  return true;
+}
+
+const TexturePack::TextureRecord* TexturePackReader::Find(std::string_view name) const
+{
+  const auto range = std::ranges::equal_range(m_textures, TexturePack::HashName(name), {},
+                                              &TexturePack::TextureRecord::name_hash);
+  const auto it = std::ranges::find_if(
+      range, [&](const auto& texture) { return GetName(texture) == name; });
+  return it != range.end() ? &*it : nullptr;
+}
+
+std::string_view TexturePackReader::GetName(const TexturePack::TextureRecord& texture) const
+{
+  return m_names.substr(texture.name_offset, texture.name_size);
+}
+
+bool TexturePackReader::LoadTexture(const TexturePack::TextureRecord& texture,
+                                    CustomTextureData* data) const
+{
+  const std::span<const u8> file = m_file.GetData();
+
+  data->m_slices.clear();
+  auto& slice = data->m_slices.emplace_back();
+  for (const auto& record : m_levels.subspan(texture.first_level, texture.num_levels))
+  {
+    auto& level = slice.m_levels.emplace_back();
+    level.format = static_cast<AbstractTextureFormat>(record.format);
+    level.width = record.width;
+    level.height = record.height;
+    level.row_length = record.row_length;
+    level.data.reset(record.size);
+
+    const u8* const stored = file.data() + record.data_offset;
+    if (record.compression == TexturePack::Compression::None)
+    {
+      std::memcpy(level.data.data(), stored, record.size);
+      continue;
+    }
+
+    const size_t decompressed_size =
+        ZSTD_decompress(level.data.data(), level.data.size(), stored, record.stored_size);
+    if (ZSTD_isError(decompressed_size) || decompressed_size != record.size)
+    {
+      ERROR_LOG_FMT(VIDEO, "Texture '{}' in texture pack failed to decompress", GetName(texture));
+      data->m_slices.clear();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool TexturePackWriter::Open(const std::string& path, int compression_level)
+{
+  m_compression_level = compression_level;
+  m_textures.clear();
+  m_levels.clear();
+  m_names.clear();
+  m_added_names.clear();
+
+  // The header is written by Finish, once the offsets are known.
+  if (!m_file.Open(path, "wb"))
+    return false;
+  const TexturePack::Header header{};
+  return m_file.WriteArray(&header, 1);
+}
+
+bool TexturePackWriter::AddTexture(std::string_view name, bool has_arbitrary_mipmaps,
+                                   const CustomTextureData& data)
+{
+  if (data.m_slices.empty() || data.m_slices[0].m_levels.empty() ||
+      !m_added_names.emplace(name).second)
+  {
+    return false;
+  }
+
+  const auto& levels = data.m_slices[0].m_levels;
+  TexturePack::TextureRecord texture{};
+  texture.name_hash = TexturePack::HashName(name);
+  texture.name_offset = static_cast<u32>(m_names.size());
+  texture.name_size = static_cast<u32>(name.size());
+  texture.first_level = static_cast<u32>(m_levels.size());
+  texture.num_levels = static_cast<u16>(levels.size());
+  texture.has_arbitrary_mipmaps = has_arbitrary_mipmaps;
+
+  std::vector<u8> compressed;
+  for (const auto& level : levels)
+  {
+    const u64 offset = Common::AlignUp(m_file.Tell(), DATA_ALIGNMENT);
+    if (!m_file.Seek(static_cast<s64>(offset), File::SeekOrigin::Begin))
+      return false;
+
+    TexturePack::LevelRecord record{};
+    record.data_offset = offset;
+    record.size = level.data.size();
+    record.width = level.width;
+    record.height = level.height;
+    record.row_length = level.row_length;
+    record.format = static_cast<u8>(level.format);
+    record.compression = TexturePack::Compression::None;
+
+    std::span<const u8> stored(level.data.data(), level.data.size());
+    if (m_compression_level > 0)
+    {
+      compressed.resize(ZSTD_compressBound(level.data.size()));
+      const size_t compressed_size = ZSTD_compress(compressed.data(), compressed.size(),
+                                                   level.data.data(), level.data.size(),
+                                                   m_compression_level);
+
+      // Levels which don't get smaller are stored as they are, as they load faster that way.
+      if (!ZSTD_isError(compressed_size) && compressed_size < level.data.size())
+      {
+        stored = std::span(compressed.data(), compressed_size);
+        record.compression = TexturePack::Compression::Zstd;
+      }
+    }
+
+    record.stored_size = stored.size();
+    if (!m_file.WriteBytes(stored.data(), stored.size()))
+      return false;
+    m_levels.push_back(record);
+  }
+
+  m_names.append(name);
+  m_textures.push_back(texture);
+  return true;
+}
+
+bool TexturePackWriter::Finish()
+{
+  std::ranges::stable_sort(m_textures, {}, &TexturePack::TextureRecord::name_hash);
+
+  TexturePack::Header header{};
+  header.magic = TexturePack::MAGIC;
+  header.version = TexturePack::VERSION;
+  header.num_textures = static_cast<u32>(m_textures.size());
+  header.num_levels = static_cast<u32>(m_levels.size());
+  header.textures_offset = Common::AlignUp(m_file.Tell(), alignof(TexturePack::TextureRecord));
+  header.levels_offset =
+      header.textures_offset + m_textures.size() * sizeof(TexturePack::TextureRecord);
+  header.names_offset = header.levels_offset + m_levels.size() * sizeof(TexturePack::LevelRecord);
+  header.names_size = m_names.size();
+
+  const bool success =
+      m_file.Seek(static_cast<s64>(header.textures_offset), File::SeekOrigin::Begin) &&
+      m_file.WriteArray(m_textures.data(), m_textures.size()) &&
+      m_file.WriteArray(m_levels.data(), m_levels.size()) &&
+      m_file.WriteBytes(m_names.data(), m_names.size()) &&
+      m_file.Seek(0, File::SeekOrigin::Begin) && m_file.WriteArray(&header, 1);
+  return m_file.Close() && success;
+}
+}  // namespace VideoCommon
@@ -0,0 +1,126 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "Common/MappedFile.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+
+namespace VideoCommon
+{
+// A texture pack in a single file, so that the textures don't have to be searched for and opened
+// one by one. The levels are stored as they are after loading the PNG or DDS files (so they don't
+// have to be decoded again), optionally compressed with zstd, and are looked up through an index
+// which is sorted by the hash of the texture names.
+//
+// Layout: Header, level data, TextureRecord[num_textures], LevelRecord[num_levels], names.
+// All values are little endian.
+namespace TexturePack
+{
+constexpr u32 MAGIC = 0x31505444;  // "DTP1"
+constexpr u32 VERSION = 1;
+constexpr std::string_view FILE_EXTENSION = ".dtp";
+
+enum class Compression : u8
+{
+  None,
+  Zstd,
+};
+
+struct Header
+{
+  u32 magic;
+  u32 version;
+  u32 num_textures;
+  u32 num_levels;
+  u64 textures_offset;
+  u64 levels_offset;
+  u64 names_offset;
+  u64 names_size;
+};
+static_assert(sizeof(Header) == 48);
+
+// Sorted by name_hash, textures with the same hash in no particular order.
+struct TextureRecord
+{
+  u64 name_hash;
+  u32 name_offset;
+  u32 name_size;
+  u32 first_level;
+  u16 num_levels;
+  u8 has_arbitrary_mipmaps;
+  u8 padding;
+};
+static_assert(sizeof(TextureRecord) == 24);
+
+struct LevelRecord
+{
+  u64 data_offset;
+  u64 stored_size;
+  u64 size;
+  u32 width;
+  u32 height;
+  u32 row_length;
+  u8 format;  // AbstractTextureFormat
+  Compression compression;
+  u16 padding;
+};
+static_assert(sizeof(LevelRecord) == 40);
+
+u64 HashName(std::string_view name);
+}  // namespace TexturePack
+
+class TexturePackReader
+{
+public:
+  // Maps the pack and validates its index, so that none of the other functions can read outside
+  // of the file.
+  bool Open(const std::string& path);
+
+  // Binary search through the index.
+  const TexturePack::TextureRecord* Find(std::string_view name) const;
+
+  std::span<const TexturePack::TextureRecord> GetTextures() const { return m_textures; }
+  std::string_view GetName(const TexturePack::TextureRecord& texture) const;
+
+  // Uncompressed levels are copied straight from the mapping, compressed ones are decompressed
+  // from it. Returns false if a level fails to decompress.
+  bool LoadTexture(const TexturePack::TextureRecord& texture, CustomTextureData* data) const;
+
+private:
+  File::MappedFile m_file;
+  std::span<const TexturePack::TextureRecord> m_textures;
+  std::span<const TexturePack::LevelRecord> m_levels;
+  std::string_view m_names;
+};
+
+class TexturePackWriter
+{
+public:
+  // Levels are compressed with the given zstd level, or stored as they are if it is 0.
+  bool Open(const std::string& path, int compression_level);
+
+  // Only the first slice of the data is stored. Returns false if the name was already added or
+  // the data couldn't be written.
+  bool AddTexture(std::string_view name, bool has_arbitrary_mipmaps, const CustomTextureData& data);
+
+  // Writes the index. The pack can't be read before this is called.
+  bool Finish();
+
+private:
+  File::IOFile m_file;
+  int m_compression_level = 0;
+  std::vector<TexturePack::TextureRecord> m_textures;
+  std::vector<TexturePack::LevelRecord> m_levels;
+  std::string m_names;
+  std::unordered_set<std::string> m_added_names;
+};
+}  // namespace VideoCommon
@@ -0,0 +1,100 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
+
+#include "Common/Logging/Log.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/RenderState.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace VideoCommon
+{
+namespace
+{
+std::size_t GetAssetSize(const CustomTextureData& data)
+{
+  std::size_t total = 0;
+  for (const auto& slice : data.m_slices)
+  {
+    for (const auto& level : slice.m_levels)
+    {
+      total += level.data.size();
+    }
+  }
+  return total;
+}
+
+// Compressed DDS textures are stored as they are, so unlike when loading the DDS file, there's no
+// fallback for backends which don't support their format.
+bool IsFormatSupported(AbstractTextureFormat format)
+{
+  switch (format)
+  {
+  case AbstractTextureFormat::DXT1:
+  case AbstractTextureFormat::DXT3:
+  case AbstractTextureFormat::DXT5:
+    return g_backend_info.bSupportsST3CTextures;
+  case AbstractTextureFormat::BPTC:
+    return g_backend_info.bSupportsBPTCTextures;
+  default:
+    return true;
+  }
+}
+}  // namespace
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                  CustomTextureData* data)
+{
+  const TexturePack::TextureRecord* texture = m_reader.Find(asset_id);
+  if (!texture)
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture not found in texture pack!", asset_id);
+    return {};
+  }
+
+  if (!m_reader.LoadTexture(*texture, data))
+    return {};
+
+  for (const auto& level : data->m_slices[0].m_levels)
+  {
+    if (!IsFormatSupported(level.format))
+    {
+      ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture format is not supported by the backend!",
+                    asset_id);
+      return {};
+    }
+  }
+
+  return LoadInfo{GetAssetSize(*data)};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                  TextureAndSamplerData* data)
+{
+  // Packs don't store any metadata, so use the same defaults as a texture without a metadata file
+  data->sampler = RenderState::GetLinearSamplerState();
+  data->type = AbstractTextureType::Texture_2D;
+  return LoadTexture(asset_id, &data->texture_data);
+}
+
+CustomAssetLibrary::LoadInfo
+TexturePackAssetLibrary::LoadRasterSurfaceShader(const AssetID& asset_id, RasterSurfaceShaderData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs can't contain shaders!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMaterial(const AssetID& asset_id,
+                                                                   MaterialData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs can't contain materials!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMesh(const AssetID& asset_id, MeshData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs can't contain meshes!", asset_id);
+  return {};
+}
+}  // namespace VideoCommon
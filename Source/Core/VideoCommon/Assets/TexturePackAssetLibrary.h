@@ -0,0 +1,31 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
+#include "VideoCommon/Assets/TexturePack.h"
+
+namespace VideoCommon
+{
+// This class implements 'CustomAssetLibrary' and loads textures from a texture pack file,
+// using the texture names as asset ids. Packs only contain textures, so all other assets fail
+// to load.
+class TexturePackAssetLibrary final : public CustomAssetLibrary
+{
+public:
+  bool Open(const std::string& path) { return m_reader.Open(path); }
+  const TexturePackReader& GetReader() const { return m_reader; }
+
+  LoadInfo LoadTexture(const AssetID& asset_id, TextureAndSamplerData* data) override;
+  LoadInfo LoadTexture(const AssetID& asset_id, CustomTextureData* data) override;
+  LoadInfo LoadRasterSurfaceShader(const AssetID& asset_id, RasterSurfaceShaderData* data) override;
+  LoadInfo LoadMaterial(const AssetID& asset_id, MaterialData* data) override;
+  LoadInfo LoadMesh(const AssetID& asset_id, MeshData* data) override;
+
+private:
+  TexturePackReader m_reader;
+};
+}  // namespace VideoCommon
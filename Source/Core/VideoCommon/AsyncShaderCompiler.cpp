@@ -73,6 +73,7 @@ void AsyncShaderCompiler::ClearAllWork()
   {
     std::lock_guard guard(m_pending_work_lock);
     m_pending_work.clear();
+    m_pending_work_taken.notify_all();
   }
 
   {
@@ -124,6 +125,17 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
   return false;
 }
 
+void AsyncShaderCompiler::WaitForPendingWork(size_t max_pending_items)
+{
+  if (!HasWorkerThreads())
+    return;
+
+  std::unique_lock pending_lock(m_pending_work_lock);
+  m_pending_work_taken.wait(pending_lock, [&] {
+    return m_pending_work.size() <= max_pending_items || m_exit_flag.IsSet();
+  });
+}
+
 bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
 {
   if (num_worker_threads == 0)
@@ -180,6 +192,7 @@ void AsyncShaderCompiler::StopWorkerThreads()
     std::lock_guard guard(m_pending_work_lock);
     m_exit_flag.Set();
     m_worker_thread_wake.notify_all();
+    m_pending_work_taken.notify_all();
   }
 
   // Wait for worker threads to exit.
@@ -237,6 +250,7 @@ void AsyncShaderCompiler::WorkerThreadRun()
       auto iter = m_pending_work.begin();
       WorkItemPtr item(std::move(iter->second));
       m_pending_work.erase(iter);
+      m_pending_work_taken.notify_all();
       pending_lock.unlock();
 
       if (item->Compile())
@@ -56,6 +56,10 @@ public:
   // Returns false if interrupted.
   bool WaitUntilCompletion(const std::function<void(size_t, size_t)>& progress_callback);
 
+  // Blocks until no more than max_pending_items are waiting for a worker thread.
+  // Used to bound the memory held by the work items when queueing a large amount of them.
+  void WaitForPendingWork(size_t max_pending_items);
+
   // Needed because of calling virtual methods in shutdown procedure.
   bool StartWorkerThreads(u32 num_worker_threads);
   bool ResizeWorkerThreads(u32 num_worker_threads);
@@ -82,6 +86,8 @@ private:
   std::multimap<u32, WorkItemPtr> m_pending_work;
   std::mutex m_pending_work_lock;
   std::condition_variable m_worker_thread_wake;
+  // Notified whenever items are removed from m_pending_work, for WaitForPendingWork
+  std::condition_variable m_pending_work_taken;
   std::atomic_size_t m_busy_workers{0};
 
   std::deque<WorkItemPtr> m_completed_work;
@@ -0,0 +1,71 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/AsyncTextureDecoder.h"
+
+#include <algorithm>
+#include <utility>
+
+void AsyncTextureDecoder::Job::Wait()
+{
+  // Only the GPU thread waits for a job, so the event is set at most once while someone waits.
+  if (!IsDone())
+    m_done.Wait();
+}
+
+void AsyncTextureDecoder::Job::DecodeLevel(Level& level) const
+{
+  level.decoded.resize(level.expanded_width * level.expanded_height * sizeof(u32));
+  TexDecoder_Decode(level.decoded.data(), level.encoded.data(), level.expanded_width,
+                    level.expanded_height, m_format, m_tlut.data(), m_tlut_format);
+
+  // The encoded data is not needed anymore, and the job may stay around until it is uploaded.
+  level.encoded = {};
+}
+
+void AsyncTextureDecoder::SetEnabled(bool enabled)
+{
+  if (enabled == IsEnabled())
+    return;
+
+  if (enabled)
+    m_workers.Reset("Texture Decoder", Common::ThreadPool::GetAutomaticThreadCount());
+  else
+    m_workers.Shutdown();
+}
+
+void AsyncTextureDecoder::WaitForCompletion()
+{
+  m_workers.WaitForCompletion();
+}
+
+std::shared_ptr<AsyncTextureDecoder::Job>
+AsyncTextureDecoder::Submit(TextureFormat format, TLUTFormat tlut_format, std::span<const u8> tlut,
+                            std::vector<Level> levels, size_t num_async_levels)
+{
+  auto job = std::make_shared<Job>();
+  job->m_format = format;
+  job->m_tlut_format = tlut_format;
+  job->m_tlut.assign(tlut.begin(), tlut.end());
+  job->m_levels = std::move(levels);
+  job->m_num_async_levels = std::min(num_async_levels, job->m_levels.size());
+  job->m_remaining_levels.store(job->m_num_async_levels, std::memory_order_relaxed);
+
+  for (size_t i = job->m_num_async_levels; i < job->m_levels.size(); ++i)
+    job->DecodeLevel(job->m_levels[i]);
+
+  if (job->m_num_async_levels == 0)
+    return job;
+
+  // Each level is pushed separately, and the biggest one first, as it takes the longest.
+  for (size_t i = 0; i < job->m_num_async_levels; ++i)
+  {
+    m_workers.Push([job, i] {
+      job->DecodeLevel(job->m_levels[i]);
+      if (job->m_remaining_levels.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        job->m_done.Set();
+    });
+  }
+
+  return job;
+}
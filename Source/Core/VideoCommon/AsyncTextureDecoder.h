@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/ThreadPool.h"
+#include "VideoCommon/TextureDecoder.h"
+
+// Decodes textures on worker threads, so that the GPU thread can keep drawing while large
+// textures are being decoded. The encoded data and palette are copied when a texture is
+// submitted, so emulated memory and TMEM may change while it is being decoded.
+class AsyncTextureDecoder
+{
+public:
+  struct Level
+  {
+    u32 level = 0;
+    u32 width = 0;
+    u32 height = 0;
+    u32 expanded_width = 0;
+    u32 expanded_height = 0;
+    std::vector<u8> encoded;
+    std::vector<u8> decoded;
+  };
+
+  // The levels of one texture. Each of the asynchronous levels is decoded by its own worker, so
+  // the levels of large mipmapped textures are decoded in parallel.
+  class Job
+  {
+  public:
+    bool IsDone() const { return m_remaining_levels.load(std::memory_order_acquire) == 0; }
+    void Wait();
+
+    // The levels past GetNumAsyncLevels() are decoded before Submit returns. The others may only
+    // be accessed once the job is done.
+    const std::vector<Level>& GetLevels() const { return m_levels; }
+    size_t GetNumAsyncLevels() const { return m_num_async_levels; }
+
+    // Whether some lower levels were decoded by Submit, so that draws can sample them until the
+    // asynchronous levels are done.
+    bool HasDecodedLowerLevels() const { return m_num_async_levels < m_levels.size(); }
+
+  private:
+    friend class AsyncTextureDecoder;
+
+    void DecodeLevel(Level& level) const;
+
+    TextureFormat m_format{};
+    TLUTFormat m_tlut_format{};
+    std::vector<u8> m_tlut;
+    std::vector<Level> m_levels;
+    size_t m_num_async_levels = 0;
+
+    std::atomic<size_t> m_remaining_levels = 0;
+    Common::Event m_done;
+  };
+
+  // Starts the workers, or stops them after finishing the queued levels.
+  void SetEnabled(bool enabled);
+  bool IsEnabled() const { return m_workers.IsRunning(); }
+
+  // Blocks until no level is being decoded anymore.
+  void WaitForCompletion();
+
+  // Decodes the first num_async_levels levels on the workers, and the remaining ones right away.
+  std::shared_ptr<Job> Submit(TextureFormat format, TLUTFormat tlut_format,
+                              std::span<const u8> tlut, std::vector<Level> levels,
+                              size_t num_async_levels);
+
+private:
+  Common::ThreadPool m_workers;
+};
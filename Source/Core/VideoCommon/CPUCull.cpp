@@ -3,13 +3,18 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <algorithm>
+#include <atomic>
+
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/MathUtil.h"
 #include "Common/MemoryUtil.h"
+#include "Common/ThreadPool.h"
 #include "Core/System.h"
 
 #include "VideoCommon/CPMemory.h"
+#include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/XFMemory.h"
@@ -52,10 +57,14 @@
 #include "VideoCommon/CPUCullImpl.h"
 #define USE_FMA
 #include "VideoCommon/CPUCullImpl.h"
+#define USE_AVX512
+#include "VideoCommon/CPUCullImpl.h"
 #endif
 
 #if defined(USE_SSE)
-#if defined(__AVX__) && defined(__FMA__)
+#if defined(__AVX512F__) && defined(__FMA__)
+static constexpr int MIN_SSE = 60;
+#elif defined(__AVX__) && defined(__FMA__)
 static constexpr int MIN_SSE = 51;
 #elif defined(__AVX__)
 static constexpr int MIN_SSE = 50;
@@ -69,10 +78,14 @@ static constexpr int MIN_SSE = 0;
 #endif
 
 template <bool PositionHas3Elems, bool PerVertexPosMtx>
-static CPUCull::TransformFunction GetTransformFunction()
+static CPUCull::TransformFunction GetTransformFunction(bool allow_avx512)
 {
 #if defined(USE_SSE)
-  if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
+  // AVX-512 hasn't been measured to be faster than FMA on every CPU with it, some of them lower
+  // their clocks while running it.  So it's only used when asked for (or when compiled for it).
+  if (MIN_SSE >= 60 || (allow_avx512 && cpu_info.bAVX512F && cpu_info.bFMA))
+    return CPUCull_AVX512::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
+  else if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
     return CPUCull_FMA::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
   else if (MIN_SSE >= 50 || cpu_info.bAVX)
     return CPUCull_AVX::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
@@ -119,14 +132,35 @@ static Common::EnumMap<CPUCull::CullFunction, CullMode::All> GetCullFunction1()
   };
 }
 
+// Large draws are transformed and culled in chunks of this many vertices on the vertex loader
+// threads.  It is a multiple of 4, 3 and 2, so every chunk starts at the first vertex of a quad,
+// a triangle or an even triangle of a strip, and can be culled on its own.
+static constexpr u32 PARALLEL_CHUNK_VERTICES = 3072;
+
 CPUCull::~CPUCull() = default;
 
+CPUCull::TransformFunction CPUCull::GetTransformFunction(bool position_has_3_elems,
+                                                         bool per_vertex_pos_mtx, bool allow_avx512)
+{
+  if (position_has_3_elems)
+  {
+    return per_vertex_pos_mtx ? ::GetTransformFunction<true, true>(allow_avx512) :
+                                ::GetTransformFunction<true, false>(allow_avx512);
+  }
+  return per_vertex_pos_mtx ? ::GetTransformFunction<false, true>(allow_avx512) :
+                              ::GetTransformFunction<false, false>(allow_avx512);
+}
+
 void CPUCull::Init()
 {
-  m_transform_table[false][false] = GetTransformFunction<false, false>();
-  m_transform_table[false][true] = GetTransformFunction<false, true>();
-  m_transform_table[true][false] = GetTransformFunction<true, false>();
-  m_transform_table[true][true] = GetTransformFunction<true, true>();
+  for (bool position_has_3_elems : {false, true})
+  {
+    for (bool per_vertex_pos_mtx : {false, true})
+    {
+      m_transform_table[position_has_3_elems][per_vertex_pos_mtx] =
+          GetTransformFunction(position_has_3_elems, per_vertex_pos_mtx, false);
+    }
+  }
   using Prim = OpcodeDecoder::Primitive;
   m_cull_table[Prim::GX_DRAW_QUADS] = GetCullFunction1<Prim::GX_DRAW_QUADS>();
   m_cull_table[Prim::GX_DRAW_QUADS_2] = GetCullFunction1<Prim::GX_DRAW_QUADS>();
@@ -148,7 +182,7 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
     u32 new_size = MathUtil::NextPowerOf2(count);
     m_transform_buffer_size = new_size;
     m_transform_buffer.reset(static_cast<TransformedVertex*>(
-        Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 32)));
+        Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 64)));
   }
 
   // transform functions need the projection matrix to transform to clip space
@@ -162,9 +196,39 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
     cull_mode = cullmode_invert[cull_mode];
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
-  transform(m_transform_buffer.get(), src, stride, count);
   const CullFunction cull = m_cull_table[primitive][cull_mode];
-  return cull(m_transform_buffer.get(), count);
+
+  Common::ThreadPool& workers = VertexLoaderManager::GetWorkers();
+  if (!workers.IsRunning() || count < 2 * PARALLEL_CHUNK_VERTICES)
+  {
+    transform(m_transform_buffer.get(), src, stride, count);
+    return cull(m_transform_buffer.get(), count);
+  }
+
+  TransformedVertex* const transformed = m_transform_buffer.get();
+  const u32 num_chunks = (count + PARALLEL_CHUNK_VERTICES - 1) / PARALLEL_CHUNK_VERTICES;
+  workers.ParallelFor(num_chunks, [&](size_t i) {
+    const u32 first = static_cast<u32>(i) * PARALLEL_CHUNK_VERTICES;
+    const u32 chunk_count = std::min(PARALLEL_CHUNK_VERTICES, count - first);
+    transform(transformed + first, src + first * stride, stride, static_cast<int>(chunk_count));
+  });
+
+  // Every triangle of a fan uses the first vertex
+  if (primitive == OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN)
+    return cull(transformed, count);
+
+  // The triangles of a strip which start in a chunk end in the two vertices after it
+  const u32 overlap = primitive == OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP ? 2 : 0;
+  std::atomic<bool> any_visible = false;
+  workers.ParallelFor(num_chunks, [&](size_t i) {
+    if (any_visible.load(std::memory_order_relaxed))
+      return;
+    const u32 first = static_cast<u32>(i) * PARALLEL_CHUNK_VERTICES;
+    const u32 chunk_count = std::min(PARALLEL_CHUNK_VERTICES + overlap, count - first);
+    if (!cull(transformed + first, static_cast<int>(chunk_count)))
+      any_visible.store(true, std::memory_order_relaxed);
+  });
+  return !any_visible.load(std::memory_order_relaxed);
 }
 
 template <typename T>
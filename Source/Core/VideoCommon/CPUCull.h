@@ -23,6 +23,11 @@ public:
   using TransformFunction = void (*)(void*, const void*, u32, int);
   using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
 
+  // Returns the function which transforms vertices of the given layout with the widest instruction
+  // set of the CPU. Init doesn't allow AVX-512 until it's been measured to be faster than AVX.
+  static TransformFunction GetTransformFunction(bool position_has_3_elems, bool per_vertex_pos_mtx,
+                                                bool allow_avx512);
+
 private:
   template <typename T>
   struct BufferDeleter
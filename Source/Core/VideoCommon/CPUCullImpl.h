@@ -1,7 +1,9 @@
 // Copyright 2022 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#if defined(USE_FMA)
+#if defined(USE_AVX512)
+#define VECTOR_NAMESPACE CPUCull_AVX512
+#elif defined(USE_FMA)
 #define VECTOR_NAMESPACE CPUCull_FMA
 #elif defined(USE_AVX)
 #define VECTOR_NAMESPACE CPUCull_AVX
@@ -19,7 +21,9 @@
 #error This file is meant to be used by CPUCull.cpp only!
 #endif
 
-#if defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
+#if defined(__GNUC__) && defined(USE_AVX512) && !(defined(__AVX512F__) && defined(__FMA__))
+#define ATTR_TARGET __attribute__((target("avx512f,avx,fma")))
+#elif defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
 #define ATTR_TARGET __attribute__((target("avx,fma")))
 #elif defined(__GNUC__) && defined(USE_AVX) && !defined(__AVX__)
 #define ATTR_TARGET __attribute__((target("avx")))
@@ -72,6 +76,13 @@ ATTR_TARGET DOLPHIN_FORCE_INLINE static __m256 vector_broadcast(__m256 v)
   return _mm256_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i));
 }
 #endif
+#ifdef USE_AVX512
+template <int i>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 vector_broadcast(__m512 v)
+{
+  return _mm512_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i));
+}
+#endif
 
 #ifdef USE_AVX
 ATTR_TARGET DOLPHIN_FORCE_INLINE static void TransposeYMM(__m256& o0, __m256& o1,  //
@@ -236,6 +247,124 @@ LoadTransform2Vertices(const u8* v0data, const u8* v1data,                  //
 
 #endif
 
+#ifdef USE_AVX512
+// The ZMM functions work on four vertices at once, one in each 128-bit lane
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 BroadcastXMM(__m128 v)
+{
+  return _mm512_broadcast_f32x4(v);
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 Combine4XMM(__m128 v0, __m128 v1, __m128 v2,
+                                                           __m128 v3)
+{
+  __m512 output = _mm512_castps128_ps512(v0);
+  output = _mm512_insertf32x4(output, v1, 1);
+  output = _mm512_insertf32x4(output, v2, 2);
+  output = _mm512_insertf32x4(output, v3, 3);
+  return output;
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static void TransposeZMM(__m512& o0, __m512& o1,  //
+                                                          __m512& o2, __m512& o3)
+{
+  __m512d tmp0 = _mm512_castps_pd(_mm512_unpacklo_ps(o0, o1));
+  __m512d tmp1 = _mm512_castps_pd(_mm512_unpacklo_ps(o2, o3));
+  __m512d tmp2 = _mm512_castps_pd(_mm512_unpackhi_ps(o0, o1));
+  __m512d tmp3 = _mm512_castps_pd(_mm512_unpackhi_ps(o2, o3));
+  o0 = _mm512_castpd_ps(_mm512_unpacklo_pd(tmp0, tmp1));
+  o1 = _mm512_castpd_ps(_mm512_unpackhi_pd(tmp0, tmp1));
+  o2 = _mm512_castpd_ps(_mm512_unpacklo_pd(tmp2, tmp3));
+  o3 = _mm512_castpd_ps(_mm512_unpackhi_pd(tmp2, tmp3));
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 ApplyMatrixZMM(__m512 v, __m512 m0, __m512 m1,
+                                                              __m512 m2, __m512 m3)
+{
+  __m512 output = _mm512_mul_ps(vector_broadcast<0>(v), m0);
+  output = _mm512_fmadd_ps(vector_broadcast<1>(v), m1, output);
+  output = _mm512_fmadd_ps(vector_broadcast<2>(v), m2, output);
+  output = _mm512_fmadd_ps(vector_broadcast<3>(v), m3, output);
+  return output;
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512
+TransformVertexNoTransposeZMM(__m512 vertex, __m512 pos0, __m512 pos1, __m512 pos2,  //
+                              __m512 proj0, __m512 proj1, __m512 proj2, __m512 proj3)
+{
+  // Same sums as the hadds of TransformVertexNoTransposeYMM, but there is no 512-bit hadd
+  __m512 mul0 = _mm512_mul_ps(vertex, pos0);
+  __m512 mul1 = _mm512_mul_ps(vertex, pos1);
+  __m512 mul2 = _mm512_mul_ps(vertex, pos2);
+  __m512 mul3 = BroadcastXMM(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+  TransposeZMM(mul0, mul1, mul2, mul3);
+  __m512 output = _mm512_add_ps(_mm512_add_ps(mul0, mul1), _mm512_add_ps(mul2, mul3));
+  return ApplyMatrixZMM(output, proj0, proj1, proj2, proj3);
+}
+
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512
+TransformVertexZMM(__m512 vertex, __m512 pos0, __m512 pos1, __m512 pos2, __m512 pos3,  //
+                   __m512 proj0, __m512 proj1, __m512 proj2, __m512 proj3)
+{
+  __m512 output = pos3;  // vertex.w is always 1.0
+  output = _mm512_fmadd_ps(vector_broadcast<0>(vertex), pos0, output);
+  output = _mm512_fmadd_ps(vector_broadcast<1>(vertex), pos1, output);
+  if constexpr (PositionHas3Elems)
+    output = _mm512_fmadd_ps(vector_broadcast<2>(vertex), pos2, output);
+  return ApplyMatrixZMM(output, proj0, proj1, proj2, proj3);
+}
+
+// Loads the position as x, y, z (or 0), 1
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m128 LoadPositionXMM(const u8* data)
+{
+  const float* fdata = reinterpret_cast<const float*>(data);
+  if constexpr (PositionHas3Elems)
+    return _mm_blend_ps(_mm_loadu_ps(fdata), _mm_set1_ps(1.0f), 8);
+  else
+    return _mm_loadl_pi(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), reinterpret_cast<const __m64*>(fdata));
+}
+
+template <bool PositionHas3Elems, bool PerVertexPosMtx>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512
+LoadTransform4Vertices(const u8* data, u32 stride,                          //
+                       __m512 pos0, __m512 pos1, __m512 pos2, __m512 pos3,  //
+                       __m512 proj0, __m512 proj1, __m512 proj2, __m512 proj3)
+{
+  const u8* v0data = data;
+  const u8* v1data = data + stride;
+  const u8* v2data = data + stride * 2;
+  const u8* v3data = data + stride * 3;
+  if constexpr (PerVertexPosMtx)
+  {
+    // Vertex data layout always starts with posmtx data if available, then position data
+    const Vector* m0 = reinterpret_cast<const Vector*>(&xfmem.posMatrices[(v0data[0] & 0x3f) * 4]);
+    const Vector* m1 = reinterpret_cast<const Vector*>(&xfmem.posMatrices[(v1data[0] & 0x3f) * 4]);
+    const Vector* m2 = reinterpret_cast<const Vector*>(&xfmem.posMatrices[(v2data[0] & 0x3f) * 4]);
+    const Vector* m3 = reinterpret_cast<const Vector*>(&xfmem.posMatrices[(v3data[0] & 0x3f) * 4]);
+    pos0 = Combine4XMM(m0[0], m1[0], m2[0], m3[0]);
+    pos1 = Combine4XMM(m0[1], m1[1], m2[1], m3[1]);
+    pos2 = Combine4XMM(m0[2], m1[2], m2[2], m3[2]);
+
+    __m512 vertices = Combine4XMM(LoadPositionXMM<PositionHas3Elems>(v0data + sizeof(u32)),
+                                  LoadPositionXMM<PositionHas3Elems>(v1data + sizeof(u32)),
+                                  LoadPositionXMM<PositionHas3Elems>(v2data + sizeof(u32)),
+                                  LoadPositionXMM<PositionHas3Elems>(v3data + sizeof(u32)));
+    return TransformVertexNoTransposeZMM(vertices, pos0, pos1, pos2, proj0, proj1, proj2, proj3);
+  }
+  else
+  {
+    __m512 vertices = Combine4XMM(LoadPositionXMM<PositionHas3Elems>(v0data),
+                                  LoadPositionXMM<PositionHas3Elems>(v1data),
+                                  LoadPositionXMM<PositionHas3Elems>(v2data),
+                                  LoadPositionXMM<PositionHas3Elems>(v3data));
+    return TransformVertexZMM<PositionHas3Elems>(vertices, pos0, pos1, pos2, pos3,  //
+                                                 proj0, proj1, proj2, proj3);
+  }
+}
+#endif
+
 #ifndef USE_AVX
 // Note: Assumes 16-byte aligned source
 ATTR_TARGET DOLPHIN_FORCE_INLINE static void LoadTransposed(const void* source, Vector& o0,
@@ -512,7 +641,45 @@ ATTR_TARGET static void TransformVertices(void* output, const void* vertices, u3
   const u8* cvertices = static_cast<const u8*>(vertices);
   Vector* voutput = static_cast<Vector*>(output);
   u32 idx = g_main_cp_state.matrix_index_a.PosNormalMtxIdx & 0x3f;
-#ifdef USE_AVX
+#if defined(USE_AVX512)
+  __m256 proj0, proj1, proj2, proj3;
+  __m256 pos0, pos1, pos2, pos3;
+  LoadTransposedYMM(vsmanager.constants.projection.data(), proj0, proj1, proj2, proj3);
+  LoadTransposedPosYMM(&xfmem.posMatrices[idx * 4], pos0, pos1, pos2, pos3);
+  const __m512 zproj0 = BroadcastXMM(_mm256_castps256_ps128(proj0));
+  const __m512 zproj1 = BroadcastXMM(_mm256_castps256_ps128(proj1));
+  const __m512 zproj2 = BroadcastXMM(_mm256_castps256_ps128(proj2));
+  const __m512 zproj3 = BroadcastXMM(_mm256_castps256_ps128(proj3));
+  const __m512 zpos0 = BroadcastXMM(_mm256_castps256_ps128(pos0));
+  const __m512 zpos1 = BroadcastXMM(_mm256_castps256_ps128(pos1));
+  const __m512 zpos2 = BroadcastXMM(_mm256_castps256_ps128(pos2));
+  const __m512 zpos3 = BroadcastXMM(_mm256_castps256_ps128(pos3));
+  for (int i = 3; i < count; i += 4)
+  {
+    __m512 v0123 = LoadTransform4Vertices<PositionHas3Elems, PerVertexPosMtx>(
+        cvertices, stride, zpos0, zpos1, zpos2, zpos3, zproj0, zproj1, zproj2, zproj3);
+    _mm512_storeu_ps(reinterpret_cast<float*>(voutput), v0123);
+    cvertices += stride * 4;
+    voutput += 4;
+  }
+  if (count & 2)
+  {
+    __m256 v01 = LoadTransform2Vertices<PositionHas3Elems, PerVertexPosMtx>(
+        cvertices, cvertices + stride, pos0, pos1, pos2, pos3, proj0, proj1, proj2, proj3);
+    _mm256_storeu_ps(reinterpret_cast<float*>(voutput), v01);
+    cvertices += stride * 2;
+    voutput += 2;
+  }
+  if (count & 1)
+  {
+    *voutput = LoadTransformVertex<PositionHas3Elems, PerVertexPosMtx>(
+        cvertices,                                                     //
+        _mm256_castps256_ps128(pos0), _mm256_castps256_ps128(pos1),    //
+        _mm256_castps256_ps128(pos2), _mm256_castps256_ps128(pos3),    //
+        _mm256_castps256_ps128(proj0), _mm256_castps256_ps128(proj1),  //
+        _mm256_castps256_ps128(proj2), _mm256_castps256_ps128(proj3));
+  }
+#elif defined(USE_AVX)
   __m256 proj0, proj1, proj2, proj3;
   __m256 pos0, pos1, pos2, pos3;
   LoadTransposedYMM(vsmanager.constants.projection.data(), proj0, proj1, proj2, proj3);
@@ -0,0 +1,118 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/DisplayListCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <xxhash.h>
+
+#include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+
+DisplayListCache g_display_list_cache;
+
+bool DisplayListCache::CachedPrimitive::IsValidFor(const VertexLoaderBase* loader, u32 src_offset,
+                                                   u32 count) const
+{
+  return m_loader == loader && m_src_offset == src_offset && m_count == count;
+}
+
+void DisplayListCache::CachedPrimitive::Store(VertexLoaderBase* loader, u32 src_offset, u32 count,
+                                              int num_loaded, const u8* vertices, size_t size)
+{
+  m_loader = loader;
+  m_src_offset = src_offset;
+  m_count = count;
+  m_num_loaded = num_loaded;
+  m_vertices.assign(vertices, vertices + size);
+
+  m_position_cache = VertexLoaderManager::position_cache;
+  m_position_matrix_index_cache = VertexLoaderManager::position_matrix_index_cache;
+  m_normal_cache = VertexLoaderManager::normal_cache;
+  m_tangent_cache = VertexLoaderManager::tangent_cache;
+  m_binormal_cache = VertexLoaderManager::binormal_cache;
+}
+
+int DisplayListCache::CachedPrimitive::Load(u8* dst)
+{
+  std::memcpy(dst, m_vertices.data(), m_vertices.size());
+
+  // Only restore what the vertex loader would have written. It stores the positions (and position
+  // matrix indices) of the last three vertices, and the normals of the last vertex.
+  const PortableVertexDeclaration& decl = m_loader->m_native_vtx_decl;
+  const u32 last_vertices = std::min<u32>(m_count, 3);
+  for (u32 i = 0; i < last_vertices; ++i)
+  {
+    if (decl.position.enable)
+    {
+      std::copy_n(m_position_cache[i].begin(), decl.position.components,
+                  VertexLoaderManager::position_cache[i].begin());
+    }
+    if (decl.posmtx.enable)
+      VertexLoaderManager::position_matrix_index_cache[i] = m_position_matrix_index_cache[i];
+  }
+
+  const auto restore_normal = [](const AttributeFormat& format, const std::array<float, 4>& from,
+                                 std::array<float, 4>& to) {
+    if (format.enable)
+      std::copy_n(from.begin(), format.components, to.begin());
+  };
+  restore_normal(decl.normals[0], m_normal_cache, VertexLoaderManager::normal_cache);
+  restore_normal(decl.normals[1], m_tangent_cache, VertexLoaderManager::tangent_cache);
+  restore_normal(decl.normals[2], m_binormal_cache, VertexLoaderManager::binormal_cache);
+
+  m_loader->m_numLoadedVertices += m_count;
+  return m_num_loaded;
+}
+
+DisplayListCache::CachedPrimitive& DisplayListCache::Entry::GetNextPrimitive()
+{
+  if (m_next_primitive == m_primitives.size())
+    m_primitives.emplace_back();
+  return m_primitives[m_next_primitive++];
+}
+
+size_t DisplayListCache::Entry::GetMemoryUsage() const
+{
+  size_t usage = 0;
+  for (const CachedPrimitive& primitive : m_primitives)
+    usage += primitive.GetSize();
+  return usage;
+}
+
+DisplayListCache::Entry* DisplayListCache::Lookup(u32 address, u32 size, const u8* data)
+{
+  if (m_last_entry)
+  {
+    m_memory_usage -= m_last_entry_memory_usage;
+    m_memory_usage += m_last_entry->GetMemoryUsage();
+  }
+
+  if (m_memory_usage > MAX_MEMORY_USAGE)
+    Clear();
+
+  const u64 hash = XXH3_64bits(data, size);
+  Entry& entry = m_entries[(static_cast<u64>(address) << 32) | size];
+  if (entry.m_hash != hash)
+  {
+    m_memory_usage -= entry.GetMemoryUsage();
+    entry.m_primitives.clear();
+    entry.m_hash = hash;
+  }
+  entry.m_next_primitive = 0;
+
+  m_last_entry = &entry;
+  m_last_entry_memory_usage = entry.GetMemoryUsage();
+  return &entry;
+}
+
+void DisplayListCache::Clear()
+{
+  m_entries.clear();
+  m_memory_usage = 0;
+  m_last_entry = nullptr;
+  m_last_entry_memory_usage = 0;
+}
@@ -0,0 +1,102 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+class VertexLoaderBase;
+
+// Games tend to call the same static display lists every frame. This keeps the vertices of the
+// primitives in display lists after they have been converted by the vertex loader, so that calling
+// a display list again only needs to copy them instead of converting them anew.
+//
+// Display lists are identified by address and size, and their contents are hashed on every call,
+// so changes to the memory backing a display list are always noticed. A primitive's cached
+// vertices are only used if it is at the same offset in the display list, has the same vertex
+// count and is loaded by the same vertex loader (i.e. with the same vertex format) as when it was
+// cached. Together with the unchanged contents, this means converting it again would give the same
+// result. Primitives using indexed attributes read their data from outside the display list, so
+// they are never cached.
+//
+// Only vertex conversion is skipped. Entries aren't invalidated by watching writes to emulated
+// RAM instead of hashing: JIT fastmem stores and DMA don't go through any hook, and games don't
+// reliably flush the data cache (dcbf/dcbst) before the GPU reads a display list. The command
+// stream is still parsed on every call, as the register writes in it have to run anyway.
+class DisplayListCache
+{
+public:
+  // The converted vertices of one primitive command, and the state the vertex loader left behind
+  // for zfreeze and for vertex formats without normals.
+  class CachedPrimitive
+  {
+  public:
+    // Whether the vertices were converted from the same data with the same loader.
+    bool IsValidFor(const VertexLoaderBase* loader, u32 src_offset, u32 count) const;
+
+    // Stores the given converted vertices, along with the state the loader wrote.
+    void Store(VertexLoaderBase* loader, u32 src_offset, u32 count, int num_loaded,
+               const u8* vertices, size_t size);
+
+    // Copies the cached vertices to dst and restores the state the loader wrote.
+    // Returns the number of vertices loaded.
+    int Load(u8* dst);
+
+    size_t GetSize() const { return m_vertices.size(); }
+
+  private:
+    VertexLoaderBase* m_loader = nullptr;
+    u32 m_src_offset = 0;
+    u32 m_count = 0;
+    int m_num_loaded = 0;
+    std::vector<u8> m_vertices;
+
+    std::array<std::array<float, 4>, 3> m_position_cache{};
+    std::array<u32, 3> m_position_matrix_index_cache{};
+    std::array<float, 4> m_normal_cache{};
+    std::array<float, 4> m_tangent_cache{};
+    std::array<float, 4> m_binormal_cache{};
+  };
+
+  class Entry
+  {
+  public:
+    // Returns the cache slot for the next primitive command in the display list.
+    CachedPrimitive& GetNextPrimitive();
+
+  private:
+    friend class DisplayListCache;
+
+    size_t GetMemoryUsage() const;
+
+    u64 m_hash = 0;
+    std::vector<CachedPrimitive> m_primitives;
+    size_t m_next_primitive = 0;
+  };
+
+  // Returns the entry for the display list at the given address, which is about to be run.
+  // The entry is reset if the contents of the display list changed since it was last run.
+  Entry* Lookup(u32 address, u32 size, const u8* data);
+
+  void Clear();
+
+private:
+  // When this is exceeded, the whole cache is cleared, so that display lists which aren't used
+  // anymore are dropped.
+  static constexpr size_t MAX_MEMORY_USAGE = 64 * 1024 * 1024;
+
+  std::unordered_map<u64, Entry> m_entries;
+  size_t m_memory_usage = 0;
+
+  // Vertices are added to the entry of the display list which is being run, so its memory usage
+  // is updated on the next lookup.
+  Entry* m_last_entry = nullptr;
+  size_t m_last_entry_memory_usage = 0;
+};
+
+extern DisplayListCache g_display_list_cache;
@@ -4,10 +4,13 @@
 #include "VideoCommon/HiresTextures.h"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 #include <xxhash.h>
 
 #include <fmt/format.h>
@@ -19,9 +22,12 @@
 #include "Common/StringUtil.h"
 #include "Core/ConfigManager.h"
 #include "Core/System.h"
+#include "VideoCommon/Assets/AssetRequestHistory.h"
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/Resources/CustomResourceManager.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
 
 constexpr std::string_view s_format_prefix{"tex1_"};
@@ -31,43 +37,125 @@ static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
 
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 
+// Loose files take precedence over the textures in packs
+static std::vector<std::shared_ptr<VideoCommon::TexturePackAssetLibrary>> s_texture_packs;
+
+// Which textures the current game used shortly after each other in earlier sessions, so that they
+// can be prefetched when one of them is used again
+static VideoCommon::AssetRequestHistory s_request_history;
+static std::string s_request_history_path;
+static std::unordered_set<std::string> s_requested_textures;
+
 namespace
 {
-std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
+struct HiresTextureMatch
 {
-  if (s_hires_texture_id_to_arbmipmap.empty())
-    return {"", false};
+  std::string name;
+  bool has_arbitrary_mipmaps;
+  std::shared_ptr<VideoCommon::CustomAssetLibrary> library;
+};
 
-  const auto texture_name_details = texture_info.CalculateTextureName();
-  // look for an exact match first
-  const std::string full_name = texture_name_details.GetFullName();
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(full_name);
+std::optional<HiresTextureMatch> FindTextureName(const std::string& name)
+{
+  if (auto iter = s_hires_texture_id_to_arbmipmap.find(name);
       iter != s_hires_texture_id_to_arbmipmap.end())
   {
-    return {full_name, iter->second};
+    return HiresTextureMatch{name, iter->second, s_file_library};
+  }
+
+  for (const auto& pack : s_texture_packs)
+  {
+    if (const auto* texture = pack->GetReader().Find(name))
+      return HiresTextureMatch{name, texture->has_arbitrary_mipmaps != 0, pack};
   }
 
+  return std::nullopt;
+}
+
+std::optional<HiresTextureMatch> FindTexture(const TextureInfo& texture_info)
+{
+  if (s_hires_texture_id_to_arbmipmap.empty() && s_texture_packs.empty())
+    return std::nullopt;
+
+  const auto texture_name_details = texture_info.CalculateTextureName();
+  // look for an exact match first
+  if (auto match = FindTextureName(texture_name_details.GetFullName()))
+    return match;
+
   // Single wildcard ignoring the tlut hash
   const std::string texture_name_single_wildcard_tlut =
       fmt::format("{}_{}_$_{}", texture_name_details.base_name, texture_name_details.texture_name,
                   texture_name_details.format_name);
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(texture_name_single_wildcard_tlut);
-      iter != s_hires_texture_id_to_arbmipmap.end())
-  {
-    return {texture_name_single_wildcard_tlut, iter->second};
-  }
+  if (auto match = FindTextureName(texture_name_single_wildcard_tlut))
+    return match;
 
   // Single wildcard ignoring the texture hash
   const std::string texture_name_single_wildcard_tex =
       fmt::format("{}_${}_{}", texture_name_details.base_name, texture_name_details.tlut_name,
                   texture_name_details.format_name);
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(texture_name_single_wildcard_tex);
-      iter != s_hires_texture_id_to_arbmipmap.end())
+  return FindTextureName(texture_name_single_wildcard_tex);
+}
+
+std::string GetRequestHistoryPath(const std::string& game_id)
+{
+  return File::GetUserPath(D_CACHE_IDX) + "HiresTextureRequests" DIR_SEP + game_id + ".txt";
+}
+
+void SaveRequestHistory()
+{
+  if (s_request_history_path.empty())
+    return;
+
+  if (s_request_history.IsDirty() && !s_request_history.Save(s_request_history_path))
+    ERROR_LOG_FMT(VIDEO, "Failed to save custom texture history to '{}'", s_request_history_path);
+
+  INFO_LOG_FMT(VIDEO, "Custom textures ready on first use: {}/{}, prefetched: {}",
+               g_stats.num_custom_textures_ready_on_first_use,
+               g_stats.num_custom_textures_first_used, g_stats.num_custom_textures_prefetched);
+
+  s_request_history.Clear();
+  s_request_history_path.clear();
+  s_requested_textures.clear();
+}
+
+void LoadRequestHistory(const std::string& game_id)
+{
+  std::string path = GetRequestHistoryPath(game_id);
+  if (path == s_request_history_path)
+    return;
+
+  SaveRequestHistory();
+
+  // The history doesn't exist until the game has been played with custom textures
+  s_request_history.Load(path);
+  s_request_history_path = std::move(path);
+}
+
+void OnFirstRequest(const HiresTexture& texture)
+{
+  ++g_stats.num_custom_textures_first_used;
+  if (texture.LoadTexture()->GetData())
+    ++g_stats.num_custom_textures_ready_on_first_use;
+
+  const auto& predicted_names = s_request_history.RecordRequest(texture.GetId());
+
+  // Cached textures are all loaded up front, so there's nothing to prefetch
+  if (g_ActiveConfig.bCacheHiresTextures)
+    return;
+
+  auto& custom_resource_manager = Core::System::GetInstance().GetCustomResourceManager();
+  for (const auto& name : predicted_names)
   {
-    return {texture_name_single_wildcard_tex, iter->second};
-  }
+    if (s_requested_textures.contains(name))
+      continue;
 
-  return {"", false};
+    auto match = FindTextureName(name);
+    if (match &&
+        custom_resource_manager.PrefetchTextureData(match->name, std::move(match->library)))
+    {
+      ++g_stats.num_custom_textures_prefetched;
+    }
+  }
 }
 }  // namespace
 
@@ -85,10 +173,20 @@ void HiresTexture::Update()
   }
 
   const std::string& game_id = SConfig::GetInstance().GetGameID();
+  if (g_ActiveConfig.bPrefetchHiresTextures && !game_id.empty())
+    LoadRequestHistory(game_id);
+  else
+    SaveRequestHistory();
+
   const std::set<std::string> texture_directories =
       GetTextureDirectoriesWithGameId(File::GetUserPath(D_HIRESTEXTURES_IDX), game_id);
   constexpr auto extensions = std::to_array<std::string_view>({".png", ".dds"});
 
+  // The packs are opened again, so that reloading the textures also picks up changed packs.
+  // Textures which are already cached keep their old pack open until they are dropped.
+  s_texture_packs.clear();
+  size_t pack_texture_count = 0;
+
   for (const auto& texture_directory : texture_directories)
   {
     // Watch this directory for any texture reloads
@@ -125,8 +223,8 @@ void HiresTexture::Update()
 
           if (g_ActiveConfig.bCacheHiresTextures)
           {
-            auto hires_texture =
-                std::make_shared<HiresTexture>(has_arbitrary_mipmaps, std::move(filename));
+            auto hires_texture = std::make_shared<HiresTexture>(
+                has_arbitrary_mipmaps, std::move(filename), s_file_library);
             static_cast<void>(hires_texture->LoadTexture());
             s_hires_texture_cache.try_emplace(hires_texture->GetId(), hires_texture);
           }
@@ -139,50 +237,93 @@ void HiresTexture::Update()
       ERROR_LOG_FMT(VIDEO, "One or more textures at path '{}' were already inserted",
                     texture_directory);
     }
+
+    // Only the index of a pack is read here, its textures are looked up when they are needed
+    const auto pack_paths = Common::DoFileSearch(
+        texture_directory, VideoCommon::TexturePack::FILE_EXTENSION, /*recursive*/ true);
+    for (const auto& path : pack_paths)
+    {
+      auto pack = std::make_shared<VideoCommon::TexturePackAssetLibrary>();
+      if (!pack->Open(path))
+      {
+        ERROR_LOG_FMT(VIDEO, "Failed to open texture pack '{}'", path);
+        continue;
+      }
+
+      pack_texture_count += pack->GetReader().GetTextures().size();
+      s_texture_packs.push_back(std::move(pack));
+    }
   }
 
   if (g_ActiveConfig.bCacheHiresTextures)
   {
+    for (const auto& pack : s_texture_packs)
+    {
+      const auto& reader = pack->GetReader();
+      for (const auto& texture : reader.GetTextures())
+      {
+        std::string name(reader.GetName(texture));
+        if (s_hires_texture_cache.contains(name))
+          continue;
+
+        auto hires_texture = std::make_shared<HiresTexture>(texture.has_arbitrary_mipmaps != 0,
+                                                            std::move(name), pack);
+        static_cast<void>(hires_texture->LoadTexture());
+        s_hires_texture_cache.try_emplace(hires_texture->GetId(), hires_texture);
+      }
+    }
+
     OSD::AddMessage(fmt::format("Loading '{}' custom textures", s_hires_texture_cache.size()),
                     10000);
   }
   else
   {
-    OSD::AddMessage(
-        fmt::format("Found '{}' custom textures", s_hires_texture_id_to_arbmipmap.size()), 10000);
+    OSD::AddMessage(fmt::format("Found '{}' custom textures",
+                                s_hires_texture_id_to_arbmipmap.size() + pack_texture_count),
+                    10000);
   }
 }
 
 void HiresTexture::Clear()
 {
+  SaveRequestHistory();
   s_hires_texture_cache.clear();
   s_hires_texture_id_to_arbmipmap.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
+  s_texture_packs.clear();
 }
 
 std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_info)
 {
-  auto [base_filename, has_arb_mipmaps] = GetNameArbPair(texture_info);
-  if (base_filename == "")
+  auto match = FindTexture(texture_info);
+  if (!match)
     return nullptr;
 
-  if (auto iter = s_hires_texture_cache.find(base_filename); iter != s_hires_texture_cache.end())
+  std::shared_ptr<HiresTexture> hires_texture;
+  if (auto iter = s_hires_texture_cache.find(match->name); iter != s_hires_texture_cache.end())
   {
-    return iter->second;
+    hires_texture = iter->second;
   }
   else
   {
-    auto hires_texture = std::make_shared<HiresTexture>(has_arb_mipmaps, std::move(base_filename));
+    hires_texture = std::make_shared<HiresTexture>(
+        match->has_arbitrary_mipmaps, std::move(match->name), std::move(match->library));
     if (g_ActiveConfig.bCacheHiresTextures)
     {
       s_hires_texture_cache.try_emplace(hires_texture->GetId(), hires_texture);
     }
-    return hires_texture;
   }
+
+  if (!s_request_history_path.empty() && s_requested_textures.insert(hires_texture->GetId()).second)
+    OnFirstRequest(*hires_texture);
+
+  return hires_texture;
 }
 
-HiresTexture::HiresTexture(bool has_arbitrary_mipmaps, std::string id)
-    : m_has_arbitrary_mipmaps(has_arbitrary_mipmaps), m_id(std::move(id))
+HiresTexture::HiresTexture(bool has_arbitrary_mipmaps, std::string id,
+                           std::shared_ptr<VideoCommon::CustomAssetLibrary> library)
+    : m_has_arbitrary_mipmaps(has_arbitrary_mipmaps), m_id(std::move(id)),
+      m_library(std::move(library))
 {
 }
 
@@ -190,7 +331,7 @@ VideoCommon::TextureDataResource* HiresTexture::LoadTexture() const
 {
   auto& system = Core::System::GetInstance();
   auto& custom_resource_manager = system.GetCustomResourceManager();
-  return custom_resource_manager.GetTextureDataFromAsset(m_id, s_file_library);
+  return custom_resource_manager.GetTextureDataFromAsset(m_id, m_library);
 }
 
 std::set<std::string> GetTextureDirectoriesWithGameId(const std::string& root_directory,
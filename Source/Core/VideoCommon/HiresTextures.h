@@ -12,8 +12,9 @@
 
 namespace VideoCommon
 {
+class CustomAssetLibrary;
 class TextureDataResource;
-}
+}  // namespace VideoCommon
 
 enum class TextureFormat;
 
@@ -28,7 +29,8 @@ public:
   static void Shutdown();
   static std::shared_ptr<HiresTexture> Search(const TextureInfo& texture_info);
 
-  HiresTexture(bool has_arbitrary_mipmaps, std::string id);
+  HiresTexture(bool has_arbitrary_mipmaps, std::string id,
+               std::shared_ptr<VideoCommon::CustomAssetLibrary> library);
 
   bool HasArbitraryMipmaps() const { return m_has_arbitrary_mipmaps; }
   VideoCommon::TextureDataResource* LoadTexture() const;
@@ -37,4 +39,7 @@ public:
 private:
   bool m_has_arbitrary_mipmaps = false;
   std::string m_id;
+
+  // Where the texture is loaded from, either the texture directories or a texture pack
+  std::shared_ptr<VideoCommon::CustomAssetLibrary> m_library;
 };
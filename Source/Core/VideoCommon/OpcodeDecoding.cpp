@@ -14,6 +14,8 @@
 
 #include "VideoCommon/OpcodeDecoding.h"
 
+#include <optional>
+
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
@@ -23,10 +25,12 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/DisplayListCache.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStateManager.h"
 
@@ -44,6 +48,7 @@ public:
 
     if constexpr (!is_preprocess)
     {
+      ScopedPhaseTimer timer(VideoPhase::XFWrites);
       LoadXFReg(address, count, data);
 
       INCSTAT(g_stats.this_frame.num_xf_loads);
@@ -55,6 +60,7 @@ public:
     const u8 sub_command = command & CP_COMMAND_MASK;
     if constexpr (!is_preprocess)
     {
+      ScopedPhaseTimer timer(VideoPhase::CPWrites);
       if (sub_command == MATINDEX_A)
       {
         VertexLoaderManager::g_needs_cp_xf_consistency_check = true;
@@ -110,6 +116,7 @@ public:
     }
     else
     {
+      ScopedPhaseTimer timer(VideoPhase::BPWrites);
       LoadBPReg(command, value, m_cycles);
       INCSTAT(g_stats.this_frame.num_bp_loads);
     }
@@ -129,8 +136,16 @@ public:
     // load vertices
     const u32 size = vertex_size * num_vertices;
 
-    const u32 bytes =
-        VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive, num_vertices, vertex_data);
+    DisplayListCache::CachedPrimitive* cached_primitive = nullptr;
+    u32 src_offset = 0;
+    if (m_display_list_cache_entry)
+    {
+      cached_primitive = &m_display_list_cache_entry->GetNextPrimitive();
+      src_offset = static_cast<u32>(vertex_data - m_display_list_start);
+    }
+
+    const u32 bytes = VertexLoaderManager::RunVertices<is_preprocess>(
+        vat, primitive, num_vertices, vertex_data, cached_primitive, src_offset);
 
     ASSERT(bytes == size);
 
@@ -187,9 +202,17 @@ public:
           // temporarily swap dl and non-dl (small "hack" for the stats)
           g_stats.SwapDL();
 
+          if (g_ActiveConfig.bDisplayListCache)
+          {
+            m_display_list_cache_entry = g_display_list_cache.Lookup(address, size, start_address);
+            m_display_list_start = start_address;
+          }
+
           Run(start_address, size, *this);
           INCSTAT(g_stats.this_frame.num_dlists_called);
 
+          m_display_list_cache_entry = nullptr;
+
           // un-swap
           g_stats.SwapDL();
         }
@@ -254,11 +277,19 @@ public:
 
   u32 m_cycles = 0;
   bool m_in_display_list = false;
+
+  // Set while running a display list with the display list cache enabled
+  DisplayListCache::Entry* m_display_list_cache_entry = nullptr;
+  const u8* m_display_list_start = nullptr;
 };
 
 template <bool is_preprocess>
 u8* RunFifo(DataReader src, u32* cycles)
 {
+  std::optional<ScopedPhaseTimer> timer;
+  if constexpr (!is_preprocess)
+    timer.emplace(VideoPhase::OpcodeDecode);
+
   using CallbackT = RunCallback<is_preprocess>;
   auto callback = CallbackT{};
   u32 size = Run(src.GetPointer(), static_cast<u32>(src.size()), callback);
@@ -0,0 +1,82 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/PipelineUIDCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+
+namespace VideoCommon::PipelineUIDCache
+{
+std::string GetUserCachePath(std::string_view game_id)
+{
+  return File::GetUserPath(D_CACHE_IDX) + std::string(game_id) + ".uidcache";
+}
+
+std::string GetSharedCachePath(std::string_view game_id)
+{
+  return File::GetUserPath(D_LOAD_IDX) + SHADERUIDCACHES_DIR DIR_SEP + std::string(game_id) +
+         ".uidcache";
+}
+
+std::optional<std::vector<SerializedGXPipelineUid>> ReadUIDs(File::IOFile& file)
+{
+  u32 magic;
+  u32 version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)) ||
+      magic != MAGIC || version != GX_PIPELINE_UID_VERSION)
+  {
+    return std::nullopt;
+  }
+
+  // Ensure the expected size matches the actual size of the file. If it doesn't, it means
+  // the cache file may be corrupted, and we should not proceed with loading potentially
+  // garbage or invalid UIDs.
+  const u64 data_size = file.GetSize() - HEADER_SIZE;
+  if (data_size % sizeof(SerializedGXPipelineUid) != 0)
+    return std::nullopt;
+
+  // Read all of the UIDs at once, as the caches of large games hold tens of thousands of them.
+  std::vector<SerializedGXPipelineUid> uids(data_size / sizeof(SerializedGXPipelineUid));
+  if (!file.ReadArray(uids.data(), uids.size()))
+    return std::nullopt;
+
+  return uids;
+}
+
+std::optional<std::vector<SerializedGXPipelineUid>> ReadUIDs(const std::string& path)
+{
+  File::IOFile file(path, "rb");
+  return ReadUIDs(file);
+}
+
+bool WriteHeader(File::IOFile& file)
+{
+  return file.WriteBytes(&MAGIC, sizeof(MAGIC)) &&
+         file.WriteBytes(&GX_PIPELINE_UID_VERSION, sizeof(GX_PIPELINE_UID_VERSION));
+}
+
+bool WriteUIDs(const std::string& path, std::span<const SerializedGXPipelineUid> uids)
+{
+  File::IOFile file(path, "wb");
+  return WriteHeader(file) && file.WriteArray(uids.data(), uids.size()) && file.Close();
+}
+
+void Canonicalize(std::vector<SerializedGXPipelineUid>* uids)
+{
+  // The serialized UIDs have no padding, and are compared as bytes like the UIDs themselves.
+  const auto less = [](const SerializedGXPipelineUid& a, const SerializedGXPipelineUid& b) {
+    return std::memcmp(&a, &b, sizeof(a)) < 0;
+  };
+  const auto equal = [](const SerializedGXPipelineUid& a, const SerializedGXPipelineUid& b) {
+    return std::memcmp(&a, &b, sizeof(a)) == 0;
+  };
+  std::ranges::sort(*uids, less);
+  const auto duplicates = std::ranges::unique(*uids, equal);
+  uids->erase(duplicates.begin(), duplicates.end());
+}
+}  // namespace VideoCommon::PipelineUIDCache
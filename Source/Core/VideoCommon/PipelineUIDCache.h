@@ -0,0 +1,46 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/GXPipelineTypes.h"
+
+namespace File
+{
+class IOFile;
+}
+
+// A UID cache lists the pipelines which a game used, so that they can be compiled before they are
+// needed the next time. It consists of a header with a magic number and GX_PIPELINE_UID_VERSION,
+// followed by the UIDs in serialized form. It doesn't depend on the backend or the machine.
+namespace VideoCommon::PipelineUIDCache
+{
+constexpr u32 MAGIC = 0x44495550;  // PUID
+constexpr size_t HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+// The UID cache which the pipelines a game uses are appended to while it runs.
+std::string GetUserCachePath(std::string_view game_id);
+
+// A UID cache which is only read, e.g. one merged from the caches of several machines with
+// dolphin-tool, so that the pipelines in it are compiled at boot on a new machine too.
+std::string GetSharedCachePath(std::string_view game_id);
+
+// Reads all UIDs of the file from the current position, which is left at the end of the file.
+// Returns nothing if the file isn't a UID cache of the current version, or is truncated.
+std::optional<std::vector<SerializedGXPipelineUid>> ReadUIDs(File::IOFile& file);
+std::optional<std::vector<SerializedGXPipelineUid>> ReadUIDs(const std::string& path);
+
+bool WriteHeader(File::IOFile& file);
+bool WriteUIDs(const std::string& path, std::span<const SerializedGXPipelineUid> uids);
+
+// Sorts the UIDs and removes the duplicates, so that merging the same caches in any order gives
+// the same file.
+void Canonicalize(std::vector<SerializedGXPipelineUid>* uids);
+}  // namespace VideoCommon::PipelineUIDCache
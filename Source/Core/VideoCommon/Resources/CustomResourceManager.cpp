@@ -103,6 +103,20 @@ TextureDataResource* CustomResourceManager::GetTextureDataFromAsset(
   return resource.get();
 }
 
+bool CustomResourceManager::PrefetchTextureData(
+    const CustomAssetLibrary::AssetID& asset_id,
+    std::shared_ptr<VideoCommon::CustomAssetLibrary> library)
+{
+  auto& resource = m_texture_data_resources[asset_id];
+  if (resource != nullptr)
+    return false;
+
+  resource =
+      std::make_unique<TextureDataResource>(CreateResourceContext(asset_id, std::move(library)));
+  resource->MarkAsPrefetched();
+  return true;
+}
+
 MaterialResource* CustomResourceManager::GetDrawMaterialFromAsset(
     const CustomAssetLibrary::AssetID& asset_id, const GXPipelineUid& pipeline_uid,
     std::shared_ptr<VideoCommon::CustomAssetLibrary> library)
@@ -37,6 +37,11 @@ public:
   TextureDataResource*
   GetTextureDataFromAsset(const CustomAssetLibrary::AssetID& asset_id,
                           std::shared_ptr<VideoCommon::CustomAssetLibrary> library);
+
+  // Starts loading the texture data in the background, at a lower priority than the assets
+  // which are in use. Returns false if the texture data was already requested
+  bool PrefetchTextureData(const CustomAssetLibrary::AssetID& asset_id,
+                           std::shared_ptr<VideoCommon::CustomAssetLibrary> library);
   MaterialResource*
   GetDrawMaterialFromAsset(const CustomAssetLibrary::AssetID& asset_id,
                            const GXPipelineUid& pipeline_uid,
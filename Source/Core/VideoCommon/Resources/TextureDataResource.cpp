@@ -45,4 +45,9 @@ void TextureDataResource::MarkAsPending()
 {
   m_resource_context.asset_cache->MarkAssetPending(m_texture_asset);
 }
+
+void TextureDataResource::MarkAsPrefetched()
+{
+  m_resource_context.asset_cache->MarkAssetPrefetched(m_texture_asset);
+}
 }  // namespace VideoCommon
@@ -20,6 +20,7 @@ public:
 
   void MarkAsActive() override;
   void MarkAsPending() override;
+  void MarkAsPrefetched();
 
 private:
   TaskComplete CollectPrimaryData() override;
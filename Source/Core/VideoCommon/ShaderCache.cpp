@@ -4,6 +4,7 @@
 #include "VideoCommon/ShaderCache.h"
 
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -17,6 +18,7 @@
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/PipelineUIDCache.h"
 #include "VideoCommon/PipelineUtils.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Statistics.h"
@@ -87,12 +89,12 @@ void ShaderCache::Reload()
   if (!CompileSharedPipelines())
     PanicAlertFmt("Failed to compile shared pipelines after reload.");
 
-  if (g_ActiveConfig.bShaderCache)
-    LoadCaches();
-
   // Switch to the precompiling shader configuration while we rebuild.
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderPrecompilerThreads());
 
+  if (g_ActiveConfig.bShaderCache)
+    LoadCaches();
+
   // We don't need to explicitly recompile the individual ubershaders here, as the pipelines
   // UIDs are still be in the map. Therefore, when these are rebuilt, the shaders will also
   // be recompiled.
@@ -122,11 +124,11 @@ void ShaderCache::Shutdown()
 
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
-  auto it = m_gx_pipeline_cache.find(uid);
-  if (it != m_gx_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  const auto* entry = m_gx_pipeline_cache.Find(uid);
+  if (entry && !entry->second)
+    return entry->first.get();
 
-  const bool exists_in_cache = it != m_gx_pipeline_cache.end();
+  const bool exists_in_cache = entry != nullptr;
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
@@ -138,12 +140,12 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 
 std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
 {
-  auto it = m_gx_pipeline_cache.find(uid);
-  if (it != m_gx_pipeline_cache.end())
+  const auto* entry = m_gx_pipeline_cache.Find(uid);
+  if (entry)
   {
     // .second is the pending flag, i.e. compiling in the background.
-    if (!it->second.second)
-      return it->second.first.get();
+    if (!entry->second)
+      return entry->first.get();
     else
       return {};
   }
@@ -155,9 +157,9 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
 
 const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid)
 {
-  auto it = m_gx_uber_pipeline_cache.find(uid);
-  if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  const auto* entry = m_gx_uber_pipeline_cache.Find(uid);
+  if (entry && !entry->second)
+    return entry->first.get();
 
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
@@ -205,6 +207,15 @@ void ShaderCache::WaitForAsyncCompiler()
   g_presenter->Present();
 }
 
+void ShaderCache::WaitForLoadedCacheEntries()
+{
+  // Without worker threads, the entries were already created while the cache was read.
+  if (m_async_shader_compiler->HasWorkerThreads())
+    WaitForAsyncCompiler();
+  else
+    m_async_shader_compiler->RetrieveWorkItems();
+}
+
 template <typename SerializedUidType, typename UidType>
 static void SerializePipelineUid(const UidType& uid, SerializedUidType& serialized_uid)
 {
@@ -234,18 +245,33 @@ static void UnserializePipelineUid(const SerializedUidType& uid, UidType& real_u
 template <ShaderStage stage, typename K, typename T>
 void ShaderCache::LoadShaderCache(T& cache, APIType api_type, const char* type, bool include_gameid)
 {
-  class CacheReader : public Common::LinearDiskCacheReader<K, u8>
+  // The shaders are created on the compiler threads, as some drivers take a while for each one,
+  // and a cache can hold tens of thousands of them.
+  class ShaderBinaryWorkItem final : public AsyncShaderCompiler::WorkItem
   {
   public:
-    CacheReader(T& cache_) : cache(cache_) {}
-    void Read(const K& key, const u8* value, u32 value_size) override
+    ShaderBinaryWorkItem(T& cache_, const K& key_, const u8* value, u32 value_size)
+        : cache(cache_), key(key_), binary(value, value + value_size)
     {
-      auto shader = g_gfx->CreateShaderFromBinary(stage, value, value_size);
-      if (shader)
+    }
+
+    bool Compile() override
+    {
+      shader = g_gfx->CreateShaderFromBinary(stage, binary.data(), binary.size());
+      binary = {};
+      return true;
+    }
+
+    void Retrieve() override
+    {
+      if (!shader)
+        return;
+
+      auto& entry = cache.shader_map[key];
+      entry.pending = false;
+      if (!entry.shader)
       {
-        auto& entry = cache.shader_map[key];
         entry.shader = std::move(shader);
-        entry.pending = false;
 
         switch (stage)
         {
@@ -265,10 +291,31 @@ void ShaderCache::LoadShaderCache(T& cache, APIType api_type, const char* type,
 
   private:
     T& cache;
+    K key;
+    std::vector<u8> binary;
+    std::unique_ptr<AbstractShader> shader;
+  };
+
+  class CacheReader : public Common::LinearDiskCacheReader<K, u8>
+  {
+  public:
+    CacheReader(ShaderCache* this_ptr_, T& cache_) : this_ptr(this_ptr_), cache(cache_) {}
+    void Read(const K& key, const u8* value, u32 value_size) override
+    {
+      auto wi = this_ptr->m_async_shader_compiler->CreateWorkItem<ShaderBinaryWorkItem>(
+          cache, key, value, value_size);
+      this_ptr->m_async_shader_compiler->QueueWorkItem(std::move(wi),
+                                                       COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+      this_ptr->m_async_shader_compiler->WaitForPendingWork(MAX_PENDING_CACHE_ENTRIES);
+    }
+
+  private:
+    ShaderCache* this_ptr;
+    T& cache;
   };
 
   std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
-  CacheReader reader(cache);
+  CacheReader reader(this, cache);
   u32 count = cache.disk_cache.OpenAndRead(filename, reader);
   INFO_LOG_FMT(VIDEO, "Loaded {} cached shaders from {}", count, filename);
 }
@@ -278,53 +325,92 @@ void ShaderCache::ClearShaderCache(T& cache)
 {
   cache.disk_cache.Sync();
   cache.disk_cache.Close();
-  cache.shader_map.clear();
+  cache.shader_map.Clear();
 }
 
 template <typename KeyType, typename DiskKeyType, typename T>
 void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyType, u8>& disk_cache,
                                     APIType api_type, const char* type, bool include_gameid)
 {
+  // Like the shaders, the pipelines are created on the compiler threads. The configs are looked up
+  // on this thread, as they refer to the shaders.
+  class CachedPipelineWorkItem final : public AsyncShaderCompiler::WorkItem
+  {
+  public:
+    CachedPipelineWorkItem(T& cache_, const KeyType& uid_, const AbstractPipelineConfig& config_,
+                           const u8* value, u32 value_size, std::shared_ptr<bool> failed_)
+        : cache(cache_), uid(uid_), config(config_), cache_data(value, value + value_size),
+          failed(std::move(failed_))
+    {
+    }
+
+    bool Compile() override
+    {
+      pipeline = g_gfx->CreatePipeline(config, cache_data.data(), cache_data.size());
+      cache_data = {};
+      return true;
+    }
+
+    void Retrieve() override
+    {
+      if (!pipeline)
+      {
+        // If any of the pipelines fail to create, consider the cache stale.
+        *failed = true;
+        return;
+      }
+
+      auto& entry = cache[uid];
+      entry.second = false;
+      if (!entry.first)
+        entry.first = std::move(pipeline);
+    }
+
+  private:
+    T& cache;
+    KeyType uid;
+    AbstractPipelineConfig config;
+    std::vector<u8> cache_data;
+    std::shared_ptr<bool> failed;
+    std::unique_ptr<AbstractPipeline> pipeline;
+  };
+
   class CacheReader : public Common::LinearDiskCacheReader<DiskKeyType, u8>
   {
   public:
     CacheReader(ShaderCache* this_ptr_, T& cache_) : this_ptr(this_ptr_), cache(cache_) {}
-    bool AnyFailed() const { return failed; }
+    bool AnyFailed() const { return *failed; }
     void Read(const DiskKeyType& key, const u8* value, u32 value_size) override
     {
       KeyType real_uid;
       UnserializePipelineUid(key, real_uid);
 
       // Skip those which are already compiled.
-      if (failed || cache.contains(real_uid))
+      if (*failed || cache.Contains(real_uid))
         return;
 
       auto config = this_ptr->GetGXPipelineConfig(real_uid);
       if (!config)
         return;
 
-      auto pipeline = g_gfx->CreatePipeline(*config, value, value_size);
-      if (!pipeline)
-      {
-        // If any of the pipelines fail to create, consider the cache stale.
-        failed = true;
-        return;
-      }
-
-      auto& entry = cache[real_uid];
-      entry.first = std::move(pipeline);
-      entry.second = false;
+      auto wi = this_ptr->m_async_shader_compiler->CreateWorkItem<CachedPipelineWorkItem>(
+          cache, real_uid, *config, value, value_size, failed);
+      this_ptr->m_async_shader_compiler->QueueWorkItem(std::move(wi),
+                                                       COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+      this_ptr->m_async_shader_compiler->WaitForPendingWork(MAX_PENDING_CACHE_ENTRIES);
     }
 
   private:
     ShaderCache* this_ptr;
     T& cache;
-    bool failed = false;
+    // Shared with the work items, which can outlive the load if it is interrupted.
+    std::shared_ptr<bool> failed = std::make_shared<bool>(false);
   };
 
   std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
   CacheReader reader(this, cache);
   const u32 count = disk_cache.OpenAndRead(filename, reader);
+  WaitForLoadedCacheEntries();
   INFO_LOG_FMT(VIDEO, "Loaded {} cached pipelines from {}", count, filename);
 
   // If any of the pipelines in the cache failed to create, it's likely because of a change of
@@ -348,11 +434,10 @@ void ShaderCache::ClearPipelineCache(T& cache, Y& disk_cache)
   disk_cache.Close();
 
   // Set the pending flag to false, and destroy the pipeline.
-  for (auto& it : cache)
-  {
-    it.second.first.reset();
-    it.second.second = false;
-  }
+  cache.ForEach([](const auto&, auto& entry) {
+    entry.first.reset();
+    entry.second = false;
+  });
 }
 
 void ShaderCache::LoadCaches()
@@ -375,6 +460,9 @@ void ShaderCache::LoadCaches()
                                                           true);
     LoadShaderCache<ShaderStage::Pixel, PixelShaderUid>(m_ps_cache, m_api_type, "specialized-ps",
                                                         true);
+
+    // The pipelines are created from the shaders, so they have to be loaded first.
+    WaitForLoadedCacheEntries();
   }
 
   if (g_backend_info.bSupportsPipelineCacheData)
@@ -424,16 +512,15 @@ void ShaderCache::ClearCaches()
 void ShaderCache::CompileMissingPipelines()
 {
   // Queue all uids with a null pipeline for compilation.
-  for (auto& it : m_gx_pipeline_cache)
-  {
-    if (!it.second.first)
-      QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
-  }
-  for (auto& it : m_gx_uber_pipeline_cache)
-  {
-    if (!it.second.first)
-      QueueUberPipelineCompile(it.first, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
-  }
+  // This only sets the pending flag of the UIDs which are iterated, so it doesn't insert any.
+  m_gx_pipeline_cache.ForEach([&](const GXPipelineUid& uid, const auto& entry) {
+    if (!entry.first)
+      QueuePipelineCompile(uid, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+  });
+  m_gx_uber_pipeline_cache.ForEach([&](const GXUberPipelineUid& uid, const auto& entry) {
+    if (!entry.first)
+      QueueUberPipelineCompile(uid, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
+  });
 }
 
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
@@ -615,9 +702,9 @@ ShaderCache::GetGXPipelineConfig(const GXPipelineUid& config_in)
 {
   GXPipelineUid config = VideoCommon::ApplyDriverBugs(config_in);
   const AbstractShader* vs;
-  auto vs_iter = m_vs_cache.shader_map.find(config.vs_uid);
-  if (vs_iter != m_vs_cache.shader_map.end() && !vs_iter->second.pending)
-    vs = vs_iter->second.shader.get();
+  const auto* vs_entry = m_vs_cache.shader_map.Find(config.vs_uid);
+  if (vs_entry && !vs_entry->pending)
+    vs = vs_entry->shader.get();
   else
     vs = InsertVertexShader(config.vs_uid, CompileVertexShader(config.vs_uid));
 
@@ -625,9 +712,9 @@ ShaderCache::GetGXPipelineConfig(const GXPipelineUid& config_in)
   ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
 
   const AbstractShader* ps;
-  auto ps_iter = m_ps_cache.shader_map.find(ps_uid);
-  if (ps_iter != m_ps_cache.shader_map.end() && !ps_iter->second.pending)
-    ps = ps_iter->second.shader.get();
+  const auto* ps_entry = m_ps_cache.shader_map.Find(ps_uid);
+  if (ps_entry && !ps_entry->pending)
+    ps = ps_entry->shader.get();
   else
     ps = InsertPixelShader(ps_uid, CompilePixelShader(ps_uid));
 
@@ -637,9 +724,9 @@ ShaderCache::GetGXPipelineConfig(const GXPipelineUid& config_in)
   const AbstractShader* gs = nullptr;
   if (NeedsGeometryShader(config.gs_uid))
   {
-    auto gs_iter = m_gs_cache.shader_map.find(config.gs_uid);
-    if (gs_iter != m_gs_cache.shader_map.end() && !gs_iter->second.pending)
-      gs = gs_iter->second.shader.get();
+    const auto* gs_entry = m_gs_cache.shader_map.Find(config.gs_uid);
+    if (gs_entry && !gs_entry->pending)
+      gs = gs_entry->shader.get();
     else
       gs = CreateGeometryShader(config.gs_uid);
     if (!gs)
@@ -705,9 +792,9 @@ ShaderCache::GetGXPipelineConfig(const GXUberPipelineUid& config_in)
 {
   GXUberPipelineUid config = ApplyDriverBugs(config_in);
   const AbstractShader* vs;
-  auto vs_iter = m_uber_vs_cache.shader_map.find(config.vs_uid);
-  if (vs_iter != m_uber_vs_cache.shader_map.end() && !vs_iter->second.pending)
-    vs = vs_iter->second.shader.get();
+  const auto* vs_entry = m_uber_vs_cache.shader_map.Find(config.vs_uid);
+  if (vs_entry && !vs_entry->pending)
+    vs = vs_entry->shader.get();
   else
     vs = InsertVertexUberShader(config.vs_uid, CompileVertexUberShader(config.vs_uid));
 
@@ -715,9 +802,9 @@ ShaderCache::GetGXPipelineConfig(const GXUberPipelineUid& config_in)
   UberShader::ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
 
   const AbstractShader* ps;
-  auto ps_iter = m_uber_ps_cache.shader_map.find(ps_uid);
-  if (ps_iter != m_uber_ps_cache.shader_map.end() && !ps_iter->second.pending)
-    ps = ps_iter->second.shader.get();
+  const auto* ps_entry = m_uber_ps_cache.shader_map.Find(ps_uid);
+  if (ps_entry && !ps_entry->pending)
+    ps = ps_entry->shader.get();
   else
     ps = InsertPixelUberShader(ps_uid, CompilePixelUberShader(ps_uid));
 
@@ -727,9 +814,9 @@ ShaderCache::GetGXPipelineConfig(const GXUberPipelineUid& config_in)
   const AbstractShader* gs = nullptr;
   if (NeedsGeometryShader(config.gs_uid))
   {
-    auto gs_iter = m_gs_cache.shader_map.find(config.gs_uid);
-    if (gs_iter != m_gs_cache.shader_map.end() && !gs_iter->second.pending)
-      gs = gs_iter->second.shader.get();
+    const auto* gs_entry = m_gs_cache.shader_map.Find(config.gs_uid);
+    if (gs_entry && !gs_entry->pending)
+      gs = gs_entry->shader.get();
     else
       gs = CreateGeometryShader(config.gs_uid);
     if (!gs)
@@ -794,53 +881,23 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
 
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
-  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
-  std::string filename =
-      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  const std::string filename = PipelineUIDCache::GetUserCachePath(game_id);
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
     // If an existing case exists, validate the version before reading entries.
-    u32 existing_magic;
-    u32 existing_version;
-    bool uid_file_valid = false;
-    if (m_gx_pipeline_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
-        m_gx_pipeline_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
-        existing_magic == CACHE_FILE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
+    const auto uids = PipelineUIDCache::ReadUIDs(m_gx_pipeline_uid_cache_file);
+    if (uids)
     {
-      // Ensure the expected size matches the actual size of the file. If it doesn't, it means
-      // the cache file may be corrupted, and we should not proceed with loading potentially
-      // garbage or invalid UIDs.
-      const u64 file_size = m_gx_pipeline_uid_cache_file.GetSize();
-      const size_t uid_count =
-          static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
-      const size_t expected_size = uid_count * sizeof(SerializedGXPipelineUid) + CACHE_HEADER_SIZE;
-      uid_file_valid = file_size == expected_size;
-      if (uid_file_valid)
-      {
-        for (size_t i = 0; i < uid_count; i++)
-        {
-          SerializedGXPipelineUid serialized_uid;
-          if (m_gx_pipeline_uid_cache_file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
-          {
-            // This just adds the pipeline to the map, it is compiled later.
-            AddSerializedGXPipelineUID(serialized_uid);
-          }
-          else
-          {
-            uid_file_valid = false;
-            break;
-          }
-        }
-      }
-
-      // We open the file for reading and writing, so we must seek to the end before writing.
-      if (uid_file_valid)
-        uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
+      // This just adds the pipelines to the map, they are compiled later.
+      m_gx_pipeline_cache.Reserve(m_gx_pipeline_cache.Size() + uids->size());
+      for (const SerializedGXPipelineUid& serialized_uid : *uids)
+        AddSerializedGXPipelineUID(serialized_uid);
     }
 
+    // We open the file for reading and writing, so we must seek to the end before writing.
     // If the file is invalid, close it. We re-open and truncate it below.
-    if (!uid_file_valid)
+    if (!uids || !m_gx_pipeline_uid_cache_file.Seek(0, File::SeekOrigin::End))
       m_gx_pipeline_uid_cache_file.Close();
   }
 
@@ -850,19 +907,37 @@ void ShaderCache::LoadPipelineUIDCache()
     if (m_gx_pipeline_uid_cache_file.Open(filename, "wb"))
     {
       // Write the version identifier.
-      m_gx_pipeline_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(GX_PIPELINE_UID_VERSION));
-      m_gx_pipeline_uid_cache_file.WriteBytes(&GX_PIPELINE_UID_VERSION,
-                                              sizeof(GX_PIPELINE_UID_VERSION));
+      PipelineUIDCache::WriteHeader(m_gx_pipeline_uid_cache_file);
 
       // Write any current UIDs out to the file.
       // This way, if we load a UID cache where the data was incomplete (e.g. Dolphin crashed),
       // we don't lose the existing UIDs which were previously at the beginning.
-      for (const auto& it : m_gx_pipeline_cache)
-        AppendGXPipelineUID(it.first);
+      m_gx_pipeline_cache.ForEach(
+          [this](const GXPipelineUid& uid, const auto&) { AppendGXPipelineUID(uid); });
     }
   }
 
-  INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.size(), filename);
+  INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.Size(), filename);
+
+  // The shared UID cache is only read. Its UIDs aren't written to the file above, as they are
+  // already in the map when the game uses them.
+  const std::string shared_filename = PipelineUIDCache::GetSharedCachePath(game_id);
+  if (File::Exists(shared_filename))
+  {
+    const auto shared_uids = PipelineUIDCache::ReadUIDs(shared_filename);
+    if (shared_uids)
+    {
+      m_gx_pipeline_cache.Reserve(m_gx_pipeline_cache.Size() + shared_uids->size());
+      for (const SerializedGXPipelineUid& serialized_uid : *shared_uids)
+        AddSerializedGXPipelineUID(serialized_uid);
+      INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", shared_uids->size(), shared_filename);
+    }
+    else
+    {
+      WARN_LOG_FMT(VIDEO, "Shared UID cache '{}' is invalid or of another version, ignoring it",
+                   shared_filename);
+    }
+  }
 }
 
 void ShaderCache::ClosePipelineUIDCache()
@@ -876,13 +951,9 @@ void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
   GXPipelineUid real_uid;
   UnserializePipelineUid(uid, real_uid);
 
-  auto iter = m_gx_pipeline_cache.find(real_uid);
-  if (iter != m_gx_pipeline_cache.end())
-    return;
-
-  // Flag it as empty with a null pipeline object, for later compilation.
-  auto& entry = m_gx_pipeline_cache[real_uid];
-  entry.second = false;
+  // Flag it as empty with a null pipeline object, for later compilation. An existing entry is
+  // left as it is.
+  m_gx_pipeline_cache[real_uid];
 }
 
 void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
@@ -1035,17 +1106,17 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
 
       GXPipelineUid actual_uid = ApplyDriverBugs(uid);
 
-      auto vs_it = shader_cache->m_vs_cache.shader_map.find(actual_uid.vs_uid);
-      stages_ready &= vs_it != shader_cache->m_vs_cache.shader_map.end() && !vs_it->second.pending;
-      if (vs_it == shader_cache->m_vs_cache.shader_map.end())
+      const auto* vs_entry = shader_cache->m_vs_cache.shader_map.Find(actual_uid.vs_uid);
+      stages_ready &= vs_entry && !vs_entry->pending;
+      if (!vs_entry)
         shader_cache->QueueVertexShaderCompile(actual_uid.vs_uid, priority);
 
       PixelShaderUid ps_uid = actual_uid.ps_uid;
       ClearUnusedPixelShaderUidBits(shader_cache->m_api_type, shader_cache->m_host_config, &ps_uid);
 
-      auto ps_it = shader_cache->m_ps_cache.shader_map.find(ps_uid);
-      stages_ready &= ps_it != shader_cache->m_ps_cache.shader_map.end() && !ps_it->second.pending;
-      if (ps_it == shader_cache->m_ps_cache.shader_map.end())
+      const auto* ps_entry = shader_cache->m_ps_cache.shader_map.Find(ps_uid);
+      stages_ready &= ps_entry && !ps_entry->pending;
+      if (!ps_entry)
         shader_cache->QueuePixelShaderCompile(ps_uid, priority);
 
       return stages_ready;
@@ -1107,20 +1178,18 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
 
       GXUberPipelineUid actual_uid = ApplyDriverBugs(uid);
 
-      auto vs_it = shader_cache->m_uber_vs_cache.shader_map.find(actual_uid.vs_uid);
-      stages_ready &=
-          vs_it != shader_cache->m_uber_vs_cache.shader_map.end() && !vs_it->second.pending;
-      if (vs_it == shader_cache->m_uber_vs_cache.shader_map.end())
+      const auto* vs_entry = shader_cache->m_uber_vs_cache.shader_map.Find(actual_uid.vs_uid);
+      stages_ready &= vs_entry && !vs_entry->pending;
+      if (!vs_entry)
         shader_cache->QueueVertexUberShaderCompile(actual_uid.vs_uid, priority);
 
       UberShader::PixelShaderUid ps_uid = actual_uid.ps_uid;
       UberShader::ClearUnusedPixelShaderUidBits(shader_cache->m_api_type,
                                                 shader_cache->m_host_config, &ps_uid);
 
-      auto ps_it = shader_cache->m_uber_ps_cache.shader_map.find(ps_uid);
-      stages_ready &=
-          ps_it != shader_cache->m_uber_ps_cache.shader_map.end() && !ps_it->second.pending;
-      if (ps_it == shader_cache->m_uber_ps_cache.shader_map.end())
+      const auto* ps_entry = shader_cache->m_uber_ps_cache.shader_map.Find(ps_uid);
+      stages_ready &= ps_entry && !ps_entry->pending;
+      if (!ps_entry)
         shader_cache->QueuePixelUberShaderCompile(ps_uid, priority);
 
       return stages_ready;
@@ -1192,12 +1261,8 @@ void ShaderCache::QueueUberShaderPipelines()
           config.blending_state.logic_mode = LogicOp::And;
         }
 
-        auto iter = m_gx_uber_pipeline_cache.find(config);
-        if (iter != m_gx_uber_pipeline_cache.end())
-          return;
-
-        auto& entry = m_gx_uber_pipeline_cache[config];
-        entry.second = false;
+        // An existing entry is left as it is
+        m_gx_uber_pipeline_cache[config];
       };
 
   // Populate the pipeline configs with empty entries, these will be compiled afterwards.
@@ -29,6 +29,7 @@
 #include "VideoCommon/TextureConverterShaderGen.h"
 #include "VideoCommon/UberShaderPixel.h"
 #include "VideoCommon/UberShaderVertex.h"
+#include "VideoCommon/UidMap.h"
 #include "VideoCommon/VertexShaderGen.h"
 #include "VideoCommon/VideoEvents.h"
 
@@ -118,6 +119,7 @@ private:
   static constexpr size_t NUM_PALETTE_CONVERSION_SHADERS = 3;
 
   void WaitForAsyncCompiler();
+  void WaitForLoadedCacheEntries();
   void LoadCaches();
   void ClearCaches();
   void LoadPipelineUIDCache();
@@ -192,6 +194,10 @@ private:
     COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
   };
 
+  // How many entries read from the disk caches can wait for a compiler thread at once, as each
+  // holds a copy of its data.
+  static constexpr size_t MAX_PENDING_CACHE_ENTRIES = 1024;
+
   // Configuration bits.
   APIType m_api_type;
   ShaderHostConfig m_host_config = {};
@@ -215,7 +221,7 @@ private:
       std::unique_ptr<AbstractShader> shader;
       bool pending = false;
     };
-    std::map<Uid, Shader> shader_map;
+    VideoCommon::UidMap<Uid, Shader> shader_map;
     Common::LinearDiskCache<Uid, u8> disk_cache;
   };
   ShaderModuleCache<VertexShaderUid> m_vs_cache;
@@ -225,8 +231,9 @@ private:
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
   // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
-  std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
+  VideoCommon::UidMap<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
+      m_gx_pipeline_cache;
+  VideoCommon::UidMap<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
       m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
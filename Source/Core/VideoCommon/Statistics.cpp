@@ -81,6 +81,9 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Custom tex prefetched", "%d", num_custom_textures_prefetched);
+  draw_statistic("Custom tex ready on use", "%d/%d", num_custom_textures_ready_on_first_use,
+                 num_custom_textures_first_used);
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
@@ -4,10 +4,28 @@
 #pragma once
 
 #include <array>
+#include <chrono>
+#include <optional>
 #include <vector>
 
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
 #include "VideoCommon/BPFunctions.h"
 
+// Parts of command processing whose run time can be measured, e.g. for benchmarking FIFO logs.
+// The phases nest: BP writes can flush vertices and load textures, and everything happens during
+// opcode decoding, so their times overlap.
+enum class VideoPhase
+{
+  OpcodeDecode,
+  VertexLoading,
+  BPWrites,
+  CPWrites,
+  XFWrites,
+  TextureCacheLookup,
+  TextureDecode,
+};
+
 struct Statistics
 {
   int num_pixel_shaders_created = 0;
@@ -19,6 +37,12 @@ struct Statistics
   int num_textures_uploaded = 0;
   int num_textures_alive = 0;
 
+  // Custom textures which were prefetched, and how many of the textures the game used were
+  // loaded by the time they were first used.
+  int num_custom_textures_prefetched = 0;
+  int num_custom_textures_first_used = 0;
+  int num_custom_textures_ready_on_first_use = 0;
+
   int num_vertex_loaders = 0;
 
   std::array<float, 6> proj{};
@@ -81,6 +105,13 @@ struct Statistics
     int num_token_int = 0;
   };
   ThisFrame this_frame;
+
+  // Reading the clock for every command isn't free, so phase times are only measured on request.
+  // They are accumulated on the GPU thread, so reading them is only safe when the GPU is idle or
+  // runs on the same thread (single core).
+  bool phase_timing_enabled = false;
+  Common::EnumMap<std::chrono::nanoseconds, VideoPhase::TextureDecode> phase_times{};
+
   void ResetFrame();
   void SwapDL();
   void AddScissorRect();
@@ -94,6 +125,29 @@ struct Statistics
 
 extern Statistics g_stats;
 
+// Adds the time until it goes out of scope to the given phase, if phase timing is enabled.
+class ScopedPhaseTimer
+{
+public:
+  explicit ScopedPhaseTimer(VideoPhase phase) : m_phase(phase)
+  {
+    if (g_stats.phase_timing_enabled) [[unlikely]]
+      m_start = std::chrono::steady_clock::now();
+  }
+  ~ScopedPhaseTimer()
+  {
+    if (m_start) [[unlikely]]
+      g_stats.phase_times[m_phase] += std::chrono::steady_clock::now() - *m_start;
+  }
+
+  ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+  ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+private:
+  VideoPhase m_phase;
+  std::optional<std::chrono::steady_clock::time_point> m_start;
+};
+
 #define STATISTICS
 
 #ifdef STATISTICS
@@ -62,6 +62,8 @@ static const u64 TEXHASH_INVALID = 0;
 // Sonic the Fighters (inside Sonic Gems Collection) loops a 64 frames animation
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
+// Smaller textures decode quickly enough that handing them to a worker isn't worth the copies.
+static const u32 ASYNC_DECODE_MIN_TEXELS = 128 * 128;
 
 static int xfb_count = 0;
 
@@ -94,6 +96,7 @@ void TextureCacheBase::CheckTempSize(size_t required_size)
 TextureCacheBase::TextureCacheBase()
 {
   SetBackupConfig(g_ActiveConfig);
+  m_async_texture_decoder.SetEnabled(m_backup_config.async_texture_decoding);
 
   m_temp_size = 2048 * 2048 * 4;
   m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
@@ -109,6 +112,9 @@ void TextureCacheBase::Shutdown()
   // Clear pending EFB copies first, so we don't try to flush them.
   m_pending_efb_copies.clear();
 
+  // Finishes the levels which are still being decoded, so no worker outlives the texture cache.
+  m_async_texture_decoder.SetEnabled(false);
+
   HiresTexture::Shutdown();
 
   // For correctness, we need to invalidate textures before the gpu context starts shutting down.
@@ -137,9 +143,14 @@ void TextureCacheBase::Invalidate()
   FlushEFBCopies();
   TMEM::InvalidateAll();
 
+  // The textures which are still being decoded are dropped below. Wait for their workers anyway,
+  // as the decoders read the texture format overlay options, which may be about to change.
+  m_async_texture_decoder.WaitForCompletion();
+  m_pending_async_decodes.clear();
+
   for (auto& bind : m_bound_textures)
     bind.reset();
-  m_textures_by_hash.clear();
+  m_textures_by_hash.Clear();
   m_textures_by_address.clear();
 
   m_texture_pool.clear();
@@ -148,7 +159,8 @@ void TextureCacheBase::Invalidate()
 void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
 {
   if (config.bHiresTextures != m_backup_config.hires_textures ||
-      config.bCacheHiresTextures != m_backup_config.cache_hires_textures)
+      config.bCacheHiresTextures != m_backup_config.cache_hires_textures ||
+      config.bPrefetchHiresTextures != m_backup_config.prefetch_hires_textures)
   {
     HiresTexture::Update();
   }
@@ -158,6 +170,7 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
 
   // TODO: Invalidating texcache is really stupid in some of these cases
   if (config.iSafeTextureCache_ColorSamples != m_backup_config.color_samples ||
+      config.safe_texture_cache_samples_by_size != m_backup_config.samples_by_size ||
       config.bTexFmtOverlayEnable != m_backup_config.texfmt_overlay ||
       config.bTexFmtOverlayCenter != m_backup_config.texfmt_overlay_center ||
       config.bHiresTextures != m_backup_config.hires_textures ||
@@ -171,6 +184,10 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  // Textures which are still pending are uploaded as usual when the decoder is disabled, as the
+  // workers finish their queued levels before stopping.
+  m_async_texture_decoder.SetEnabled(config.bAsyncTextureDecoding);
+
   SetBackupConfig(config);
 }
 
@@ -247,16 +264,19 @@ bool TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
 void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
 {
   m_backup_config.color_samples = config.iSafeTextureCache_ColorSamples;
+  m_backup_config.samples_by_size = config.safe_texture_cache_samples_by_size;
   m_backup_config.texfmt_overlay = config.bTexFmtOverlayEnable;
   m_backup_config.texfmt_overlay_center = config.bTexFmtOverlayCenter;
   m_backup_config.hires_textures = config.bHiresTextures;
   m_backup_config.cache_hires_textures = config.bCacheHiresTextures;
+  m_backup_config.prefetch_hires_textures = config.bPrefetchHiresTextures;
   m_backup_config.stereo_3d = config.stereo_mode != StereoMode::Off;
   m_backup_config.efb_mono_depth = config.bStereoEFBMonoDepth;
   m_backup_config.gpu_texture_decoding = config.bEnableGPUTextureDecoding;
   m_backup_config.disable_vram_copies = config.bDisableCopyToVRAM;
   m_backup_config.arbitrary_mipmap_detection = config.bArbitraryMipmapDetection;
   m_backup_config.graphics_mods = config.bGraphicMods;
+  m_backup_config.async_texture_decoding = config.bAsyncTextureDecoding;
   m_backup_config.graphics_mod_change_count =
       config.graphics_mod_config ? config.graphics_mod_config->GetChangeCount() : 0;
 }
@@ -551,6 +571,9 @@ void TextureCacheBase::DoState(PointerWrap& p)
   // Flush all pending XFB copies before either loading or saving.
   FlushEFBCopies();
 
+  // Textures are saved from VRAM, so all of their levels need to be uploaded.
+  FinishAllAsyncDecodes(true);
+
   p.Do(m_last_entry_id);
 
   if (p.IsWriteMode() || p.IsMeasureMode())
@@ -605,14 +628,13 @@ void TextureCacheBase::DoSaveState(PointerWrap& p)
         textures_by_address_list.emplace_back(it.first, id);
       }
     }
-    for (const auto& it : m_textures_by_hash)
-    {
-      if (ShouldSaveEntry(it.second))
+    m_textures_by_hash.ForEach([&](u64 hash, const RcTcacheEntry& entry) {
+      if (ShouldSaveEntry(entry))
       {
-        const u32 id = AddCacheEntryToMap(it.second);
-        textures_by_hash_list.emplace_back(it.first, id);
+        const u32 id = AddCacheEntryToMap(entry);
+        textures_by_hash_list.emplace_back(hash, id);
       }
-    }
+    });
     for (u32 i = 0; i < m_bound_textures.size(); i++)
     {
       const auto& tentry = m_bound_textures[i];
@@ -704,7 +726,6 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
     auto tex = DeserializeTexture(p);
     auto entry =
         std::make_shared<TCacheEntry>(std::move(tex->texture), std::move(tex->framebuffer));
-    entry->textures_by_hash_iter = m_textures_by_hash.end();
     entry->DoState(p);
     if (entry->texture && commit_state)
       id_map.emplace(i, entry);
@@ -749,7 +770,10 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      entry->textures_by_hash_iter = m_textures_by_hash.emplace(hash, entry);
+    {
+      m_textures_by_hash.Insert(hash, entry);
+      entry->textures_by_hash_key = hash;
+    }
   }
 
   // Clear bound textures
@@ -778,6 +802,10 @@ void TextureCacheBase::OnFrameEnd()
   // copies.
   FlushEFBCopies();
 
+  // Upload the textures which finished decoding without being drawn with, so their decoded data
+  // doesn't stay around.
+  FinishAllAsyncDecodes(false);
+
   Cleanup(g_presenter->FrameCount());
 }
 
@@ -847,6 +875,10 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
     {
       if (entry->hash == entry->CalculateHash())
       {
+        // The EFB copy is drawn over the decoded texture, so that has to be uploaded first.
+        if (entry_to_update->pending_decode)
+          FinishAsyncDecode(*entry_to_update, true);
+
         // If the texture formats are not compatible or convertible, skip it.
         if (!IsCompatibleTextureFormat(entry_to_update->format.texfmt, entry->format.texfmt))
         {
@@ -987,6 +1019,19 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
   return entry_to_update;
 }
 
+// Smaller textures can be given more samples, as hashing all of a small texture costs little more
+// than sampling it.
+static int GetHashSampleSize(int color_samples, u32 size_in_bytes)
+{
+  for (const auto& [max_size, samples] : g_ActiveConfig.safe_texture_cache_samples_by_size)
+  {
+    if (size_in_bytes <= max_size)
+      return samples;
+  }
+
+  return color_samples;
+}
+
 // Helper for checking if a BPMemory TexMode0 register is set to Point
 // Filtering modes. This is used to decide whether Anisotropic enhancements
 // are (mostly) safe in the VideoBackends.
@@ -1074,10 +1119,30 @@ void TextureCacheBase::BindTextures(BitSet32 used_textures,
     const RcTcacheEntry& tentry = m_bound_textures[i];
     if (used_textures[i] && tentry)
     {
-      g_gfx->SetTexture(i, tentry->texture.get());
+      const AbstractTexture* texture = tentry->texture.get();
+      SamplerState state = samplers[i];
+      if (tentry->pending_decode && !FinishAsyncDecode(*tentry, false))
+      {
+        if (tentry->placeholder && tentry->placeholder->texture)
+        {
+          texture = tentry->placeholder->texture.get();
+        }
+        else if (tentry->pending_decode->HasDecodedLowerLevels())
+        {
+          // Only the first level is still being decoded, so sample the lower levels meanwhile.
+          // The LOD is in units of 1/16.
+          state.tm1.min_lod = 16;
+          state.tm1.max_lod = std::max<u32>(state.tm1.max_lod, 16);
+        }
+        else
+        {
+          FinishAsyncDecode(*tentry, true);
+        }
+      }
+
+      g_gfx->SetTexture(i, texture);
       pixel_shader_manager.SetTexDims(i, tentry->native_width, tentry->native_height);
 
-      auto& state = samplers[i];
       g_gfx->SetSamplerState(i, state);
       pixel_shader_manager.SetSamplerState(i, state.tm0.hex, state.tm1.hex);
     }
@@ -1233,6 +1298,7 @@ private:
 
 TCacheEntry* TextureCacheBase::Load(u32 stage)
 {
+  ScopedPhaseTimer timer(VideoPhase::TextureCacheLookup);
   if (auto entry = LoadImpl(stage, false))
   {
     if (!DidLinkedAssetsChange(*entry))
@@ -1309,6 +1375,9 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   if (!texture_info.IsDataValid())
     return {};
 
+  const int hash_sample_size =
+      GetHashSampleSize(textureCacheSafetyColorSampleSize, texture_info.GetTextureSize());
+
   // Hash assigned to texcache entry (also used to generate filenames used for texture dumping and
   // custom texture lookup)
   u64 base_hash = TEXHASH_INVALID;
@@ -1339,15 +1408,15 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  base_hash =
+      Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(), hash_sample_size);
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
     palette_size = *texture_info.GetPaletteSize();
     full_hash =
         base_hash ^ Common::GetHash64(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
-                                      textureCacheSafetyColorSampleSize);
+                                      hash_sample_size);
   }
   else
   {
@@ -1525,35 +1594,39 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   // textures cause unnecessary slowdowns
   // Example: Tales of Symphonia (GC) uses over 500 small textures in menus, but only around 70
   // different ones
-  if (textureCacheSafetyColorSampleSize == 0 ||
-      std::max(texture_info.GetTextureSize(), palette_size) <=
-          (u32)textureCacheSafetyColorSampleSize * 8)
-  {
-    auto hash_range = m_textures_by_hash.equal_range(full_hash);
-    TexHashCache::iterator hash_iter = hash_range.first;
-    while (hash_iter != hash_range.second)
-    {
-      RcTcacheEntry& entry = hash_iter->second;
-      // All parameters, except the address, need to match here
-      if (entry->format == full_format && entry->native_levels >= texture_info.GetLevelCount() &&
-          entry->native_width == texture_info.GetRawWidth() &&
-          entry->native_height == texture_info.GetRawHeight())
+  if (hash_sample_size == 0 ||
+      std::max(texture_info.GetTextureSize(), palette_size) <= (u32)hash_sample_size * 8)
+  {
+    // All parameters, except the address, need to match here
+    const RcTcacheEntry* found = m_textures_by_hash.FindIf(full_hash, [&](const RcTcacheEntry& e) {
+      return e->format == full_format && e->native_levels >= texture_info.GetLevelCount() &&
+             e->native_width == texture_info.GetRawWidth() &&
+             e->native_height == texture_info.GetRawHeight();
+    });
+
+    // The map must not be modified while it is searched, so the partial updates are only done
+    // once the entry has been found. Copy the entry, as the updates may invalidate textures.
+    if (found)
+    {
+      RcTcacheEntry entry = *found;
+      entry = DoPartialTextureUpdates(entry, texture_info.GetTlutAddress(),
+                                      texture_info.GetTlutFormat());
+      if (entry)
       {
-        entry = DoPartialTextureUpdates(hash_iter->second, texture_info.GetTlutAddress(),
-                                        texture_info.GetTlutFormat());
-        if (entry)
-        {
-          entry->texture->FinishedRendering();
-          return entry;
-        }
+        entry->texture->FinishedRendering();
+        return entry;
       }
-      ++hash_iter;
     }
   }
 
   // If at least one entry was not used for the same frame, overwrite the oldest one
+  RcTcacheEntry previous_entry;
   if (temp_frameCount != 0x7fffffff)
   {
+    // Keep the entry, so its texture can be drawn with while the new one is decoded
+    if (g_ActiveConfig.bAsyncTextureDecoding)
+      previous_entry = oldest_entry->second;
+
     // pool this texture and make a new one later
     InvalidateTexture(oldest_entry);
   }
@@ -1600,8 +1673,8 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 
   auto entry =
       CreateTextureEntry(TextureCreationInfo{base_hash, full_hash, bytes_per_block, palette_size},
-                         texture_info, textureCacheSafetyColorSampleSize, custom_texture_data.get(),
-                         has_arbitrary_mipmaps, skip_texture_dump);
+                         texture_info, hash_sample_size, custom_texture_data.get(),
+                         has_arbitrary_mipmaps, skip_texture_dump, previous_entry);
   entry->hires_texture = std::move(hires_texture);
   entry->last_load_time = load_time;
   entry->texture_info_name = std::move(texture_name);
@@ -1614,7 +1687,8 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     const TextureCreationInfo& creation_info, const TextureInfo& texture_info,
     const int safety_color_sample_size, VideoCommon::CustomTextureData* custom_texture_data,
-    const bool custom_arbitrary_mipmaps, bool skip_texture_dump)
+    const bool custom_arbitrary_mipmaps, bool skip_texture_dump,
+    const RcTcacheEntry& previous_entry)
 {
 #ifdef __APPLE__
   const bool no_mips = g_ActiveConfig.bNoMipmapping;
@@ -1668,96 +1742,117 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         g_ActiveConfig.UseGPUTextureDecoding() &&
         !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
 
-    ArbitraryMipmapDetector arbitrary_mip_detector;
-
-    // Initialized to null because only software loading uses this buffer
-    u8* dst_buffer = nullptr;
+    // Large textures can be decoded on worker threads, unless they are dumped right away. RGBA8
+    // textures from TMEM are split across both banks, so they are always decoded here.
+    const bool decode_async =
+        g_ActiveConfig.bAsyncTextureDecoding && !decode_on_gpu && !no_mips &&
+        !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8) &&
+        !(g_ActiveConfig.bDumpTextures && !skip_texture_dump) &&
+        expanded_width * expanded_height >= ASYNC_DECODE_MIN_TEXELS;
 
-    if (!decode_on_gpu ||
-        !DecodeTextureOnGPU(
-            entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
-            texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
-            creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
-            texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+    // When decoding asynchronously, the levels are uploaded once they are decoded, and
+    // has_arbitrary_mips is set then.
+    if (!decode_async || !DecodeTextureAsync(entry, texture_info, previous_entry))
     {
-      size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
+      ArbitraryMipmapDetector arbitrary_mip_detector;
 
-      // Allocate memory for all levels at once
-      size_t total_texture_size = decoded_texture_size;
+      // Initialized to null because only software loading uses this buffer
+      u8* dst_buffer = nullptr;
 
-      // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
-      size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
-
-      size_t prev_level_size = decoded_texture_size;
-      for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
+      if (!decode_on_gpu ||
+          !DecodeTextureOnGPU(
+              entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
+              texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
+              creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
+              texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
       {
-        prev_level_size /= 4;
-        total_texture_size += prev_level_size;
-      }
+        size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
 
-      // Add space for the downsampling at the end
-      total_texture_size += mip_downsample_buffer_size;
+        // Allocate memory for all levels at once
+        size_t total_texture_size = decoded_texture_size;
 
-      CheckTempSize(total_texture_size);
-      dst_buffer = m_temp;
-      if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
-      {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
-      }
-      else
-      {
-        TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
-                                       texture_info.GetTmemOddAddress(), expanded_width,
-                                       expanded_height);
-      }
+        // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
+        size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
 
-      entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
+        size_t prev_level_size = decoded_texture_size;
+        for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
+        {
+          prev_level_size /= 4;
+          total_texture_size += prev_level_size;
+        }
 
-      arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
+        // Add space for the downsampling at the end
+        total_texture_size += mip_downsample_buffer_size;
 
-      dst_buffer += decoded_texture_size;
-    }
+        CheckTempSize(total_texture_size);
+        dst_buffer = m_temp;
+        {
+          ScopedPhaseTimer timer(VideoPhase::TextureDecode);
+          if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 &&
+                texture_info.IsFromTmem()))
+          {
+            TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
+                              texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                              texture_info.GetTlutFormat());
+          }
+          else
+          {
+            TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
+                                           texture_info.GetTmemOddAddress(), expanded_width,
+                                           expanded_height);
+          }
+        }
 
-    for (const auto& mip_level : texture_info.GetMipMapLevels())
-    {
-      if (no_mips)
-        break;
-      if (!mip_level.IsDataValid())
-      {
-        ERROR_LOG_FMT(VIDEO, "Trying to use an invalid mipmap address {:#010x}",
-                      texture_info.GetRawAddress());
-        continue;
+        entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
+
+        arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
+
+        dst_buffer += decoded_texture_size;
       }
 
-      if (!decode_on_gpu ||
-          !DecodeTextureOnGPU(entry, mip_level.GetLevel(), mip_level.GetData(),
-                              mip_level.GetTextureSize(), texture_info.GetTextureFormat(),
-                              mip_level.GetRawWidth(), mip_level.GetRawHeight(),
-                              mip_level.GetExpandedWidth(), mip_level.GetExpandedHeight(),
-                              creation_info.bytes_per_block *
-                                  (mip_level.GetExpandedWidth() / texture_info.GetBlockWidth()),
-                              texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+      for (const auto& mip_level : texture_info.GetMipMapLevels())
       {
-        // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
-        const u32 decoded_mip_size =
-            mip_level.GetExpandedWidth() * sizeof(u32) * mip_level.GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level.GetData(), mip_level.GetExpandedWidth(),
-                          mip_level.GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
-        entry->texture->Load(mip_level.GetLevel(), mip_level.GetRawWidth(),
-                             mip_level.GetRawHeight(), mip_level.GetExpandedWidth(), dst_buffer,
-                             decoded_mip_size);
-
-        arbitrary_mip_detector.AddLevel(mip_level.GetRawWidth(), mip_level.GetRawHeight(),
-                                        mip_level.GetExpandedWidth(), dst_buffer);
-
-        dst_buffer += decoded_mip_size;
+        if (no_mips)
+          break;
+        if (!mip_level.IsDataValid())
+        {
+          ERROR_LOG_FMT(VIDEO, "Trying to use an invalid mipmap address {:#010x}",
+                        texture_info.GetRawAddress());
+          continue;
+        }
+
+        if (!decode_on_gpu ||
+            !DecodeTextureOnGPU(entry, mip_level.GetLevel(), mip_level.GetData(),
+                                mip_level.GetTextureSize(), texture_info.GetTextureFormat(),
+                                mip_level.GetRawWidth(), mip_level.GetRawHeight(),
+                                mip_level.GetExpandedWidth(), mip_level.GetExpandedHeight(),
+                                creation_info.bytes_per_block *
+                                    (mip_level.GetExpandedWidth() / texture_info.GetBlockWidth()),
+                                texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+        {
+          // No need to call CheckTempSize here, as the whole buffer is preallocated at the
+          // beginning
+          const u32 decoded_mip_size =
+              mip_level.GetExpandedWidth() * sizeof(u32) * mip_level.GetExpandedHeight();
+          {
+            ScopedPhaseTimer timer(VideoPhase::TextureDecode);
+            TexDecoder_Decode(dst_buffer, mip_level.GetData(), mip_level.GetExpandedWidth(),
+                              mip_level.GetExpandedHeight(), texture_info.GetTextureFormat(),
+                              texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+          }
+          entry->texture->Load(mip_level.GetLevel(), mip_level.GetRawWidth(),
+                               mip_level.GetRawHeight(), mip_level.GetExpandedWidth(), dst_buffer,
+                               decoded_mip_size);
+
+          arbitrary_mip_detector.AddLevel(mip_level.GetRawWidth(), mip_level.GetRawHeight(),
+                                          mip_level.GetExpandedWidth(), dst_buffer);
+
+          dst_buffer += decoded_mip_size;
+        }
       }
-    }
 
-    entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+      entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+    }
 
     if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
     {
@@ -1781,7 +1876,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
           (u32)safety_color_sample_size * 8)
   {
-    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
+    m_textures_by_hash.Insert(creation_info.full_hash, entry);
+    entry->textures_by_hash_key = creation_info.full_hash;
   }
 
   const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
@@ -1806,6 +1902,115 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   return entry;
 }
 
+bool TextureCacheBase::DecodeTextureAsync(RcTcacheEntry& entry, const TextureInfo& texture_info,
+                                          const RcTcacheEntry& previous_entry)
+{
+  // Prefer drawing with the previous texture at this address, which is usually the previous
+  // version of the same image (e.g. the last frame of a video).
+  RcTcacheEntry placeholder;
+  if (previous_entry && previous_entry->texture && !previous_entry->pending_decode &&
+      previous_entry->native_width == texture_info.GetRawWidth() &&
+      previous_entry->native_height == texture_info.GetRawHeight())
+  {
+    placeholder = previous_entry;
+  }
+
+  std::vector<AsyncTextureDecoder::Level> levels;
+  const auto add_level = [&](u32 level, u32 width, u32 height, u32 expanded_width,
+                             u32 expanded_height, const u8* data, u32 size) {
+    levels.push_back({level, width, height, expanded_width, expanded_height,
+                      std::vector<u8>(data, data + size), {}});
+  };
+
+  add_level(0, texture_info.GetRawWidth(), texture_info.GetRawHeight(),
+            texture_info.GetExpandedWidth(), texture_info.GetExpandedHeight(),
+            texture_info.GetData(), texture_info.GetTextureSize());
+  for (const auto& mip_level : texture_info.GetMipMapLevels())
+  {
+    if (!mip_level.IsDataValid())
+    {
+      ERROR_LOG_FMT(VIDEO, "Trying to use an invalid mipmap address {:#010x}",
+                    texture_info.GetRawAddress());
+      continue;
+    }
+
+    add_level(mip_level.GetLevel(), mip_level.GetRawWidth(), mip_level.GetRawHeight(),
+              mip_level.GetExpandedWidth(), mip_level.GetExpandedHeight(), mip_level.GetData(),
+              mip_level.GetTextureSize());
+  }
+
+  // Without a placeholder, the lower levels are decoded right away, and drawn with until the first
+  // level is ready. Textures without mipmaps have nothing to draw with meanwhile.
+  if (!placeholder && levels.size() < 2)
+    return false;
+  const size_t num_async_levels = placeholder ? levels.size() : 1;
+
+  const u8* tlut = texture_info.GetTlutAddress();
+  const u32 tlut_size = texture_info.GetPaletteSize().value_or(0);
+
+  {
+    ScopedPhaseTimer timer(VideoPhase::TextureDecode);
+    entry->pending_decode = m_async_texture_decoder.Submit(
+        texture_info.GetTextureFormat(), texture_info.GetTlutFormat(),
+        std::span<const u8>(tlut, tlut ? tlut_size : 0), std::move(levels), num_async_levels);
+  }
+  entry->placeholder = std::move(placeholder);
+
+  const auto& decoded_levels = entry->pending_decode->GetLevels();
+  for (size_t i = num_async_levels; i < decoded_levels.size(); ++i)
+  {
+    const auto& level = decoded_levels[i];
+    entry->texture->Load(level.level, level.width, level.height, level.expanded_width,
+                         level.decoded.data(), level.decoded.size());
+  }
+
+  m_pending_async_decodes.push_back(entry);
+  return true;
+}
+
+bool TextureCacheBase::FinishAsyncDecode(TCacheEntry& entry, bool wait)
+{
+  AsyncTextureDecoder::Job& job = *entry.pending_decode;
+  if (!job.IsDone())
+  {
+    if (!wait)
+      return false;
+
+    ScopedPhaseTimer timer(VideoPhase::TextureDecode);
+    job.Wait();
+  }
+
+  // The levels past the asynchronous ones were uploaded when the texture was created.
+  const auto& levels = job.GetLevels();
+  ArbitraryMipmapDetector arbitrary_mip_detector;
+  for (size_t i = 0; i < levels.size(); ++i)
+  {
+    const auto& level = levels[i];
+    if (i < job.GetNumAsyncLevels())
+    {
+      entry.texture->Load(level.level, level.width, level.height, level.expanded_width,
+                          level.decoded.data(), level.decoded.size());
+    }
+    arbitrary_mip_detector.AddLevel(level.width, level.height, level.expanded_width,
+                                    level.decoded.data());
+  }
+
+  // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
+  CheckTempSize(levels[0].decoded.size() * 5 / 16);
+  entry.has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(m_temp);
+
+  entry.pending_decode.reset();
+  entry.placeholder.reset();
+  return true;
+}
+
+void TextureCacheBase::FinishAllAsyncDecodes(bool wait)
+{
+  std::erase_if(m_pending_async_decodes, [&](const RcTcacheEntry& entry) {
+    return !entry->pending_decode || FinishAsyncDecode(*entry, wait);
+  });
+}
+
 static void GetDisplayRectForXFBEntry(TCacheEntry* entry, u32 width, u32 height,
                                       MathUtil::Rectangle<int>* display_rect)
 {
@@ -2482,11 +2687,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
 
       // Do not load textures by hash, if they were at least partly overwritten by an efb copy.
       // In this case, comparing the hash is not enough to check, if two textures are identical.
-      if (overlapping_entry->textures_by_hash_iter != m_textures_by_hash.end())
-      {
-        m_textures_by_hash.erase(overlapping_entry->textures_by_hash_iter);
-        overlapping_entry->textures_by_hash_iter = m_textures_by_hash.end();
-      }
+      EraseFromHashCache(overlapping_entry.get());
     }
     ++iter.first;
   }
@@ -2666,7 +2867,6 @@ RcTcacheEntry TextureCacheBase::AllocateCacheEntry(const TextureConfig& config)
 
   auto cacheEntry =
       std::make_shared<TCacheEntry>(std::move(alloc->texture), std::move(alloc->framebuffer));
-  cacheEntry->textures_by_hash_iter = m_textures_by_hash.end();
   cacheEntry->id = m_last_entry_id++;
   return cacheEntry;
 }
@@ -2753,6 +2953,16 @@ TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
   return std::make_pair(begin, end);
 }
 
+void TextureCacheBase::EraseFromHashCache(TCacheEntry* entry)
+{
+  if (!entry->textures_by_hash_key)
+    return;
+
+  m_textures_by_hash.EraseIf(*entry->textures_by_hash_key,
+                             [entry](const RcTcacheEntry& other) { return other.get() == entry; });
+  entry->textures_by_hash_key.reset();
+}
+
 TextureCacheBase::TexAddrCache::iterator
 TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pending_efb_copy)
 {
@@ -2761,11 +2971,7 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
 
   RcTcacheEntry& entry = iter->second;
 
-  if (entry->textures_by_hash_iter != m_textures_by_hash.end())
-  {
-    m_textures_by_hash.erase(entry->textures_by_hash_iter);
-    entry->textures_by_hash_iter = m_textures_by_hash.end();
-  }
+  EraseFromHashCache(entry.get());
 
   // If this is a pending EFB copy, we don't want to flush it here.
   // Why? Because let's say a game is rendering a bloom-type effect, using EFB copies to essentially
@@ -3224,7 +3430,7 @@ int TCacheEntry::HashSampleSize() const
     return 0;
   }
 
-  return g_ActiveConfig.iSafeTextureCache_ColorSamples;
+  return GetHashSampleSize(g_ActiveConfig.iSafeTextureCache_ColorSamples, size_in_bytes);
 }
 
 u64 TCacheEntry::CalculateHash() const
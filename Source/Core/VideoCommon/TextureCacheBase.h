@@ -14,15 +14,18 @@
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
+#include "Common/FlatHashMultiMap.h"
 #include "Common/Flag.h"
 #include "Common/MathUtil.h"
 
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/Assets/CustomAsset.h"
+#include "VideoCommon/AsyncTextureDecoder.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/TextureConfig.h"
@@ -153,9 +156,8 @@ struct TCacheEntry
   // used to delete textures which haven't been used for TEXTURE_KILL_THRESHOLD frames
   int frameCount = FRAMECOUNT_INVALID;
 
-  // Keep an iterator to the entry in m_textures_by_hash, so it does not need to be searched when
-  // removing the cache entry
-  std::multimap<u64, std::shared_ptr<TCacheEntry>>::iterator textures_by_hash_iter;
+  // The key this entry is stored under in m_textures_by_hash, if it is in there
+  std::optional<u64> textures_by_hash_key;
 
   // This is used to keep track of both:
   //   * efb copies used by this partially updated texture
@@ -167,6 +169,11 @@ struct TCacheEntry
   u32 pending_efb_copy_width = 0;
   u32 pending_efb_copy_height = 0;
 
+  // Set while (some of) the levels of this texture are decoded on worker threads. Until they have
+  // been uploaded, draws sample the placeholder instead, or only the levels which are uploaded.
+  std::shared_ptr<AsyncTextureDecoder::Job> pending_decode;
+  std::shared_ptr<TCacheEntry> placeholder;
+
   std::string texture_info_name = "";
 
   VideoCommon::CustomAsset::TimeType last_load_time;
@@ -341,7 +348,7 @@ protected:
 
 private:
   using TexAddrCache = std::multimap<u32, RcTcacheEntry>;
-  using TexHashCache = std::multimap<u64, RcTcacheEntry>;
+  using TexHashCache = Common::FlatHashMultiMap<RcTcacheEntry>;
 
   using TexPool = std::unordered_multimap<TextureConfig, TexPoolEntry>;
 
@@ -356,7 +363,18 @@ private:
   RcTcacheEntry CreateTextureEntry(const TextureCreationInfo& creation_info,
                                    const TextureInfo& texture_info, int safety_color_sample_size,
                                    VideoCommon::CustomTextureData* custom_texture_data,
-                                   bool custom_arbitrary_mipmaps, bool skip_texture_dump);
+                                   bool custom_arbitrary_mipmaps, bool skip_texture_dump,
+                                   const RcTcacheEntry& previous_entry);
+
+  // Submits the levels of a new texture to the asynchronous decoder. Returns false if the texture
+  // has to be decoded synchronously, as there is nothing which could be drawn in the meantime.
+  bool DecodeTextureAsync(RcTcacheEntry& entry, const TextureInfo& texture_info,
+                          const RcTcacheEntry& previous_entry);
+
+  // Uploads the levels of an asynchronously decoded texture. Returns false if the decode hasn't
+  // finished yet and wait is false.
+  bool FinishAsyncDecode(TCacheEntry& entry, bool wait);
+  void FinishAllAsyncDecodes(bool wait);
 
   RcTcacheEntry GetXFBFromCache(u32 address, u32 width, u32 height, u32 stride);
 
@@ -380,6 +398,9 @@ private:
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
   FindOverlappingTextures(u32 addr, u32 size_in_bytes);
 
+  // Removes the entry from m_textures_by_hash, if it is in there
+  void EraseFromHashCache(TCacheEntry* entry);
+
   // Removes and unlinks texture from texture cache and returns it to the pool
   TexAddrCache::iterator InvalidateTexture(TexAddrCache::iterator t_iter,
                                            bool discard_pending_efb_copy = false);
@@ -429,10 +450,12 @@ private:
   struct BackupConfig
   {
     int color_samples;
+    std::vector<std::pair<u32, int>> samples_by_size;
     bool texfmt_overlay;
     bool texfmt_overlay_center;
     bool hires_textures;
     bool cache_hires_textures;
+    bool prefetch_hires_textures;
     bool copy_cache_enable;
     bool stereo_3d;
     bool efb_mono_depth;
@@ -440,6 +463,7 @@ private:
     bool disable_vram_copies;
     bool arbitrary_mipmap_detection;
     bool graphics_mods;
+    bool async_texture_decoding;
     u32 graphics_mod_change_count;
   };
   BackupConfig m_backup_config = {};
@@ -459,6 +483,13 @@ private:
   // It's valid for textures to live be in here after they've been invalidated
   std::vector<RcTcacheEntry> m_pending_efb_copies;
 
+  // Decodes large textures on worker threads, if enabled.
+  AsyncTextureDecoder m_async_texture_decoder;
+
+  // Textures which are being decoded asynchronously. The finished ones are uploaded at the end
+  // of each frame, if they weren't drawn with before.
+  std::vector<RcTcacheEntry> m_pending_async_decodes;
+
   // Staging texture used for readbacks.
   // We store this in the class so that the same staging texture can be used for multiple
   // readbacks, saving the overhead of allocating a new buffer every time.
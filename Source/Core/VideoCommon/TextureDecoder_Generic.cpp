@@ -6,6 +6,10 @@
 #include <algorithm>
 #include <cmath>
 
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
 #include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
@@ -125,10 +129,202 @@ static inline void DecodeBytes_RGBA8(u32* dst, const u16* src, const u16* src2)
     dst[x] = ((src[x] & 0xFF) << 24) | ((src[x] & 0xFF00) >> 8) | (src2[x] << 8);
 }
 
-static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
+#ifdef _M_ARM_64
+// NEON is always available on ARM64, so these are used unconditionally. Each function decodes one
+// row of a block, except for RGBA8, where the whole block is decoded at once.
+
+// Two rows of 8 texels
+static inline void DecodeBytes_I4_NEON(u32* dst0, u32* dst1, const u8* src)
+{
+  const uint8x8_t val = vld1_u8(src);
+  const uint8x8x2_t texels = vzip_u8(vshr_n_u8(val, 4), vand_u8(val, vdup_n_u8(0xF)));
+
+  // Swizzle bits: 00001234 -> 12341234
+  const uint8x8_t i0 = vorr_u8(vshl_n_u8(texels.val[0], 4), texels.val[0]);
+  const uint8x8_t i1 = vorr_u8(vshl_n_u8(texels.val[1], 4), texels.val[1]);
+  vst4_u8(reinterpret_cast<u8*>(dst0), (uint8x8x4_t{{i0, i0, i0, i0}}));
+  vst4_u8(reinterpret_cast<u8*>(dst1), (uint8x8x4_t{{i1, i1, i1, i1}}));
+}
+
+static inline void DecodeBytes_I8_NEON(u32* dst, const u8* src)
+{
+  const uint8x8_t i = vld1_u8(src);
+  vst4_u8(reinterpret_cast<u8*>(dst), (uint8x8x4_t{{i, i, i, i}}));
+}
+
+static inline void DecodeBytes_IA4_NEON(u32* dst, const u8* src)
+{
+  const uint8x8_t val = vld1_u8(src);
+  const uint8x8_t tmpa = vshr_n_u8(val, 4);
+  const uint8x8_t a = vorr_u8(vshl_n_u8(tmpa, 4), tmpa);
+  const uint8x8_t tmpl = vand_u8(val, vdup_n_u8(0xF));
+  const uint8x8_t l = vorr_u8(vshl_n_u8(tmpl, 4), tmpl);
+  vst4_u8(reinterpret_cast<u8*>(dst), (uint8x8x4_t{{l, l, l, a}}));
+}
+
+static inline void DecodeBytes_IA8_NEON(u32* dst, const u8* src)
+{
+  static constexpr u8 shuffle[16] = {1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6};
+  const uint8x16_t val = vcombine_u8(vld1_u8(src), vdup_n_u8(0));
+  vst1q_u8(reinterpret_cast<u8*>(dst), vqtbl1q_u8(val, vld1q_u8(shuffle)));
+}
+
+// Byteswaps 4 big-endian 16-bit texels and zero-extends them to 32 bits.
+static inline uint32x4_t LoadTexels16_NEON(const u8* src)
+{
+  return vmovl_u16(vreinterpret_u16_u8(vrev16_u8(vld1_u8(src))));
+}
+
+static inline void DecodeBytes_RGB565_NEON(u32* dst, const u8* src)
+{
+  const uint32x4_t val = LoadTexels16_NEON(src);
+
+  const uint32x4_t tmpr = vshrq_n_u32(val, 11);
+  const uint32x4_t r = vorrq_u32(vshlq_n_u32(tmpr, 3), vshrq_n_u32(tmpr, 2));
+  const uint32x4_t tmpg = vandq_u32(vshrq_n_u32(val, 5), vdupq_n_u32(0x3F));
+  const uint32x4_t g = vorrq_u32(vshlq_n_u32(tmpg, 2), vshrq_n_u32(tmpg, 4));
+  const uint32x4_t tmpb = vandq_u32(val, vdupq_n_u32(0x1F));
+  const uint32x4_t b = vorrq_u32(vshlq_n_u32(tmpb, 3), vshrq_n_u32(tmpb, 2));
+
+  const uint32x4_t rgba = vorrq_u32(vorrq_u32(r, vshlq_n_u32(g, 8)),
+                                    vorrq_u32(vshlq_n_u32(b, 16), vdupq_n_u32(0xFF000000)));
+  vst1q_u32(dst, rgba);
+}
+
+static inline void DecodeBytes_RGB5A3_NEON(u32* dst, const u8* src)
+{
+  const uint32x4_t val = LoadTexels16_NEON(src);
+  const uint32x4_t mask_1f = vdupq_n_u32(0x1F);
+  const uint32x4_t mask_0f = vdupq_n_u32(0xF);
+
+  // Both encodings are decoded, and the MSB of each texel selects which one is used.
+  const uint32x4_t tmpr5 = vandq_u32(vshrq_n_u32(val, 10), mask_1f);
+  const uint32x4_t r5 = vorrq_u32(vshlq_n_u32(tmpr5, 3), vshrq_n_u32(tmpr5, 2));
+  const uint32x4_t tmpg5 = vandq_u32(vshrq_n_u32(val, 5), mask_1f);
+  const uint32x4_t g5 = vorrq_u32(vshlq_n_u32(tmpg5, 3), vshrq_n_u32(tmpg5, 2));
+  const uint32x4_t tmpb5 = vandq_u32(val, mask_1f);
+  const uint32x4_t b5 = vorrq_u32(vshlq_n_u32(tmpb5, 3), vshrq_n_u32(tmpb5, 2));
+  const uint32x4_t rgb555 = vorrq_u32(vorrq_u32(r5, vshlq_n_u32(g5, 8)),
+                                      vorrq_u32(vshlq_n_u32(b5, 16), vdupq_n_u32(0xFF000000)));
+
+  const uint32x4_t tmpr4 = vandq_u32(vshrq_n_u32(val, 8), mask_0f);
+  const uint32x4_t r4 = vorrq_u32(vshlq_n_u32(tmpr4, 4), tmpr4);
+  const uint32x4_t tmpg4 = vandq_u32(vshrq_n_u32(val, 4), mask_0f);
+  const uint32x4_t g4 = vorrq_u32(vshlq_n_u32(tmpg4, 4), tmpg4);
+  const uint32x4_t tmpb4 = vandq_u32(val, mask_0f);
+  const uint32x4_t b4 = vorrq_u32(vshlq_n_u32(tmpb4, 4), tmpb4);
+  const uint32x4_t tmpa3 = vandq_u32(vshrq_n_u32(val, 12), vdupq_n_u32(0x7));
+  const uint32x4_t a3 = vorrq_u32(vshlq_n_u32(tmpa3, 5),
+                                  vorrq_u32(vshlq_n_u32(tmpa3, 2), vshrq_n_u32(tmpa3, 1)));
+  const uint32x4_t rgba4443 = vorrq_u32(vorrq_u32(r4, vshlq_n_u32(g4, 8)),
+                                        vorrq_u32(vshlq_n_u32(b4, 16), vshlq_n_u32(a3, 24)));
+
+  const uint32x4_t is_rgb555 = vtstq_u32(val, vdupq_n_u32(0x8000));
+  vst1q_u32(dst, vbslq_u32(is_rgb555, rgb555, rgba4443));
+}
+
+// A whole 4x4 block
+static inline void DecodeBlock_RGBA8_NEON(u32* dst, const u8* src, int pitch)
+{
+  // The 16 AR pairs are followed by the 16 GB pairs.
+  const uint8x16x2_t ar = vld2q_u8(src);
+  const uint8x16x2_t gb = vld2q_u8(src + 32);
+
+  const uint8x16x2_t rg = vzipq_u8(ar.val[1], gb.val[0]);
+  const uint8x16x2_t ba = vzipq_u8(gb.val[1], ar.val[0]);
+  const uint16x8x2_t rows01 =
+      vzipq_u16(vreinterpretq_u16_u8(rg.val[0]), vreinterpretq_u16_u8(ba.val[0]));
+  const uint16x8x2_t rows23 =
+      vzipq_u16(vreinterpretq_u16_u8(rg.val[1]), vreinterpretq_u16_u8(ba.val[1]));
+
+  vst1q_u32(dst + 0 * pitch, vreinterpretq_u32_u16(rows01.val[0]));
+  vst1q_u32(dst + 1 * pitch, vreinterpretq_u32_u16(rows01.val[1]));
+  vst1q_u32(dst + 2 * pitch, vreinterpretq_u32_u16(rows23.val[0]));
+  vst1q_u32(dst + 3 * pitch, vreinterpretq_u32_u16(rows23.val[1]));
+}
+
+// Looks up 4 palette entries and decodes them together. NEON has no gather, so the lookups
+// themselves are scalar. The entries are stored big-endian like IA8, RGB565 and RGB5A3 texels.
+template <TLUTFormat tlutfmt>
+static inline void DecodePaletteEntries_NEON(u32* dst, const u16* tlut, u32 i0, u32 i1, u32 i2,
+                                             u32 i3)
+{
+  const u16 entries[4] = {tlut[i0], tlut[i1], tlut[i2], tlut[i3]};
+  const u8* src = reinterpret_cast<const u8*>(entries);
+  if constexpr (tlutfmt == TLUTFormat::IA8)
+    DecodeBytes_IA8_NEON(dst, src);
+  else if constexpr (tlutfmt == TLUTFormat::RGB565)
+    DecodeBytes_RGB565_NEON(dst, src);
+  else
+    DecodeBytes_RGB5A3_NEON(dst, src);
+}
+
+template <TLUTFormat tlutfmt>
+static void DecodePaletted_NEON(u32* dst, const u8* src, int width, int height,
+                                TextureFormat texformat, const u8* tlut_)
+{
+  const u16* tlut = reinterpret_cast<const u16*>(tlut_);
+  switch (texformat)
+  {
+  case TextureFormat::C4:
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 8; iy++, src += 4)
+        {
+          u32* row = dst + (y + iy) * width + x;
+          DecodePaletteEntries_NEON<tlutfmt>(row, tlut, src[0] >> 4, src[0] & 0xF, src[1] >> 4,
+                                             src[1] & 0xF);
+          DecodePaletteEntries_NEON<tlutfmt>(row + 4, tlut, src[2] >> 4, src[2] & 0xF,
+                                             src[3] >> 4, src[3] & 0xF);
+        }
+    break;
+  case TextureFormat::C8:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+        {
+          u32* row = dst + (y + iy) * width + x;
+          DecodePaletteEntries_NEON<tlutfmt>(row, tlut, src[0], src[1], src[2], src[3]);
+          DecodePaletteEntries_NEON<tlutfmt>(row + 4, tlut, src[4], src[5], src[6], src[7]);
+        }
+    break;
+  case TextureFormat::C14X2:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+        {
+          const auto index = [src](int i) { return ((src[2 * i] & 0x3F) << 8) | src[2 * i + 1]; };
+          DecodePaletteEntries_NEON<tlutfmt>(dst + (y + iy) * width + x, tlut, index(0), index(1),
+                                             index(2), index(3));
+        }
+    break;
+  default:
+    break;
+  }
+}
+
+static void DecodePaletted_NEON(u32* dst, const u8* src, int width, int height,
+                                TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    DecodePaletted_NEON<TLUTFormat::IA8>(dst, src, width, height, texformat, tlut);
+    break;
+  case TLUTFormat::RGB565:
+    DecodePaletted_NEON<TLUTFormat::RGB565>(dst, src, width, height, texformat, tlut);
+    break;
+  case TLUTFormat::RGB5A3:
+    DecodePaletted_NEON<TLUTFormat::RGB5A3>(dst, src, width, height, texformat, tlut);
+    break;
+  }
+}
+#endif
+
+// The 4 colors a DXT block's 2-bit indices select from
+static inline void DecodeDXTColors(const DXTBlock* src, int colors[4])
 {
   // S3TC Decoder (Note: GCN decodes differently from PC so we can't use native support)
-  // Needs more speed.
   u16 c1 = Common::swap16(src->color1);
   u16 c2 = Common::swap16(src->color2);
   int blue1 = Convert5To8(c1 & 0x1F);
@@ -137,7 +333,6 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
   int green2 = Convert6To8((c2 >> 5) & 0x3F);
   int red1 = Convert5To8((c1 >> 11) & 0x1F);
   int red2 = Convert5To8((c2 >> 11) & 0x1F);
-  int colors[4];
   colors[0] = MakeRGBA(red1, green1, blue1, 255);
   colors[1] = MakeRGBA(red2, green2, blue2, 255);
   if (c1 > c2)
@@ -154,6 +349,36 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
     colors[2] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 255);
     colors[3] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 0);
   }
+}
+
+#ifdef _M_ARM_64
+// Each row's indices select the bytes of its 4 texels from the colors with a single table lookup.
+static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
+{
+  int colors[4];
+  DecodeDXTColors(src, colors);
+  const uint8x16_t palette = vld1q_u8(reinterpret_cast<const u8*>(colors));
+
+  // The index of the leftmost texel is in the top 2 bits
+  static constexpr s8 shifts[16] = {-6, -6, -6, -6, -4, -4, -4, -4, -2, -2, -2, -2, 0, 0, 0, 0};
+  static constexpr u8 byte_offsets[16] = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+  const int8x16_t shift = vld1q_s8(shifts);
+  const uint8x16_t offsets = vld1q_u8(byte_offsets);
+  const uint8x16_t mask = vdupq_n_u8(3);
+
+  for (int y = 0; y < 4; y++)
+  {
+    const uint8x16_t indices = vandq_u8(vshlq_u8(vdupq_n_u8(src->lines[y]), shift), mask);
+    const uint8x16_t bytes = vorrq_u8(vshlq_n_u8(indices, 2), offsets);
+    vst1q_u8(reinterpret_cast<u8*>(dst + y * pitch), vqtbl1q_u8(palette, bytes));
+  }
+}
+#else
+static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
+{
+  // Needs more speed.
+  int colors[4];
+  DecodeDXTColors(src, colors);
 
   for (int y = 0; y < 4; y++)
   {
@@ -166,6 +391,7 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
     dst += pitch;
   }
 }
+#endif
 
 // JSD 01/06/11:
 // TODO: we really should ensure BOTH the source and destination addresses are aligned to 16-byte
@@ -181,19 +407,29 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
-  const int Wsteps4 = (width + 3) / 4;
+  [[maybe_unused]] const int Wsteps4 = (width + 3) / 4;
   const int Wsteps8 = (width + 7) / 8;
 
   switch (texformat)
   {
   case TextureFormat::C4:
+#ifdef _M_ARM_64
+    DecodePaletted_NEON(dst, src, width, height, texformat, tlut, tlutfmt);
+#else
     for (int y = 0; y < height; y += 8)
       for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
         for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
           DecodeBytes_C4(dst + (y + iy) * width + x, src + 4 * xStep, tlut, tlutfmt);
+#endif
     break;
   case TextureFormat::I4:
   {
+#ifdef _M_ARM_64
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 8; iy += 2, src += 8)
+          DecodeBytes_I4_NEON(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, src);
+#else
     // Reference C implementation:
     for (int y = 0; y < height; y += 8)
       for (int x = 0; x < width; x += 8)
@@ -206,10 +442,17 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
             memset(dst + (y + iy) * width + x + ix * 2, i1, 4);
             memset(dst + (y + iy) * width + x + ix * 2 + 1, i2, 4);
           }
+#endif
   }
   break;
   case TextureFormat::I8:  // speed critical
   {
+#ifdef _M_ARM_64
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; ++iy, src += 8)
+          DecodeBytes_I8_NEON(dst + (y + iy) * width + x, src);
+#else
     // Reference C implementation
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 8)
@@ -236,24 +479,41 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
           srcval = newsrc[0];
           newdst[0] = srcval | (srcval << 8) | (srcval << 16) | (srcval << 24);
         }
+#endif
   }
   break;
   case TextureFormat::C8:
+#ifdef _M_ARM_64
+    DecodePaletted_NEON(dst, src, width, height, texformat, tlut, tlutfmt);
+#else
     for (int y = 0; y < height; y += 4)
       for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
         for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
           DecodeBytes_C8((u32*)dst + (y + iy) * width + x, src + 8 * xStep, tlut, tlutfmt);
+#endif
     break;
   case TextureFormat::IA4:
   {
     for (int y = 0; y < height; y += 4)
       for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
         for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+        {
+#ifdef _M_ARM_64
+          DecodeBytes_IA4_NEON(dst + (y + iy) * width + x, src + 8 * xStep);
+#else
           DecodeBytes_IA4(dst + (y + iy) * width + x, src + 8 * xStep);
+#endif
+        }
   }
   break;
   case TextureFormat::IA8:
   {
+#ifdef _M_ARM_64
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+          DecodeBytes_IA8_NEON(dst + (y + iy) * width + x, src);
+#else
     // Reference C implementation:
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 4)
@@ -266,16 +526,27 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
           ptr[2] = DecodePixel_IA8(s[2]);
           ptr[3] = DecodePixel_IA8(s[3]);
         }
+#endif
   }
   break;
   case TextureFormat::C14X2:
+#ifdef _M_ARM_64
+    DecodePaletted_NEON(dst, src, width, height, texformat, tlut, tlutfmt);
+#else
     for (int y = 0; y < height; y += 4)
       for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
         for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
           DecodeBytes_C14X2(dst + (y + iy) * width + x, (u16*)(src + 8 * xStep), tlut, tlutfmt);
+#endif
     break;
   case TextureFormat::RGB565:
   {
+#ifdef _M_ARM_64
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+          DecodeBytes_RGB565_NEON(dst + (y + iy) * width + x, src);
+#else
     // Reference C implementation.
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 4)
@@ -286,6 +557,7 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
           for (int j = 0; j < 4; j++)
             *ptr++ = DecodePixel_RGB565(Common::swap16(*s++));
         }
+#endif
   }
   break;
   case TextureFormat::RGB5A3:
@@ -294,7 +566,13 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 4)
         for (int iy = 0; iy < 4; iy++, src += 8)
+        {
+#ifdef _M_ARM_64
+          DecodeBytes_RGB5A3_NEON(dst + (y + iy) * width + x, src);
+#else
           DecodeBytes_RGB5A3(dst + (y + iy) * width + x, (u16*)src);
+#endif
+        }
   }
   break;
   case TextureFormat::RGBA8:  // speed critical
@@ -303,9 +581,13 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 4)
       {
+#ifdef _M_ARM_64
+        DecodeBlock_RGBA8_NEON(dst + y * width + x, src, width);
+#else
         for (int iy = 0; iy < 4; iy++)
           DecodeBytes_RGBA8(dst + (y + iy) * width + x, (u16*)src + 4 * iy,
                             (u16*)src + 4 * iy + 16);
+#endif
         src += 64;
       }
   }
@@ -3,12 +3,15 @@
 
 #include "VideoCommon/TextureDecoder.h"
 
+#include <cstring>
+
 #ifdef CHECK
 #include "Common/Assert.h"
 #endif
 
 #include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/Inline.h"
 #include "Common/Intrinsics.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
@@ -161,6 +164,149 @@ static inline void DecodeBytes_IA4(u32* dst, const u8* src)
   }
 }
 
+// Expands the 16 bytes in `bytes` to one pixel per byte, with the byte replicated to all channels.
+// Bytes 0-7 are written to dst0 and bytes 8-15 to dst1.
+FUNCTION_TARGET_AVX2
+static inline void DecodeBytes_I8x16_AVX2(u32* dst0, u32* dst1, __m128i bytes)
+{
+  const __m256i mask_lo = _mm256_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,  //
+                                           4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+  const __m256i mask_hi = _mm256_add_epi8(mask_lo, _mm256_set1_epi8(8));
+
+  const __m256i v = _mm256_broadcastsi128_si256(bytes);
+  _mm256_storeu_si256((__m256i*)dst0, _mm256_shuffle_epi8(v, mask_lo));
+  _mm256_storeu_si256((__m256i*)dst1, _mm256_shuffle_epi8(v, mask_hi));
+}
+
+// Loads the 8-byte rows of two horizontally adjacent blocks. If there is no second block, the
+// upper half is zero.
+FUNCTION_TARGET_AVX2
+static inline __m128i LoadBlockRows_AVX2(const u8* row0, const u8* row1, bool both)
+{
+  const __m128i r0 = _mm_loadl_epi64((const __m128i*)row0);
+  const __m128i r1 = both ? _mm_loadl_epi64((const __m128i*)row1) : _mm_setzero_si128();
+  return _mm_unpacklo_epi64(r0, r1);
+}
+
+// Byteswaps 8 big-endian 16-bit texels and zero-extends them to 32 bits.
+FUNCTION_TARGET_AVX2
+static inline __m256i ExpandTexels16_AVX2(__m128i texels)
+{
+  const __m128i swap_mask = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  return _mm256_cvtepu16_epi32(_mm_shuffle_epi8(texels, swap_mask));
+}
+
+// Stores 8 pixels to dst, or only the first 4 if !both.
+FUNCTION_TARGET_AVX2
+static inline void StorePixels_AVX2(u32* dst, __m256i pixels, bool both)
+{
+  if (both)
+    _mm256_storeu_si256((__m256i*)dst, pixels);
+  else
+    _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(pixels));
+}
+
+// Decodes 8 RGB565 texels, zero-extended to 32 bits, to RGBA8 pixels.
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePixels_RGB565_AVX2(__m256i val)
+{
+  const __m256i kMask_x1f = _mm256_set1_epi32(0x0000001fL);
+  const __m256i kMask_x3f = _mm256_set1_epi32(0x0000003fL);
+  const __m256i kAlpha = _mm256_set1_epi32(0xFF000000L);
+
+  // r = Convert5To8((val >> 11) & 0x1f);
+  const __m256i tmpr = _mm256_srli_epi32(val, 11);
+  const __m256i r = _mm256_or_si256(_mm256_slli_epi32(tmpr, 3), _mm256_srli_epi32(tmpr, 2));
+
+  // g = Convert6To8((val >> 5) & 0x3f);
+  const __m256i tmpg = _mm256_and_si256(_mm256_srli_epi32(val, 5), kMask_x3f);
+  const __m256i g = _mm256_or_si256(_mm256_slli_epi32(tmpg, 2), _mm256_srli_epi32(tmpg, 4));
+
+  // b = Convert5To8((val) & 0x1f);
+  const __m256i tmpb = _mm256_and_si256(val, kMask_x1f);
+  const __m256i b = _mm256_or_si256(_mm256_slli_epi32(tmpb, 3), _mm256_srli_epi32(tmpb, 2));
+
+  // r | (g << 8) | (b << 16) | (a << 24);
+  return _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)),
+                         _mm256_or_si256(_mm256_slli_epi32(b, 16), kAlpha));
+}
+
+// Decodes 8 RGB5A3 texels, zero-extended to 32 bits, to RGBA8 pixels. Both encodings are decoded
+// for all pixels, and the MSB of each pixel selects which one is used, so there is no need to fall
+// back to scalar code for texels which mix them.
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePixels_RGB5A3_AVX2(__m256i val)
+{
+  const __m256i kMask_x1f = _mm256_set1_epi32(0x0000001fL);
+  const __m256i kMask_x0f = _mm256_set1_epi32(0x0000000fL);
+  const __m256i kMask_x07 = _mm256_set1_epi32(0x00000007L);
+  const __m256i kAlpha = _mm256_set1_epi32(0xFF000000L);
+
+  // RGB555: Swizzle bits: 00012345 -> 12345123
+  const __m256i tmpr5 = _mm256_and_si256(_mm256_srli_epi32(val, 10), kMask_x1f);
+  const __m256i r5 = _mm256_or_si256(_mm256_slli_epi32(tmpr5, 3), _mm256_srli_epi32(tmpr5, 2));
+  const __m256i tmpg5 = _mm256_and_si256(_mm256_srli_epi32(val, 5), kMask_x1f);
+  const __m256i g5 = _mm256_or_si256(_mm256_slli_epi32(tmpg5, 3), _mm256_srli_epi32(tmpg5, 2));
+  const __m256i tmpb5 = _mm256_and_si256(val, kMask_x1f);
+  const __m256i b5 = _mm256_or_si256(_mm256_slli_epi32(tmpb5, 3), _mm256_srli_epi32(tmpb5, 2));
+  const __m256i rgb555 = _mm256_or_si256(_mm256_or_si256(r5, _mm256_slli_epi32(g5, 8)),
+                                         _mm256_or_si256(_mm256_slli_epi32(b5, 16), kAlpha));
+
+  // RGBA4443: Swizzle bits: 00001234 -> 12341234, 00000123 -> 12312312
+  const __m256i tmpr4 = _mm256_and_si256(_mm256_srli_epi32(val, 8), kMask_x0f);
+  const __m256i r4 = _mm256_or_si256(_mm256_slli_epi32(tmpr4, 4), tmpr4);
+  const __m256i tmpg4 = _mm256_and_si256(_mm256_srli_epi32(val, 4), kMask_x0f);
+  const __m256i g4 = _mm256_or_si256(_mm256_slli_epi32(tmpg4, 4), tmpg4);
+  const __m256i tmpb4 = _mm256_and_si256(val, kMask_x0f);
+  const __m256i b4 = _mm256_or_si256(_mm256_slli_epi32(tmpb4, 4), tmpb4);
+  const __m256i tmpa3 = _mm256_and_si256(_mm256_srli_epi32(val, 12), kMask_x07);
+  const __m256i a3 = _mm256_or_si256(
+      _mm256_slli_epi32(tmpa3, 5),
+      _mm256_or_si256(_mm256_slli_epi32(tmpa3, 2), _mm256_srli_epi32(tmpa3, 1)));
+  const __m256i rgba4443 =
+      _mm256_or_si256(_mm256_or_si256(r4, _mm256_slli_epi32(g4, 8)),
+                      _mm256_or_si256(_mm256_slli_epi32(b4, 16), _mm256_slli_epi32(a3, 24)));
+
+  // All ones for pixels with the MSB set
+  const __m256i is_rgb555 = _mm256_srai_epi32(_mm256_slli_epi32(val, 16), 31);
+  return _mm256_blendv_epi8(rgba4443, rgb555, is_rgb555);
+}
+
+// Looks up the palette entries of 8 texel indices and decodes them to RGBA8 pixels. The entries
+// are fetched with 32-bit gathers, which read 2 bytes past each entry. The palette ends right
+// after its last entry, so the lanes with the highest index take it from a broadcast instead.
+template <TLUTFormat tlutfmt>
+FUNCTION_TARGET_AVX2 static inline __m256i DecodePaletteEntries_AVX2(__m256i indices,
+                                                                     const u8* tlut, int max_index)
+{
+  const __m256i last_entry = _mm256_set1_epi32(reinterpret_cast<const u16*>(tlut)[max_index]);
+  const __m256i gather_mask =
+      _mm256_xor_si256(_mm256_cmpeq_epi32(indices, _mm256_set1_epi32(max_index)),
+                       _mm256_set1_epi32(-1));
+  const __m256i entries = _mm256_mask_i32gather_epi32(
+      last_entry, reinterpret_cast<const int*>(tlut), indices, gather_mask, 2);
+
+  if constexpr (tlutfmt == TLUTFormat::IA8)
+  {
+    // The intensity is in the second byte, and the alpha in the first
+    const __m256i mask = _mm256_setr_epi8(1, 1, 1, 0, 5, 5, 5, 4, 9, 9, 9, 8, 13, 13, 13, 12,  //
+                                          1, 1, 1, 0, 5, 5, 5, 4, 9, 9, 9, 8, 13, 13, 13, 12);
+    return _mm256_shuffle_epi8(entries, mask);
+  }
+  else
+  {
+    // Byteswap the big-endian entries, dropping the bytes read past them
+    const __m256i mask =
+        _mm256_setr_epi8(1, 0, -1, -1, 5, 4, -1, -1, 9, 8, -1, -1, 13, 12, -1, -1,  //
+                         1, 0, -1, -1, 5, 4, -1, -1, 9, 8, -1, -1, 13, 12, -1, -1);
+    const __m256i val = _mm256_shuffle_epi8(entries, mask);
+    if constexpr (tlutfmt == TLUTFormat::RGB565)
+      return DecodePixels_RGB565_AVX2(val);
+    else
+      return DecodePixels_RGB5A3_AVX2(val);
+  }
+}
+
 #ifdef CHECK
 static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
 {
@@ -250,6 +396,83 @@ static void TexDecoder_DecodeImpl_C4(u32* dst, const u8* src, int width, int hei
   }
 }
 
+template <TLUTFormat tlutfmt>
+FUNCTION_TARGET_AVX2 static void DecodeC4_AVX2(u32* dst, const u8* src, int width, int height,
+                                               const u8* tlut, int Wsteps8)
+{
+  const __m128i kMask_x0f = _mm_set1_epi8(0x0f);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+      {
+        // 4 bytes of 2 texels each, the first texel in the upper nibble
+        u32 row;
+        std::memcpy(&row, src + 4 * xStep, sizeof(row));
+        const __m128i bytes = _mm_cvtsi32_si128(row);
+        const __m128i nibbles = _mm_unpacklo_epi8(
+            _mm_and_si128(_mm_srli_epi16(bytes, 4), kMask_x0f), _mm_and_si128(bytes, kMask_x0f));
+
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            DecodePaletteEntries_AVX2<tlutfmt>(_mm256_cvtepu8_epi32(nibbles),
+                                                               tlut, 0xF));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::RGB5A3:
+    DecodeC4_AVX2<TLUTFormat::RGB5A3>(dst, src, width, height, tlut, Wsteps8);
+    break;
+  case TLUTFormat::IA8:
+    DecodeC4_AVX2<TLUTFormat::IA8>(dst, src, width, height, tlut, Wsteps8);
+    break;
+  case TLUTFormat::RGB565:
+    DecodeC4_AVX2<TLUTFormat::RGB565>(dst, src, width, height, tlut, Wsteps8);
+    break;
+  default:
+    break;
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m128i kMask_x0f = _mm_set1_epi32(0x0f0f0f0fL);
+  const __m128i kMask_xf0 = _mm_set1_epi32(0xf0f0f0f0L);
+
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 8; iy += 2, xStep++)
+      {
+        // Two rows of 8 texels each: (00000000 00000000 HhGgFfEe DdCcBbAa)
+        const __m128i r0 = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+
+        // Expand each nibble to a byte: (HHhhGGgg FFffEEee DDddCCcc BBbbAAaa)
+        const __m128i i1 = _mm_and_si128(r0, kMask_xf0);
+        const __m128i i11 = _mm_or_si128(i1, _mm_srli_epi16(i1, 4));
+        const __m128i i2 = _mm_and_si128(r0, kMask_x0f);
+        const __m128i i22 = _mm_or_si128(i2, _mm_slli_epi16(i2, 4));
+        const __m128i texels = _mm_unpacklo_epi8(i11, i22);
+
+        DecodeBytes_I8x16_AVX2(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, texels);
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_I4_SSSE3(u32* dst, const u8* src, int width, int height,
                                            TextureFormat texformat, const u8* tlut,
@@ -390,6 +613,25 @@ static void TexDecoder_DecodeImpl_I4(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        // Two rows of 8 texels each
+        const __m128i texels = _mm_loadu_si128((const __m128i*)(src + 8 * xStep));
+        DecodeBytes_I8x16_AVX2(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, texels);
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_I8_SSSE3(u32* dst, const u8* src, int width, int height,
                                            TextureFormat texformat, const u8* tlut,
@@ -521,6 +763,46 @@ static void TexDecoder_DecodeImpl_I8(u32* dst, const u8* src, int width, int hei
   }
 }
 
+template <TLUTFormat tlutfmt>
+FUNCTION_TARGET_AVX2 static void DecodeC8_AVX2(u32* dst, const u8* src, int width, int height,
+                                               const u8* tlut, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m128i indices = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            DecodePaletteEntries_AVX2<tlutfmt>(_mm256_cvtepu8_epi32(indices),
+                                                               tlut, 0xFF));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::RGB5A3:
+    DecodeC8_AVX2<TLUTFormat::RGB5A3>(dst, src, width, height, tlut, Wsteps8);
+    break;
+  case TLUTFormat::IA8:
+    DecodeC8_AVX2<TLUTFormat::IA8>(dst, src, width, height, tlut, Wsteps8);
+    break;
+  case TLUTFormat::RGB565:
+    DecodeC8_AVX2<TLUTFormat::RGB565>(dst, src, width, height, tlut, Wsteps8);
+    break;
+  default:
+    break;
+  }
+}
+
 static void TexDecoder_DecodeImpl_C8(u32* dst, const u8* src, int width, int height,
                                      TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                      int Wsteps4, int Wsteps8)
@@ -559,6 +841,37 @@ static void TexDecoder_DecodeImpl_C8(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA4_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i kMask_x0f = _mm256_set1_epi32(0x0000000fL);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m128i texels = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+        const __m256i val = _mm256_cvtepu8_epi32(texels);
+
+        // l = Convert4To8(val & 0xF), a = Convert4To8(val >> 4)
+        const __m256i tmpl = _mm256_and_si256(val, kMask_x0f);
+        const __m256i l = _mm256_or_si256(tmpl, _mm256_slli_epi32(tmpl, 4));
+        const __m256i tmpa = _mm256_srli_epi32(val, 4);
+        const __m256i a = _mm256_or_si256(tmpa, _mm256_slli_epi32(tmpa, 4));
+
+        // dst[x] = (a << 24) | l << 16 | l << 8 | l;
+        const __m256i la = _mm256_or_si256(_mm256_or_si256(l, _mm256_slli_epi32(l, 8)),
+                                           _mm256_or_si256(_mm256_slli_epi32(l, 16),
+                                                           _mm256_slli_epi32(a, 24)));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), la);
+      }
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int height,
                                       TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                       int Wsteps4, int Wsteps8)
@@ -575,6 +888,32 @@ static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int he
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Two horizontally adjacent blocks are decoded at once, so that each row is a single 256-bit
+  // store. If the width is not a multiple of 8, the last block is decoded on its own.
+  const __m256i mask = _mm256_setr_epi8(1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6,  //
+                                        9, 9, 9, 8, 11, 11, 11, 10, 13, 13, 13, 12, 15, 15, 15, 14);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 8, yStep += 2)
+    {
+      const bool both = x + 4 < width;
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        // Load the row of both blocks: (HGFE DCBA hgfe dcba)
+        const __m256i texels = _mm256_broadcastsi128_si256(
+            LoadBlockRows_AVX2(src + 8 * xStep, src + 8 * (xStep + 4), both));
+
+        StorePixels_AVX2(dst + (y + iy) * width + x, _mm256_shuffle_epi8(texels, mask), both);
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_IA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                             TextureFormat texformat, const u8* tlut,
@@ -661,6 +1000,52 @@ static void TexDecoder_DecodeImpl_IA8(u32* dst, const u8* src, int width, int he
   }
 }
 
+template <TLUTFormat tlutfmt>
+FUNCTION_TARGET_AVX2 static void DecodeC14X2_AVX2(u32* dst, const u8* src, int width,
+                                                  int height, const u8* tlut, int Wsteps4)
+{
+  const __m256i kMask_x3fff = _mm256_set1_epi32(0x3fff);
+
+  // Two horizontally adjacent blocks are decoded at once, so that each row is a single 256-bit
+  // store. If the width is not a multiple of 8, the last block is decoded on its own.
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 8, yStep += 2)
+    {
+      const bool both = x + 4 < width;
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i indices = _mm256_and_si256(
+            ExpandTexels16_AVX2(LoadBlockRows_AVX2(src + 8 * xStep, src + 8 * (xStep + 4), both)),
+            kMask_x3fff);
+        StorePixels_AVX2(dst + (y + iy) * width + x,
+                         DecodePaletteEntries_AVX2<tlutfmt>(indices, tlut, 0x3FFF), both);
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C14X2_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::RGB5A3:
+    DecodeC14X2_AVX2<TLUTFormat::RGB5A3>(dst, src, width, height, tlut, Wsteps4);
+    break;
+  case TLUTFormat::IA8:
+    DecodeC14X2_AVX2<TLUTFormat::IA8>(dst, src, width, height, tlut, Wsteps4);
+    break;
+  case TLUTFormat::RGB565:
+    DecodeC14X2_AVX2<TLUTFormat::RGB565>(dst, src, width, height, tlut, Wsteps4);
+    break;
+  default:
+    break;
+  }
+}
+
 static void TexDecoder_DecodeImpl_C14X2(u32* dst, const u8* src, int width, int height,
                                         TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                         int Wsteps4, int Wsteps8)
@@ -699,6 +1084,28 @@ static void TexDecoder_DecodeImpl_C14X2(u32* dst, const u8* src, int width, int
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB565_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Two horizontally adjacent blocks are decoded at once, so that each row is a single 256-bit
+  // store. If the width is not a multiple of 8, the last block is decoded on its own.
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 8, yStep += 2)
+    {
+      const bool both = x + 4 < width;
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i val = ExpandTexels16_AVX2(
+            LoadBlockRows_AVX2(src + 8 * xStep, src + 8 * (xStep + 4), both));
+        StorePixels_AVX2(dst + (y + iy) * width + x, DecodePixels_RGB565_AVX2(val), both);
+      }
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_RGB565(u32* dst, const u8* src, int width, int height,
                                          TextureFormat texformat, const u8* tlut,
                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
@@ -770,6 +1177,29 @@ static void TexDecoder_DecodeImpl_RGB565(u32* dst, const u8* src, int width, int
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB5A3_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Two horizontally adjacent blocks are decoded at once, so that each row is a single 256-bit
+  // store. If the width is not a multiple of 8, the last block is decoded on its own.
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 8, yStep += 2)
+    {
+      const bool both = x + 4 < width;
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i val = ExpandTexels16_AVX2(
+            LoadBlockRows_AVX2(src + 8 * xStep, src + 8 * (xStep + 4), both));
+
+        StorePixels_AVX2(dst + (y + iy) * width + x, DecodePixels_RGB5A3_AVX2(val), both);
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_RGB5A3_SSSE3(u32* dst, const u8* src, int width, int height,
                                                TextureFormat texformat, const u8* tlut,
@@ -997,6 +1427,58 @@ static void TexDecoder_DecodeImpl_RGB5A3(u32* dst, const u8* src, int width, int
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGBA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i mask0312 =
+      _mm256_setr_epi8(2, 1, 3, 0, 6, 5, 7, 4, 10, 9, 11, 8, 14, 13, 15, 12,  //
+                       2, 1, 3, 0, 6, 5, 7, 4, 10, 9, 11, 8, 14, 13, 15, 12);
+
+  // Two horizontally adjacent blocks are decoded at once, so that each row is a single 256-bit
+  // store. If the width is not a multiple of 8, the last block is decoded on its own.
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 8, yStep += 2)
+    {
+      const u8* src2 = src + 64 * yStep;
+
+      // The 16 AR pairs of a block are followed by its 16 GB pairs. Interleaving them gives
+      // (row 0 | row 2) and (row 1 | row 3).
+      const __m256i ar0 = _mm256_loadu_si256((const __m256i*)src2);
+      const __m256i gb0 = _mm256_loadu_si256((const __m256i*)src2 + 1);
+      const __m256i rows02_0 = _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar0, gb0), mask0312);
+      const __m256i rows13_0 = _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar0, gb0), mask0312);
+
+      u32* const dst_row = dst + y * width + x;
+      if (x + 4 < width)
+      {
+        const __m256i ar1 = _mm256_loadu_si256((const __m256i*)src2 + 2);
+        const __m256i gb1 = _mm256_loadu_si256((const __m256i*)src2 + 3);
+        const __m256i rows02_1 = _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar1, gb1), mask0312);
+        const __m256i rows13_1 = _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar1, gb1), mask0312);
+
+        _mm256_storeu_si256((__m256i*)(dst_row + 0 * width),
+                            _mm256_permute2x128_si256(rows02_0, rows02_1, 0x20));
+        _mm256_storeu_si256((__m256i*)(dst_row + 1 * width),
+                            _mm256_permute2x128_si256(rows13_0, rows13_1, 0x20));
+        _mm256_storeu_si256((__m256i*)(dst_row + 2 * width),
+                            _mm256_permute2x128_si256(rows02_0, rows02_1, 0x31));
+        _mm256_storeu_si256((__m256i*)(dst_row + 3 * width),
+                            _mm256_permute2x128_si256(rows13_0, rows13_1, 0x31));
+      }
+      else
+      {
+        _mm_storeu_si128((__m128i*)(dst_row + 0 * width), _mm256_castsi256_si128(rows02_0));
+        _mm_storeu_si128((__m128i*)(dst_row + 1 * width), _mm256_castsi256_si128(rows13_0));
+        _mm_storeu_si128((__m128i*)(dst_row + 2 * width), _mm256_extracti128_si256(rows02_0, 1));
+        _mm_storeu_si128((__m128i*)(dst_row + 3 * width), _mm256_extracti128_si256(rows13_0, 1));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_RGBA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                               TextureFormat texformat, const u8* tlut,
@@ -1153,6 +1635,165 @@ static void TexDecoder_DecodeImpl_RGBA8(u32* dst, const u8* src, int width, int
   }
 }
 
+// Decodes the palettes of the two DXT blocks at src, in the order of their 2-bit indices.
+// This is shared by the SSE2 and AVX2 decoders, and must be inlined into the latter so that it is
+// compiled with VEX encoding; switching between legacy SSE and AVX code is expensive.
+static DOLPHIN_FORCE_INLINE void DecodeDXTBlockPairColors(const u8* src, __m128i* mmcolors0,
+                                                         __m128i* mmcolors1)
+{
+  // JSD NOTE: You may see many strange patterns of behavior in the below code, but they
+  // are for performance reasons. Sometimes, calculating what should be obvious hard-coded
+  // constants is faster than loading their values from memory. Unfortunately, there is no
+  // way to inline 128-bit constants from opcodes so they must be loaded from memory. This
+  // seems a little ridiculous to me in that you can't even generate a constant value of 1
+  // without having to load it from memory. So, I stored the minimal constant I could,
+  // 128-bits worth of 1s :). Then I use sequences of shifts to squash it to the appropriate
+  // size and bitpositions that I need.
+  const __m128i allFFs128 = _mm_cmpeq_epi32(_mm_setzero_si128(), _mm_setzero_si128());
+
+  // Load 128 bits, i.e. two DXTBlocks (64-bits each)
+  const __m128i dxt = _mm_loadu_si128((const __m128i*)src);
+
+  __m128i argb888x4;
+  __m128i c1 = _mm_unpackhi_epi16(dxt, dxt);
+  c1 = _mm_slli_si128(c1, 8);
+  const __m128i c0 =
+      _mm_or_si128(c1, _mm_srli_si128(_mm_slli_si128(_mm_unpacklo_epi16(dxt, dxt), 8), 8));
+
+  // Compare rgb0 to rgb1:
+  // Each 32-bit word will contain either 0xFFFFFFFF or 0x00000000 for true/false.
+  const __m128i c0cmp = _mm_srli_epi32(_mm_slli_epi32(_mm_srli_epi64(c0, 8), 16), 16);
+  const __m128i c0shr = _mm_srli_epi64(c0cmp, 32);
+  const __m128i cmprgb0rgb1 = _mm_cmpgt_epi32(c0cmp, c0shr);
+
+  int cmp0 = _mm_extract_epi16(cmprgb0rgb1, 0);
+  int cmp1 = _mm_extract_epi16(cmprgb0rgb1, 4);
+
+  // green:
+  // NOTE: We start with the larger number of bits (6) first for G and shift the mask down
+  // 1 bit to get a 5-bit mask later for R and B components.
+  // low6mask == _mm_set_epi32(0x0000FC00, 0x0000FC00, 0x0000FC00, 0x0000FC00)
+  const __m128i low6mask = _mm_slli_epi32(_mm_srli_epi32(allFFs128, 24 + 2), 8 + 2);
+  const __m128i gtmp = _mm_srli_epi32(c0, 3);
+  const __m128i g0 = _mm_and_si128(gtmp, low6mask);
+  // low3mask == _mm_set_epi32(0x00000300, 0x00000300, 0x00000300, 0x00000300)
+  const __m128i g1 = _mm_and_si128(
+      _mm_srli_epi32(gtmp, 6), _mm_set_epi32(0x00000300, 0x00000300, 0x00000300, 0x00000300));
+  argb888x4 = _mm_or_si128(g0, g1);
+  // red:
+  // low5mask == _mm_set_epi32(0x000000F8, 0x000000F8, 0x000000F8, 0x000000F8)
+  const __m128i low5mask = _mm_slli_epi32(_mm_srli_epi32(low6mask, 8 + 3), 3);
+  const __m128i r0 = _mm_and_si128(c0, low5mask);
+  const __m128i r1 = _mm_srli_epi32(r0, 5);
+  argb888x4 = _mm_or_si128(argb888x4, _mm_or_si128(r0, r1));
+  // blue:
+  // _mm_slli_epi32(low5mask, 16) == _mm_set_epi32(0x00F80000, 0x00F80000, 0x00F80000,
+  // 0x00F80000)
+  const __m128i b0 = _mm_and_si128(_mm_srli_epi32(c0, 5), _mm_slli_epi32(low5mask, 16));
+  const __m128i b1 = _mm_srli_epi16(b0, 5);
+  // OR in the fixed alpha component
+  // _mm_slli_epi32( allFFs128, 24 ) == _mm_set_epi32(0xFF000000, 0xFF000000, 0xFF000000,
+  // 0xFF000000)
+  argb888x4 = _mm_or_si128(_mm_or_si128(argb888x4, _mm_slli_epi32(allFFs128, 24)),
+                           _mm_or_si128(b0, b1));
+  // calculate RGB2 and RGB3:
+  const __m128i rgb0 = _mm_shuffle_epi32(argb888x4, _MM_SHUFFLE(2, 2, 0, 0));
+  const __m128i rgb1 = _mm_shuffle_epi32(argb888x4, _MM_SHUFFLE(3, 3, 1, 1));
+  const __m128i rrggbb0 =
+      _mm_and_si128(_mm_unpacklo_epi8(rgb0, rgb0), _mm_srli_epi16(allFFs128, 8));
+  const __m128i rrggbb1 =
+      _mm_and_si128(_mm_unpacklo_epi8(rgb1, rgb1), _mm_srli_epi16(allFFs128, 8));
+  const __m128i rrggbb01 =
+      _mm_and_si128(_mm_unpackhi_epi8(rgb0, rgb0), _mm_srli_epi16(allFFs128, 8));
+  const __m128i rrggbb11 =
+      _mm_and_si128(_mm_unpackhi_epi8(rgb1, rgb1), _mm_srli_epi16(allFFs128, 8));
+
+  __m128i rgb2, rgb3;
+
+  // if (rgb0 > rgb1):
+  if (cmp0 != 0)
+  {
+    // RGB2 = (RGB0 * 5 + RGB1 * 3) / 8 = (RGB0 << 2 + RGB1 << 1 + (RGB0 + RGB1)) >> 3
+    // RGB3 = (RGB0 * 3 + RGB1 * 5) / 8 = (RGB0 << 1 + RGB1 << 2 + (RGB0 + RGB1)) >> 3
+    const __m128i rrggbbsum = _mm_add_epi16(rrggbb0, rrggbb1);
+
+    const __m128i rrggbb0shl1 = _mm_slli_epi16(rrggbb0, 1);
+    const __m128i rrggbb0shl2 = _mm_slli_epi16(rrggbb0, 2);
+
+    const __m128i rrggbb1shl1 = _mm_slli_epi16(rrggbb1, 1);
+    const __m128i rrggbb1shl2 = _mm_slli_epi16(rrggbb1, 2);
+
+    const __m128i rrggbb2 =
+        _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl2, rrggbb1shl1), rrggbbsum), 3);
+    const __m128i rrggbb3 =
+        _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl1, rrggbb1shl2), rrggbbsum), 3);
+
+    const __m128i rgb2dup = _mm_packus_epi16(rrggbb2, rrggbb2);
+    const __m128i rgb3dup = _mm_packus_epi16(rrggbb3, rrggbb3);
+
+    rgb2 = _mm_and_si128(rgb2dup, _mm_srli_si128(allFFs128, 8));
+    rgb3 = _mm_and_si128(rgb3dup, _mm_srli_si128(allFFs128, 8));
+  }
+  else
+  {
+    // RGB2b = avg(RGB0, RGB1)
+    const __m128i rrggbb21 = _mm_srai_epi16(_mm_add_epi16(rrggbb0, rrggbb1), 1);
+    const __m128i rgb210 = _mm_srli_si128(_mm_packus_epi16(rrggbb21, rrggbb21), 8);
+    rgb2 = rgb210;
+    rgb3 = _mm_and_si128(rgb210, _mm_srli_epi32(allFFs128, 8));
+  }
+
+  // if (rgb0 > rgb1):
+  if (cmp1 != 0)
+  {
+    // RGB2 = (RGB0 * 5 + RGB1 * 3) / 8 = (RGB0 << 2 + RGB1 << 1 + (RGB0 + RGB1)) >> 3
+    // RGB3 = (RGB0 * 3 + RGB1 * 5) / 8 = (RGB0 << 1 + RGB1 << 2 + (RGB0 + RGB1)) >> 3
+    const __m128i rrggbbsum = _mm_add_epi16(rrggbb01, rrggbb11);
+
+    const __m128i rrggbb0shl1 = _mm_slli_epi16(rrggbb01, 1);
+    const __m128i rrggbb0shl2 = _mm_slli_epi16(rrggbb01, 2);
+
+    const __m128i rrggbb1shl1 = _mm_slli_epi16(rrggbb11, 1);
+    const __m128i rrggbb1shl2 = _mm_slli_epi16(rrggbb11, 2);
+
+    const __m128i rrggbb2 =
+        _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl2, rrggbb1shl1), rrggbbsum), 3);
+    const __m128i rrggbb3 =
+        _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl1, rrggbb1shl2), rrggbbsum), 3);
+
+    const __m128i rgb2dup = _mm_packus_epi16(rrggbb2, rrggbb2);
+    const __m128i rgb3dup = _mm_packus_epi16(rrggbb3, rrggbb3);
+
+    rgb2 = _mm_or_si128(rgb2, _mm_and_si128(rgb2dup, _mm_slli_si128(allFFs128, 8)));
+    rgb3 = _mm_or_si128(rgb3, _mm_and_si128(rgb3dup, _mm_slli_si128(allFFs128, 8)));
+  }
+  else
+  {
+    // RGB2b = avg(RGB0, RGB1)
+    const __m128i rrggbb211 = _mm_srai_epi16(_mm_add_epi16(rrggbb01, rrggbb11), 1);
+    const __m128i rgb211 = _mm_slli_si128(_mm_packus_epi16(rrggbb211, rrggbb211), 8);
+    rgb2 = _mm_or_si128(rgb2, rgb211);
+
+    // _mm_srli_epi32( allFFs128, 8 ) == _mm_set_epi32(0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    // 0x00FFFFFF)
+    // Make this color fully transparent:
+    rgb3 = _mm_or_si128(rgb3, _mm_and_si128(_mm_and_si128(rgb2, _mm_srli_epi32(allFFs128, 8)),
+                                            _mm_slli_si128(allFFs128, 8)));
+  }
+
+  // Create an array for color lookups for DXT0 so we can use the 2-bit indices:
+  *mmcolors0 = _mm_or_si128(
+      _mm_or_si128(_mm_srli_si128(_mm_slli_si128(argb888x4, 8), 8),
+                   _mm_slli_si128(_mm_srli_si128(_mm_slli_si128(rgb2, 8), 8 + 4), 8)),
+      _mm_slli_si128(_mm_srli_si128(rgb3, 4), 8 + 4));
+
+  // Create an array for color lookups for DXT1 so we can use the 2-bit indices:
+  *mmcolors1 =
+      _mm_or_si128(_mm_or_si128(_mm_srli_si128(argb888x4, 8),
+                                _mm_slli_si128(_mm_srli_si128(rgb2, 8 + 4), 8)),
+                   _mm_slli_si128(_mm_srli_si128(rgb3, 8 + 4), 8 + 4));
+}
+
 static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int height,
                                        TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                        int Wsteps4, int Wsteps8)
@@ -1172,164 +1813,16 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
       // parallelizable at this level, so we do.
       for (int z = 0, xStep = 2 * yStep; z < 2; ++z, xStep++)
       {
-        // JSD NOTE: You may see many strange patterns of behavior in the below code, but they
-        // are for performance reasons. Sometimes, calculating what should be obvious hard-coded
-        // constants is faster than loading their values from memory. Unfortunately, there is no
-        // way to inline 128-bit constants from opcodes so they must be loaded from memory. This
-        // seems a little ridiculous to me in that you can't even generate a constant value of 1
-        // without having to load it from memory. So, I stored the minimal constant I could,
-        // 128-bits worth of 1s :). Then I use sequences of shifts to squash it to the appropriate
-        // size and bitpositions that I need.
-        const __m128i allFFs128 = _mm_cmpeq_epi32(_mm_setzero_si128(), _mm_setzero_si128());
-
-        // Load 128 bits, i.e. two DXTBlocks (64-bits each)
-        const __m128i dxt = _mm_loadu_si128((__m128i*)(src + sizeof(struct DXTBlock) * 2 * xStep));
-
         // Copy the 2-bit indices from each DXT block:
+        const u8* dxt_src = src + sizeof(struct DXTBlock) * 2 * xStep;
         alignas(16) u32 dxttmp[4];
-        _mm_store_si128((__m128i*)dxttmp, dxt);
+        _mm_store_si128((__m128i*)dxttmp, _mm_loadu_si128((const __m128i*)dxt_src));
 
         u32 dxt0sel = dxttmp[1];
         u32 dxt1sel = dxttmp[3];
 
-        __m128i argb888x4;
-        __m128i c1 = _mm_unpackhi_epi16(dxt, dxt);
-        c1 = _mm_slli_si128(c1, 8);
-        const __m128i c0 =
-            _mm_or_si128(c1, _mm_srli_si128(_mm_slli_si128(_mm_unpacklo_epi16(dxt, dxt), 8), 8));
-
-        // Compare rgb0 to rgb1:
-        // Each 32-bit word will contain either 0xFFFFFFFF or 0x00000000 for true/false.
-        const __m128i c0cmp = _mm_srli_epi32(_mm_slli_epi32(_mm_srli_epi64(c0, 8), 16), 16);
-        const __m128i c0shr = _mm_srli_epi64(c0cmp, 32);
-        const __m128i cmprgb0rgb1 = _mm_cmpgt_epi32(c0cmp, c0shr);
-
-        int cmp0 = _mm_extract_epi16(cmprgb0rgb1, 0);
-        int cmp1 = _mm_extract_epi16(cmprgb0rgb1, 4);
-
-        // green:
-        // NOTE: We start with the larger number of bits (6) first for G and shift the mask down
-        // 1 bit to get a 5-bit mask later for R and B components.
-        // low6mask == _mm_set_epi32(0x0000FC00, 0x0000FC00, 0x0000FC00, 0x0000FC00)
-        const __m128i low6mask = _mm_slli_epi32(_mm_srli_epi32(allFFs128, 24 + 2), 8 + 2);
-        const __m128i gtmp = _mm_srli_epi32(c0, 3);
-        const __m128i g0 = _mm_and_si128(gtmp, low6mask);
-        // low3mask == _mm_set_epi32(0x00000300, 0x00000300, 0x00000300, 0x00000300)
-        const __m128i g1 = _mm_and_si128(
-            _mm_srli_epi32(gtmp, 6), _mm_set_epi32(0x00000300, 0x00000300, 0x00000300, 0x00000300));
-        argb888x4 = _mm_or_si128(g0, g1);
-        // red:
-        // low5mask == _mm_set_epi32(0x000000F8, 0x000000F8, 0x000000F8, 0x000000F8)
-        const __m128i low5mask = _mm_slli_epi32(_mm_srli_epi32(low6mask, 8 + 3), 3);
-        const __m128i r0 = _mm_and_si128(c0, low5mask);
-        const __m128i r1 = _mm_srli_epi32(r0, 5);
-        argb888x4 = _mm_or_si128(argb888x4, _mm_or_si128(r0, r1));
-        // blue:
-        // _mm_slli_epi32(low5mask, 16) == _mm_set_epi32(0x00F80000, 0x00F80000, 0x00F80000,
-        // 0x00F80000)
-        const __m128i b0 = _mm_and_si128(_mm_srli_epi32(c0, 5), _mm_slli_epi32(low5mask, 16));
-        const __m128i b1 = _mm_srli_epi16(b0, 5);
-        // OR in the fixed alpha component
-        // _mm_slli_epi32( allFFs128, 24 ) == _mm_set_epi32(0xFF000000, 0xFF000000, 0xFF000000,
-        // 0xFF000000)
-        argb888x4 = _mm_or_si128(_mm_or_si128(argb888x4, _mm_slli_epi32(allFFs128, 24)),
-                                 _mm_or_si128(b0, b1));
-        // calculate RGB2 and RGB3:
-        const __m128i rgb0 = _mm_shuffle_epi32(argb888x4, _MM_SHUFFLE(2, 2, 0, 0));
-        const __m128i rgb1 = _mm_shuffle_epi32(argb888x4, _MM_SHUFFLE(3, 3, 1, 1));
-        const __m128i rrggbb0 =
-            _mm_and_si128(_mm_unpacklo_epi8(rgb0, rgb0), _mm_srli_epi16(allFFs128, 8));
-        const __m128i rrggbb1 =
-            _mm_and_si128(_mm_unpacklo_epi8(rgb1, rgb1), _mm_srli_epi16(allFFs128, 8));
-        const __m128i rrggbb01 =
-            _mm_and_si128(_mm_unpackhi_epi8(rgb0, rgb0), _mm_srli_epi16(allFFs128, 8));
-        const __m128i rrggbb11 =
-            _mm_and_si128(_mm_unpackhi_epi8(rgb1, rgb1), _mm_srli_epi16(allFFs128, 8));
-
-        __m128i rgb2, rgb3;
-
-        // if (rgb0 > rgb1):
-        if (cmp0 != 0)
-        {
-          // RGB2 = (RGB0 * 5 + RGB1 * 3) / 8 = (RGB0 << 2 + RGB1 << 1 + (RGB0 + RGB1)) >> 3
-          // RGB3 = (RGB0 * 3 + RGB1 * 5) / 8 = (RGB0 << 1 + RGB1 << 2 + (RGB0 + RGB1)) >> 3
-          const __m128i rrggbbsum = _mm_add_epi16(rrggbb0, rrggbb1);
-
-          const __m128i rrggbb0shl1 = _mm_slli_epi16(rrggbb0, 1);
-          const __m128i rrggbb0shl2 = _mm_slli_epi16(rrggbb0, 2);
-
-          const __m128i rrggbb1shl1 = _mm_slli_epi16(rrggbb1, 1);
-          const __m128i rrggbb1shl2 = _mm_slli_epi16(rrggbb1, 2);
-
-          const __m128i rrggbb2 =
-              _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl2, rrggbb1shl1), rrggbbsum), 3);
-          const __m128i rrggbb3 =
-              _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl1, rrggbb1shl2), rrggbbsum), 3);
-
-          const __m128i rgb2dup = _mm_packus_epi16(rrggbb2, rrggbb2);
-          const __m128i rgb3dup = _mm_packus_epi16(rrggbb3, rrggbb3);
-
-          rgb2 = _mm_and_si128(rgb2dup, _mm_srli_si128(allFFs128, 8));
-          rgb3 = _mm_and_si128(rgb3dup, _mm_srli_si128(allFFs128, 8));
-        }
-        else
-        {
-          // RGB2b = avg(RGB0, RGB1)
-          const __m128i rrggbb21 = _mm_srai_epi16(_mm_add_epi16(rrggbb0, rrggbb1), 1);
-          const __m128i rgb210 = _mm_srli_si128(_mm_packus_epi16(rrggbb21, rrggbb21), 8);
-          rgb2 = rgb210;
-          rgb3 = _mm_and_si128(rgb210, _mm_srli_epi32(allFFs128, 8));
-        }
-
-        // if (rgb0 > rgb1):
-        if (cmp1 != 0)
-        {
-          // RGB2 = (RGB0 * 5 + RGB1 * 3) / 8 = (RGB0 << 2 + RGB1 << 1 + (RGB0 + RGB1)) >> 3
-          // RGB3 = (RGB0 * 3 + RGB1 * 5) / 8 = (RGB0 << 1 + RGB1 << 2 + (RGB0 + RGB1)) >> 3
-          const __m128i rrggbbsum = _mm_add_epi16(rrggbb01, rrggbb11);
-
-          const __m128i rrggbb0shl1 = _mm_slli_epi16(rrggbb01, 1);
-          const __m128i rrggbb0shl2 = _mm_slli_epi16(rrggbb01, 2);
-
-          const __m128i rrggbb1shl1 = _mm_slli_epi16(rrggbb11, 1);
-          const __m128i rrggbb1shl2 = _mm_slli_epi16(rrggbb11, 2);
-
-          const __m128i rrggbb2 =
-              _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl2, rrggbb1shl1), rrggbbsum), 3);
-          const __m128i rrggbb3 =
-              _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl1, rrggbb1shl2), rrggbbsum), 3);
-
-          const __m128i rgb2dup = _mm_packus_epi16(rrggbb2, rrggbb2);
-          const __m128i rgb3dup = _mm_packus_epi16(rrggbb3, rrggbb3);
-
-          rgb2 = _mm_or_si128(rgb2, _mm_and_si128(rgb2dup, _mm_slli_si128(allFFs128, 8)));
-          rgb3 = _mm_or_si128(rgb3, _mm_and_si128(rgb3dup, _mm_slli_si128(allFFs128, 8)));
-        }
-        else
-        {
-          // RGB2b = avg(RGB0, RGB1)
-          const __m128i rrggbb211 = _mm_srai_epi16(_mm_add_epi16(rrggbb01, rrggbb11), 1);
-          const __m128i rgb211 = _mm_slli_si128(_mm_packus_epi16(rrggbb211, rrggbb211), 8);
-          rgb2 = _mm_or_si128(rgb2, rgb211);
-
-          // _mm_srli_epi32( allFFs128, 8 ) == _mm_set_epi32(0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
-          // 0x00FFFFFF)
-          // Make this color fully transparent:
-          rgb3 = _mm_or_si128(rgb3, _mm_and_si128(_mm_and_si128(rgb2, _mm_srli_epi32(allFFs128, 8)),
-                                                  _mm_slli_si128(allFFs128, 8)));
-        }
-
-        // Create an array for color lookups for DXT0 so we can use the 2-bit indices:
-        const __m128i mmcolors0 = _mm_or_si128(
-            _mm_or_si128(_mm_srli_si128(_mm_slli_si128(argb888x4, 8), 8),
-                         _mm_slli_si128(_mm_srli_si128(_mm_slli_si128(rgb2, 8), 8 + 4), 8)),
-            _mm_slli_si128(_mm_srli_si128(rgb3, 4), 8 + 4));
-
-        // Create an array for color lookups for DXT1 so we can use the 2-bit indices:
-        const __m128i mmcolors1 =
-            _mm_or_si128(_mm_or_si128(_mm_srli_si128(argb888x4, 8),
-                                      _mm_slli_si128(_mm_srli_si128(rgb2, 8 + 4), 8)),
-                         _mm_slli_si128(_mm_srli_si128(rgb3, 8 + 4), 8 + 4));
+        __m128i mmcolors0, mmcolors1;
+        DecodeDXTBlockPairColors(dxt_src, &mmcolors0, &mmcolors1);
 
 // The #ifdef CHECKs here and below are to compare correctness of output against the reference code.
 // Don't use them in a normal build.
@@ -1409,6 +1902,49 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_CMPR_AVX2(u32* dst, const u8* src, int width, int height,
+                                            TextureFormat texformat, const u8* tlut,
+                                            TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // The palettes of two horizontally adjacent DXT blocks are decoded as in the SSE2 decoder, and
+  // then form a single 8-entry table. Each row of both blocks is looked up from it with one
+  // permute, instead of a load and store per pixel.
+  const __m256i kMask_x03 = _mm256_set1_epi32(3);
+  const __m256i row_shifts = _mm256_setr_epi32(6, 4, 2, 0, 6, 4, 2, 0);
+  const __m256i block_offsets = _mm256_setr_epi32(0, 0, 0, 0, 4, 4, 4, 4);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int z = 0, xStep = 2 * yStep; z < 2; ++z, xStep++)
+      {
+        const u8* dxt_src = src + sizeof(struct DXTBlock) * 2 * xStep;
+
+        __m128i mmcolors0, mmcolors1;
+        DecodeDXTBlockPairColors(dxt_src, &mmcolors0, &mmcolors1);
+        const __m256i colors = _mm256_inserti128_si256(_mm256_castsi128_si256(mmcolors0),
+                                                       mmcolors1, 1);
+
+        // The 2-bit indices of the first block in the lower half, and of the second in the upper
+        const __m256i dxtsel = _mm256_permutevar8x32_epi32(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)dxt_src)),
+            _mm256_setr_epi32(1, 1, 1, 1, 3, 3, 3, 3));
+
+        u32* dst32 = dst + (y + z * 4) * width + x;
+        for (int row = 0; row < 4; ++row)
+        {
+          const __m256i shifts = _mm256_add_epi32(row_shifts, _mm256_set1_epi32(row * 8));
+          const __m256i indices = _mm256_add_epi32(
+              _mm256_and_si256(_mm256_srlv_epi32(dxtsel, shifts), kMask_x03), block_offsets);
+          _mm256_storeu_si256((__m256i*)(dst32 + width * row),
+                              _mm256_permutevar8x32_epi32(colors, indices));
+        }
+      }
+    }
+  }
+}
+
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
@@ -1418,11 +1954,18 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   switch (texformat)
   {
   case TextureFormat::C4:
-    TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::I4:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I4_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1430,7 +1973,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::I8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1438,15 +1984,27 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C8:
-    TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::IA4:
-    TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else
+      TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                Wsteps8);
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                       Wsteps8);
     else
@@ -1455,17 +2013,28 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C14X2:
-    TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C14X2_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                  Wsteps8);
     break;
 
   case TextureFormat::RGB565:
-    TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                 Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB565_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else
+      TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                   Wsteps8);
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB5A3_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                          Wsteps8);
     else
@@ -1474,7 +2043,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGBA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGBA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGBA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                         Wsteps8);
     else
@@ -1483,7 +2055,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::CMPR:
-    TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_CMPR_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                      Wsteps8);
+    else
+      TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                 Wsteps8);
     break;
 
   case TextureFormat::XFB:
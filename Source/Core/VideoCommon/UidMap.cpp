@@ -0,0 +1,14 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/UidMap.h"
+
+#include <xxhash.h>
+
+namespace VideoCommon
+{
+u64 HashUidBytes(const void* data, size_t size)
+{
+  return XXH3_64bits(data, size);
+}
+}  // namespace VideoCommon
@@ -0,0 +1,83 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Common/CommonTypes.h"
+#include "Common/FlatHashMultiMap.h"
+#include "VideoCommon/ShaderGenCommon.h"
+
+namespace VideoCommon
+{
+// Hashes the raw bytes of a UID with XXH3. UIDs are compared with memcmp and have their padding
+// zeroed, so equal UIDs always have equal bytes.
+u64 HashUidBytes(const void* data, size_t size);
+
+template <typename UidData>
+u64 HashUid(const ShaderUid<UidData>& uid)
+{
+  return HashUidBytes(uid.GetUidDataRaw(), uid.GetUidDataSize());
+}
+
+template <typename Uid>
+  requires(!std::is_base_of_v<ShaderGeneratorInterface, Uid>)
+u64 HashUid(const Uid& uid)
+{
+  return HashUidBytes(&uid, sizeof(uid));
+}
+
+// A map from shader or pipeline UIDs to values, for the shader cache, which looks them up on
+// every state change and holds every UID from the UID cache.
+//
+// The entries are kept in a flat open-addressing table, keyed by the hash of their UID. The hash
+// is computed once per lookup and stored next to the entry, so probing compares 64-bit hashes
+// and only memcmps the (several hundred bytes long) UID of an entry whose hash matched, and
+// growing the table never hashes a UID again.
+//
+// Pointers to values are invalidated by inserting a UID which isn't in the map yet.
+template <typename Uid, typename Value>
+class UidMap
+{
+public:
+  Value* Find(const Uid& uid) { return Find(uid, HashUid(uid)); }
+  bool Contains(const Uid& uid) { return Find(uid) != nullptr; }
+
+  // Returns the value of uid, inserting a default-constructed one if there is none.
+  Value& operator[](const Uid& uid)
+  {
+    const u64 hash = HashUid(uid);
+    if (Value* value = Find(uid, hash))
+      return *value;
+    return m_map.Insert(hash, Entry{uid, Value{}}).value;
+  }
+
+  // Calls func(uid, value) for every entry. func must not insert UIDs.
+  template <typename Func>
+  void ForEach(Func func)
+  {
+    m_map.ForEach([&](u64, Entry& entry) { func(entry.uid, entry.value); });
+  }
+
+  void Reserve(size_t count) { m_map.Reserve(count); }
+  void Clear() { m_map.Clear(); }
+  size_t Size() const { return m_map.Size(); }
+
+private:
+  struct Entry
+  {
+    Uid uid;
+    Value value;
+  };
+
+  Value* Find(const Uid& uid, u64 hash)
+  {
+    Entry* entry = m_map.FindIf(hash, [&](const Entry& e) { return e.uid == uid; });
+    return entry ? &entry->value : nullptr;
+  }
+
+  Common::FlatHashMultiMap<Entry> m_map;
+};
+}  // namespace VideoCommon
@@ -52,10 +52,14 @@ alignas(16) static const float scale_factors[] = {
 VertexLoaderARM64::VertexLoaderARM64(const TVtxDesc& vtx_desc, const VAT& vtx_att)
     : VertexLoaderBase(vtx_desc, vtx_att), m_float_emit(this)
 {
-  AllocCodeSpace(4096);
+  // Room for two copies of the loader: one updating the zfreeze caches and one leaving them alone
+  // for converting a draw on several threads.
+  AllocCodeSpace(8192);
   const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
   ClearCodeSpace();
-  GenerateVertexLoader();
+  GenerateVertexLoader(true);
+  m_run_without_caches = AlignCode16();
+  GenerateVertexLoader(false);
   WriteProtect(true);
 }
 
@@ -156,34 +160,37 @@ void VertexLoaderARM64::ReadVertex(VertexComponentFormat attribute, ComponentFor
   m_float_emit.STUR(write_size, coords, dst_reg, m_dst_ofs);
 
   // Z-Freeze
-  if (native_format == &m_native_vtx_decl.position)
+  if (m_store_caches)
   {
-    CMP(remaining_reg, 3);
-    FixupBranch dont_store = B(CC_GE);
-    MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::position_cache.data());
-    m_float_emit.STR(128, coords, EncodeRegTo64(scratch2_reg), ArithOption(remaining_reg, true));
-    SetJumpTarget(dont_store);
-  }
-  else if (native_format == &m_native_vtx_decl.normals[0])
-  {
-    FixupBranch dont_store = CBNZ(remaining_reg);
-    MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::normal_cache.data());
-    m_float_emit.STR(128, IndexType::Unsigned, coords, EncodeRegTo64(scratch2_reg), 0);
-    SetJumpTarget(dont_store);
-  }
-  else if (native_format == &m_native_vtx_decl.normals[1])
-  {
-    FixupBranch dont_store = CBNZ(remaining_reg);
-    MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::tangent_cache.data());
-    m_float_emit.STR(128, IndexType::Unsigned, coords, EncodeRegTo64(scratch2_reg), 0);
-    SetJumpTarget(dont_store);
-  }
-  else if (native_format == &m_native_vtx_decl.normals[2])
-  {
-    FixupBranch dont_store = CBNZ(remaining_reg);
-    MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::binormal_cache.data());
-    m_float_emit.STR(128, IndexType::Unsigned, coords, EncodeRegTo64(scratch2_reg), 0);
-    SetJumpTarget(dont_store);
+    if (native_format == &m_native_vtx_decl.position)
+    {
+      CMP(remaining_reg, 3);
+      FixupBranch dont_store = B(CC_GE);
+      MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::position_cache.data());
+      m_float_emit.STR(128, coords, EncodeRegTo64(scratch2_reg), ArithOption(remaining_reg, true));
+      SetJumpTarget(dont_store);
+    }
+    else if (native_format == &m_native_vtx_decl.normals[0])
+    {
+      FixupBranch dont_store = CBNZ(remaining_reg);
+      MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::normal_cache.data());
+      m_float_emit.STR(128, IndexType::Unsigned, coords, EncodeRegTo64(scratch2_reg), 0);
+      SetJumpTarget(dont_store);
+    }
+    else if (native_format == &m_native_vtx_decl.normals[1])
+    {
+      FixupBranch dont_store = CBNZ(remaining_reg);
+      MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::tangent_cache.data());
+      m_float_emit.STR(128, IndexType::Unsigned, coords, EncodeRegTo64(scratch2_reg), 0);
+      SetJumpTarget(dont_store);
+    }
+    else if (native_format == &m_native_vtx_decl.normals[2])
+    {
+      FixupBranch dont_store = CBNZ(remaining_reg);
+      MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::binormal_cache.data());
+      m_float_emit.STR(128, IndexType::Unsigned, coords, EncodeRegTo64(scratch2_reg), 0);
+      SetJumpTarget(dont_store);
+    }
   }
 
   native_format->components = count_out;
@@ -312,8 +319,12 @@ void VertexLoaderARM64::ReadColor(VertexComponentFormat attribute, ColorFormat f
     m_src_ofs += load_bytes;
 }
 
-void VertexLoaderARM64::GenerateVertexLoader()
+void VertexLoaderARM64::GenerateVertexLoader(bool store_caches)
 {
+  m_store_caches = store_caches;
+  m_src_ofs = 0;
+  m_dst_ofs = 0;
+
   // The largest input vertex (with the position matrix index and all texture matrix indices
   // enabled, and all components set as direct) is 129 bytes (corresponding to a 156-byte
   // output). This is small enough that we can always use the unscaled load/store instructions
@@ -367,11 +378,15 @@ void VertexLoaderARM64::GenerateVertexLoader()
     STR(IndexType::Unsigned, scratch1_reg, dst_reg, m_dst_ofs);
 
     // Z-Freeze
-    CMP(remaining_reg, 3);
-    FixupBranch dont_store = B(CC_GE);
-    MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::position_matrix_index_cache.data());
-    STR(scratch1_reg, EncodeRegTo64(scratch2_reg), ArithOption(remaining_reg, true));
-    SetJumpTarget(dont_store);
+    if (m_store_caches)
+    {
+      CMP(remaining_reg, 3);
+      FixupBranch dont_store = B(CC_GE);
+      MOVP2R(EncodeRegTo64(scratch2_reg),
+             VertexLoaderManager::position_matrix_index_cache.data());
+      STR(scratch1_reg, EncodeRegTo64(scratch2_reg), ArithOption(remaining_reg, true));
+      SetJumpTarget(dont_store);
+    }
 
     m_native_vtx_decl.posmtx.components = 4;
     m_native_vtx_decl.posmtx.enable = true;
@@ -532,3 +547,8 @@ int VertexLoaderARM64::RunVertices(const u8* src, u8* dst, int count)
   m_numLoadedVertices += count;
   return ((int (*)(const u8* src, u8* dst, int count))region)(src, dst, count - 1);
 }
+
+int VertexLoaderARM64::RunVerticesConcurrently(const u8* src, u8* dst, int count)
+{
+  return ((int (*)(const u8* src, u8* dst, int count))m_run_without_caches)(src, dst, count - 1);
+}
@@ -21,10 +21,14 @@ public:
 
 protected:
   int RunVertices(const u8* src, u8* dst, int count) override;
+  bool CanRunConcurrently() const override { return true; }
+  int RunVerticesConcurrently(const u8* src, u8* dst, int count) override;
 
 private:
   u32 m_src_ofs = 0;
   u32 m_dst_ofs = 0;
+  bool m_store_caches = true;
+  const u8* m_run_without_caches = nullptr;
   Arm64Gen::FixupBranch m_skip_vertex;
   Arm64Gen::ARM64FloatEmitter m_float_emit;
   std::pair<Arm64Gen::ARM64Reg, u32> GetVertexAddr(CPArray array, VertexComponentFormat attribute);
@@ -33,5 +37,5 @@ private:
                   AttributeFormat* native_format, Arm64Gen::ARM64Reg reg, u32 offset);
   void ReadColor(VertexComponentFormat attribute, ColorFormat format, Arm64Gen::ARM64Reg reg,
                  u32 offset);
-  void GenerateVertexLoader();
+  void GenerateVertexLoader(bool store_caches);
 };
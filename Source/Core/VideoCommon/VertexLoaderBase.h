@@ -62,6 +62,13 @@ public:
   virtual ~VertexLoaderBase() {}
   virtual int RunVertices(const u8* src, u8* dst, int count) = 0;
 
+  // Loaders which keep no state between vertices can convert different ranges of the same draw
+  // on several threads at once. Unlike RunVertices, RunVerticesConcurrently doesn't count the
+  // vertices in m_numLoadedVertices and doesn't write the position and normal caches, so the caller
+  // has to update those afterwards.
+  virtual bool CanRunConcurrently() const { return false; }
+  virtual int RunVerticesConcurrently(const u8* src, u8* dst, int count) { return 0; }
+
   // per loader public state
   PortableVertexDeclaration m_native_vtx_decl{};
   const u32 m_vertex_size;  // number of bytes of a raw GC vertex
@@ -4,6 +4,7 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -16,6 +17,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "Common/Logging/Log.h"
+#include "Common/ThreadPool.h"
 
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
@@ -52,6 +54,11 @@ static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
+// Converts and culls the vertices of large draws together with the GPU thread.
+static Common::ThreadPool s_workers;
+static std::vector<int> s_chunk_vertex_counts;
+static std::vector<u8> s_scratch_vertices;
+
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 
 BitSet8 g_main_vat_dirty;
@@ -67,10 +74,17 @@ void Init()
   g_main_vertex_loaders.fill(nullptr);
   g_preprocess_vertex_loaders.fill(nullptr);
   SETSTAT(g_stats.num_vertex_loaders, 0);
+
+  s_workers.Reset("Vertex Loader", g_Config.GetVertexLoaderThreads());
 }
 
 void Clear()
 {
+  s_workers.Shutdown();
+
+  // The display list cache refers to the loaders which converted its vertices.
+  g_display_list_cache.Clear();
+
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
@@ -395,8 +409,67 @@ static bool CanSplit(OpcodeDecoder::Primitive primitive)
   }
 }
 
+// Splitting a draw between threads only pays off if each thread gets a fair amount of vertices.
+// Smaller draws are converted on the GPU thread.
+constexpr int MIN_VERTICES_PER_THREAD = 2048;
+
+int ConvertVertices(VertexLoaderBase* loader, const u8* src, u8* dst, int count)
+{
+  if (!s_workers.IsRunning() || count < 2 * MIN_VERTICES_PER_THREAD ||
+      !loader->CanRunConcurrently())
+  {
+    return loader->RunVertices(src, dst, count);
+  }
+
+  const int num_chunks =
+      std::min(static_cast<int>(s_workers.GetThreadCount()) + 1, count / MIN_VERTICES_PER_THREAD);
+  const int chunk_size = (count + num_chunks - 1) / num_chunks;
+  const int stride = loader->m_native_vtx_decl.stride;
+  s_chunk_vertex_counts.resize(num_chunks);
+  s_workers.ParallelFor(num_chunks, [&](size_t i) {
+    const int first = static_cast<int>(i) * chunk_size;
+    s_chunk_vertex_counts[i] =
+        loader->RunVerticesConcurrently(src + first * loader->m_vertex_size, dst + first * stride,
+                                        std::min(chunk_size, count - first));
+  });
+
+  // Skipped vertices leave a gap at the end of their chunk, which the later chunks are moved into.
+  int num_loaded = s_chunk_vertex_counts[0];
+  for (int i = 1; i < num_chunks; ++i)
+  {
+    if (num_loaded != i * chunk_size)
+    {
+      std::memmove(dst + num_loaded * stride, dst + i * chunk_size * stride,
+                   s_chunk_vertex_counts[i] * stride);
+    }
+    num_loaded += s_chunk_vertex_counts[i];
+  }
+
+  // The worker threads leave the position and normal caches alone. Only the last three vertices
+  // of the draw affect them, so converting those once more on this thread updates the caches as if
+  // the whole draw had been converted here.
+  const int num_tail_vertices = std::min(count, 3);
+  s_scratch_vertices.resize(num_tail_vertices * stride);
+  loader->RunVertices(src + (count - num_tail_vertices) * loader->m_vertex_size,
+                      s_scratch_vertices.data(), num_tail_vertices);
+  loader->m_numLoadedVertices += count - num_tail_vertices;
+
+  return num_loaded;
+}
+
+// Whether any attribute of the current vertex format is read from an array in memory.
+static bool HasIndexedAttributes()
+{
+  const TVtxDesc& desc = g_main_cp_state.vtx_desc;
+  const auto is_indexed = [](auto format) { return IsIndexed(format); };
+  return IsIndexed(desc.low.Position) || IsIndexed(desc.low.Normal) ||
+         std::any_of(desc.low.Color.begin(), desc.low.Color.end(), is_indexed) ||
+         std::any_of(desc.high.TexCoord.begin(), desc.high.TexCoord.end(), is_indexed);
+}
+
 template <bool IsPreprocess>
-int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src)
+int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src,
+                DisplayListCache::CachedPrimitive* cached_primitive, u32 src_offset)
 {
   if (count == 0) [[unlikely]]
     return 0;
@@ -443,16 +516,37 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
     const bool cullall = (bpmem.genMode.cull_mode == CullMode::All &&
                           primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
 
+    // Indexed attributes are read from outside the display list, so the vertices can't be reused
+    // even if the display list didn't change. Primitives which are split up aren't cached either.
+    constexpr int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
+    if (cached_primitive && (count > max_vertices || HasIndexedAttributes()))
+      cached_primitive = nullptr;
+
     const int stride = loader->m_native_vtx_decl.stride;
     do
     {
-      const int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
       const int run = CanSplit(primitive) && count > max_vertices ? max_vertices : count;
       count -= run;
       DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, run, stride,
                                                                   cullall || can_cpu_cull);
 
-      const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      int num_loaded;
+      {
+        ScopedPhaseTimer timer(VideoPhase::VertexLoading);
+        if (cached_primitive && cached_primitive->IsValidFor(loader, src_offset, run))
+        {
+          num_loaded = cached_primitive->Load(dst.GetPointer());
+        }
+        else
+        {
+          num_loaded = ConvertVertices(loader, src, dst.GetPointer(), run);
+          if (cached_primitive)
+          {
+            cached_primitive->Store(loader, src_offset, run, num_loaded, dst.GetPointer(),
+                                    num_loaded * stride);
+          }
+        }
+      }
       src += loader->m_vertex_size * max_vertices;
 
       if (can_cpu_cull && !cullall)
@@ -479,13 +573,20 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 }
 
 template int RunVertices<false>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                                const u8* src);
+                                const u8* src, DisplayListCache::CachedPrimitive* cached_primitive,
+                                u32 src_offset);
 template int RunVertices<true>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                               const u8* src);
+                               const u8* src, DisplayListCache::CachedPrimitive* cached_primitive,
+                               u32 src_offset);
 
 NativeVertexFormat* GetCurrentVertexFormat()
 {
   return s_current_vtx_fmt;
 }
 
+Common::ThreadPool& GetWorkers()
+{
+  return s_workers;
+}
+
 }  // namespace VertexLoaderManager
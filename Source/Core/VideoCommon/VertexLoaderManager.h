@@ -11,9 +11,16 @@
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/CPMemory.h"
+#include "VideoCommon/DisplayListCache.h"
 
 class NativeVertexFormat;
 struct PortableVertexDeclaration;
+class VertexLoaderBase;
+
+namespace Common
+{
+class ThreadPool;
+}
 
 namespace OpcodeDecoder
 {
@@ -41,8 +48,11 @@ NativeVertexFormat* GetOrCreateMatchingFormat(const PortableVertexDeclaration& d
 NativeVertexFormat* GetUberVertexFormat(const PortableVertexDeclaration& decl);
 
 // Returns -1 if buf_size is insufficient, else the amount of bytes consumed
+// If cached_primitive is given, the vertices are taken from it if it is valid for the data at
+// src_offset in the display list being run, and stored in it otherwise.
 template <bool IsPreprocess = false>
-int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src);
+int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src,
+                DisplayListCache::CachedPrimitive* cached_primitive = nullptr, u32 src_offset = 0);
 
 namespace detail
 {
@@ -54,6 +64,14 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group);
 
 NativeVertexFormat* GetCurrentVertexFormat();
 
+// The threads which convert and cull the vertices of large draws together with the GPU thread.
+// Only runs when enabled in the config, and must only be used from the GPU thread.
+Common::ThreadPool& GetWorkers();
+
+// Converts the vertices like loader->RunVertices, on the worker threads as well if the draw is
+// large enough. Returns the number of vertices written to dst.
+int ConvertVertices(VertexLoaderBase* loader, const u8* src, u8* dst, int count);
+
 // Resolved pointers to array bases. Used by vertex loaders.
 extern Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 void UpdateVertexArrayPointers();
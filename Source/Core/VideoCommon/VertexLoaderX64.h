@@ -19,15 +19,19 @@ public:
 
 protected:
   int RunVertices(const u8* src, u8* dst, int count) override;
+  bool CanRunConcurrently() const override { return true; }
+  int RunVerticesConcurrently(const u8* src, u8* dst, int count) override;
 
 private:
   u32 m_src_ofs = 0;
   u32 m_dst_ofs = 0;
+  bool m_store_caches = true;
+  const u8* m_run_without_caches = nullptr;
   Gen::FixupBranch m_skip_vertex;
   Gen::OpArg GetVertexAddr(CPArray array, VertexComponentFormat attribute);
   void ReadVertex(Gen::OpArg data, VertexComponentFormat attribute, ComponentFormat format,
                   int count_in, int count_out, bool dequantize, u8 scaling_exponent,
                   AttributeFormat* native_format);
   void ReadColor(Gen::OpArg data, VertexComponentFormat attribute, ColorFormat format);
-  void GenerateVertexLoader();
+  void GenerateVertexLoader(bool store_caches);
 };
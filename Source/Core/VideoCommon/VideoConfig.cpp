@@ -9,6 +9,9 @@
 #include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
 #include "Common/Contains.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Config/GraphicsSettings.h"
@@ -53,6 +56,32 @@ void UpdateActiveConfig()
   g_ActiveConfig.bVSyncActive = IsVSyncActive(g_ActiveConfig.bVSync);
 }
 
+// Parses a list like "4096:0,65536:512", which gives textures of up to 4096 bytes full hashes and
+// those of up to 65536 bytes 512 samples.
+static std::vector<std::pair<u32, int>> ParseHashSamplesBySize(const std::string& list)
+{
+  std::vector<std::pair<u32, int>> result;
+  for (const std::string& entry : SplitString(list, ','))
+  {
+    if (StripWhitespace(entry).empty())
+      continue;
+
+    const std::vector<std::string> parts = SplitString(entry, ':');
+    u32 max_size;
+    int samples;
+    if (parts.size() != 2 || !TryParse(std::string(StripWhitespace(parts[0])), &max_size) ||
+        !TryParse(std::string(StripWhitespace(parts[1])), &samples) || samples < 0)
+    {
+      WARN_LOG_FMT(VIDEO, "Ignoring invalid texture hash samples '{}'", entry);
+      continue;
+    }
+    result.emplace_back(max_size, samples);
+  }
+
+  std::ranges::sort(result);
+  return result;
+}
+
 void VideoConfig::Refresh()
 {
   if (!s_config_changed_callback_id.has_value())
@@ -100,6 +129,8 @@ void VideoConfig::Refresh()
       Config::Get(Config::GFX_WIDESCREEN_HEURISTIC_WIDESCREEN_RATIO);
   bCrop = Config::Get(Config::GFX_CROP);
   iSafeTextureCache_ColorSamples = Config::Get(Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES);
+  safe_texture_cache_samples_by_size =
+      ParseHashSamplesBySize(Config::Get(Config::GFX_SAFE_TEXTURE_CACHE_SAMPLES_BY_SIZE));
   bShowFPS = Config::Get(Config::GFX_SHOW_FPS);
   bShowFTimes = Config::Get(Config::GFX_SHOW_FTIMES);
   bShowVPS = Config::Get(Config::GFX_SHOW_VPS);
@@ -117,6 +148,7 @@ void VideoConfig::Refresh()
   bDumpBaseTextures = Config::Get(Config::GFX_DUMP_BASE_TEXTURES);
   bHiresTextures = Config::Get(Config::GFX_HIRES_TEXTURES);
   bCacheHiresTextures = Config::Get(Config::GFX_CACHE_HIRES_TEXTURES);
+  bPrefetchHiresTextures = Config::Get(Config::GFX_PREFETCH_HIRES_TEXTURES);
   bDumpEFBTarget = Config::Get(Config::GFX_DUMP_EFB_TARGET);
   bDumpXFBTarget = Config::Get(Config::GFX_DUMP_XFB_TARGET);
   bEnableGPUTextureDecoding = Config::Get(Config::GFX_ENABLE_GPU_TEXTURE_DECODING);
@@ -139,6 +171,8 @@ void VideoConfig::Refresh()
   iShaderCompilationMode = Config::Get(Config::GFX_SHADER_COMPILATION_MODE);
   iShaderCompilerThreads = Config::Get(Config::GFX_SHADER_COMPILER_THREADS);
   iShaderPrecompilerThreads = Config::Get(Config::GFX_SHADER_PRECOMPILER_THREADS);
+  iSWRasterizerThreads = Config::Get(Config::GFX_SW_RASTERIZER_THREADS);
+  iVertexLoaderThreads = Config::Get(Config::GFX_VERTEX_LOADER_THREADS);
   bCPUCull = Config::Get(Config::GFX_CPU_CULL);
 
   texture_filtering_mode = Config::Get(Config::GFX_ENHANCE_FORCE_TEXTURE_FILTERING);
@@ -179,6 +213,8 @@ void VideoConfig::Refresh()
   bImmediateXFB = Config::Get(Config::GFX_HACK_IMMEDIATE_XFB);
   bVISkip = Config::Get(Config::GFX_HACK_VI_SKIP);
   bSkipPresentingDuplicateXFBs = bVISkip || Config::Get(Config::GFX_HACK_SKIP_DUPLICATE_XFBS);
+  bDisplayListCache = Config::Get(Config::GFX_HACK_DISPLAY_LIST_CACHE);
+  bAsyncTextureDecoding = Config::Get(Config::GFX_HACK_ASYNC_TEXTURE_DECODING);
   bCopyEFBScaled = Config::Get(Config::GFX_HACK_COPY_EFB_SCALED);
   bEFBEmulateFormatChanges = Config::Get(Config::GFX_HACK_EFB_EMULATE_FORMAT_CHANGES);
   bVertexRounding = Config::Get(Config::GFX_HACK_VERTEX_ROUNDING);
@@ -284,6 +320,22 @@ u32 VideoConfig::GetShaderPrecompilerThreads() const
     return 1;
 }
 
+u32 VideoConfig::GetSoftwareRasterizerThreads() const
+{
+  if (iSWRasterizerThreads >= 0)
+    return static_cast<u32>(iSWRasterizerThreads);
+  else
+    return Common::ThreadPool::GetAutomaticThreadCount();
+}
+
+u32 VideoConfig::GetVertexLoaderThreads() const
+{
+  if (iVertexLoaderThreads >= 0)
+    return static_cast<u32>(iVertexLoaderThreads);
+  else
+    return Common::ThreadPool::GetAutomaticThreadCount();
+}
+
 void CheckForConfigChanges()
 {
   const ShaderHostConfig old_shader_host_config = ShaderHostConfig::GetCurrent();
@@ -11,6 +11,7 @@
 
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -269,6 +270,7 @@ struct VideoConfig final
   bool bDumpBaseTextures = false;
   bool bHiresTextures = false;
   bool bCacheHiresTextures = false;
+  bool bPrefetchHiresTextures = false;
   bool bDumpEFBTarget = false;
   bool bDumpXFBTarget = false;
   bool bBorderlessFullscreen = false;
@@ -293,12 +295,17 @@ struct VideoConfig final
   bool bSkipPresentingDuplicateXFBs = false;
   bool bCopyEFBScaled = false;
   int iSafeTextureCache_ColorSamples = 0;
+  // Color samples for textures of up to a size in bytes, as (size, samples) sorted by size. Larger
+  // textures use iSafeTextureCache_ColorSamples.
+  std::vector<std::pair<u32, int>> safe_texture_cache_samples_by_size;
   float fAspectRatioHackW = 1;  // Initial value needed for the first frame
   float fAspectRatioHackH = 1;
   bool bEnablePixelLighting = false;
   bool bFastDepthCalc = false;
   bool bVertexRounding = false;
   bool bVISkip = false;
+  bool bDisplayListCache = false;
+  bool bAsyncTextureDecoding = false;
   int iEFBAccessTileSize = 0;
   int iSaveTargetId = 0;  // TODO: Should be dropped
   u32 iMissingColorValue = 0;
@@ -342,6 +349,16 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Number of extra threads the software renderer draws EFB tiles on.
+  // 0 draws everything on the GPU thread.
+  // -1 uses an automatic number based on the CPU threads.
+  int iSWRasterizerThreads = 0;
+
+  // Number of extra threads the vertices of large draws are converted and culled on.
+  // 0 converts and culls all vertices on the GPU thread.
+  // -1 uses an automatic number based on the CPU threads.
+  int iVertexLoaderThreads = 0;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -391,6 +408,8 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetSoftwareRasterizerThreads() const;
+  u32 GetVertexLoaderThreads() const;
 
   float GetCustomAspectRatio() const { return (float)custom_aspect_width / custom_aspect_height; }
 };
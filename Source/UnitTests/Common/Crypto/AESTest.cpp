@@ -0,0 +1,68 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/AES.h"
+
+// FIPS-197 appendix C.1
+TEST(AES, Vector)
+{
+  constexpr std::array<u8, 16> key{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                   0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
+  constexpr std::array<u8, 16> plaintext{0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                         0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+  constexpr std::array<u8, 16> ciphertext{0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+                                          0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a};
+
+  std::array<u8, 16> out;
+  Common::AES::CreateContextEncrypt(key.data())->CryptIvZero(plaintext.data(), out.data(), 16);
+  EXPECT_EQ(ciphertext, out);
+  Common::AES::CreateContextDecrypt(key.data())->CryptIvZero(ciphertext.data(), out.data(), 16);
+  EXPECT_EQ(plaintext, out);
+}
+
+TEST(AES, CryptMultiple)
+{
+  constexpr std::array<u8, 16> key{0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+                                   0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+  const auto encrypt = Common::AES::CreateContextEncrypt(key.data());
+  const auto decrypt = Common::AES::CreateContextDecrypt(key.data());
+
+  constexpr size_t LEN = 0x400;
+  for (size_t count = 1; count <= 19; ++count)
+  {
+    std::vector<std::vector<u8>> in(count, std::vector<u8>(LEN));
+    std::vector<std::array<u8, 16>> ivs(count);
+    std::vector<std::vector<u8>> encrypted(count, std::vector<u8>(LEN));
+    std::vector<std::vector<u8>> decrypted(count, std::vector<u8>(LEN));
+    std::vector<Common::AES::Context::Buffer> encrypt_buffers;
+    std::vector<Common::AES::Context::Buffer> decrypt_buffers;
+    for (size_t i = 0; i < count; ++i)
+    {
+      for (size_t j = 0; j < LEN; ++j)
+        in[i][j] = static_cast<u8>(i * 13 + j * 5);
+      ivs[i].fill(static_cast<u8>(i));
+
+      // Mix buffers with and without an IV
+      const u8* iv = i % 2 ? ivs[i].data() : nullptr;
+      encrypt_buffers.push_back({iv, in[i].data(), encrypted[i].data()});
+      decrypt_buffers.push_back({iv, encrypted[i].data(), decrypted[i].data()});
+    }
+
+    ASSERT_TRUE(encrypt->CryptMultiple(encrypt_buffers, LEN));
+    ASSERT_TRUE(decrypt->CryptMultiple(decrypt_buffers, LEN));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      std::vector<u8> expected(LEN);
+      encrypt->Crypt(encrypt_buffers[i].iv, in[i].data(), expected.data(), LEN);
+      EXPECT_EQ(expected, encrypted[i]);
+      EXPECT_EQ(in[i], decrypted[i]);
+    }
+  }
+}
@@ -1,3 +1,5 @@
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "Common/Crypto/SHA1.h"
@@ -28,3 +30,28 @@ TEST(SHA1, Vectors)
     EXPECT_EQ(test.expected, actual);
   }
 }
+
+TEST(SHA1, MultipleDigests)
+{
+  // Covers messages that need one or two padding blocks, and counts that don't fill every slot
+  for (const size_t len : {0, 3, 55, 56, 64, 119, 620, 0x400})
+  {
+    for (size_t count = 1; count <= 17; ++count)
+    {
+      std::vector<std::vector<u8>> msgs(count, std::vector<u8>(len));
+      std::vector<const u8*> msg_ptrs;
+      for (size_t i = 0; i < count; ++i)
+      {
+        for (size_t j = 0; j < len; ++j)
+          msgs[i][j] = static_cast<u8>(i * 31 + j * 7);
+        msg_ptrs.push_back(msgs[i].data());
+      }
+
+      std::vector<Common::SHA1::Digest> digests(count);
+      Common::SHA1::CalculateDigests(msg_ptrs, len, digests.data());
+
+      for (size_t i = 0; i < count; ++i)
+        EXPECT_EQ(Common::SHA1::CalculateDigest(msgs[i]), digests[i]);
+    }
+  }
+}
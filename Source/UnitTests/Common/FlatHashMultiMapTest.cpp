@@ -0,0 +1,91 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Common/FlatHashMultiMap.h"
+
+TEST(FlatHashMultiMap, MultipleValuesPerKey)
+{
+  Common::FlatHashMultiMap<int> map;
+  map.Insert(42, 1);
+  map.Insert(42, 2);
+  map.Insert(7, 3);
+  EXPECT_EQ(map.Size(), 3u);
+
+  EXPECT_NE(map.FindIf(42, [](int v) { return v == 1; }), nullptr);
+  EXPECT_NE(map.FindIf(42, [](int v) { return v == 2; }), nullptr);
+  EXPECT_EQ(map.FindIf(42, [](int v) { return v == 3; }), nullptr);
+  EXPECT_EQ(*map.FindIf(7, [](int) { return true; }), 3);
+
+  EXPECT_TRUE(map.EraseIf(42, [](int v) { return v == 1; }));
+  EXPECT_FALSE(map.EraseIf(42, [](int v) { return v == 1; }));
+  EXPECT_EQ(map.FindIf(42, [](int v) { return v == 1; }), nullptr);
+  EXPECT_NE(map.FindIf(42, [](int v) { return v == 2; }), nullptr);
+  EXPECT_EQ(map.Size(), 2u);
+
+  map.Clear();
+  EXPECT_TRUE(map.Empty());
+  EXPECT_EQ(map.FindIf(7, [](int) { return true; }), nullptr);
+}
+
+TEST(FlatHashMultiMap, MatchesStdMultimap)
+{
+  Common::FlatHashMultiMap<u32> map;
+  std::multimap<u64, u32> reference;
+
+  // Few distinct keys, so there are long runs of equal keys and many collisions.
+  std::mt19937_64 rng(1234);
+  for (u32 i = 0; i < 20000; ++i)
+  {
+    const u64 key = rng() % 512;
+    if (rng() % 3 != 0)
+    {
+      map.Insert(key, i);
+      reference.emplace(key, i);
+    }
+    else
+    {
+      const auto it = reference.find(key);
+      if (it == reference.end())
+        continue;
+
+      const u32 value = it->second;
+      EXPECT_TRUE(map.EraseIf(key, [value](u32 v) { return v == value; }));
+      reference.erase(it);
+    }
+  }
+
+  EXPECT_EQ(map.Size(), reference.size());
+  for (const auto& [key, value] : reference)
+    EXPECT_NE(map.FindIf(key, [value](u32 v) { return v == value; }), nullptr);
+
+  size_t count = 0;
+  map.ForEach([&](u64 key, u32 value) {
+    ++count;
+    const auto [begin, end] = reference.equal_range(key);
+    EXPECT_TRUE(std::any_of(begin, end, [value](const auto& kv) { return kv.second == value; }));
+  });
+  EXPECT_EQ(count, reference.size());
+}
+
+TEST(FlatHashMultiMap, ReserveKeepsValues)
+{
+  Common::FlatHashMultiMap<std::unique_ptr<int>> map;
+  for (int i = 0; i < 100; ++i)
+    *map.Insert(i, std::make_unique<int>(0)) = i;
+
+  map.Reserve(10000);
+  EXPECT_EQ(map.Size(), 100u);
+  for (int i = 0; i < 100; ++i)
+  {
+    const auto* value = map.FindIf(i, [](const auto&) { return true; });
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(**value, i);
+  }
+}
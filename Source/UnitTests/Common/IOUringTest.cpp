@@ -0,0 +1,117 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/IOUring.h"
+
+namespace
+{
+std::vector<u8> MakeData()
+{
+  std::vector<u8> data(1 << 20);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<u8>(i * 7 + (i >> 8));
+  return data;
+}
+}  // namespace
+
+TEST(IOUring, ReadsMatchFile)
+{
+  const auto reader = Common::IOUringReader::Create(8);
+  if (!reader)
+    GTEST_SKIP() << "io_uring is not available";
+
+  const std::string dir = File::CreateTempDir();
+  ASSERT_FALSE(dir.empty());
+  const std::string path = dir + "/data.bin";
+
+  const std::vector<u8> data = MakeData();
+  {
+    File::IOFile file(path, "wb");
+    ASSERT_TRUE(file.WriteBytes(data.data(), data.size()));
+  }
+
+  const int fd = open(path.c_str(), O_RDONLY);
+  ASSERT_GE(fd, 0);
+
+  constexpr u64 READ_SIZE = 0x1000;
+  std::vector<u8> out(data.size());
+  std::atomic<int> successes = 0;
+  for (u64 offset = 0; offset < data.size(); offset += READ_SIZE)
+  {
+    reader->Read(fd, offset, out.data() + offset, READ_SIZE,
+                 [&successes](bool success) { successes += success; });
+  }
+
+  // Reading past the end of the file must fail instead of returning partial data
+  std::atomic<bool> eof_success = true;
+  u8 eof_buffer[16];
+  reader->Read(fd, data.size() - 8, eof_buffer, sizeof(eof_buffer),
+               [&eof_success](bool success) { eof_success = success; });
+
+  reader->WaitForReads();
+  close(fd);
+  File::DeleteDirRecursively(dir);
+
+  EXPECT_EQ(successes.load(), static_cast<int>(data.size() / READ_SIZE));
+  EXPECT_FALSE(eof_success.load());
+  EXPECT_EQ(out, data);
+}
+
+TEST(IOUring, FailedSubmitsAreNotResubmitted)
+{
+  const auto reader = Common::IOUringReader::Create(8);
+  if (!reader)
+    GTEST_SKIP() << "io_uring is not available";
+
+  const std::string dir = File::CreateTempDir();
+  ASSERT_FALSE(dir.empty());
+  const std::string path = dir + "/data.bin";
+
+  const std::vector<u8> data = MakeData();
+  {
+    File::IOFile file(path, "wb");
+    ASSERT_TRUE(file.WriteBytes(data.data(), data.size()));
+  }
+
+  const int fd = open(path.c_str(), O_RDONLY);
+  ASSERT_GE(fd, 0);
+
+  // The requests of failed submissions are freed right away, so the kernel must never see them.
+  // If it did, the reads after them would complete with the freed requests instead of their own.
+  constexpr u64 READ_SIZE = 0x1000;
+  constexpr int FAILED_READS = 3;
+  std::vector<u8> out(data.size());
+  std::atomic<int> successes = 0;
+  std::atomic<int> failures = 0;
+  reader->SimulateSubmitFailures(FAILED_READS);
+  for (int i = 0; i < FAILED_READS; ++i)
+  {
+    std::vector<u8> failed_out(READ_SIZE);
+    reader->Read(fd, 0, failed_out.data(), READ_SIZE,
+                 [&failures](bool success) { failures += !success; });
+  }
+  for (u64 offset = 0; offset < data.size(); offset += READ_SIZE)
+  {
+    reader->Read(fd, offset, out.data() + offset, READ_SIZE,
+                 [&successes](bool success) { successes += success; });
+  }
+
+  reader->WaitForReads();
+  close(fd);
+  File::DeleteDirRecursively(dir);
+
+  EXPECT_EQ(failures.load(), FAILED_READS);
+  EXPECT_EQ(successes.load(), static_cast<int>(data.size() / READ_SIZE));
+  EXPECT_EQ(out, data);
+}
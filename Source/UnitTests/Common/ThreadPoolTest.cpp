@@ -0,0 +1,65 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/ThreadPool.h"
+
+TEST(ThreadPool, PushAndWait)
+{
+  Common::ThreadPool pool("test pool", 4);
+
+  std::atomic<int> sum = 0;
+  for (int i = 1; i <= 1000; ++i)
+    pool.Push([&sum, i] { sum += i; });
+  pool.WaitForCompletion();
+
+  EXPECT_EQ(sum.load(), 500500);
+}
+
+TEST(ThreadPool, NoThreadsRunsInline)
+{
+  Common::ThreadPool pool;
+  EXPECT_FALSE(pool.IsRunning());
+
+  int x = 0;
+  pool.Push([&] { x = 1; });
+  // Ran immediately as there is no worker to hand it to.
+  EXPECT_EQ(x, 1);
+
+  pool.WaitForCompletion();
+}
+
+TEST(ThreadPool, ParallelFor)
+{
+  Common::ThreadPool pool("test pool", 3);
+
+  std::vector<int> values(10000, 0);
+  pool.ParallelFor(values.size(), [&](size_t i) { values[i] += static_cast<int>(i); });
+
+  for (size_t i = 0; i < values.size(); ++i)
+    EXPECT_EQ(values[i], static_cast<int>(i));
+
+  // Zero items is a no-op.
+  pool.ParallelFor(0, [](size_t) { FAIL(); });
+}
+
+TEST(ThreadPool, ShutdownFinishesWork)
+{
+  std::atomic<int> count = 0;
+  {
+    Common::ThreadPool pool("test pool", 2);
+    for (int i = 0; i < 100; ++i)
+      pool.Push([&] { ++count; });
+    pool.Shutdown();
+    EXPECT_EQ(count.load(), 100);
+
+    pool.Reset("test pool", 1);
+    pool.Push([&] { ++count; });
+  }
+  // The destructor also finishes the queue.
+  EXPECT_EQ(count.load(), 101);
+}
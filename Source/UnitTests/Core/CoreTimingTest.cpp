@@ -6,14 +6,19 @@
 #include <array>
 #include <bitset>
 #include <string>
+#include <vector>
 
+#include "Common/Buffer.h"
+#include "Common/ChunkFile.h"
 #include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
+#include "Common/ThreadPool.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RewindBuffer.h"
 #include "Core/System.h"
 #include "UICommon/UICommon.h"
 
@@ -393,3 +398,86 @@ TEST(CoreTiming, Overclocking)
   Config::SetCurrent(Config::MAIN_OVERCLOCK, 1.0f);
   AdvanceAndCheck(system, 4, MAX_SLICE_LENGTH);
 }
+
+namespace RewindSnapshotTest
+{
+// The parts of a savestate which GetTicks depends on
+void DoTimingState(Core::System& system, PointerWrap& p)
+{
+  system.GetCoreTiming().DoState(p);
+  p.Do(system.GetPPCState().downcount);
+}
+
+std::vector<u8> SaveTimingState(Core::System& system)
+{
+  u8* ptr = nullptr;
+  PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  DoTimingState(system, p_measure);
+
+  std::vector<u8> state(reinterpret_cast<size_t>(ptr));
+  ptr = state.data();
+  PointerWrap p(&ptr, state.size(), PointerWrap::Mode::Write);
+  DoTimingState(system, p);
+  return state;
+}
+
+void LoadTimingState(Core::System& system, Common::UniqueBuffer<u8>& state)
+{
+  u8* ptr = state.data();
+  PointerWrap p(&ptr, state.size(), PointerWrap::Mode::Read);
+  DoTimingState(system, p);
+}
+}  // namespace RewindSnapshotTest
+
+// Rewind snapshots are requested from an event, like the VideoInterface's field updates, and must
+// restore the timing state as it was when they were taken.
+TEST(CoreTiming, RewindSnapshotKeepsTicks)
+{
+  using namespace RewindSnapshotTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  Common::ThreadPool pool("test pool", 2);
+  State::RewindBuffer rewind_buffer(pool, 64 * 1024 * 1024);
+  u64 snapshot_ticks = 0;
+
+  CoreTiming::EventType* cb_a = core_timing.RegisterEvent("callbackA", CallbackTemplate<0>);
+  CoreTiming::EventType* cb_snapshot = core_timing.RegisterEvent(
+      "callbackSnapshot", [&](Core::System& event_system, u64, s64) {
+        event_system.GetCoreTiming().RunAfterAdvance([&] {
+          snapshot_ticks = core_timing.GetTicks();
+          rewind_buffer.Push(SaveTimingState(system));
+        });
+      });
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  core_timing.ScheduleEvent(500, cb_snapshot);
+  core_timing.ScheduleEvent(1000, cb_a, CB_IDS[0]);
+
+  ppc_state.downcount = 0;
+  core_timing.Advance();  // cb_snapshot
+  EXPECT_EQ(500u, snapshot_ticks);
+  EXPECT_EQ(1u, rewind_buffer.GetSnapshotCount());
+
+  // Run past the snapshot before rewinding to it
+  AdvanceAndCheck(system, 0, MAX_SLICE_LENGTH);
+  ppc_state.downcount -= 300;
+  EXPECT_EQ(1300u, core_timing.GetTicks());
+
+  Common::UniqueBuffer<u8> state;
+  ASSERT_TRUE(rewind_buffer.Pop(state));
+  LoadTimingState(system, state);
+  EXPECT_EQ(snapshot_ticks, core_timing.GetTicks());
+
+  // The events after the snapshot run at the same ticks again
+  AdvanceAndCheck(system, 0, MAX_SLICE_LENGTH);
+  EXPECT_EQ(1000u, core_timing.GetTicks());
+}
@@ -0,0 +1,191 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/JitCommon/JitAnalysisCache.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+
+static constexpr u32 BLOCK_ADDRESS = 0x00003000;
+static constexpr u32 BLOCK_SIZE = 32;
+static constexpr u32 FEATURE_FLAGS = 0;
+
+// addi r3, r3, immediate
+static constexpr u32 AddiR3(u16 immediate)
+{
+  return 0x38630000 | immediate;
+}
+static constexpr u32 BLR = 0x4E800020;
+
+class JitAnalysisCacheTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_profile_path = File::CreateTempDir();
+    ASSERT_FALSE(m_profile_path.empty());
+    UICommon::SetUserDirectory(m_profile_path);
+
+    auto& system = Core::System::GetInstance();
+    system.GetMemory().Init();
+
+    // Read instructions straight from memory, without address translation or the icache
+    auto& ppc_state = system.GetPPCState();
+    ppc_state.msr.IR = 0;
+    HID0(ppc_state).ICE = 0;
+
+    m_buffer.resize(BLOCK_SIZE);
+  }
+
+  void TearDown() override
+  {
+    Core::System::GetInstance().GetMemory().Shutdown();
+    File::DeleteDirRecursively(m_profile_path);
+  }
+
+  static void WriteBlock(u16 immediate)
+  {
+    auto& memory = Core::System::GetInstance().GetMemory();
+    memory.Write_U32(AddiR3(immediate), BLOCK_ADDRESS);
+    memory.Write_U32(AddiR3(immediate), BLOCK_ADDRESS + 4);
+    memory.Write_U32(BLR, BLOCK_ADDRESS + 8);
+  }
+
+  u32 Analyze()
+  {
+    return m_analyzer.Analyze(BLOCK_ADDRESS, &m_block, &m_buffer, BLOCK_SIZE);
+  }
+
+  void Store(JitAnalysisCache& cache, u32 next_pc)
+  {
+    cache.Store(BLOCK_ADDRESS, FEATURE_FLAGS, m_analyzer.GetAnalysisFlags(), next_pc, m_block,
+                m_buffer);
+  }
+
+  std::optional<u32> Lookup(JitAnalysisCache& cache)
+  {
+    return cache.Lookup(BLOCK_ADDRESS, FEATURE_FLAGS, m_analyzer.GetAnalysisFlags(), &m_block,
+                        &m_buffer);
+  }
+
+  std::string m_profile_path;
+
+  PPCAnalyst::PPCAnalyzer m_analyzer;
+  PPCAnalyst::BlockStats m_stats{};
+  PPCAnalyst::BlockRegStats m_gpa{};
+  PPCAnalyst::BlockRegStats m_fpa{};
+  PPCAnalyst::CodeBlock m_block{.m_stats = &m_stats, .m_gpa = &m_gpa, .m_fpa = &m_fpa};
+  PPCAnalyst::CodeBuffer m_buffer;
+};
+
+TEST_F(JitAnalysisCacheTest, HitReturnsStoredAnalysis)
+{
+  JitAnalysisCache cache(Core::System::GetInstance());
+  cache.Open("GTEST01");
+
+  WriteBlock(1);
+  const u32 next_pc = Analyze();
+  const u32 num_instructions = m_block.m_num_instructions;
+  const u32 num_cycles = m_stats.numCycles;
+  const BitSet32 gpr_inputs = m_block.m_gpr_inputs;
+  ASSERT_EQ(num_instructions, 3u);
+
+  EXPECT_FALSE(Lookup(cache).has_value());
+  Store(cache, next_pc);
+
+  m_block = {.m_stats = &m_stats, .m_gpa = &m_gpa, .m_fpa = &m_fpa};
+  m_buffer.assign(BLOCK_SIZE, {});
+
+  EXPECT_EQ(Lookup(cache), next_pc);
+  EXPECT_EQ(m_block.m_address, BLOCK_ADDRESS);
+  EXPECT_EQ(m_block.m_num_instructions, num_instructions);
+  EXPECT_EQ(m_stats.numCycles, num_cycles);
+  EXPECT_EQ(m_block.m_gpr_inputs, gpr_inputs);
+  for (u32 i = 0; i < num_instructions; ++i)
+  {
+    EXPECT_EQ(m_buffer[i].address, BLOCK_ADDRESS + i * 4);
+    EXPECT_NE(m_buffer[i].opinfo, nullptr);
+  }
+  EXPECT_EQ(m_buffer[0].inst.hex, AddiR3(1));
+  EXPECT_EQ(m_buffer[2].inst.hex, BLR);
+}
+
+TEST_F(JitAnalysisCacheTest, HitAfterReopening)
+{
+  WriteBlock(1);
+  const u32 next_pc = Analyze();
+
+  {
+    JitAnalysisCache cache(Core::System::GetInstance());
+    cache.Open("GTEST01");
+    Store(cache, next_pc);
+    cache.Close();
+  }
+
+  JitAnalysisCache cache(Core::System::GetInstance());
+  cache.Open("GTEST01");
+  EXPECT_EQ(Lookup(cache), next_pc);
+
+  // Each game has a cache file of its own
+  cache.Open("GTEST02");
+  EXPECT_FALSE(Lookup(cache).has_value());
+}
+
+TEST_F(JitAnalysisCacheTest, ChangedInstructionsInvalidateEntry)
+{
+  JitAnalysisCache cache(Core::System::GetInstance());
+  cache.Open("GTEST01");
+
+  WriteBlock(1);
+  Store(cache, Analyze());
+
+  WriteBlock(2);
+  EXPECT_FALSE(Lookup(cache).has_value());
+
+  // Entries are only used with the analyzer settings they were created with
+  WriteBlock(1);
+  m_analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_MERGE);
+  EXPECT_FALSE(Lookup(cache).has_value());
+  m_analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_MERGE);
+  EXPECT_TRUE(Lookup(cache).has_value());
+}
+
+TEST_F(JitAnalysisCacheTest, OldestVersionIsEvicted)
+{
+  JitAnalysisCache cache(Core::System::GetInstance());
+  cache.Open("GTEST01");
+
+  // Store one more version of the block than the cache keeps for an address
+  const u16 versions = static_cast<u16>(JitAnalysisCache::MAX_ENTRIES_PER_KEY + 1);
+  for (u16 i = 1; i <= versions; ++i)
+  {
+    WriteBlock(i);
+    Store(cache, Analyze());
+  }
+
+  WriteBlock(1);
+  EXPECT_FALSE(Lookup(cache).has_value());
+
+  for (u16 i = 2; i <= versions; ++i)
+  {
+    WriteBlock(i);
+    EXPECT_TRUE(Lookup(cache).has_value()) << "version " << i;
+  }
+
+  // The same versions are kept when loading the file again
+  cache.Close();
+  cache.Open("GTEST01");
+  WriteBlock(1);
+  EXPECT_FALSE(Lookup(cache).has_value());
+  WriteBlock(versions);
+  EXPECT_TRUE(Lookup(cache).has_value());
+}
@@ -0,0 +1,141 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/Buffer.h"
+#include "Common/ThreadPool.h"
+#include "Core/RewindBuffer.h"
+
+namespace
+{
+// Data which doesn't repeat within a state, so that no two chunks of it are the same
+std::vector<u8> MakeState(size_t size, u8 seed)
+{
+  std::vector<u8> state(size);
+  u32 value = seed;
+  for (u8& byte : state)
+  {
+    value = value * 1664525 + 1013904223;
+    byte = static_cast<u8>(value >> 24);
+  }
+  return state;
+}
+
+bool Matches(const Common::UniqueBuffer<u8>& buffer, const std::vector<u8>& expected)
+{
+  return buffer.size() == expected.size() && std::ranges::equal(buffer, expected);
+}
+}  // namespace
+
+TEST(RewindBuffer, PopsNewestFirst)
+{
+  Common::ThreadPool pool("test pool", 2);
+  State::RewindBuffer rewind_buffer(pool, 64 * 1024 * 1024);
+
+  // Not a multiple of the chunk size, to cover the shorter last chunk.
+  const std::vector<u8> first = MakeState(State::RewindBuffer::CHUNK_SIZE * 3 + 123, 0);
+  const std::vector<u8> second = MakeState(State::RewindBuffer::CHUNK_SIZE * 3 + 123, 1);
+  rewind_buffer.Push(first);
+  rewind_buffer.Push(second);
+  EXPECT_EQ(rewind_buffer.GetSnapshotCount(), 2u);
+
+  Common::UniqueBuffer<u8> buffer;
+  ASSERT_TRUE(rewind_buffer.Pop(buffer));
+  EXPECT_TRUE(Matches(buffer, second));
+  ASSERT_TRUE(rewind_buffer.Pop(buffer));
+  EXPECT_TRUE(Matches(buffer, first));
+
+  EXPECT_FALSE(rewind_buffer.Pop(buffer));
+  EXPECT_EQ(rewind_buffer.GetMemoryUsage(), 0u);
+}
+
+TEST(RewindBuffer, DeduplicatesChunks)
+{
+  Common::ThreadPool pool;
+  State::RewindBuffer rewind_buffer(pool, 64 * 1024 * 1024);
+
+  std::vector<u8> state = MakeState(State::RewindBuffer::CHUNK_SIZE * 8, 0);
+  rewind_buffer.Push(state);
+  const size_t usage_after_first = rewind_buffer.GetMemoryUsage();
+
+  // Only one chunk differs, so the second snapshot must be much cheaper than the first.
+  state[5] ^= 0xff;
+  rewind_buffer.Push(state);
+  EXPECT_LT(rewind_buffer.GetMemoryUsage() - usage_after_first, usage_after_first / 2);
+
+  Common::UniqueBuffer<u8> buffer;
+  ASSERT_TRUE(rewind_buffer.Pop(buffer));
+  EXPECT_TRUE(Matches(buffer, state));
+
+  // The shared chunks must still be there for the first snapshot.
+  state[5] ^= 0xff;
+  ASSERT_TRUE(rewind_buffer.Pop(buffer));
+  EXPECT_TRUE(Matches(buffer, state));
+}
+
+TEST(RewindBuffer, DropsOldestOverBudget)
+{
+  Common::ThreadPool pool;
+  State::RewindBuffer rewind_buffer(pool, 64 * 1024 * 1024);
+
+  for (u8 i = 0; i < 4; ++i)
+    rewind_buffer.Push(MakeState(State::RewindBuffer::CHUNK_SIZE * 2, i));
+  EXPECT_EQ(rewind_buffer.GetSnapshotCount(), 4u);
+
+  // The newest snapshot is kept even when it doesn't fit.
+  rewind_buffer.SetMemoryBudget(0);
+  EXPECT_EQ(rewind_buffer.GetSnapshotCount(), 1u);
+
+  Common::UniqueBuffer<u8> buffer;
+  ASSERT_TRUE(rewind_buffer.Pop(buffer));
+  EXPECT_TRUE(Matches(buffer, MakeState(State::RewindBuffer::CHUNK_SIZE * 2, 3)));
+}
+
+TEST(RewindBuffer, AlignsChunksToMemoryRegions)
+{
+  Common::ThreadPool pool;
+  State::RewindBuffer rewind_buffer(pool, 64 * 1024 * 1024);
+
+  constexpr size_t RAM_SIZE = State::RewindBuffer::CHUNK_SIZE * 8;
+  const std::vector<u8> ram = MakeState(RAM_SIZE, 0);
+  const auto make_state = [&ram](size_t header_size) {
+    std::vector<u8> state = MakeState(header_size, 100);
+    state.insert(state.end(), ram.begin(), ram.end());
+    return state;
+  };
+
+  // RAM is the same in both, but the data before it has grown by an amount which isn't a multiple
+  // of the chunk size. The chunks of RAM must still be shared.
+  const std::vector<u8> first = make_state(1000);
+  const std::vector<u8> second = make_state(1123);
+  rewind_buffer.Push(first, {{{.offset = 1000, .size = RAM_SIZE}}});
+  const size_t usage_after_first = rewind_buffer.GetMemoryUsage();
+  rewind_buffer.Push(second, {{{.offset = 1123, .size = RAM_SIZE}}});
+  EXPECT_LT(rewind_buffer.GetMemoryUsage() - usage_after_first, usage_after_first / 2);
+
+  Common::UniqueBuffer<u8> buffer;
+  ASSERT_TRUE(rewind_buffer.Pop(buffer));
+  EXPECT_TRUE(Matches(buffer, second));
+  ASSERT_TRUE(rewind_buffer.Pop(buffer));
+  EXPECT_TRUE(Matches(buffer, first));
+}
+
+TEST(RewindBuffer, StoresIncompressibleChunksUncompressed)
+{
+  Common::ThreadPool pool;
+  State::RewindBuffer rewind_buffer(pool, 64 * 1024 * 1024);
+
+  const std::vector<u8> state = MakeState(State::RewindBuffer::CHUNK_SIZE * 2 + 5, 1);
+
+  // The chunks are kept as they are rather than growing by being compressed.
+  rewind_buffer.Push(state);
+  EXPECT_LE(rewind_buffer.GetMemoryUsage(), state.size() + 3 * 16);
+
+  Common::UniqueBuffer<u8> buffer;
+  ASSERT_TRUE(rewind_buffer.Pop(buffer));
+  EXPECT_TRUE(Matches(buffer, state));
+}
@@ -0,0 +1,171 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Core/StateDelta.h"
+
+namespace
+{
+constexpr u32 PAGE_SIZE = 4096;
+
+// A state with the given amount of other data before RAM, which like the real sections before it
+// (the video backend, for instance) can change its size from one state to the next.
+struct TestState
+{
+  TestState(size_t header_size, size_t ram_size, size_t exram_size, u8 seed)
+  {
+    const size_t l1_offset = header_size + ram_size;
+    const size_t exram_offset = l1_offset + L1_SIZE + sizeof(u32);
+    data.resize(exram_offset + exram_size + TRAILER_SIZE);
+    std::iota(data.begin(), data.end(), seed);
+
+    layout[0] = {.offset = header_size, .size = ram_size};
+    layout[1] = {.offset = l1_offset, .size = L1_SIZE};
+    layout[3] = {.offset = exram_offset, .size = exram_size};
+  }
+
+  u8* Ram() { return data.data() + layout[0].offset; }
+  u8* ExRam() { return data.data() + layout[3].offset; }
+
+  // Gives this state the same memory contents as other, as far as the sizes of the regions allow.
+  void CopyMemoryFrom(const TestState& other)
+  {
+    for (size_t i = 0; i < layout.size(); ++i)
+    {
+      std::copy_n(other.data.data() + other.layout[i].offset,
+                  std::min(layout[i].size, other.layout[i].size), data.data() + layout[i].offset);
+    }
+  }
+
+  static constexpr size_t L1_SIZE = 16 * 1024;
+  static constexpr size_t TRAILER_SIZE = 777;
+
+  std::vector<u8> data;
+  State::MemoryLayout layout;
+};
+
+bool Matches(const Common::UniqueBuffer<u8>& buffer, const std::vector<u8>& expected)
+{
+  return buffer.size() == expected.size() && std::ranges::equal(buffer, expected);
+}
+}  // namespace
+
+TEST(StateDelta, ReconstructsTargetWhenSectionsBeforeMemoryGrow)
+{
+  constexpr size_t RAM_SIZE = PAGE_SIZE * 16;
+  constexpr size_t EXRAM_SIZE = PAGE_SIZE * 8;
+
+  TestState base(1000, RAM_SIZE, EXRAM_SIZE, 0);
+  TestState target(1234, RAM_SIZE, EXRAM_SIZE, 7);
+
+  // The same memory in both, except for one byte in RAM and one in EXRAM
+  target.CopyMemoryFrom(base);
+  target.Ram()[PAGE_SIZE * 5 + 17] ^= 0xFF;
+  target.ExRam()[EXRAM_SIZE - 1] ^= 0xFF;
+
+  const Common::UniqueBuffer<u8> delta =
+      State::CreateDelta(base.data, base.layout, target.data, target.layout, PAGE_SIZE);
+
+  // Only the two changed pages are stored, even though everything after the header has moved
+  const size_t memory_size = RAM_SIZE + TestState::L1_SIZE + EXRAM_SIZE;
+  const size_t header_size = (base.layout.size() + 2) * sizeof(u32);
+  EXPECT_EQ(delta.size(), header_size + (target.data.size() - memory_size) + 2 * PAGE_SIZE);
+
+  Common::UniqueBuffer<u8> reconstructed;
+  ASSERT_TRUE(State::ApplyDelta(base.data, base.layout, delta, target.layout, target.data.size(),
+                                PAGE_SIZE, reconstructed));
+  EXPECT_TRUE(Matches(reconstructed, target.data));
+}
+
+TEST(StateDelta, ReconstructsTargetWhenSectionsBeforeMemoryShrink)
+{
+  // Memory sizes which aren't a multiple of the page size, to cover the shorter last page
+  constexpr size_t RAM_SIZE = PAGE_SIZE * 4 + 100;
+  constexpr size_t EXRAM_SIZE = PAGE_SIZE * 2 + 3;
+
+  TestState base(5000, RAM_SIZE, EXRAM_SIZE, 3);
+  TestState target(20, RAM_SIZE, EXRAM_SIZE, 3);
+  target.CopyMemoryFrom(base);
+  target.Ram()[RAM_SIZE - 1] ^= 0xFF;
+
+  // Only the shorter last page of RAM is stored
+  const Common::UniqueBuffer<u8> delta =
+      State::CreateDelta(base.data, base.layout, target.data, target.layout, PAGE_SIZE);
+  const size_t memory_size = RAM_SIZE + TestState::L1_SIZE + EXRAM_SIZE;
+  const size_t header_size = (base.layout.size() + 1) * sizeof(u32);
+  EXPECT_EQ(delta.size(), header_size + (target.data.size() - memory_size) + 100);
+
+  Common::UniqueBuffer<u8> reconstructed;
+  ASSERT_TRUE(State::ApplyDelta(base.data, base.layout, delta, target.layout, target.data.size(),
+                                PAGE_SIZE, reconstructed));
+  EXPECT_TRUE(Matches(reconstructed, target.data));
+}
+
+TEST(StateDelta, ReconstructsTargetWithMoreMemoryThanBase)
+{
+  TestState base(100, PAGE_SIZE * 2, 0, 0);
+  TestState target(100, PAGE_SIZE * 3, PAGE_SIZE, 0);
+  base.layout[3] = {};
+  target.CopyMemoryFrom(base);
+
+  const Common::UniqueBuffer<u8> delta =
+      State::CreateDelta(base.data, base.layout, target.data, target.layout, PAGE_SIZE);
+
+  Common::UniqueBuffer<u8> reconstructed;
+  ASSERT_TRUE(State::ApplyDelta(base.data, base.layout, delta, target.layout, target.data.size(),
+                                PAGE_SIZE, reconstructed));
+  EXPECT_TRUE(Matches(reconstructed, target.data));
+}
+
+TEST(StateDelta, RejectsCorruptedDelta)
+{
+  TestState base(100, PAGE_SIZE * 4, PAGE_SIZE, 0);
+  TestState target(200, PAGE_SIZE * 4, PAGE_SIZE, 1);
+
+  const Common::UniqueBuffer<u8> delta =
+      State::CreateDelta(base.data, base.layout, target.data, target.layout, PAGE_SIZE);
+  Common::UniqueBuffer<u8> reconstructed;
+
+  // Truncated
+  const std::span<const u8> truncated(delta.data(), delta.size() - 1);
+  EXPECT_FALSE(State::ApplyDelta(base.data, base.layout, truncated, target.layout,
+                                 target.data.size(), PAGE_SIZE, reconstructed));
+
+  // Page index past the end of its region
+  Common::UniqueBuffer<u8> bad_index(delta.size());
+  std::ranges::copy(delta, bad_index.begin());
+  const u32 index = 1000;
+  std::copy_n(reinterpret_cast<const u8*>(&index), sizeof(index),
+              bad_index.data() + base.layout.size() * sizeof(u32));
+  EXPECT_FALSE(State::ApplyDelta(base.data, base.layout, bad_index, target.layout,
+                                 target.data.size(), PAGE_SIZE, reconstructed));
+
+  // Layout which doesn't fit the size of the state
+  EXPECT_FALSE(State::ApplyDelta(base.data, base.layout, delta, target.layout,
+                                 target.layout[3].offset, PAGE_SIZE, reconstructed));
+}
+
+TEST(StateDelta, ValidatesMemoryLayout)
+{
+  State::MemoryLayout layout{};
+  EXPECT_TRUE(State::IsValidMemoryLayout(layout, 0));
+
+  layout[0] = {.offset = 10, .size = 100};
+  layout[3] = {.offset = 110, .size = 50};
+  EXPECT_TRUE(State::IsValidMemoryLayout(layout, 160));
+  EXPECT_FALSE(State::IsValidMemoryLayout(layout, 159));
+
+  layout[3].offset = 100;
+  EXPECT_FALSE(State::IsValidMemoryLayout(layout, 1000));
+
+  layout[3] = {.offset = 0, .size = 0};
+  layout[0].size = ~u64{0};
+  EXPECT_FALSE(State::IsValidMemoryLayout(layout, 1000));
+}
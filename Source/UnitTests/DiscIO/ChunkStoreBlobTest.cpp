@@ -0,0 +1,300 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/AES.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Swap.h"
+#include "Core/IOS/ES/Formats.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/LaggedFibonacciGenerator.h"
+#include "DiscIO/VolumeWii.h"
+
+namespace
+{
+constexpr int CHUNK_SIZE = 0x8000;
+constexpr int COMPRESSION_LEVEL = 1;
+
+// Fills a chunk with data that doesn't compress or look like junk data, so that every chunk id
+// gives different chunk contents
+std::vector<u8> MakeChunk(u32 id, size_t size = CHUNK_SIZE)
+{
+  std::vector<u8> chunk(size);
+  u32 state = id * 0x9E3779B9 + 1;
+  for (u8& byte : chunk)
+  {
+    state = state * 1103515245 + 12345;
+    byte = static_cast<u8>(state >> 24);
+  }
+  return chunk;
+}
+
+std::vector<u8> MakeDisc(const std::vector<u32>& chunk_ids, size_t tail_size)
+{
+  std::vector<u8> disc;
+  for (u32 id : chunk_ids)
+  {
+    const std::vector<u8> chunk = MakeChunk(id);
+    disc.insert(disc.end(), chunk.begin(), chunk.end());
+  }
+  const std::vector<u8> tail = MakeChunk(0xFFFF, tail_size);
+  disc.insert(disc.end(), tail.begin(), tail.end());
+  return disc;
+}
+
+// Fills data with the junk data that is used as padding on discs, using a different seed for
+// each block like the mastering tools do
+void FillWithJunk(u8* data, size_t size, u32 seed_id)
+{
+  DiscIO::LaggedFibonacciGenerator lfg;
+  for (size_t offset = 0; offset < size; offset += DiscIO::VolumeWii::BLOCK_TOTAL_SIZE)
+  {
+    std::array<u32, DiscIO::LaggedFibonacciGenerator::SEED_SIZE> seed;
+    for (u32& word : seed)
+      word = seed_id++ * 0x9E3779B9;
+    lfg.SetSeed(seed.data());
+    lfg.GetBytes(std::min<size_t>(DiscIO::VolumeWii::BLOCK_TOTAL_SIZE, size - offset),
+                 data + offset);
+  }
+}
+
+void WriteSwapped32(std::vector<u8>* data, size_t offset, u32 value)
+{
+  const u32 swapped = Common::swap32(value);
+  std::memcpy(data->data() + offset, &swapped, sizeof(swapped));
+}
+
+// Builds a Wii disc with one encrypted partition of the given amount of blocks, with data that
+// doesn't compress. The hash block of the block at modified_hash_block is changed after hashing,
+// as some discs have hash blocks which don't match their data.
+std::vector<u8> MakeWiiDisc(size_t blocks, std::optional<size_t> modified_hash_block)
+{
+  using DiscIO::VolumeWii;
+
+  constexpr size_t PARTITION_OFFSET = 0x50000;
+  constexpr size_t PARTITION_DATA_OFFSET = 0x20000;
+  constexpr size_t DATA_START = PARTITION_OFFSET + PARTITION_DATA_OFFSET;
+  const size_t data_size = blocks * VolumeWii::BLOCK_TOTAL_SIZE;
+
+  std::vector<u8> disc = MakeDisc({}, DATA_START + data_size + 0x1234);
+
+  // Disc header, without the flags at 0x60 and 0x61 that turn off hashing and encryption
+  WriteSwapped32(&disc, 0x18, 0x5D1C9EA3);
+  std::fill(disc.begin() + 0x60, disc.begin() + 0x62, 0);
+
+  // Partition table with only the game partition
+  std::fill(disc.begin() + 0x40000, disc.begin() + 0x40028, 0);
+  WriteSwapped32(&disc, 0x40000, 1);
+  WriteSwapped32(&disc, 0x40004, 0x40020 >> 2);
+  WriteSwapped32(&disc, 0x40020, PARTITION_OFFSET >> 2);
+
+  // Partition header. The ticket only has to be valid enough to get the title key out of it.
+  u8* const partition = disc.data() + PARTITION_OFFSET;
+  std::fill(partition, partition + sizeof(IOS::ES::Ticket), 0);
+  WriteSwapped32(&disc, PARTITION_OFFSET, 0x10001);
+  std::fill(partition + offsetof(IOS::ES::Ticket, title_key),
+            partition + offsetof(IOS::ES::Ticket, title_key) + 0x10, 0x5A);
+  std::fill(partition + 0x2A4, partition + 0x2C0, 0);
+  WriteSwapped32(&disc, PARTITION_OFFSET + 0x2B8, PARTITION_DATA_OFFSET >> 2);
+  WriteSwapped32(&disc, PARTITION_OFFSET + 0x2BC, static_cast<u32>(data_size >> 2));
+
+  const IOS::ES::TicketReader ticket(
+      std::vector<u8>(partition, partition + sizeof(IOS::ES::Ticket)));
+  const std::array<u8, VolumeWii::AES_KEY_SIZE> key = ticket.GetTitleKey();
+  const auto aes_context = Common::AES::CreateContextEncrypt(key.data());
+
+  using BlockData = std::array<u8, VolumeWii::BLOCK_DATA_SIZE>;
+  std::vector<BlockData> group_data(VolumeWii::BLOCKS_PER_GROUP);
+  std::vector<VolumeWii::HashBlock> group_hashes(VolumeWii::BLOCKS_PER_GROUP);
+  for (size_t group_start = 0; group_start < blocks; group_start += VolumeWii::BLOCKS_PER_GROUP)
+  {
+    // The data past the end of the partition is hashed as zeroes
+    for (size_t i = 0; i < VolumeWii::BLOCKS_PER_GROUP; ++i)
+    {
+      if (group_start + i < blocks)
+      {
+        const std::vector<u8> block_data = MakeChunk(0x1000 + group_start + i, sizeof(BlockData));
+        std::ranges::copy(block_data, group_data[i].begin());
+      }
+      else
+      {
+        group_data[i].fill(0);
+      }
+    }
+    VolumeWii::HashGroup(group_data.data(), group_hashes.data());
+
+    for (size_t i = 0; i < VolumeWii::BLOCKS_PER_GROUP && group_start + i < blocks; ++i)
+    {
+      const size_t block = group_start + i;
+      if (block == modified_hash_block)
+        group_hashes[i].h1[3][7] ^= 0xFF;
+
+      u8* const out = disc.data() + DATA_START + block * VolumeWii::BLOCK_TOTAL_SIZE;
+      aes_context->CryptIvZero(reinterpret_cast<const u8*>(&group_hashes[i]), out,
+                               VolumeWii::BLOCK_HEADER_SIZE);
+      aes_context->Crypt(out + 0x3D0, group_data[i].data(), out + VolumeWii::BLOCK_HEADER_SIZE,
+                         VolumeWii::BLOCK_DATA_SIZE);
+    }
+  }
+
+  return disc;
+}
+
+class ChunkStoreBlobTest : public testing::Test
+{
+protected:
+  ChunkStoreBlobTest()
+      : m_directory(File::CreateTempDir()), m_store_path(m_directory + "/chunks")
+  {
+  }
+  ~ChunkStoreBlobTest() override { File::DeleteDirRecursively(m_directory); }
+
+  bool Convert(const std::vector<u8>& data, const std::string& name)
+  {
+    const std::string iso_path = m_directory + "/" + name + ".iso";
+    if (!File::IOFile(iso_path, "wb").WriteBytes(data.data(), data.size()))
+      return false;
+
+    const std::unique_ptr<DiscIO::BlobReader> iso = DiscIO::CreateBlobReader(iso_path);
+    if (!iso)
+      return false;
+
+    return DiscIO::ConvertToChunkStore(iso.get(), iso_path, GetManifestPath(name), m_store_path,
+                                       COMPRESSION_LEVEL, CHUNK_SIZE,
+                                       [](const std::string&, float) { return true; });
+  }
+
+  std::string GetManifestPath(const std::string& name) const
+  {
+    return m_directory + "/" + name + ".dcs";
+  }
+
+  void ExpectReadsBack(const std::string& name, const std::vector<u8>& data) const
+  {
+    const std::unique_ptr<DiscIO::BlobReader> reader =
+        DiscIO::CreateBlobReader(GetManifestPath(name));
+    ASSERT_NE(reader, nullptr);
+    ASSERT_EQ(reader->GetDataSize(), data.size());
+
+    std::vector<u8> read_data(data.size());
+    ASSERT_TRUE(reader->Read(0, read_data.size(), read_data.data()));
+    EXPECT_EQ(Common::SHA1::CalculateDigest(read_data), Common::SHA1::CalculateDigest(data));
+  }
+
+  size_t CountStoredChunks() const { return Common::DoFileSearch(m_store_path, ".zst").size(); }
+
+  std::string m_directory;
+  std::string m_store_path;
+};
+}  // namespace
+
+TEST_F(ChunkStoreBlobTest, RoundTrip)
+{
+  const std::vector<u8> data = MakeDisc({0, 1, 2, 3, 4}, 0x1234);
+  ASSERT_TRUE(Convert(data, "game"));
+
+  ExpectReadsBack("game", data);
+
+  const std::unique_ptr<DiscIO::BlobReader> reader =
+      DiscIO::CreateBlobReader(GetManifestPath("game"));
+  ASSERT_NE(reader, nullptr);
+  EXPECT_EQ(reader->GetBlobType(), DiscIO::BlobType::CHUNK_STORE);
+
+  // A read which starts and ends in the middle of chunks
+  constexpr u64 offset = CHUNK_SIZE / 2 + 3;
+  constexpr u64 size = CHUNK_SIZE * 2;
+  std::vector<u8> partial(size);
+  ASSERT_TRUE(reader->Read(offset, size, partial.data()));
+  EXPECT_TRUE(std::equal(partial.begin(), partial.end(), data.begin() + offset));
+
+  EXPECT_FALSE(reader->Read(data.size() - 1, 2, partial.data()));
+}
+
+TEST_F(ChunkStoreBlobTest, DuplicateChunksAreStoredOnce)
+{
+  // Chunks 0 and 1 appear twice within the disc
+  const std::vector<u8> data = MakeDisc({0, 1, 2, 0, 3, 1}, 0x1234);
+  ASSERT_TRUE(Convert(data, "game"));
+  EXPECT_EQ(CountStoredChunks(), 5u);
+
+  // A variant of the disc only adds the chunk it doesn't share with the first one
+  const std::vector<u8> variant_data = MakeDisc({0, 1, 4, 0, 3, 1}, 0x1234);
+  ASSERT_TRUE(Convert(variant_data, "variant"));
+  EXPECT_EQ(CountStoredChunks(), 6u);
+
+  ExpectReadsBack("game", data);
+  ExpectReadsBack("variant", variant_data);
+}
+
+TEST_F(ChunkStoreBlobTest, WiiPartitionWithModifiedHashBlock)
+{
+  // One full group and a group with only a few blocks, the first of which has a modified hash
+  const std::vector<u8> data = MakeWiiDisc(DiscIO::VolumeWii::BLOCKS_PER_GROUP + 3,
+                                           DiscIO::VolumeWii::BLOCKS_PER_GROUP + 1);
+  ASSERT_TRUE(Convert(data, "game"));
+
+  // 14 chunks before the partition data, 2 groups, 1 chunk after the partition data and the
+  // original hash blocks of the second group
+  EXPECT_EQ(CountStoredChunks(), 18u);
+
+  ExpectReadsBack("game", data);
+
+  // The same disc with hashes that match its data shares all of its chunks with the first one
+  const std::vector<u8> unmodified_data =
+      MakeWiiDisc(DiscIO::VolumeWii::BLOCKS_PER_GROUP + 3, std::nullopt);
+  ASSERT_TRUE(Convert(unmodified_data, "unmodified"));
+  EXPECT_EQ(CountStoredChunks(), 18u);
+
+  ExpectReadsBack("unmodified", unmodified_data);
+}
+
+TEST_F(ChunkStoreBlobTest, JunkDataIsPacked)
+{
+  // Junk data over several chunks, junk data after a few zero bytes like there often are at the
+  // end of a file, and junk data which is cut off by the end of the disc
+  std::vector<u8> data = MakeDisc({0}, 0);
+  data.resize(CHUNK_SIZE * 5 + 0x1234);
+  FillWithJunk(data.data() + CHUNK_SIZE, data.size() - CHUNK_SIZE, 1);
+  std::fill(data.begin() + CHUNK_SIZE * 4, data.begin() + CHUNK_SIZE * 4 + 0x1C, 0);
+  ASSERT_TRUE(Convert(data, "game"));
+
+  ExpectReadsBack("game", data);
+
+  // Junk data doesn't compress, so only the packing can make the chunks small
+  u64 store_size = 0;
+  for (const std::string& path : Common::DoFileSearch(m_store_path, ".zst"))
+    store_size += File::GetSize(path);
+  EXPECT_LT(store_size, CHUNK_SIZE + 0x1000);
+}
+
+TEST_F(ChunkStoreBlobTest, ReplacedChunkIsRejected)
+{
+  // The chunks must not be used by the other tests, as they would be in the shared chunk cache
+  const std::vector<u8> data = MakeDisc({100, 101}, 0);
+  ASSERT_TRUE(Convert(data, "game"));
+
+  // A chunk that decompresses fine but isn't the data its name says it is
+  const std::vector<std::string> chunks = Common::DoFileSearch(m_store_path, ".zst");
+  ASSERT_EQ(chunks.size(), 2u);
+  ASSERT_TRUE(File::Copy(chunks[0], chunks[1], true));
+
+  const std::unique_ptr<DiscIO::BlobReader> reader =
+      DiscIO::CreateBlobReader(GetManifestPath("game"));
+  ASSERT_NE(reader, nullptr);
+  std::vector<u8> read_data(data.size());
+  EXPECT_FALSE(reader->Read(0, read_data.size(), read_data.data()));
+}
@@ -0,0 +1,140 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Swap.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/WIABlob.h"
+
+namespace
+{
+struct WIAFormat
+{
+  bool rvz;
+  DiscIO::WIARVZCompressionType compression_type;
+  int compression_level;
+  int chunk_size;
+};
+
+// Enough groups for the read-ahead to run ahead of the reads for a while
+constexpr u64 GROUPS = 20;
+constexpr u64 READ_SIZE = 0x8000;
+
+class WIABlobTest : public testing::TestWithParam<WIAFormat>
+{
+protected:
+  WIABlobTest() : m_directory(File::CreateTempDir()) {}
+  ~WIABlobTest() override { File::DeleteDirRecursively(m_directory); }
+
+  void SetUp() override
+  {
+    // Data that compresses somewhat and is different in every group, with a GameCube disc header
+    // so that the disc is recognized as one
+    m_data.resize(GROUPS * GetParam().chunk_size + 0x1234);
+    u32 state = 1;
+    for (u8& byte : m_data)
+    {
+      state = state * 1103515245 + 12345;
+      byte = static_cast<u8>(state >> 28);
+    }
+    const u32 magic = Common::swap32(0xC2339F3D);
+    std::memcpy(m_data.data() + 0x1C, &magic, sizeof(magic));
+
+    const std::string iso_path = m_directory + "/game.iso";
+    const std::string converted_path = m_directory + "/game.wia";
+    ASSERT_TRUE(File::IOFile(iso_path, "wb").WriteBytes(m_data.data(), m_data.size()));
+
+    const std::unique_ptr<DiscIO::BlobReader> iso = DiscIO::CreateBlobReader(iso_path);
+    ASSERT_NE(iso, nullptr);
+    const WIAFormat& format = GetParam();
+    ASSERT_TRUE(DiscIO::ConvertToWIAOrRVZ(iso.get(), iso_path, converted_path, format.rvz,
+                                          format.compression_type, format.compression_level,
+                                          format.chunk_size,
+                                          [](const std::string&, float) { return true; }));
+
+    m_reader = DiscIO::CreateBlobReader(converted_path);
+    ASSERT_NE(m_reader, nullptr);
+    ASSERT_EQ(m_reader->GetBlobType(), format.rvz ? DiscIO::BlobType::RVZ : DiscIO::BlobType::WIA);
+    ASSERT_EQ(m_reader->GetDataSize(), m_data.size());
+  }
+
+  void ExpectRead(u64 offset, u64 size)
+  {
+    SCOPED_TRACE(fmt::format("offset {:#x}, size {:#x}", offset, size));
+    std::vector<u8> buffer(size);
+    ASSERT_TRUE(m_reader->Read(offset, size, buffer.data()));
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), m_data.begin() + offset));
+  }
+
+  void ExpectSequentialReads(u64 start, u64 end)
+  {
+    for (u64 offset = start; offset < end; offset += READ_SIZE)
+      ExpectRead(offset, std::min(READ_SIZE, end - offset));
+  }
+
+  std::string m_directory;
+  std::vector<u8> m_data;
+  std::unique_ptr<DiscIO::BlobReader> m_reader;
+};
+}  // namespace
+
+TEST_P(WIABlobTest, SequentialReads)
+{
+  ExpectSequentialReads(0, m_data.size());
+}
+
+TEST_P(WIABlobTest, RandomReads)
+{
+  std::mt19937 rng(1);
+  for (int i = 0; i < 200; ++i)
+  {
+    const u64 offset = std::uniform_int_distribution<u64>(0, m_data.size() - 1)(rng);
+    const u64 size =
+        std::uniform_int_distribution<u64>(1, std::min<u64>(0x30000, m_data.size() - offset))(rng);
+    ExpectRead(offset, size);
+  }
+}
+
+TEST_P(WIABlobTest, SequentialThenRandomReads)
+{
+  const u64 chunk_size = GetParam().chunk_size;
+
+  // Reading a few groups in order starts the read-ahead
+  ExpectSequentialReads(0, chunk_size * 4);
+
+  // Jumping back and then past the groups that are being read ahead throws them away
+  ExpectRead(chunk_size + 0x123, 0x4000);
+  ExpectRead(chunk_size * 15 + 0x10, READ_SIZE);
+
+  // A group that was read ahead is skipped, and the read after it isn't in order anymore
+  ExpectSequentialReads(chunk_size * 5, chunk_size * 8);
+  ExpectRead(chunk_size * 10, READ_SIZE);
+
+  std::mt19937 rng(2);
+  for (int i = 0; i < 50; ++i)
+  {
+    const u64 offset = std::uniform_int_distribution<u64>(0, m_data.size() - READ_SIZE)(rng);
+    ExpectRead(offset, READ_SIZE);
+  }
+
+  // The read-ahead starts over once the reads are in order again
+  ExpectSequentialReads(chunk_size * 2, m_data.size());
+}
+
+// WIA only allows chunk sizes which are multiples of 2 MiB, while RVZ allows smaller ones
+INSTANTIATE_TEST_SUITE_P(
+    Formats, WIABlobTest,
+    testing::Values(WIAFormat{false, DiscIO::WIARVZCompressionType::Purge, 0, 0x200000},
+                    WIAFormat{true, DiscIO::WIARVZCompressionType::Zstd, 1, 0x20000}));
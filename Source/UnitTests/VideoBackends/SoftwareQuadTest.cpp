@@ -0,0 +1,197 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/ScopeGuard.h"
+#include "VideoBackends/Software/Tev.h"
+#include "VideoBackends/Software/TextureSampler.h"
+#include "VideoCommon/BPMemory.h"
+
+namespace
+{
+constexpr size_t SPAN_SIZE = 1024;
+
+// Calls func once with the kernels the host CPU supports, and once more for every narrower
+// instruction set that has its own kernels, down to the scalar ones.
+template <typename Func>
+void ForEachKernelPath(Func func)
+{
+  const CPUInfo saved_cpu_info = cpu_info;
+  Common::ScopeGuard restore_guard([&] { cpu_info = saved_cpu_info; });
+
+  func("host");
+#ifdef _M_X86_64
+  if (cpu_info.bAVX2)
+  {
+    cpu_info.bAVX2 = false;
+    func("SSE4.1");
+  }
+  if (cpu_info.bSSE4_1)
+  {
+    cpu_info.bSSE4_1 = false;
+    func("scalar");
+  }
+#endif
+}
+
+std::vector<u32> RandomTexels(std::mt19937& rng, size_t count)
+{
+  std::uniform_int_distribution<u32> texel_dist;
+  std::vector<u32> texels(count);
+  for (u32& texel : texels)
+    texel = texel_dist(rng);
+  return texels;
+}
+}  // namespace
+
+TEST(SoftwareQuadTest, BilinearFilterSpanMatchesScalar)
+{
+  std::mt19937 rng(1);
+  std::array<std::vector<u32>, 4> texels;
+  for (std::vector<u32>& row : texels)
+    row = RandomTexels(rng, SPAN_SIZE);
+
+  // Every combination of the fractions, along with the extremes of the texels
+  std::vector<s32> fract_s(SPAN_SIZE);
+  std::vector<s32> fract_t(SPAN_SIZE);
+  for (size_t i = 0; i < SPAN_SIZE; ++i)
+  {
+    fract_s[i] = static_cast<s32>(i % 128);
+    fract_t[i] = static_cast<s32>((i / 128 * 37 + i) % 128);
+  }
+  for (std::vector<u32>& row : texels)
+    row[0] = row[5] = 0xFFFFFFFF;
+
+  std::vector<u32> expected(SPAN_SIZE);
+  for (size_t i = 0; i < SPAN_SIZE; ++i)
+  {
+    u8 pixel_texels[4][4];
+    for (int j = 0; j < 4; ++j)
+      std::memcpy(pixel_texels[j], &texels[j][i], sizeof(u32));
+    TextureSampler::BilinearFilter(pixel_texels, fract_s[i], fract_t[i],
+                                   reinterpret_cast<u8*>(&expected[i]));
+  }
+
+  ForEachKernelPath([&](const char* path) {
+    SCOPED_TRACE(path);
+    std::vector<u32> samples(SPAN_SIZE);
+    TextureSampler::BilinearFilterSpan(
+        {texels[0].data(), texels[1].data(), texels[2].data(), texels[3].data()}, fract_s.data(),
+        fract_t.data(), samples.data(), SPAN_SIZE);
+    EXPECT_EQ(samples, expected);
+
+    // A single quad, like the sampler uses it
+    std::vector<u32> quad(TextureSampler::QUAD_SIZE);
+    TextureSampler::BilinearFilterSpan(
+        {texels[0].data() + 8, texels[1].data() + 8, texels[2].data() + 8, texels[3].data() + 8},
+        fract_s.data() + 8, fract_t.data() + 8, quad.data(), quad.size());
+    EXPECT_TRUE(std::equal(quad.begin(), quad.end(), expected.begin() + 8));
+  });
+}
+
+TEST(SoftwareQuadTest, LerpMipsSpanMatchesScalar)
+{
+  std::mt19937 rng(2);
+  std::vector<u32> base_mip = RandomTexels(rng, SPAN_SIZE);
+  std::vector<u32> next_mip = RandomTexels(rng, SPAN_SIZE);
+  base_mip[0] = next_mip[0] = 0xFFFFFFFF;
+
+  for (s32 lod_fract = 0; lod_fract < 16; ++lod_fract)
+  {
+    SCOPED_TRACE(lod_fract);
+
+    std::vector<u32> expected(SPAN_SIZE);
+    for (size_t i = 0; i < SPAN_SIZE; ++i)
+    {
+      TextureSampler::LerpMips(reinterpret_cast<const u8*>(&base_mip[i]),
+                               reinterpret_cast<const u8*>(&next_mip[i]), lod_fract,
+                               reinterpret_cast<u8*>(&expected[i]));
+    }
+
+    ForEachKernelPath([&](const char* path) {
+      SCOPED_TRACE(path);
+      std::vector<u32> samples(SPAN_SIZE);
+      TextureSampler::LerpMipsSpan(base_mip.data(), next_mip.data(), lod_fract, samples.data(),
+                                   SPAN_SIZE);
+      EXPECT_EQ(samples, expected);
+
+      std::vector<u32> quad(TextureSampler::QUAD_SIZE);
+      TextureSampler::LerpMipsSpan(base_mip.data() + 4, next_mip.data() + 4, lod_fract,
+                                   quad.data(), quad.size());
+      EXPECT_TRUE(std::equal(quad.begin(), quad.end(), expected.begin() + 4));
+    });
+  }
+}
+
+TEST(SoftwareQuadTest, CombineRegularMatchesScalar)
+{
+  // Every setting of the regular combiners: bias (without compare), op, clamp and scale
+  std::vector<u32> settings;
+  for (u32 bias = 0; bias < 3; ++bias)
+  {
+    for (u32 rest = 0; rest < 0x10; ++rest)
+      settings.push_back(bias << 16 | rest << 18);
+  }
+
+  // The inputs are full register values, which the combiners have to truncate. Some pixels get the
+  // extremes of the inputs after truncation.
+  std::mt19937 rng(3);
+  std::uniform_int_distribution<int> reg_dist(-1024, 1023);
+  std::vector<Tev::QuadInputs> inputs(64);
+  for (Tev::QuadInputs& quad : inputs)
+  {
+    for (auto* values : {&quad.a, &quad.b, &quad.c, &quad.d})
+    {
+      for (s16& value : *values)
+        value = static_cast<s16>(reg_dist(rng));
+    }
+  }
+  inputs[0].a.fill(0xFF);
+  inputs[0].b.fill(0xFF);
+  inputs[0].c.fill(0xFF);
+  inputs[0].d.fill(0x3FF);
+  inputs[1].a.fill(0);
+  inputs[1].b.fill(0xFF);
+  inputs[1].c.fill(0x80);
+  inputs[1].d.fill(-0x400);
+
+  const auto combine_all = [&](std::vector<Tev::QuadOutputs>* outputs) {
+    for (size_t i = 0; i < settings.size(); ++i)
+    {
+      TevStageCombiner::ColorCombiner cc;
+      TevStageCombiner::AlphaCombiner ac;
+      cc.hex = settings[i];
+      // Pair each color setting with several alpha settings
+      for (size_t j = 0; j < settings.size(); j += 5)
+      {
+        ac.hex = settings[(i + j) % settings.size()];
+        for (const Tev::QuadInputs& quad : inputs)
+        {
+          Tev::QuadOutputs& quad_outputs = outputs->emplace_back();
+          Tev::CombineRegular(cc, ac, quad, quad_outputs);
+        }
+      }
+    }
+  };
+
+  std::vector<std::vector<Tev::QuadOutputs>> results;
+  ForEachKernelPath([&](const char*) { combine_all(&results.emplace_back()); });
+
+  // The scalar kernels are the last ones to run
+  for (size_t path = 0; path + 1 < results.size(); ++path)
+  {
+    SCOPED_TRACE(path);
+    ASSERT_EQ(results[path].size(), results.back().size());
+    for (size_t i = 0; i < results[path].size(); ++i)
+      ASSERT_EQ(results[path][i], results.back()[i]) << "combination " << i;
+  }
+}
@@ -0,0 +1,139 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/FileUtil.h"
+#include "VideoCommon/Assets/AssetRequestHistory.h"
+
+using VideoCommon::AssetRequestHistory;
+using AssetIDs = std::vector<VideoCommon::CustomAssetLibrary::AssetID>;
+
+namespace
+{
+class AssetRequestHistoryTest : public testing::Test
+{
+protected:
+  AssetRequestHistoryTest()
+      : m_directory(File::CreateTempDir()), m_path(m_directory + "/history.txt")
+  {
+  }
+  ~AssetRequestHistoryTest() override { File::DeleteDirRecursively(m_directory); }
+
+  // Each asset is only recorded once per session, so the saved history is loaded again to see
+  // which assets followed one.
+  AssetIDs LoadSuccessors(const std::string& asset_id) const
+  {
+    AssetRequestHistory history;
+    EXPECT_TRUE(history.Load(m_path));
+    return history.RecordRequest(asset_id);
+  }
+
+  void RecordSession(const AssetIDs& asset_ids) const
+  {
+    AssetRequestHistory history;
+    history.Load(m_path);
+    for (const auto& asset_id : asset_ids)
+      history.RecordRequest(asset_id);
+    EXPECT_TRUE(history.Save(m_path));
+  }
+
+  std::string m_directory;
+  std::string m_path;
+};
+}  // namespace
+
+TEST_F(AssetRequestHistoryTest, RecordsFollowingAssets)
+{
+  AssetRequestHistory history;
+  EXPECT_TRUE(history.RecordRequest("a").empty());
+  EXPECT_TRUE(history.RecordRequest("b").empty());
+  EXPECT_TRUE(history.RecordRequest("c").empty());
+  EXPECT_TRUE(history.IsDirty());
+  ASSERT_TRUE(history.Save(m_path));
+
+  // The most recent followers come first
+  EXPECT_EQ(LoadSuccessors("a"), (AssetIDs{"c", "b"}));
+  EXPECT_EQ(LoadSuccessors("b"), (AssetIDs{"c"}));
+  EXPECT_TRUE(LoadSuccessors("c").empty());
+
+  // A follower which shows up again moves to the front
+  RecordSession({"a", "b"});
+  EXPECT_EQ(LoadSuccessors("a"), (AssetIDs{"b", "c"}));
+}
+
+TEST_F(AssetRequestHistoryTest, OnlyRecordsAssetsWithinWindow)
+{
+  AssetIDs session;
+  for (size_t i = 0; i <= AssetRequestHistory::WINDOW_SIZE + 1; ++i)
+    session.push_back(fmt::format("{}", i));
+  RecordSession(session);
+
+  // Asset 0 dropped out of the window before the last asset was requested
+  AssetIDs expected;
+  for (size_t i = AssetRequestHistory::WINDOW_SIZE; i > 0; --i)
+    expected.push_back(fmt::format("{}", i));
+  EXPECT_EQ(LoadSuccessors("0"), expected);
+}
+
+TEST_F(AssetRequestHistoryTest, KeepsMostRecentSuccessors)
+{
+  size_t next_id = 0;
+  for (int round = 0; round < 3; ++round)
+  {
+    AssetIDs session{"first"};
+    for (size_t i = 0; i < AssetRequestHistory::WINDOW_SIZE; ++i)
+      session.push_back(fmt::format("{}", next_id++));
+    RecordSession(session);
+  }
+
+  const AssetIDs successors = LoadSuccessors("first");
+  ASSERT_EQ(successors.size(), AssetRequestHistory::MAX_SUCCESSORS);
+  EXPECT_EQ(successors.front(), fmt::format("{}", next_id - 1));
+  EXPECT_EQ(successors.back(), fmt::format("{}", next_id - AssetRequestHistory::MAX_SUCCESSORS));
+}
+
+TEST_F(AssetRequestHistoryTest, SaveLoadRoundTrip)
+{
+  AssetRequestHistory history;
+  for (const char* id : {"a", "b", "c", "d"})
+    history.RecordRequest(id);
+  ASSERT_TRUE(history.Save(m_path));
+
+  AssetRequestHistory loaded;
+  ASSERT_TRUE(loaded.Load(m_path));
+  EXPECT_FALSE(loaded.IsDirty());
+  EXPECT_EQ(loaded.RecordRequest("a"), (AssetIDs{"d", "c", "b"}));
+  EXPECT_EQ(loaded.RecordRequest("c"), (AssetIDs{"d"}));
+  EXPECT_TRUE(loaded.RecordRequest("d").empty());
+}
+
+TEST_F(AssetRequestHistoryTest, LoadSkipsInvalidLines)
+{
+  std::string contents = "lonely\n\na\t\tb\n";
+  contents += "many";
+  for (size_t i = 0; i < AssetRequestHistory::MAX_SUCCESSORS + 4; ++i)
+    contents += fmt::format("\t{}", i);
+  contents += '\n';
+  ASSERT_TRUE(File::WriteStringToFile(m_path, contents));
+
+  AssetRequestHistory history;
+  ASSERT_TRUE(history.Load(m_path));
+  EXPECT_TRUE(history.RecordRequest("lonely").empty());
+  EXPECT_EQ(history.RecordRequest("a"), (AssetIDs{"b"}));
+  EXPECT_EQ(history.RecordRequest("many").size(), AssetRequestHistory::MAX_SUCCESSORS);
+}
+
+TEST_F(AssetRequestHistoryTest, LoadFailsWithoutFile)
+{
+  AssetRequestHistory history;
+  history.RecordRequest("a");
+  history.RecordRequest("b");
+  EXPECT_FALSE(history.Load(m_path));
+  EXPECT_FALSE(history.IsDirty());
+  EXPECT_TRUE(history.RecordRequest("a").empty());
+}
@@ -0,0 +1,197 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/AsyncTextureDecoder.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+constexpr TextureFormat FORMAT = TextureFormat::C8;
+constexpr TLUTFormat TLUT_FORMAT = TLUTFormat::RGB5A3;
+constexpr u32 WIDTH = 256;
+constexpr u32 HEIGHT = 128;
+constexpr u32 NUM_LEVELS = 4;
+constexpr size_t TLUT_SIZE = 0x100 * sizeof(u16);
+
+std::vector<u8> RandomBytes(std::mt19937& rng, size_t size)
+{
+  std::uniform_int_distribution<int> byte_dist(0, 0xFF);
+  std::vector<u8> bytes(size);
+  for (u8& byte : bytes)
+    byte = static_cast<u8>(byte_dist(rng));
+  return bytes;
+}
+
+// The encoded levels of one texture, along with the reference decode of each of them
+struct Texture
+{
+  explicit Texture(u32 seed)
+  {
+    std::mt19937 rng(seed);
+    tlut = RandomBytes(rng, TLUT_SIZE);
+    for (u32 i = 0; i < NUM_LEVELS; ++i)
+    {
+      AsyncTextureDecoder::Level level;
+      level.level = i;
+      level.width = level.expanded_width = WIDTH >> i;
+      level.height = level.expanded_height = HEIGHT >> i;
+      level.encoded = RandomBytes(
+          rng, TexDecoder_GetTextureSizeInBytes(level.width, level.height, FORMAT));
+
+      std::vector<u8> decoded(level.width * level.height * sizeof(u32));
+      TexDecoder_Decode(decoded.data(), level.encoded.data(), level.width, level.height, FORMAT,
+                        tlut.data(), TLUT_FORMAT);
+
+      levels.push_back(std::move(level));
+      expected.push_back(std::move(decoded));
+    }
+  }
+
+  std::shared_ptr<AsyncTextureDecoder::Job> Submit(AsyncTextureDecoder& decoder,
+                                                   size_t num_async_levels) const
+  {
+    return decoder.Submit(FORMAT, TLUT_FORMAT, tlut, levels, num_async_levels);
+  }
+
+  std::vector<u8> tlut;
+  std::vector<AsyncTextureDecoder::Level> levels;
+  std::vector<std::vector<u8>> expected;
+};
+
+void ExpectLevelsDecoded(const AsyncTextureDecoder::Job& job, const Texture& texture)
+{
+  const std::vector<AsyncTextureDecoder::Level>& levels = job.GetLevels();
+  ASSERT_EQ(levels.size(), texture.expected.size());
+  for (size_t i = 0; i < levels.size(); ++i)
+  {
+    EXPECT_TRUE(levels[i].encoded.empty()) << "level " << i;
+    EXPECT_EQ(levels[i].decoded, texture.expected[i]) << "level " << i;
+  }
+}
+
+// Saves the decoded levels of the given jobs the way the texture cache saves them: waiting for the
+// jobs first, which it does with FinishAllAsyncDecodes(true) before saving the textures from VRAM.
+std::vector<u8> SaveState(const std::vector<std::shared_ptr<AsyncTextureDecoder::Job>>& jobs)
+{
+  const auto do_state = [&](PointerWrap& p) {
+    for (const auto& job : jobs)
+    {
+      job->Wait();
+      for (const AsyncTextureDecoder::Level& level : job->GetLevels())
+      {
+        std::vector<u8> decoded = level.decoded;
+        p.Do(decoded);
+      }
+    }
+  };
+
+  u8* ptr = nullptr;
+  PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  do_state(p_measure);
+
+  std::vector<u8> state(reinterpret_cast<size_t>(ptr));
+  ptr = state.data();
+  PointerWrap p(&ptr, state.size(), PointerWrap::Mode::Write);
+  do_state(p);
+  EXPECT_EQ(ptr, state.data() + state.size());
+  return state;
+}
+}  // namespace
+
+class AsyncTextureDecoderTest : public testing::Test
+{
+protected:
+  AsyncTextureDecoderTest()
+  {
+    for (u32 i = 0; i < 8; ++i)
+      m_textures.emplace_back(i);
+  }
+
+  ~AsyncTextureDecoderTest() override { m_decoder.SetEnabled(false); }
+
+  AsyncTextureDecoder m_decoder;
+  std::vector<Texture> m_textures;
+};
+
+TEST_F(AsyncTextureDecoderTest, LowerLevelsAreDecodedRightAway)
+{
+  m_decoder.SetEnabled(true);
+
+  // Without a placeholder, the texture cache only decodes the first level asynchronously and
+  // draws with the lower levels meanwhile
+  const auto job = m_textures[0].Submit(m_decoder, 1);
+  EXPECT_TRUE(job->HasDecodedLowerLevels());
+  for (size_t i = 1; i < NUM_LEVELS; ++i)
+    EXPECT_EQ(job->GetLevels()[i].decoded, m_textures[0].expected[i]) << "level " << i;
+
+  job->Wait();
+  ExpectLevelsDecoded(*job, m_textures[0]);
+}
+
+TEST_F(AsyncTextureDecoderTest, AllLevelsAsyncWithPlaceholder)
+{
+  m_decoder.SetEnabled(true);
+
+  // With a placeholder to draw with, none of the levels are needed before the job is done
+  const auto job = m_textures[0].Submit(m_decoder, NUM_LEVELS);
+  EXPECT_FALSE(job->HasDecodedLowerLevels());
+  EXPECT_EQ(job->GetNumAsyncLevels(), NUM_LEVELS);
+
+  job->Wait();
+  EXPECT_TRUE(job->IsDone());
+  ExpectLevelsDecoded(*job, m_textures[0]);
+}
+
+TEST_F(AsyncTextureDecoderTest, WaitFinishesJobQueuedBehindOthers)
+{
+  m_decoder.SetEnabled(true);
+
+  // EFB copies are drawn over a texture only after waiting for it, which must not return before
+  // all of its levels are decoded, however many other levels are queued before them
+  std::vector<std::shared_ptr<AsyncTextureDecoder::Job>> jobs;
+  for (const Texture& texture : m_textures)
+    jobs.push_back(texture.Submit(m_decoder, NUM_LEVELS));
+
+  jobs.back()->Wait();
+  EXPECT_TRUE(jobs.back()->IsDone());
+  ExpectLevelsDecoded(*jobs.back(), m_textures.back());
+
+  m_decoder.WaitForCompletion();
+  for (size_t i = 0; i < jobs.size(); ++i)
+  {
+    SCOPED_TRACE(i);
+    EXPECT_TRUE(jobs[i]->IsDone());
+    ExpectLevelsDecoded(*jobs[i], m_textures[i]);
+  }
+}
+
+TEST_F(AsyncTextureDecoderTest, PendingDecodesAreSavedDeterministically)
+{
+  // The reference state is decoded synchronously
+  std::vector<std::shared_ptr<AsyncTextureDecoder::Job>> sync_jobs;
+  for (const Texture& texture : m_textures)
+    sync_jobs.push_back(texture.Submit(m_decoder, NUM_LEVELS));
+  const std::vector<u8> expected_state = SaveState(sync_jobs);
+
+  // Saving while the decodes are still pending must give the same state, whichever order the
+  // workers happen to finish the levels in
+  m_decoder.SetEnabled(true);
+  for (int attempt = 0; attempt < 4; ++attempt)
+  {
+    SCOPED_TRACE(attempt);
+
+    std::vector<std::shared_ptr<AsyncTextureDecoder::Job>> jobs;
+    for (size_t i = 0; i < m_textures.size(); ++i)
+      jobs.push_back(m_textures[i].Submit(m_decoder, i % 2 == 0 ? NUM_LEVELS : 1));
+
+    EXPECT_EQ(SaveState(jobs), expected_state);
+  }
+}
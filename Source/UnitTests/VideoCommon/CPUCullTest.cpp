@@ -0,0 +1,105 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Core/System.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/CPUCull.h"
+#include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/XFMemory.h"
+
+namespace
+{
+// Enough vertices for the loops over 4 and 2 vertices as well as the single vertex at the end
+constexpr u32 VERTEX_COUNT = 103;
+// A position matrix index followed by up to 3 floats
+constexpr u32 STRIDE = sizeof(u32) + 3 * sizeof(float);
+
+void SetUpMatrices(std::mt19937& rng)
+{
+  std::uniform_real_distribution<float> dist(-2.0f, 2.0f);
+  auto& projection = Core::System::GetInstance().GetVertexShaderManager().constants.projection;
+  for (auto& row : projection)
+  {
+    for (float& value : row)
+      value = dist(rng);
+  }
+  for (float& value : xfmem.posMatrices)
+    value = dist(rng);
+  g_main_cp_state.matrix_index_a.PosNormalMtxIdx = 6;
+}
+
+std::vector<u8> MakeVertices(std::mt19937& rng)
+{
+  std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+  // Positions are loaded with a fourth float, which may be past the last vertex
+  std::vector<u8> vertices(VERTEX_COUNT * STRIDE + sizeof(float));
+  for (u32 i = 0; i < VERTEX_COUNT; ++i)
+  {
+    const u32 pos_mtx = (i * 3) % 64;
+    std::memcpy(&vertices[i * STRIDE], &pos_mtx, sizeof(pos_mtx));
+    for (u32 j = 0; j < 3; ++j)
+    {
+      const float value = dist(rng);
+      std::memcpy(&vertices[i * STRIDE + sizeof(u32) + j * sizeof(float)], &value, sizeof(value));
+    }
+  }
+  return vertices;
+}
+}  // namespace
+
+TEST(CPUCull, AVX512MatchesAVX)
+{
+  if (!cpu_info.bAVX512F || !cpu_info.bFMA)
+    GTEST_SKIP() << "The CPU doesn't support AVX-512";
+
+  std::mt19937 rng(1);
+  SetUpMatrices(rng);
+  const std::vector<u8> vertices = MakeVertices(rng);
+
+  for (bool position_has_3_elems : {false, true})
+  {
+    for (bool per_vertex_pos_mtx : {false, true})
+    {
+      SCOPED_TRACE(fmt::format("3 elements: {}, per vertex matrix: {}", position_has_3_elems,
+                               per_vertex_pos_mtx));
+
+      // The position follows the matrix index only if there is one
+      const u8* const src = vertices.data() + (per_vertex_pos_mtx ? 0 : sizeof(u32));
+      alignas(64) std::array<CPUCull::TransformedVertex, VERTEX_COUNT + 1> expected{};
+      alignas(64) std::array<CPUCull::TransformedVertex, VERTEX_COUNT + 1> actual{};
+      CPUCull::GetTransformFunction(position_has_3_elems, per_vertex_pos_mtx, false)(
+          expected.data(), src, STRIDE, VERTEX_COUNT);
+      CPUCull::GetTransformFunction(position_has_3_elems, per_vertex_pos_mtx, true)(
+          actual.data(), src, STRIDE, VERTEX_COUNT);
+
+      // The paths may round differently where they use FMA in other places, which doesn't matter
+      // for culling.
+      for (u32 i = 0; i < VERTEX_COUNT; ++i)
+      {
+        const auto& e = expected[i];
+        const auto& a = actual[i];
+        const float tolerance =
+            1e-5f * (std::abs(e.x) + std::abs(e.y) + std::abs(e.z) + std::abs(e.w)) + 1e-3f;
+        EXPECT_NEAR(a.x, e.x, tolerance) << "vertex " << i;
+        EXPECT_NEAR(a.y, e.y, tolerance) << "vertex " << i;
+        EXPECT_NEAR(a.z, e.z, tolerance) << "vertex " << i;
+        EXPECT_NEAR(a.w, e.w, tolerance) << "vertex " << i;
+      }
+      // Nothing may be written past the last vertex
+      EXPECT_EQ(std::memcmp(&actual[VERTEX_COUNT], &expected[VERTEX_COUNT],
+                            sizeof(CPUCull::TransformedVertex)),
+                0);
+    }
+  }
+}
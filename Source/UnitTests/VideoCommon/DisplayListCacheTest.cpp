@@ -0,0 +1,128 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/DisplayListCache.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+
+namespace
+{
+constexpr u32 ADDRESS = 0x80001000;
+constexpr u32 SRC_OFFSET = 3;
+constexpr u32 COUNT = 4;
+
+class DisplayListCacheTest : public testing::Test
+{
+protected:
+  DisplayListCacheTest()
+  {
+    TVtxDesc vtx_desc;
+    VAT vat;
+    vtx_desc.low.Position = VertexComponentFormat::Direct;
+    vat.g0.PosElements = CoordComponentCount::XYZ;
+    vat.g0.PosFormat = ComponentFormat::Float;
+    m_loader = VertexLoaderBase::CreateVertexLoader(vtx_desc, vat);
+
+    vat.g0.PosFormat = ComponentFormat::Short;
+    m_other_loader = VertexLoaderBase::CreateVertexLoader(vtx_desc, vat);
+
+    m_display_list.resize(0x40);
+    for (size_t i = 0; i < m_display_list.size(); ++i)
+      m_display_list[i] = static_cast<u8>(i);
+
+    m_vertices.resize(COUNT * m_loader->m_native_vtx_decl.stride);
+    for (size_t i = 0; i < m_vertices.size(); ++i)
+      m_vertices[i] = static_cast<u8>(i * 7);
+  }
+
+  ~DisplayListCacheTest() override { m_cache.Clear(); }
+
+  DisplayListCache::Entry* Lookup()
+  {
+    return m_cache.Lookup(ADDRESS, static_cast<u32>(m_display_list.size()),
+                          m_display_list.data());
+  }
+
+  // Runs the display list for the first time, storing the converted vertices of its primitive
+  void StoreVertices()
+  {
+    VertexLoaderManager::position_cache = {{{1, 2, 3, 0}, {4, 5, 6, 0}, {7, 8, 9, 0}}};
+    Lookup()->GetNextPrimitive().Store(m_loader.get(), SRC_OFFSET, COUNT, COUNT,
+                                       m_vertices.data(), m_vertices.size());
+    VertexLoaderManager::position_cache = {};
+  }
+
+  DisplayListCache m_cache;
+  std::unique_ptr<VertexLoaderBase> m_loader;
+  std::unique_ptr<VertexLoaderBase> m_other_loader;
+  std::vector<u8> m_display_list;
+  std::vector<u8> m_vertices;
+};
+}  // namespace
+
+TEST_F(DisplayListCacheTest, HitRestoresVerticesAndLoaderState)
+{
+  StoreVertices();
+
+  DisplayListCache::CachedPrimitive& primitive = Lookup()->GetNextPrimitive();
+  ASSERT_TRUE(primitive.IsValidFor(m_loader.get(), SRC_OFFSET, COUNT));
+
+  const int loaded_vertices = m_loader->m_numLoadedVertices;
+  std::vector<u8> dst(m_vertices.size());
+  EXPECT_EQ(primitive.Load(dst.data()), static_cast<int>(COUNT));
+  EXPECT_EQ(dst, m_vertices);
+  EXPECT_EQ(m_loader->m_numLoadedVertices, loaded_vertices + static_cast<int>(COUNT));
+  EXPECT_EQ(VertexLoaderManager::position_cache[0], (std::array<float, 4>{1, 2, 3, 0}));
+  EXPECT_EQ(VertexLoaderManager::position_cache[2], (std::array<float, 4>{7, 8, 9, 0}));
+}
+
+TEST_F(DisplayListCacheTest, MissAfterDataChanges)
+{
+  StoreVertices();
+
+  m_display_list[0x20] ^= 0xFF;
+  EXPECT_FALSE(Lookup()->GetNextPrimitive().IsValidFor(m_loader.get(), SRC_OFFSET, COUNT));
+}
+
+TEST_F(DisplayListCacheTest, MissAfterLoaderChanges)
+{
+  StoreVertices();
+
+  DisplayListCache::CachedPrimitive& primitive = Lookup()->GetNextPrimitive();
+  EXPECT_FALSE(primitive.IsValidFor(m_other_loader.get(), SRC_OFFSET, COUNT));
+  EXPECT_FALSE(primitive.IsValidFor(m_loader.get(), SRC_OFFSET + 1, COUNT));
+  EXPECT_FALSE(primitive.IsValidFor(m_loader.get(), SRC_OFFSET, COUNT - 1));
+  EXPECT_TRUE(primitive.IsValidFor(m_loader.get(), SRC_OFFSET, COUNT));
+}
+
+TEST_F(DisplayListCacheTest, ClearedWithVertexLoaders)
+{
+  // The cached primitives point to the loaders which converted them, so they must not outlive
+  // the loaders, which VertexLoaderManager::Clear destroys
+  const auto store = [this] {
+    g_display_list_cache.Lookup(ADDRESS, static_cast<u32>(m_display_list.size()),
+                                m_display_list.data())
+        ->GetNextPrimitive()
+        .Store(m_loader.get(), SRC_OFFSET, COUNT, COUNT, m_vertices.data(), m_vertices.size());
+  };
+  const auto is_cached = [this] {
+    return g_display_list_cache
+        .Lookup(ADDRESS, static_cast<u32>(m_display_list.size()), m_display_list.data())
+        ->GetNextPrimitive()
+        .IsValidFor(m_loader.get(), SRC_OFFSET, COUNT);
+  };
+
+  store();
+  ASSERT_TRUE(is_cached());
+
+  VertexLoaderManager::Clear();
+  EXPECT_FALSE(is_cached());
+}
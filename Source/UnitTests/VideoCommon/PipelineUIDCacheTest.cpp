@@ -0,0 +1,91 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/GXPipelineTypes.h"
+#include "VideoCommon/PipelineUIDCache.h"
+
+using VideoCommon::SerializedGXPipelineUid;
+namespace PipelineUIDCache = VideoCommon::PipelineUIDCache;
+
+namespace
+{
+SerializedGXPipelineUid MakeUID(u32 blending_state_bits)
+{
+  SerializedGXPipelineUid uid;
+  uid.blending_state_bits = blending_state_bits;
+  return uid;
+}
+
+bool IsSame(const SerializedGXPipelineUid& a, const SerializedGXPipelineUid& b)
+{
+  return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+class PipelineUIDCacheTest : public testing::Test
+{
+protected:
+  PipelineUIDCacheTest()
+      : m_directory(File::CreateTempDir()), m_path(m_directory + "/game.uidcache")
+  {
+  }
+  ~PipelineUIDCacheTest() override { File::DeleteDirRecursively(m_directory); }
+
+  std::string m_directory;
+  std::string m_path;
+};
+}  // namespace
+
+TEST_F(PipelineUIDCacheTest, RoundTrip)
+{
+  const std::vector<SerializedGXPipelineUid> uids = {MakeUID(3), MakeUID(1), MakeUID(2)};
+  ASSERT_TRUE(PipelineUIDCache::WriteUIDs(m_path, uids));
+
+  const auto read_uids = PipelineUIDCache::ReadUIDs(m_path);
+  ASSERT_TRUE(read_uids.has_value());
+  ASSERT_EQ(read_uids->size(), uids.size());
+  for (size_t i = 0; i < uids.size(); ++i)
+    EXPECT_TRUE(IsSame((*read_uids)[i], uids[i]));
+}
+
+TEST_F(PipelineUIDCacheTest, RejectsOtherVersionsAndTruncatedFiles)
+{
+  ASSERT_TRUE(PipelineUIDCache::WriteUIDs(m_path, std::vector{MakeUID(1), MakeUID(2)}));
+  {
+    File::IOFile file(m_path, "r+b");
+    ASSERT_TRUE(file.Resize(file.GetSize() - 1));
+  }
+  EXPECT_FALSE(PipelineUIDCache::ReadUIDs(m_path).has_value());
+
+  {
+    File::IOFile file(m_path, "wb");
+    const u32 header[] = {PipelineUIDCache::MAGIC, VideoCommon::GX_PIPELINE_UID_VERSION + 1};
+    ASSERT_TRUE(file.WriteArray(header, std::size(header)));
+  }
+  EXPECT_FALSE(PipelineUIDCache::ReadUIDs(m_path).has_value());
+
+  EXPECT_FALSE(PipelineUIDCache::ReadUIDs(m_directory + "/missing.uidcache").has_value());
+}
+
+TEST(PipelineUIDCache, CanonicalizeSortsAndRemovesDuplicates)
+{
+  std::vector<SerializedGXPipelineUid> a = {MakeUID(2), MakeUID(1), MakeUID(2), MakeUID(3)};
+  std::vector<SerializedGXPipelineUid> b = {MakeUID(3), MakeUID(3), MakeUID(1), MakeUID(2)};
+  PipelineUIDCache::Canonicalize(&a);
+  PipelineUIDCache::Canonicalize(&b);
+
+  ASSERT_EQ(a.size(), 3u);
+  ASSERT_EQ(b.size(), 3u);
+  for (size_t i = 0; i < a.size(); ++i)
+    EXPECT_TRUE(IsSame(a[i], b[i]));
+  EXPECT_FALSE(IsSame(a[0], a[1]));
+  EXPECT_FALSE(IsSame(a[1], a[2]));
+}
@@ -0,0 +1,119 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/ScopeGuard.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+// Calls func once with the decoders the host CPU supports, and once more for every narrower
+// instruction set that has its own decoders, so that each of them is compared to the reference.
+template <typename Func>
+void ForEachDecoderPath(Func func)
+{
+  const CPUInfo saved_cpu_info = cpu_info;
+  Common::ScopeGuard restore_guard([&] { cpu_info = saved_cpu_info; });
+
+  func("host");
+#ifdef _M_X86_64
+  if (cpu_info.bAVX2)
+  {
+    cpu_info.bAVX2 = false;
+    func("SSSE3");
+  }
+  if (cpu_info.bSSSE3)
+  {
+    cpu_info.bSSSE3 = false;
+    func("SSE2");
+  }
+#endif
+}
+
+std::vector<std::tuple<TextureFormat, TLUTFormat>> GetAllFormats()
+{
+  std::vector<std::tuple<TextureFormat, TLUTFormat>> formats;
+  for (TextureFormat format :
+       {TextureFormat::I4, TextureFormat::I8, TextureFormat::IA4, TextureFormat::IA8,
+        TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::CMPR})
+  {
+    formats.emplace_back(format, TLUTFormat::IA8);
+  }
+  for (TextureFormat format : {TextureFormat::C4, TextureFormat::C8, TextureFormat::C14X2})
+  {
+    for (TLUTFormat tlut_format : {TLUTFormat::IA8, TLUTFormat::RGB565, TLUTFormat::RGB5A3})
+      formats.emplace_back(format, tlut_format);
+  }
+  return formats;
+}
+}  // namespace
+
+class TextureDecoderTest : public testing::TestWithParam<std::tuple<TextureFormat, TLUTFormat>>
+{
+};
+INSTANTIATE_TEST_SUITE_P(AllFormats, TextureDecoderTest, testing::ValuesIn(GetAllFormats()));
+
+// The block decoders are compared against the texel decoder, which is what the software renderer
+// uses and is simple enough to serve as the reference.
+TEST_P(TextureDecoderTest, MatchesTexelDecoder)
+{
+  const auto [format, tlut_format] = GetParam();
+  const int block_width = TexDecoder_GetBlockWidthInTexels(format);
+  const int block_height = TexDecoder_GetBlockHeightInTexels(format);
+
+  std::mt19937 rng(static_cast<u32>(format) * 3 + static_cast<u32>(tlut_format));
+  std::uniform_int_distribution<int> byte_dist(0, 0xFF);
+  const auto random_bytes = [&](size_t size) {
+    std::vector<u8> bytes(size);
+    for (u8& byte : bytes)
+      byte = static_cast<u8>(byte_dist(rng));
+    return bytes;
+  };
+
+  // Exactly as large as the palette of the format, so that reading past it is caught by
+  // sanitizers
+  const std::vector<u8> tlut = random_bytes(TexDecoder_GetPaletteSize(format));
+
+  // Odd numbers of blocks cover the decoders which handle several blocks at once.
+  for (int blocks_wide : {1, 2, 3, 5, 16})
+  {
+    for (int blocks_high : {1, 2, 3})
+    {
+      const int width = blocks_wide * block_width;
+      const int height = blocks_high * block_height;
+      const std::vector<u8> src =
+          random_bytes(TexDecoder_GetTextureSizeInBytes(width, height, format));
+
+      std::vector<u32> expected(width * height);
+      for (int t = 0; t < height; ++t)
+      {
+        for (int s = 0; s < width; ++s)
+        {
+          TexDecoder_DecodeTexel(reinterpret_cast<u8*>(&expected[t * width + s]), src, s, t,
+                                 width - 1, format, tlut, tlut_format);
+        }
+      }
+
+      ForEachDecoderPath([&](const char* path) {
+        SCOPED_TRACE(fmt::format("{} decoders, {}x{}", path, width, height));
+
+        std::vector<u32> decoded(width * height);
+        TexDecoder_Decode(reinterpret_cast<u8*>(decoded.data()), src.data(), width, height,
+                          format, tlut.data(), tlut_format);
+
+        for (int i = 0; i < width * height; ++i)
+        {
+          ASSERT_EQ(decoded[i], expected[i]) << fmt::format("at ({}, {})", i % width, i / width);
+        }
+      });
+    }
+  }
+}
@@ -0,0 +1,143 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <string>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/Assets/TexturePack.h"
+
+namespace
+{
+VideoCommon::CustomTextureData MakeTexture(u32 width, u32 height, u8 seed)
+{
+  VideoCommon::CustomTextureData data;
+  auto& slice = data.m_slices.emplace_back();
+  for (u32 level_width = width, level_height = height; level_width != 0 && level_height != 0;
+       level_width /= 2, level_height /= 2)
+  {
+    auto& level = slice.m_levels.emplace_back();
+    level.format = AbstractTextureFormat::RGBA8;
+    level.width = level_width;
+    level.height = level_height;
+    level.row_length = level_width;
+    level.data.reset(level_width * level_height * 4);
+    // Runs of equal bytes, so that the levels compress.
+    for (size_t i = 0; i < level.data.size(); ++i)
+      level.data[i] = static_cast<u8>(seed + i / 64);
+  }
+  return data;
+}
+
+void ExpectSameLevels(const VideoCommon::CustomTextureData& expected,
+                      const VideoCommon::CustomTextureData& actual)
+{
+  ASSERT_EQ(actual.m_slices.size(), 1u);
+  const auto& expected_levels = expected.m_slices[0].m_levels;
+  const auto& actual_levels = actual.m_slices[0].m_levels;
+  ASSERT_EQ(actual_levels.size(), expected_levels.size());
+  for (size_t i = 0; i < expected_levels.size(); ++i)
+  {
+    EXPECT_EQ(actual_levels[i].format, expected_levels[i].format);
+    EXPECT_EQ(actual_levels[i].width, expected_levels[i].width);
+    EXPECT_EQ(actual_levels[i].height, expected_levels[i].height);
+    EXPECT_EQ(actual_levels[i].row_length, expected_levels[i].row_length);
+    ASSERT_EQ(actual_levels[i].data.size(), expected_levels[i].data.size());
+    EXPECT_TRUE(std::equal(actual_levels[i].data.begin(), actual_levels[i].data.end(),
+                           expected_levels[i].data.begin()));
+  }
+}
+
+class TexturePackTest : public testing::TestWithParam<int>
+{
+protected:
+  TexturePackTest() : m_directory(File::CreateTempDir()), m_path(m_directory + "/pack.dtp") {}
+  ~TexturePackTest() override { File::DeleteDirRecursively(m_directory); }
+
+  std::string m_directory;
+  std::string m_path;
+};
+}  // namespace
+
+TEST_P(TexturePackTest, RoundTrip)
+{
+  constexpr int NUM_TEXTURES = 20;
+
+  VideoCommon::TexturePackWriter writer;
+  ASSERT_TRUE(writer.Open(m_path, GetParam()));
+  for (int i = 0; i < NUM_TEXTURES; ++i)
+  {
+    const auto texture = MakeTexture(64 >> (i % 3), 32, static_cast<u8>(i));
+    ASSERT_TRUE(writer.AddTexture(fmt::format("tex1_64x32_{:016x}_{}", i, i % 7), i % 2 == 0,
+                                  texture));
+  }
+  EXPECT_FALSE(writer.AddTexture("tex1_64x32_0000000000000000_0", false, MakeTexture(4, 4, 0)));
+  ASSERT_TRUE(writer.Finish());
+
+  VideoCommon::TexturePackReader reader;
+  ASSERT_TRUE(reader.Open(m_path));
+  EXPECT_EQ(reader.GetTextures().size(), static_cast<size_t>(NUM_TEXTURES));
+
+  for (int i = 0; i < NUM_TEXTURES; ++i)
+  {
+    const std::string name = fmt::format("tex1_64x32_{:016x}_{}", i, i % 7);
+    const auto* const record = reader.Find(name);
+    ASSERT_NE(record, nullptr) << name;
+    EXPECT_EQ(reader.GetName(*record), name);
+    EXPECT_EQ(record->has_arbitrary_mipmaps != 0, i % 2 == 0);
+
+    VideoCommon::CustomTextureData data;
+    ASSERT_TRUE(reader.LoadTexture(*record, &data));
+    ExpectSameLevels(MakeTexture(64 >> (i % 3), 32, static_cast<u8>(i)), data);
+  }
+
+  EXPECT_EQ(reader.Find("tex1_64x32_0000000000000000_1"), nullptr);
+  EXPECT_EQ(reader.Find(""), nullptr);
+}
+
+TEST_P(TexturePackTest, RejectsTruncatedPack)
+{
+  VideoCommon::TexturePackWriter writer;
+  ASSERT_TRUE(writer.Open(m_path, GetParam()));
+  ASSERT_TRUE(writer.AddTexture("tex1_16x16_0000000000000000_0", false, MakeTexture(16, 16, 0)));
+  ASSERT_TRUE(writer.Finish());
+
+  {
+    File::IOFile file(m_path, "r+b");
+    ASSERT_TRUE(file.Resize(file.GetSize() - 1));
+  }
+  VideoCommon::TexturePackReader reader;
+  EXPECT_FALSE(reader.Open(m_path));
+}
+
+TEST_P(TexturePackTest, RejectsWrongLevelSize)
+{
+  VideoCommon::TexturePackWriter writer;
+  ASSERT_TRUE(writer.Open(m_path, GetParam()));
+  ASSERT_TRUE(writer.AddTexture("tex1_16x16_0000000000000000_0", false, MakeTexture(16, 16, 0)));
+  ASSERT_TRUE(writer.Finish());
+
+  // The decoded size of the first level is allocated when loading it, so a huge one must be
+  // rejected when opening the pack.
+  {
+    File::IOFile file(m_path, "r+b");
+    VideoCommon::TexturePack::Header header;
+    ASSERT_TRUE(file.ReadArray(&header, 1));
+    VideoCommon::TexturePack::LevelRecord level;
+    ASSERT_TRUE(file.Seek(header.levels_offset, File::SeekOrigin::Begin));
+    ASSERT_TRUE(file.ReadArray(&level, 1));
+    level.size = u64{1} << 40;
+    ASSERT_TRUE(file.Seek(header.levels_offset, File::SeekOrigin::Begin));
+    ASSERT_TRUE(file.WriteArray(&level, 1));
+  }
+  VideoCommon::TexturePackReader reader;
+  EXPECT_FALSE(reader.Open(m_path));
+}
+
+INSTANTIATE_TEST_SUITE_P(Compression, TexturePackTest, testing::Values(0, 3));
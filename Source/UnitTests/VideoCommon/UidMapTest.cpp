@@ -0,0 +1,70 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <utility>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/GXPipelineTypes.h"
+#include "VideoCommon/UidMap.h"
+#include "VideoCommon/VertexShaderGen.h"
+
+using VideoCommon::GXPipelineUid;
+
+namespace
+{
+GXPipelineUid MakeUID(u32 blending_state_bits)
+{
+  GXPipelineUid uid;
+  uid.blending_state.hex = blending_state_bits;
+  return uid;
+}
+}  // namespace
+
+TEST(UidMap, InsertAndFind)
+{
+  VideoCommon::UidMap<GXPipelineUid, std::pair<std::unique_ptr<int>, bool>> map;
+  for (u32 i = 0; i < 1000; ++i)
+    map[MakeUID(i)].first = std::make_unique<int>(static_cast<int>(i));
+  EXPECT_EQ(map.Size(), 1000u);
+
+  for (u32 i = 0; i < 1000; ++i)
+  {
+    const auto* entry = map.Find(MakeUID(i));
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(*entry->first, static_cast<int>(i));
+  }
+  EXPECT_FALSE(map.Contains(MakeUID(1000)));
+
+  // Looking up an existing UID doesn't insert it again
+  map[MakeUID(5)].second = true;
+  EXPECT_EQ(map.Size(), 1000u);
+  EXPECT_TRUE(map.Find(MakeUID(5))->second);
+
+  size_t count = 0;
+  map.ForEach([&](const GXPipelineUid& uid, const auto& entry) {
+    EXPECT_EQ(*entry.first, static_cast<int>(uid.blending_state.hex));
+    ++count;
+  });
+  EXPECT_EQ(count, 1000u);
+
+  map.Clear();
+  EXPECT_EQ(map.Size(), 0u);
+  EXPECT_FALSE(map.Contains(MakeUID(5)));
+}
+
+TEST(UidMap, ShaderUids)
+{
+  VideoCommon::UidMap<VertexShaderUid, int> map;
+  VertexShaderUid a;
+  VertexShaderUid b;
+  b.GetUidData()->numTexGens = 3;
+
+  map[a] = 1;
+  map[b] = 2;
+  EXPECT_EQ(*map.Find(a), 1);
+  EXPECT_EQ(*map.Find(b), 2);
+  EXPECT_EQ(map.Size(), 2u);
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <bit>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <tuple>
@@ -10,6 +11,7 @@
 #include <gtest/gtest.h>  // NOLINT
 
 #include "Common/MathUtil.h"
+#include "Common/ThreadPool.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -1062,6 +1064,76 @@ TEST_P(VertexLoaderSkippedTexCoordsTest, SkippedTextures)
   }
 }
 
+TEST_F(VertexLoaderTest, ConvertVerticesParallelMatchesSerial)
+{
+  m_vtx_desc.low.PosMatIdx = 1;
+  m_vtx_desc.low.Position = VertexComponentFormat::Index16;
+  m_vtx_desc.low.Normal = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  m_vtx_attr.g0.NormalElements = NormalComponentCount::NTB;
+  m_vtx_attr.g0.NormalFormat = ComponentFormat::Short;
+  CreateAndCheckSizes(1 + sizeof(u16) + 9 * sizeof(s16), 4 + 3 * sizeof(float) * 4);
+
+  // Large enough to be split into several chunks, with skipped vertices in the middle of a chunk
+  // and among the last three vertices, which are the ones written to the caches.
+  constexpr int count = 4 * 2048 + 5;
+  constexpr int num_positions = 256;
+  const auto is_skipped = [](int i) { return i % 1000 == 999 || i == count - 2; };
+  for (int i = 0; i < count; i++)
+  {
+    Input<u8>(i);
+    Input<u16>(is_skipped(i) ? 0xFFFF : i % num_positions);
+    for (int j = 0; j < 9; j++)
+      Input<s16>(i * 9 + j);
+  }
+  const u8* src = input_memory;
+
+  VertexLoaderManager::cached_arraybases[CPArray::Position] = m_src.GetPointer();
+  g_main_cp_state.array_strides[CPArray::Position] = 3 * sizeof(float);
+  for (int i = 0; i < num_positions * 3; i++)
+    Input<float>(i * 0.5f);
+
+  const auto reset_caches = [] {
+    VertexLoaderManager::position_cache = {};
+    VertexLoaderManager::position_matrix_index_cache = {};
+    VertexLoaderManager::normal_cache = {};
+    VertexLoaderManager::tangent_cache = {};
+    VertexLoaderManager::binormal_cache = {};
+  };
+
+  u8* const serial_dst = output_memory;
+  u8* const parallel_dst = output_memory + sizeof(output_memory) / 2;
+  const int stride = m_loader->m_native_vtx_decl.stride;
+  ASSERT_LE(count * stride, static_cast<int>(sizeof(output_memory) / 2));
+
+  reset_caches();
+  const int serial_count = m_loader->RunVertices(src, serial_dst, count);
+  EXPECT_EQ(serial_count, count - 9);
+  const auto position_cache = VertexLoaderManager::position_cache;
+  const auto position_matrix_index_cache = VertexLoaderManager::position_matrix_index_cache;
+  const auto normal_cache = VertexLoaderManager::normal_cache;
+  const auto tangent_cache = VertexLoaderManager::tangent_cache;
+  const auto binormal_cache = VertexLoaderManager::binormal_cache;
+
+  reset_caches();
+  const int loaded_vertices = m_loader->m_numLoadedVertices;
+  Common::ThreadPool& workers = VertexLoaderManager::GetWorkers();
+  workers.Reset("Vertex Loader", 3);
+  const int parallel_count =
+      VertexLoaderManager::ConvertVertices(m_loader.get(), src, parallel_dst, count);
+  workers.Shutdown();
+
+  EXPECT_EQ(parallel_count, serial_count);
+  EXPECT_EQ(m_loader->m_numLoadedVertices, loaded_vertices + count);
+  EXPECT_EQ(0, std::memcmp(serial_dst, parallel_dst, serial_count * stride));
+  EXPECT_EQ(VertexLoaderManager::position_cache, position_cache);
+  EXPECT_EQ(VertexLoaderManager::position_matrix_index_cache, position_matrix_index_cache);
+  EXPECT_EQ(VertexLoaderManager::normal_cache, normal_cache);
+  EXPECT_EQ(VertexLoaderManager::tangent_cache, tangent_cache);
+  EXPECT_EQ(VertexLoaderManager::binormal_cache, binormal_cache);
+}
+
 // For gtest, which doesn't know about our fmt::formatters by default
 static void PrintTo(const VertexComponentFormat& t, std::ostream* os)
 {